@@ -0,0 +1,2 @@
+#define DD_INTARKDB_LIB_VERSION static char* str_INTARKDB_LIB_VERSION="INTARKDB Debug eee100b4914409dad331fe64192fae7d941dcbf4 compiled at 2026-10-19 13:32:56"
+#define DD_GETLIBVERSION intarkdb_get_version
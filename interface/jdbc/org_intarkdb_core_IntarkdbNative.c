@@ -494,6 +494,8 @@ JNIEXPORT jint JNICALL Java_org_intarkdb_core_IntarkdbNative_intarkdb_1start_1re
     config.db_items[0].isUsed = true;
 
     config.port = port;
+    config.uds_path[0] = '\0';
+    config.shm_path[0] = '\0';
     // todo:add db config
     int result = 0;
 #ifdef _ANDROID
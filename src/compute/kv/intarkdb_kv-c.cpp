@@ -20,7 +20,8 @@
  *
  * -------------------------------------------------------------------------
  */
-#include <vector> 
+#include <cstring>
+#include <vector>
 
 #include "intarkdb_kv.h"
 #include "intarkdb_kv.hpp"
@@ -32,7 +33,7 @@ struct DatabaseWrapper_kv {
     std::shared_ptr<IntarkDB> instance;
 };
 
-KvReply default_reply = { KV_ERROR, 20, (char *)"KvConnection is NULL" };
+KvReply default_reply = { KV_ERROR, 20, (char *)"KvConnection is NULL", 0, NULL };
 
 int intarkdb_open_kv(const char *path, intarkdb_database_kv *db) {
     return intarkdb_open(path, (intarkdb_database *)db);
@@ -89,6 +90,24 @@ int intarkdb_open_memtable_kv(intarkdb_connection_kv kvconn, const char *table_n
     return conn->OpenMemoryTable(table_name);
 }
 
+int intarkdb_open_hashtable_kv(intarkdb_connection_kv kvconn, const char *table_name, bool persistent) {
+    if (!kvconn) {
+        return -1;
+    }
+
+    KvConnection *conn = (KvConnection *)kvconn;
+    return conn->OpenHashTable(table_name, persistent);
+}
+
+int intarkdb_save_hashtable_kv(intarkdb_connection_kv kvconn) {
+    if (!kvconn) {
+        return -1;
+    }
+
+    KvConnection *conn = (KvConnection *)kvconn;
+    return conn->SaveHashTable();
+}
+
 void * intarkdb_set(intarkdb_connection_kv kvconn, const char *key, const char *val) {
     if (!kvconn) {
         return &default_reply;
@@ -98,6 +117,24 @@ void * intarkdb_set(intarkdb_connection_kv kvconn, const char *key, const char *
     return conn->Set(key, val);
 }
 
+void * intarkdb_upsert(intarkdb_connection_kv kvconn, const char *key, const char *val, bool *inserted) {
+    if (!kvconn) {
+        return &default_reply;
+    }
+
+    KvConnection *conn = (KvConnection *)kvconn;
+    return conn->Set(key, val, inserted);
+}
+
+void * intarkdb_setex(intarkdb_connection_kv kvconn, const char *key, const char *val, unsigned int seconds) {
+    if (!kvconn) {
+        return &default_reply;
+    }
+
+    KvConnection *conn = (KvConnection *)kvconn;
+    return conn->SetEx(key, key == nullptr ? 0 : strlen(key), val, val == nullptr ? 0 : strlen(val), seconds);
+}
+
 void * intarkdb_get(intarkdb_connection_kv kvconn, const char *key) {
     if (!kvconn) {
         return &default_reply;
@@ -116,6 +153,126 @@ void * intarkdb_del(intarkdb_connection_kv kvconn, const char *key) {
     return conn->Del(key);
 }
 
+void * intarkdb_set_len(intarkdb_connection_kv kvconn, const char *key, size_t key_len, const char *val,
+    size_t val_len) {
+    if (!kvconn) {
+        return &default_reply;
+    }
+
+    KvConnection *conn = (KvConnection *)kvconn;
+    return conn->Set(key, key_len, val, val_len);
+}
+
+void * intarkdb_get_len(intarkdb_connection_kv kvconn, const char *key, size_t key_len) {
+    if (!kvconn) {
+        return &default_reply;
+    }
+
+    KvConnection *conn = (KvConnection *)kvconn;
+    return conn->Get(key, key_len);
+}
+
+void * intarkdb_del_len(intarkdb_connection_kv kvconn, const char *key, size_t key_len) {
+    if (!kvconn) {
+        return &default_reply;
+    }
+
+    KvConnection *conn = (KvConnection *)kvconn;
+    return conn->Del(key, key_len);
+}
+
+intarkdb_state_kv intarkdb_get_into(intarkdb_connection_kv kvconn, const char *key, size_t key_len,
+    char *buf, size_t buf_size, size_t *val_len, bool *found) {
+    if (!kvconn || !val_len || !found || (!buf && buf_size > 0)) {
+        return KV_ERROR;
+    }
+
+    const char *val = nullptr;
+    KvConnection *conn = (KvConnection *)kvconn;
+    if (conn->GetRef(key, key_len, &val, val_len, found) != KV_SUCCESS) {
+        return KV_ERROR;
+    }
+    if (*val_len > 0 && buf_size > 0) {
+        memcpy(buf, val, *val_len < buf_size ? *val_len : buf_size);
+    }
+    return KV_SUCCESS;
+}
+
+intarkdb_state_kv intarkdb_get_ref(intarkdb_connection_kv kvconn, const char *key, size_t key_len,
+    const char **val, size_t *val_len, bool *found) {
+    if (!kvconn || !val || !val_len || !found) {
+        return KV_ERROR;
+    }
+
+    KvConnection *conn = (KvConnection *)kvconn;
+    return (intarkdb_state_kv)conn->GetRef(key, key_len, val, val_len, found);
+}
+
+void * intarkdb_mset(intarkdb_connection_kv kvconn, size_t count, const char **keys, const char **vals) {
+    if (!kvconn) {
+        return &default_reply;
+    }
+
+    KvConnection *conn = (KvConnection *)kvconn;
+    return conn->MSet(count, keys, vals);
+}
+
+void * intarkdb_mget(intarkdb_connection_kv kvconn, size_t count, const char **keys) {
+    if (!kvconn) {
+        return &default_reply;
+    }
+
+    KvConnection *conn = (KvConnection *)kvconn;
+    return conn->MGet(count, keys);
+}
+
+void * intarkdb_mdel(intarkdb_connection_kv kvconn, size_t count, const char **keys) {
+    if (!kvconn) {
+        return &default_reply;
+    }
+
+    KvConnection *conn = (KvConnection *)kvconn;
+    return conn->MDel(count, keys);
+}
+
+intarkdb_kv_iterator intarkdb_scan(intarkdb_connection_kv kvconn, const char *start, const char *end, size_t limit,
+    bool reverse) {
+    if (!kvconn) {
+        return nullptr;
+    }
+
+    KvConnection *conn = (KvConnection *)kvconn;
+    return (intarkdb_kv_iterator)conn->Scan(start, end, limit, reverse).release();
+}
+
+intarkdb_kv_iterator intarkdb_scan_prefix(intarkdb_connection_kv kvconn, const char *prefix, size_t limit,
+    bool reverse) {
+    if (!kvconn) {
+        return nullptr;
+    }
+
+    KvConnection *conn = (KvConnection *)kvconn;
+    return (intarkdb_kv_iterator)conn->ScanPrefix(prefix, limit, reverse).release();
+}
+
+intarkdb_state_kv intarkdb_iterator_next(intarkdb_kv_iterator iter, const char **key, size_t *key_len,
+    const char **val, size_t *val_len, bool *eof) {
+    if (!iter || !key || !key_len || !val || !val_len || !eof) {
+        return KV_ERROR;
+    }
+
+    KvScanIterator *scan = (KvScanIterator *)iter;
+    return (intarkdb_state_kv)scan->Next(key, key_len, val, val_len, eof);
+}
+
+void intarkdb_iterator_close(intarkdb_kv_iterator *iter) {
+    if (iter && *iter) {
+        KvScanIterator *scan = (KvScanIterator *)*iter;
+        delete scan;
+        *iter = nullptr;
+    }
+}
+
 intarkdb_state_kv intarkdb_begin(intarkdb_connection_kv kvconn) {
     if (!kvconn) {
         return KV_ERROR;
@@ -196,10 +353,38 @@ int KvIntarkDB::OpenMemoryTable(const char* table_name) {
     return intarkdb_open_memtable_kv(conn_, table_name);
 }
 
+int KvIntarkDB::OpenHashTable(const char* table_name, bool persistent) {
+    return intarkdb_open_hashtable_kv(conn_, table_name, persistent);
+}
+
+int KvIntarkDB::SaveHashTable() {
+    return intarkdb_save_hashtable_kv(conn_);
+}
+
 Reply * KvIntarkDB::Set(const char* key, const char* val) {
     return (Reply *)intarkdb_set(conn_, key, val);
 }
 
+Reply * KvIntarkDB::Set(const std::string& key, const std::string& val) {
+    return (Reply *)intarkdb_set_len(conn_, key.data(), key.size(), val.data(), val.size());
+}
+
+Reply * KvIntarkDB::Get(const std::string& key) {
+    return (Reply *)intarkdb_get_len(conn_, key.data(), key.size());
+}
+
+Reply * KvIntarkDB::Del(const std::string& key) {
+    return (Reply *)intarkdb_del_len(conn_, key.data(), key.size());
+}
+
+Reply * KvIntarkDB::Upsert(const char* key, const char* val, bool* inserted) {
+    return (Reply *)intarkdb_upsert(conn_, key, val, inserted);
+}
+
+Reply * KvIntarkDB::SetEx(const char* key, const char* val, unsigned int seconds) {
+    return (Reply *)intarkdb_setex(conn_, key, val, seconds);
+}
+
 Reply * KvIntarkDB::Get(const char* key) {
     return (Reply *)intarkdb_get(conn_, key);
 }
@@ -208,6 +393,65 @@ Reply * KvIntarkDB::Del(const char* key) {
     return (Reply *)intarkdb_del(conn_, key);
 }
 
+static std::vector<const char*> kv_c_strs(const std::vector<std::string>& strs) {
+    std::vector<const char*> result(strs.size());
+    for (size_t i = 0; i < strs.size(); i++) {
+        result[i] = strs[i].c_str();
+    }
+    return result;
+}
+
+Reply * KvIntarkDB::MSet(const std::vector<std::string>& keys, const std::vector<std::string>& vals) {
+    if (keys.size() != vals.size()) {
+        throw intarkdb::Exception(ExceptionType::INVALID_INPUT,
+                                  fmt::format("mset got {} keys but {} values!", keys.size(), vals.size()));
+    }
+    auto c_keys = kv_c_strs(keys);
+    auto c_vals = kv_c_strs(vals);
+    return (Reply *)intarkdb_mset(conn_, c_keys.size(), c_keys.data(), c_vals.data());
+}
+
+Reply * KvIntarkDB::MGet(const std::vector<std::string>& keys) {
+    auto c_keys = kv_c_strs(keys);
+    return (Reply *)intarkdb_mget(conn_, c_keys.size(), c_keys.data());
+}
+
+Reply * KvIntarkDB::MDel(const std::vector<std::string>& keys) {
+    auto c_keys = kv_c_strs(keys);
+    return (Reply *)intarkdb_mdel(conn_, c_keys.size(), c_keys.data());
+}
+
+KvIterator::~KvIterator() {
+    intarkdb_iterator_close(&iter_);
+}
+
+bool KvIterator::Next() {
+    if (!iter_) {
+        return false;
+    }
+    bool eof = true;
+    if (intarkdb_iterator_next(iter_, &key_, &key_len_, &val_, &val_len_, &eof) != KV_SUCCESS) {
+        throw intarkdb::Exception(ExceptionType::EXECUTOR, fmt::format("kv scan error!"));
+    }
+    return !eof;
+}
+
+KvIterator KvIntarkDB::Scan(const std::string& start, const std::string& end, size_t limit, bool reverse) {
+    auto iter = intarkdb_scan(conn_, start.empty() ? nullptr : start.c_str(), end.empty() ? nullptr : end.c_str(), limit, reverse);
+    if (!iter) {
+        throw intarkdb::Exception(ExceptionType::EXECUTOR, fmt::format("open kv scan error!"));
+    }
+    return KvIterator(iter);
+}
+
+KvIterator KvIntarkDB::ScanPrefix(const std::string& prefix, size_t limit, bool reverse) {
+    auto iter = intarkdb_scan_prefix(conn_, prefix.c_str(), limit, reverse);
+    if (!iter) {
+        throw intarkdb::Exception(ExceptionType::EXECUTOR, fmt::format("open kv scan error!"));
+    }
+    return KvIterator(iter);
+}
+
 int KvIntarkDB::Begin() {
     return intarkdb_begin(conn_);
 }
@@ -49,11 +49,17 @@ typedef struct st_intarkdb_connection_kv {
     void *conn;
 } *intarkdb_connection_kv;
 
+typedef struct st_intarkdb_kv_iterator {
+    void *iter;
+} *intarkdb_kv_iterator;
+
 /* This is the reply object */
 typedef struct KvReply_t {
     int type;   /* return type */
     size_t len; /* Length of string */
     char *str;  /* err or value*/
+    size_t elements;          /* number of elements of intarkdb_mget */
+    struct KvReply_t *element; /* values in the order of the keys, str is NULL if the key not exist */
 } KvReply;
 
 typedef enum en_status_kv {
@@ -74,12 +80,63 @@ EXP_KV_API int intarkdb_open_table_kv(intarkdb_connection_kv kvconn, const char
 
 EXP_KV_API int intarkdb_open_memtable_kv(intarkdb_connection_kv kvconn, const char *table_name);
 
+// hash indexed memory table, O(1) set/get/del without redo. writes are not transactional.
+// a persistent table is loaded from its snapshot on first open and saved when the database closes
+EXP_KV_API int intarkdb_open_hashtable_kv(intarkdb_connection_kv kvconn, const char *table_name, bool persistent);
+
+// write the snapshot of the open persistent hash table now
+EXP_KV_API int intarkdb_save_hashtable_kv(intarkdb_connection_kv kvconn);
+
 EXP_KV_API void * intarkdb_set(intarkdb_connection_kv kvconn, const char *key, const char *val);
 
+// same as intarkdb_set, inserted tells whether the key was new or overwritten
+EXP_KV_API void * intarkdb_upsert(intarkdb_connection_kv kvconn, const char *key, const char *val, bool *inserted);
+
+// same as intarkdb_set, the key expires after seconds(> 0) and reads as missing from then on
+EXP_KV_API void * intarkdb_setex(intarkdb_connection_kv kvconn, const char *key, const char *val, unsigned int seconds);
+
 EXP_KV_API void * intarkdb_get(intarkdb_connection_kv kvconn, const char *key);
 
 EXP_KV_API void * intarkdb_del(intarkdb_connection_kv kvconn, const char *key);
 
+// binary safe variants, keys and values may contain '\0'. the reply of intarkdb_get_len holds the value in str/len
+EXP_KV_API void * intarkdb_set_len(intarkdb_connection_kv kvconn, const char *key, size_t key_len, const char *val,
+    size_t val_len);
+
+EXP_KV_API void * intarkdb_get_len(intarkdb_connection_kv kvconn, const char *key, size_t key_len);
+
+EXP_KV_API void * intarkdb_del_len(intarkdb_connection_kv kvconn, const char *key, size_t key_len);
+
+// copies at most buf_size bytes of the value into buf, val_len is the full length of the value
+EXP_KV_API intarkdb_state_kv intarkdb_get_into(intarkdb_connection_kv kvconn, const char *key, size_t key_len,
+    char *buf, size_t buf_size, size_t *val_len, bool *found);
+
+// zero copy get, val is borrowed from the connection and valid until its next call
+EXP_KV_API intarkdb_state_kv intarkdb_get_ref(intarkdb_connection_kv kvconn, const char *key, size_t key_len,
+    const char **val, size_t *val_len, bool *found);
+
+// batched set/get/del of count keys, committed once outside a transaction
+EXP_KV_API void * intarkdb_mset(intarkdb_connection_kv kvconn, size_t count, const char **keys, const char **vals);
+
+EXP_KV_API void * intarkdb_mget(intarkdb_connection_kv kvconn, size_t count, const char **keys);
+
+EXP_KV_API void * intarkdb_mdel(intarkdb_connection_kv kvconn, size_t count, const char **keys);
+
+// keys in [start, end) in key order, a NULL border is unbounded, limit 0 is unlimited.
+// one scan is open per connection, starting another scan ends the previous one. returns NULL on error.
+EXP_KV_API intarkdb_kv_iterator intarkdb_scan(intarkdb_connection_kv kvconn, const char *start, const char *end,
+    size_t limit, bool reverse);
+
+// keys starting with prefix in key order
+EXP_KV_API intarkdb_kv_iterator intarkdb_scan_prefix(intarkdb_connection_kv kvconn, const char *prefix, size_t limit,
+    bool reverse);
+
+// key and val are valid until the next call, eof is set after the last pair
+EXP_KV_API intarkdb_state_kv intarkdb_iterator_next(intarkdb_kv_iterator iter, const char **key, size_t *key_len,
+    const char **val, size_t *val_len, bool *eof);
+
+EXP_KV_API void intarkdb_iterator_close(intarkdb_kv_iterator *iter);
+
 EXP_KV_API intarkdb_state_kv intarkdb_begin(intarkdb_connection_kv kvconn);
 EXP_KV_API intarkdb_state_kv intarkdb_commit(intarkdb_connection_kv kvconn);
 EXP_KV_API intarkdb_state_kv intarkdb_rollback(intarkdb_connection_kv kvconn);
@@ -30,12 +30,39 @@
 #endif
 
 #include <string>
+#include <vector>
 
 class Reply {
    public:
     int type;
     size_t len;
     char *str;
+    size_t elements;
+    Reply *element;
+};
+
+// pairs of a range scan in key order, the scan ends when the iterator is destroyed
+class KvIterator {
+   public:
+    EXP_KV_API ~KvIterator();
+    EXP_KV_API KvIterator(KvIterator&& other) noexcept : iter_(other.iter_) { other.iter_ = nullptr; }
+    KvIterator(const KvIterator&) = delete;
+    KvIterator& operator=(const KvIterator&) = delete;
+
+    // false at the end of the scan
+    EXP_KV_API bool Next();
+    EXP_KV_API std::string Key() const { return std::string(key_, key_len_); }
+    EXP_KV_API std::string Value() const { return std::string(val_, val_len_); }
+
+   private:
+    friend class KvIntarkDB;
+    explicit KvIterator(struct st_intarkdb_kv_iterator *iter) : iter_(iter) {}
+
+    struct st_intarkdb_kv_iterator *iter_{nullptr};
+    const char *key_{nullptr};
+    size_t key_len_{0};
+    const char *val_{nullptr};
+    size_t val_len_{0};
 };
 
 class KvIntarkDB {
@@ -47,11 +74,29 @@ class KvIntarkDB {
 
     EXP_KV_API int OpenTable(const char* table_name);
     EXP_KV_API int OpenMemoryTable(const char* table_name);
+    EXP_KV_API int OpenHashTable(const char* table_name, bool persistent = false);
+    EXP_KV_API int SaveHashTable();
 
     EXP_KV_API Reply * Set(const char* key, const char* val);
+    // binary safe variants, keys and values may contain '\0'
+    EXP_KV_API Reply * Set(const std::string& key, const std::string& val);
+    EXP_KV_API Reply * Get(const std::string& key);
+    EXP_KV_API Reply * Del(const std::string& key);
+
+    EXP_KV_API Reply * Upsert(const char* key, const char* val, bool* inserted);
+    EXP_KV_API Reply * SetEx(const char* key, const char* val, unsigned int seconds);
     EXP_KV_API Reply * Get(const char* key);
     EXP_KV_API Reply * Del(const char* key);
 
+    EXP_KV_API Reply * MSet(const std::vector<std::string>& keys, const std::vector<std::string>& vals);
+    EXP_KV_API Reply * MGet(const std::vector<std::string>& keys);
+    EXP_KV_API Reply * MDel(const std::vector<std::string>& keys);
+
+    // an empty border is unbounded, limit 0 is unlimited
+    EXP_KV_API KvIterator Scan(const std::string& start, const std::string& end, size_t limit = 0,
+                               bool reverse = false);
+    EXP_KV_API KvIterator ScanPrefix(const std::string& prefix, size_t limit = 0, bool reverse = false);
+
     EXP_KV_API int Begin();
     EXP_KV_API int Commit();
     EXP_KV_API int Rollback();
@@ -23,9 +23,14 @@
 
 #include "kv_connection.h"
 
+#include <algorithm>
+#include <numeric>
+
+#include "kv_hash_table.h"
 #include "main/database.h"
 #include "storage/db_handle.h"
 #include "storage/gstor/gstor_executor.h"
+#include "storage/gstor/zekernel/common/cm_file.h"
 
 KvConnection::KvConnection(std::shared_ptr<IntarkDB> instance) : instance_(instance) {} 
 
@@ -63,14 +68,86 @@ void KvConnection::Init() {
 }
 
 int KvConnection::OpenTable(const char* table_name) {
+    scan_id_ = 0;
+    hash_table_.reset();
     return gstor_open_table(((db_handle_t*)handle_)->handle, table_name);
 }
 
 int KvConnection::OpenMemoryTable(const char* table_name) {
+    scan_id_ = 0;
+    hash_table_.reset();
     return gstor_open_mem_table(((db_handle_t*)handle_)->handle, table_name);
 }
 
-KvReplyInternal * KvConnection::Set(const char* key, const char* val) {
+int KvConnection::OpenHashTable(const char* table_name, bool persistent) {
+    ret_code_ = GS_ERROR;
+    if (table_name == nullptr || table_name[0] == '\0') {
+        ret_msg_ = "table name is empty!";
+        return ret_code_;
+    }
+    auto instance_ptr = instance_.lock();
+    if (instance_ptr == nullptr) {
+        ret_msg_ = "the database has closed!";
+        return ret_code_;
+    }
+
+    std::string snapshot_path;
+    if (persistent) {
+        std::string dir = instance_ptr->GetFullDbPath() + "/kvhash";
+        if (!cm_dir_exist(dir.c_str()) && cm_create_dir_ex(dir.c_str()) != GS_SUCCESS) {
+            cm_reset_error();
+            ret_msg_ = "create directory " + dir + " failed!";
+            return ret_code_;
+        }
+        snapshot_path = dir + "/" + table_name + ".snap";
+    }
+
+    auto tables = instance_ptr->GetKvHashTables([]() { return std::make_shared<KvHashTables>(); });
+    auto table = tables->Open(table_name, snapshot_path, ret_msg_);
+    if (table == nullptr) {
+        return ret_code_;
+    }
+
+    // the kernel scan of the previous table ends here, as opening a table does
+    scan_id_ = 0;
+    gstor_kv_scan_close(((db_handle_t*)handle_)->handle);
+    hash_table_ = table;
+    ret_code_ = GS_SUCCESS;
+    ret_msg_ = "success";
+    return ret_code_;
+}
+
+int KvConnection::SaveHashTable() {
+    if (hash_table_ == nullptr) {
+        ret_code_ = GS_ERROR;
+        ret_msg_ = "no hash table is open!";
+        return ret_code_;
+    }
+    ret_msg_ = "success";
+    ret_code_ = hash_table_->Save(ret_msg_);
+    return ret_code_;
+}
+
+KvReplyInternal * KvConnection::Set(const char* key, const char* val, bool* inserted) {
+    return Set(key, key == nullptr ? 0 : strlen(key), val, val == nullptr ? 0 : strlen(val), inserted);
+}
+
+KvReplyInternal * KvConnection::Set(const char* key, size_t key_len, const char* val, size_t val_len,
+                                    bool* inserted) {
+    return Put(key, key_len, val, val_len, 0, inserted);
+}
+
+KvReplyInternal * KvConnection::SetEx(const char* key, size_t key_len, const char* val, size_t val_len,
+                                      uint32_t seconds) {
+    if (seconds == 0) {
+        memset(&reply, 0, sizeof(reply));
+        return ErrorReply("invalid expire time, seconds should be greater than 0!");
+    }
+    return Put(key, key_len, val, val_len, (uint64_t)seconds * MILLISECS_PER_SECOND, nullptr);
+}
+
+KvReplyInternal * KvConnection::Put(const char* key, size_t key_len, const char* val, size_t val_len,
+                                    uint64_t ttl_ms, bool* inserted) {
     ret_code_ = GS_SUCCESS;
     ret_msg_ = "success";
     memset(&reply, 0, sizeof(reply));
@@ -84,12 +161,34 @@ KvReplyInternal * KvConnection::Set(const char* key, const char* val) {
         return &reply;
     }
 
+    if (hash_table_ != nullptr) {
+        int64_t expire_us = ttl_ms == 0 ? 0 : KvHashTable::NowUs() + (int64_t)ttl_ms * MICROSECS_PER_MILLISEC;
+        bool is_new = hash_table_->Put(std::string(key, key_len), val, val_len, expire_us);
+        if (inserted != nullptr) {
+            *inserted = is_new;
+        }
+        reply.type = ret_code_;
+        reply.len = ret_msg_.length();
+        reply.str = (char *)ret_msg_.c_str();
+        return &reply;
+    }
+
     text_t text_key, text_val;
-    text_key.len = strlen(key);
+    text_key.len = key_len;
     text_key.str = (char*)key;
-    text_val.len = strlen(val);
+    text_val.len = val_len;
     text_val.str = (char*)val;
-    ret_code_ = gstor_put(((db_handle_t*)handle_)->handle, text_key.str, text_key.len, text_val.str, text_val.len);
+    unsigned int is_insert = 0;
+    if (ttl_ms > 0) {
+        ret_code_ = gstor_setex(((db_handle_t*)handle_)->handle, text_key.str, text_key.len, text_val.str,
+                                text_val.len, ttl_ms);
+    } else {
+        ret_code_ = gstor_upsert(((db_handle_t*)handle_)->handle, text_key.str, text_key.len, text_val.str,
+                                 text_val.len, &is_insert);
+    }
+    if (inserted != nullptr) {
+        *inserted = (is_insert != 0);
+    }
 
     if (ret_code_ == GS_SUCCESS) {
         if (!is_multi_) {
@@ -115,29 +214,54 @@ KvReplyInternal * KvConnection::Set(const char* key, const char* val) {
 }
 
 KvReplyInternal * KvConnection::Get(const char* key) {
+    return Get(key, key == nullptr ? 0 : strlen(key));
+}
+
+KvReplyInternal * KvConnection::Get(const char* key, size_t key_len) {
+    memset(&reply, 0, sizeof(reply));
+
+    const char* val = nullptr;
+    size_t val_len = 0;
+    bool found = false;
+    if (GetRef(key, key_len, &val, &val_len, &found) == GS_SUCCESS) {
+        ret_msg_ = std::string(val == nullptr ? "" : val, val_len);
+    }
+
+    reply.type = ret_code_;
+    reply.len = ret_msg_.length();
+    reply.str = (char *)ret_msg_.c_str();
+    return &reply;
+}
+
+int KvConnection::GetRef(const char* key, size_t key_len, const char** val, size_t* val_len, bool* found) {
     ret_code_ = GS_SUCCESS;
     ret_msg_ = "success";
-    memset(&reply, 0, sizeof(reply));
+    *val = nullptr;
+    *val_len = 0;
+    *found = false;
 
     if (key == nullptr) {
         ret_code_ = GS_ERROR;
         ret_msg_ = "key is NULL!";
-        reply.type = ret_code_;
-        reply.len = ret_msg_.length();
-        reply.str = (char *)ret_msg_.c_str();
-        return &reply;
+        return ret_code_;
     }
 
-    text_t text_key, text_val;
-    text_key.len = strlen(key);
-    text_key.str = (char*)key;
+    if (hash_table_ != nullptr) {
+        *found = hash_table_->Get(std::string(key, key_len), KvHashTable::NowUs(), hash_val_);
+        *val = *found ? hash_val_.data() : nullptr;
+        *val_len = *found ? hash_val_.length() : 0;
+        return ret_code_;
+    }
+
+    char* data = nullptr;
+    unsigned int data_len = 0;
     bool32 eof;
-    text_val.str = nullptr;
-    text_val.len = 0;
-    ret_code_ = gstor_get(((db_handle_t*)handle_)->handle, text_key.str, text_key.len, &text_val.str, &text_val.len, &eof);
+    ret_code_ = gstor_get(((db_handle_t*)handle_)->handle, (char*)key, key_len, &data, &data_len, &eof);
 
     if (ret_code_ == GS_SUCCESS) {
-        ret_msg_ = std::string(text_val.str, text_val.len);
+        *found = !eof;
+        *val = data;
+        *val_len = data_len;
     } else {
         int32_t err_code;
         const char* message = nullptr;
@@ -147,14 +271,14 @@ KvReplyInternal * KvConnection::Get(const char* key) {
         ret_msg_ = std::string(message);
         cm_reset_error();
     }
-
-    reply.type = ret_code_;
-    reply.len = ret_msg_.length();
-    reply.str = (char *)ret_msg_.c_str();
-    return &reply;
+    return ret_code_;
 }
 
 KvReplyInternal * KvConnection::Del(const char* key) {
+    return Del(key, key == nullptr ? 0 : strlen(key));
+}
+
+KvReplyInternal * KvConnection::Del(const char* key, size_t key_len) {
     ret_code_ = GS_SUCCESS;
     ret_msg_ = "success";
     memset(&reply, 0, sizeof(reply));
@@ -168,8 +292,16 @@ KvReplyInternal * KvConnection::Del(const char* key) {
         return &reply;
     }
 
+    if (hash_table_ != nullptr) {
+        (void)hash_table_->Del(std::string(key, key_len));
+        reply.type = ret_code_;
+        reply.len = ret_msg_.length();
+        reply.str = (char *)ret_msg_.c_str();
+        return &reply;
+    }
+
     text_t text_key;
-    text_key.len = strlen(key);
+    text_key.len = key_len;
     text_key.str = (char*)key;
     unsigned int prefix = 0;
     unsigned int count = 0;
@@ -198,6 +330,338 @@ KvReplyInternal * KvConnection::Del(const char* key) {
     return &reply;
 }
 
+std::vector<size_t> KvConnection::SortKeys(size_t count, const char** keys) {
+    std::vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    // same order as the kv index, keep the input order of duplicated keys
+    std::stable_sort(order.begin(), order.end(),
+                     [keys](size_t a, size_t b) { return strcmp(keys[a], keys[b]) < 0; });
+    std::vector<size_t> result;
+    result.reserve(count);
+    for (size_t i = 0; i < order.size(); i++) {
+        if (i + 1 < order.size() && strcmp(keys[order[i]], keys[order[i + 1]]) == 0) {
+            continue;
+        }
+        result.push_back(order[i]);
+    }
+    return result;
+}
+
+KvReplyInternal * KvConnection::ErrorReply(const std::string& msg) {
+    ret_code_ = GS_ERROR;
+    ret_msg_ = msg;
+    reply.type = ret_code_;
+    reply.len = ret_msg_.length();
+    reply.str = (char *)ret_msg_.c_str();
+    return &reply;
+}
+
+KvReplyInternal * KvConnection::FinishBatch(int ret) {
+    ret_code_ = ret;
+    if (ret_code_ == GS_SUCCESS) {
+        if (!is_multi_) {
+            gstor_commit(((db_handle_t*)handle_)->handle);
+        }
+    } else {
+        if (!is_multi_) {
+            gstor_rollback(((db_handle_t*)handle_)->handle);
+        }
+        int32_t err_code;
+        const char* message = nullptr;
+        cm_get_error(&err_code, &message, nullptr);
+
+        ret_code_ = GS_ERROR;
+        ret_msg_ = std::string(message);
+        cm_reset_error();
+    }
+
+    reply.type = ret_code_;
+    reply.len = ret_msg_.length();
+    reply.str = (char *)ret_msg_.c_str();
+    return &reply;
+}
+
+KvReplyInternal * KvConnection::MSet(size_t count, const char** keys, const char** vals) {
+    ret_code_ = GS_SUCCESS;
+    ret_msg_ = "success";
+    memset(&reply, 0, sizeof(reply));
+
+    if (keys == nullptr || vals == nullptr) {
+        return ErrorReply("keys or vals is NULL!");
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (keys[i] == nullptr || vals[i] == nullptr) {
+            return ErrorReply("key or val is NULL!");
+        }
+    }
+
+    if (hash_table_ != nullptr) {
+        for (size_t i = 0; i < count; i++) {
+            (void)hash_table_->Put(keys[i], vals[i], strlen(vals[i]), 0);
+        }
+        return FinishBatch(GS_SUCCESS);
+    }
+
+    // inserting in key order keeps the index descents on neighbouring leaves,
+    // the last value wins for a duplicated key
+    int ret = GS_SUCCESS;
+    for (auto idx : SortKeys(count, keys)) {
+        ret = gstor_put(((db_handle_t*)handle_)->handle, (char*)keys[idx], strlen(keys[idx]), (char*)vals[idx],
+                        strlen(vals[idx]));
+        if (ret != GS_SUCCESS) {
+            break;
+        }
+    }
+    return FinishBatch(ret);
+}
+
+KvReplyInternal * KvConnection::MGet(size_t count, const char** keys) {
+    ret_code_ = GS_SUCCESS;
+    ret_msg_ = "success";
+    memset(&reply, 0, sizeof(reply));
+
+    if (keys == nullptr) {
+        return ErrorReply("keys is NULL!");
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (keys[i] == nullptr) {
+            return ErrorReply("key is NULL!");
+        }
+    }
+
+    if (hash_table_ != nullptr) {
+        // no index to walk, every key is one hash lookup
+        int64_t now_us = KvHashTable::NowUs();
+        values_.assign(count, std::string());
+        elements_.assign(count, KvReplyInternal{});
+        for (size_t i = 0; i < count; i++) {
+            bool found = hash_table_->Get(keys[i], now_us, values_[i]);
+            elements_[i].type = GS_SUCCESS;
+            elements_[i].len = values_[i].length();
+            elements_[i].str = found ? (char *)values_[i].c_str() : nullptr;
+        }
+        reply.type = ret_code_;
+        reply.len = ret_msg_.length();
+        reply.str = (char *)ret_msg_.c_str();
+        reply.elements = count;
+        reply.element = elements_.data();
+        return &reply;
+    }
+
+    auto order = SortKeys(count, keys);
+    std::vector<char*> sorted_keys(order.size());
+    std::vector<unsigned int> key_lens(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        sorted_keys[i] = (char*)keys[order[i]];
+        key_lens[i] = strlen(keys[order[i]]);
+    }
+
+    struct Visitor {
+        std::vector<size_t>* order;
+        std::vector<std::string>* values;
+        std::vector<bool> found;
+    } visitor{&order, &values_, std::vector<bool>(count, false)};
+    values_.assign(count, std::string());
+
+    auto visit = [](void* arg, unsigned int idx, char* val, unsigned int val_len) -> int {
+        auto v = (Visitor*)arg;
+        size_t pos = (*v->order)[idx];
+        (*v->values)[pos].assign(val == nullptr ? "" : val, val_len);
+        v->found[pos] = true;
+        return GS_SUCCESS;
+    };
+    ret_code_ = gstor_mget(((db_handle_t*)handle_)->handle, sorted_keys.size(), sorted_keys.data(), key_lens.data(),
+                           visit, &visitor);
+    if (ret_code_ != GS_SUCCESS) {
+        return FinishBatch(ret_code_);
+    }
+
+    // duplicated keys share the value looked up for their last occurrence
+    std::vector<size_t> all(count);
+    std::iota(all.begin(), all.end(), 0);
+    std::stable_sort(all.begin(), all.end(), [keys](size_t a, size_t b) { return strcmp(keys[a], keys[b]) < 0; });
+    for (size_t i = count; i > 1; i--) {
+        size_t cur = all[i - 2], next = all[i - 1];
+        if (strcmp(keys[cur], keys[next]) == 0) {
+            values_[cur] = values_[next];
+            visitor.found[cur] = visitor.found[next];
+        }
+    }
+
+    elements_.assign(count, KvReplyInternal{});
+    for (size_t i = 0; i < count; i++) {
+        elements_[i].type = GS_SUCCESS;
+        elements_[i].len = values_[i].length();
+        elements_[i].str = visitor.found[i] ? (char *)values_[i].c_str() : nullptr;
+    }
+
+    reply.type = ret_code_;
+    reply.len = ret_msg_.length();
+    reply.str = (char *)ret_msg_.c_str();
+    reply.elements = count;
+    reply.element = elements_.data();
+    return &reply;
+}
+
+KvReplyInternal * KvConnection::MDel(size_t count, const char** keys) {
+    ret_code_ = GS_SUCCESS;
+    ret_msg_ = "success";
+    memset(&reply, 0, sizeof(reply));
+
+    if (keys == nullptr) {
+        return ErrorReply("keys is NULL!");
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (keys[i] == nullptr) {
+            return ErrorReply("key is NULL!");
+        }
+    }
+
+    auto order = SortKeys(count, keys);
+    std::vector<char*> sorted_keys(order.size());
+    std::vector<unsigned int> key_lens(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        sorted_keys[i] = (char*)keys[order[i]];
+        key_lens[i] = strlen(keys[order[i]]);
+    }
+
+    if (hash_table_ != nullptr) {
+        for (size_t i = 0; i < count; i++) {
+            (void)hash_table_->Del(keys[i]);
+        }
+        return FinishBatch(GS_SUCCESS);
+    }
+
+    unsigned int deleted = 0;
+    return FinishBatch(
+        gstor_mdel(((db_handle_t*)handle_)->handle, sorted_keys.size(), sorted_keys.data(), key_lens.data(), &deleted));
+}
+
+std::unique_ptr<KvScanIterator> KvConnection::OpenScan(const char* start, const char* end, unsigned int prefix,
+                                                       size_t limit, bool reverse) {
+    ret_code_ = GS_SUCCESS;
+    ret_msg_ = "success";
+
+    // an empty border is unbounded as well
+    start = (start != nullptr && start[0] == '\0') ? nullptr : start;
+    end = (end != nullptr && end[0] == '\0') ? nullptr : end;
+
+    scan_id_ = 0;
+    if (hash_table_ != nullptr) {
+        std::optional<std::string> lower, upper;
+        if (start != nullptr) {
+            lower = std::string(start);
+        }
+        if (end != nullptr) {
+            upper = std::string(end);
+        }
+        auto rows = hash_table_->Collect(lower ? &*lower : nullptr, upper ? &*upper : nullptr, prefix != 0,
+                                         KvHashTable::NowUs());
+        if (reverse) {
+            std::reverse(rows.begin(), rows.end());
+        }
+        scan_id_ = next_scan_id_++;
+        std::unique_ptr<KvScanIterator> iter(new KvScanIterator(this, scan_id_, limit));
+        iter->rows_ = std::move(rows);
+        return iter;
+    }
+
+    ret_code_ = gstor_kv_scan_open(((db_handle_t*)handle_)->handle, (char*)start, start ? strlen(start) : 0,
+                                   (char*)end, end ? strlen(end) : 0, prefix, reverse);
+    if (ret_code_ != GS_SUCCESS) {
+        int32_t err_code;
+        const char* message = nullptr;
+        cm_get_error(&err_code, &message, nullptr);
+
+        ret_code_ = GS_ERROR;
+        ret_msg_ = std::string(message);
+        cm_reset_error();
+        return nullptr;
+    }
+
+    scan_end_.reset();
+    if (end != nullptr) {
+        scan_end_ = std::string(end);
+    }
+    scan_id_ = next_scan_id_++;
+    return std::unique_ptr<KvScanIterator>(new KvScanIterator(this, scan_id_, limit));
+}
+
+std::unique_ptr<KvScanIterator> KvConnection::Scan(const char* start, const char* end, size_t limit, bool reverse) {
+    return OpenScan(start, end, 0, limit, reverse);
+}
+
+std::unique_ptr<KvScanIterator> KvConnection::ScanPrefix(const char* prefix, size_t limit, bool reverse) {
+    if (prefix == nullptr || prefix[0] == '\0') {
+        return OpenScan(nullptr, nullptr, 0, limit, reverse);
+    }
+    return OpenScan(prefix, nullptr, 1, limit, reverse);
+}
+
+KvScanIterator::~KvScanIterator() {
+    if (conn_->scan_id_ == scan_id_) {
+        if (!rows_.has_value()) {
+            gstor_kv_scan_close(((db_handle_t*)conn_->handle_)->handle);
+        }
+        conn_->scan_id_ = 0;
+    }
+}
+
+int KvScanIterator::Next(const char** key, size_t* key_len, const char** val, size_t* val_len, bool* eof) {
+    *eof = true;
+    if (conn_->scan_id_ != scan_id_) {
+        ret_msg_ = "the scan has been closed by another scan!";
+        return GS_ERROR;
+    }
+    if (limit_ != 0 && count_ >= limit_) {
+        return GS_SUCCESS;
+    }
+
+    if (rows_.has_value()) {
+        if (pos_ >= rows_->size()) {
+            return GS_SUCCESS;
+        }
+        auto& row = (*rows_)[pos_++];
+        *key = row.first.c_str();
+        *key_len = row.first.length();
+        *val = row.second.c_str();
+        *val_len = row.second.length();
+        *eof = false;
+        count_++;
+        return GS_SUCCESS;
+    }
+
+    for (;;) {
+        char *k = nullptr, *v = nullptr;
+        unsigned int k_len = 0, v_len = 0, is_eof = 0;
+        if (gstor_kv_scan_next(((db_handle_t*)conn_->handle_)->handle, &k, &k_len, &v, &v_len, &is_eof) !=
+            GS_SUCCESS) {
+            int32_t err_code;
+            const char* message = nullptr;
+            cm_get_error(&err_code, &message, nullptr);
+            ret_msg_ = std::string(message);
+            cm_reset_error();
+            return GS_ERROR;
+        }
+        if (is_eof) {
+            return GS_SUCCESS;
+        }
+        if (conn_->scan_end_.has_value() && conn_->scan_end_->compare(0, std::string::npos, k, k_len) == 0) {
+            continue;
+        }
+
+        key_.assign(k, k_len);
+        val_.assign(v == nullptr ? "" : v, v_len);
+        *key = key_.c_str();
+        *key_len = key_.length();
+        *val = val_.c_str();
+        *val_len = val_.length();
+        *eof = false;
+        count_++;
+        return GS_SUCCESS;
+    }
+}
+
 int KvConnection::Begin() {
     is_multi_ = true;
     return gstor_begin(((db_handle_t*)handle_)->handle);
@@ -30,14 +30,47 @@
 
 #include <string>
 #include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
 
 class IntarkDB;
+class KvHashTable;
 
 class KvReplyInternal {
    public:
     int type;   /* return type */
     size_t len; /* Length of string */
     char *str;  /* err or value*/
+    size_t elements;          /* number of elements of a batched get */
+    KvReplyInternal *element; /* values in the order of the keys, str is NULL if the key not exist */
+};
+
+class KvConnection;
+
+// range scan over a kv table in key order, rows are fetched from the index one by one.
+// a scan of a hash table works on the sorted copy of the matching rows taken when the scan opens.
+class KvScanIterator {
+   public:
+    EXP_KV_API ~KvScanIterator();
+
+    // key and val are valid until the next call, eof is set after the last row
+    EXP_KV_API int Next(const char** key, size_t* key_len, const char** val, size_t* val_len, bool* eof);
+    EXP_KV_API const std::string& GetRetMsg() { return ret_msg_; }
+
+   private:
+    friend class KvConnection;
+    KvScanIterator(KvConnection* conn, uint64_t scan_id, size_t limit) : conn_(conn), scan_id_(scan_id), limit_(limit) {}
+
+    KvConnection* conn_;
+    uint64_t scan_id_;
+    size_t limit_;  // 0 is unlimited
+    size_t count_ = 0;
+    std::string key_;
+    std::string val_;
+    std::string ret_msg_{"success"};
+    std::optional<std::vector<std::pair<std::string, std::string>>> rows_;  // hash table rows
+    size_t pos_ = 0;
 };
 
 class KvConnection {
@@ -49,11 +82,39 @@ class KvConnection {
 
     EXP_KV_API int OpenTable(const char* table_name);
     EXP_KV_API int OpenMemoryTable(const char* table_name);
+    // hash indexed memory table shared by the connections of the database, O(1) get/set without
+    // buffer pool, undo or redo. writes are not transactional. a persistent table is loaded from
+    // its snapshot on first open and saved when the database closes or SaveHashTable is called.
+    EXP_KV_API int OpenHashTable(const char* table_name, bool persistent = false);
+    EXP_KV_API int SaveHashTable();
 
-    EXP_KV_API KvReplyInternal * Set(const char* key, const char* val);
+    // inserted, if given, tells whether the key was new or overwritten
+    EXP_KV_API KvReplyInternal * Set(const char* key, const char* val, bool* inserted = nullptr);
     EXP_KV_API KvReplyInternal * Get(const char* key);
     EXP_KV_API KvReplyInternal * Del(const char* key);
 
+    // binary safe variants, keys and values may contain '\0'
+    EXP_KV_API KvReplyInternal * Set(const char* key, size_t key_len, const char* val, size_t val_len,
+                                     bool* inserted = nullptr);
+    EXP_KV_API KvReplyInternal * Get(const char* key, size_t key_len);
+    EXP_KV_API KvReplyInternal * Del(const char* key, size_t key_len);
+    // set with a time to live, the key reads as missing once expired. a later Set without ttl makes it persistent.
+    // only tables created with the EXPIRE column support ttl
+    EXP_KV_API KvReplyInternal * SetEx(const char* key, size_t key_len, const char* val, size_t val_len,
+                                       uint32_t seconds);
+    // get without copying the value, val points into the storage buffers and is valid until the next call
+    EXP_KV_API int GetRef(const char* key, size_t key_len, const char** val, size_t* val_len, bool* found);
+
+    // batched operations, keys are handled in key order and committed once outside a transaction
+    EXP_KV_API KvReplyInternal * MSet(size_t count, const char** keys, const char** vals);
+    EXP_KV_API KvReplyInternal * MGet(size_t count, const char** keys);
+    EXP_KV_API KvReplyInternal * MDel(size_t count, const char** keys);
+
+    // keys in [start, end) or starting with prefix, a NULL border is unbounded, limit 0 is unlimited.
+    // one scan is open per connection, starting another scan or opening a table ends the previous one.
+    EXP_KV_API std::unique_ptr<KvScanIterator> Scan(const char* start, const char* end, size_t limit, bool reverse);
+    EXP_KV_API std::unique_ptr<KvScanIterator> ScanPrefix(const char* prefix, size_t limit, bool reverse);
+
     EXP_KV_API int Begin();
     EXP_KV_API int Commit();
     EXP_KV_API int Rollback();
@@ -64,6 +125,18 @@ class KvConnection {
     EXP_KV_API KvReplyInternal * GetReply() { return &reply; }
 
    private:
+    // indexes of the keys sorted by key, duplicated keys are dropped except the last one
+    static std::vector<size_t> SortKeys(size_t count, const char** keys);
+    KvReplyInternal * ErrorReply(const std::string& msg);
+    // ttl_ms 0 means no expiration
+    KvReplyInternal * Put(const char* key, size_t key_len, const char* val, size_t val_len, uint64_t ttl_ms,
+                          bool* inserted);
+    KvReplyInternal * FinishBatch(int ret);
+    std::unique_ptr<KvScanIterator> OpenScan(const char* start, const char* end, unsigned int prefix, size_t limit,
+                                             bool reverse);
+
+    friend class KvScanIterator;
+
     std::weak_ptr<IntarkDB> instance_;
     void* handle_{NULL};
 
@@ -72,6 +145,14 @@ class KvConnection {
     KvReplyInternal reply;
     int32_t ret_code_{0};
     std::string ret_msg_{"success"};
+    std::vector<std::string> values_;
+    std::vector<KvReplyInternal> elements_;
+
+    uint64_t scan_id_ = 0;  // id of the open scan, 0 if none
+    uint64_t next_scan_id_ = 1;
+    std::optional<std::string> scan_end_;  // the kernel range is closed, the end key is skipped
 
     std::string kv_table{"SYS_KV"};
+    std::shared_ptr<KvHashTable> hash_table_;  // set while a hash table is open
+    std::string hash_val_;
 };
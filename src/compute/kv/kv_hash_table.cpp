@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+ *
+ * openGauss embedded is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ * http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ *
+ * kv_hash_table.cpp
+ *
+ * IDENTIFICATION
+ * openGauss-embedded/src/compute/kv/kv_hash_table.cpp
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "kv_hash_table.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+#include "storage/gstor/zekernel/common/cm_date.h"
+#include "storage/gstor/zekernel/common/cm_defs.h"
+#include "storage/gstor/zekernel/common/cm_error.h"
+#include "storage/gstor/zekernel/common/cm_file.h"
+
+namespace {
+const char SNAPSHOT_MAGIC[4] = {'I', 'K', 'V', 'H'};
+const uint32_t SNAPSHOT_VERSION = 1;
+
+inline bool IsLive(int64_t expire_us, int64_t now_us) { return expire_us == 0 || expire_us > now_us; }
+
+template <typename T>
+void WritePod(std::ofstream& out, T v) {
+    out.write((const char*)&v, sizeof(T));
+}
+
+template <typename T>
+bool ReadPod(std::ifstream& in, T& v) {
+    return (bool)in.read((char*)&v, sizeof(T));
+}
+}  // namespace
+
+int64_t KvHashTable::NowUs() {
+    timeval_t tv;
+    (void)cm_gettimeofday(&tv);
+    return (int64_t)tv.tv_sec * MICROSECS_PER_SECOND + tv.tv_usec;
+}
+
+bool KvHashTable::Put(const std::string& key, const char* val, size_t val_len, int64_t expire_us) {
+    auto& stripe = StripeOf(key);
+    std::unique_lock<std::shared_mutex> guard(stripe.lock);
+    auto [it, inserted] = stripe.map.try_emplace(key);
+    it->second.val.assign(val, val_len);
+    it->second.expire_us = expire_us;
+    return inserted;
+}
+
+bool KvHashTable::Get(const std::string& key, int64_t now_us, std::string& val) {
+    auto& stripe = StripeOf(key);
+    {
+        std::shared_lock<std::shared_mutex> guard(stripe.lock);
+        auto it = stripe.map.find(key);
+        if (it == stripe.map.end()) {
+            return false;
+        }
+        if (IsLive(it->second.expire_us, now_us)) {
+            val.assign(it->second.val.data(), it->second.val.size());
+            return true;
+        }
+    }
+
+    // expired keys are dropped by the reader that finds them
+    std::unique_lock<std::shared_mutex> guard(stripe.lock);
+    auto it = stripe.map.find(key);
+    if (it != stripe.map.end() && !IsLive(it->second.expire_us, now_us)) {
+        stripe.map.erase(it);
+    }
+    return false;
+}
+
+bool KvHashTable::Del(const std::string& key) {
+    auto& stripe = StripeOf(key);
+    std::unique_lock<std::shared_mutex> guard(stripe.lock);
+    return stripe.map.erase(key) > 0;
+}
+
+auto KvHashTable::Collect(const std::string* start, const std::string* end, bool prefix, int64_t now_us) const
+    -> std::vector<std::pair<std::string, std::string>> {
+    auto match = [&](const std::string& key) {
+        if (prefix) {
+            return start == nullptr || key.compare(0, start->size(), *start) == 0;
+        }
+        return (start == nullptr || key >= *start) && (end == nullptr || key < *end);
+    };
+
+    std::vector<std::pair<std::string, std::string>> rows;
+    for (auto& stripe : stripes_) {
+        std::shared_lock<std::shared_mutex> guard(stripe.lock);
+        for (auto& [key, entry] : stripe.map) {
+            if (IsLive(entry.expire_us, now_us) && match(key)) {
+                rows.emplace_back(key, std::string(entry.val.data(), entry.val.size()));
+            }
+        }
+    }
+    // same order as the kv index, unsigned bytes then length
+    std::sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    return rows;
+}
+
+size_t KvHashTable::Size() const {
+    size_t size = 0;
+    for (auto& stripe : stripes_) {
+        std::shared_lock<std::shared_mutex> guard(stripe.lock);
+        size += stripe.map.size();
+    }
+    return size;
+}
+
+int KvHashTable::Save(std::string& err) const {
+    if (snapshot_path_.empty()) {
+        err = "hash table " + name_ + " has no snapshot file!";
+        return GS_ERROR;
+    }
+
+    std::string tmp_path = snapshot_path_ + ".tmp";
+    std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        err = "open snapshot file " + tmp_path + " failed!";
+        return GS_ERROR;
+    }
+
+    // stripes are written one by one, the snapshot is consistent per key only
+    out.write(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    WritePod(out, SNAPSHOT_VERSION);
+    for (auto& stripe : stripes_) {
+        std::shared_lock<std::shared_mutex> guard(stripe.lock);
+        for (auto& [key, entry] : stripe.map) {
+            WritePod(out, (uint32_t)key.size());
+            out.write(key.data(), key.size());
+            WritePod(out, (uint32_t)entry.val.size());
+            out.write(entry.val.data(), entry.val.size());
+            WritePod(out, entry.expire_us);
+        }
+    }
+    out.close();
+    if (!out) {
+        err = "write snapshot file " + tmp_path + " failed!";
+        return GS_ERROR;
+    }
+
+    // the temporary file is synced before the rename, a crash never leaves the name on an empty file
+    if (cm_rename_file_durably(tmp_path.c_str(), snapshot_path_.c_str()) != GS_SUCCESS) {
+        cm_reset_error();
+        err = "sync and rename snapshot file " + tmp_path + " failed!";
+        return GS_ERROR;
+    }
+    return GS_SUCCESS;
+}
+
+int KvHashTable::Load(std::string& err) {
+    std::ifstream in(snapshot_path_, std::ios::binary);
+    if (!in) {
+        return GS_SUCCESS;  // nothing saved yet
+    }
+
+    char magic[sizeof(SNAPSHOT_MAGIC)];
+    uint32_t version = 0;
+    if (!in.read(magic, sizeof(magic)) || memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) != 0 ||
+        !ReadPod(in, version) || version != SNAPSHOT_VERSION) {
+        err = "invalid snapshot file " + snapshot_path_;
+        return GS_ERROR;
+    }
+
+    int64_t now_us = NowUs();
+    std::string key, val;
+    uint32_t key_len = 0, val_len = 0;
+    int64_t expire_us = 0;
+    // the snapshot may only end before the key_len of a record, anything cut off later is an error
+    while (ReadPod(in, key_len)) {
+        key.resize(key_len);
+        if (!in.read(key.data(), key_len) || !ReadPod(in, val_len)) {
+            err = "truncated snapshot file " + snapshot_path_;
+            return GS_ERROR;
+        }
+        val.resize(val_len);
+        if (!in.read(val.data(), val_len) || !ReadPod(in, expire_us)) {
+            err = "truncated snapshot file " + snapshot_path_;
+            return GS_ERROR;
+        }
+        if (IsLive(expire_us, now_us)) {
+            Put(key, val.data(), val.size(), expire_us);
+        }
+    }
+    if (!in.eof() || in.gcount() != 0) {
+        err = "truncated snapshot file " + snapshot_path_;
+        return GS_ERROR;
+    }
+    return GS_SUCCESS;
+}
+
+KvHashTables::~KvHashTables() {
+    std::string err;
+    for (auto& [name, table] : tables_) {
+        if (!table->SnapshotPath().empty()) {
+            (void)table->Save(err);
+        }
+    }
+}
+
+auto KvHashTables::Open(const std::string& name, const std::string& snapshot_path, std::string& err)
+    -> std::shared_ptr<KvHashTable> {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = tables_.find(name);
+    if (it != tables_.end()) {
+        return it->second;
+    }
+
+    auto table = std::make_shared<KvHashTable>(name, snapshot_path);
+    if (!snapshot_path.empty() && table->Load(err) != GS_SUCCESS) {
+        return nullptr;
+    }
+    tables_.emplace(name, table);
+    return table;
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+ *
+ * openGauss embedded is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ * http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ *
+ * kv_hash_table.h
+ *
+ * IDENTIFICATION
+ * openGauss-embedded/src/compute/kv/kv_hash_table.h
+ *
+ * -------------------------------------------------------------------------
+ */
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// volatile kv table kept in a lock striped hash map. nothing goes through the buffer pool,
+// undo or redo, writes are visible at once and are not part of a transaction.
+// every stripe allocates its map nodes and values from its own pool, freed memory is kept in
+// the pool for later writes of that stripe and released with the table.
+class KvHashTable {
+   public:
+    static constexpr size_t STRIPE_COUNT = 64;
+
+    // snapshot_path is empty for a table that is never written to disk
+    KvHashTable(const std::string& name, const std::string& snapshot_path)
+        : name_(name), snapshot_path_(snapshot_path) {}
+
+    // unix time in microseconds, the unit of expire_us
+    static int64_t NowUs();
+
+    const std::string& Name() const { return name_; }
+    const std::string& SnapshotPath() const { return snapshot_path_; }
+
+    // expire_us is the unix time(us) the key expires at, 0 means never. returns true if the key was new
+    bool Put(const std::string& key, const char* val, size_t val_len, int64_t expire_us);
+    // copies the value of a live key into val
+    bool Get(const std::string& key, int64_t now_us, std::string& val);
+    bool Del(const std::string& key);
+
+    // live pairs in [start, end) or starting with prefix, in key order. a NULL border is unbounded
+    auto Collect(const std::string* start, const std::string* end, bool prefix, int64_t now_us) const
+        -> std::vector<std::pair<std::string, std::string>>;
+    size_t Size() const;
+
+    // the snapshot is written to a temporary file and renamed, loading skips the expired keys
+    int Save(std::string& err) const;
+    int Load(std::string& err);
+
+   private:
+    // constructed by the map with the allocator of its stripe
+    struct Entry {
+        using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+        explicit Entry(const allocator_type& alloc) : val(alloc) {}
+        Entry(const Entry& other, const allocator_type& alloc) : val(other.val, alloc), expire_us(other.expire_us) {}
+        Entry(Entry&& other, const allocator_type& alloc)
+            : val(std::move(other.val), alloc), expire_us(other.expire_us) {}
+
+        std::pmr::string val;
+        int64_t expire_us = 0;
+    };
+
+    // one cache line per stripe lock, readers of a stripe share it. the pool is not synchronized,
+    // it is only allocated from and freed to under the exclusive lock
+    struct alignas(64) Stripe {
+        mutable std::shared_mutex lock;
+        std::pmr::unsynchronized_pool_resource arena;
+        std::pmr::unordered_map<std::string, Entry> map{&arena};
+    };
+
+    Stripe& StripeOf(const std::string& key) { return stripes_[std::hash<std::string>{}(key) % STRIPE_COUNT]; }
+
+    std::string name_;
+    std::string snapshot_path_;
+    Stripe stripes_[STRIPE_COUNT];
+};
+
+// hash tables of one database, shared by all kv connections
+class KvHashTables {
+   public:
+    // tables with a snapshot path are written to disk when the database closes
+    ~KvHashTables();
+
+    // the first open of a persistent table loads its snapshot
+    auto Open(const std::string& name, const std::string& snapshot_path, std::string& err)
+        -> std::shared_ptr<KvHashTable>;
+
+   private:
+    std::mutex mutex_;
+    std::map<std::string, std::shared_ptr<KvHashTable>> tables_;
+};
@@ -354,6 +354,10 @@ static auto HandleCreatePartionAndTimescale(duckdb_libpgquery::PGCreateStmt *pg_
                     fmt::format("the interval must be  1h/1d, but now is {}!",
                                 pg_stmt->interval));
             }
+            // the storage and the partition keys only know the lower case suffixes
+            for (char *c = pg_stmt->interval; *c != '\0'; c++) {
+                *c = std::tolower(static_cast<unsigned char>(*c));
+            }
             part_obj.is_interval = GS_TRUE;
             part_obj.interval.str = pg_stmt->interval;
             part_obj.interval.len = strlen(pg_stmt->interval);
@@ -31,7 +31,7 @@ void CheckUnSpportedWithCreateViewOptions(duckdb_libpgquery::PGViewStmt *stmt) {
         throw intarkdb::Exception(ExceptionType::SYNTAX, "unsupported create view with aliases");
     }
 
-    if (stmt->options && stmt->options->length > 0) {
+    if (stmt->options && stmt->options->length > 0 && !ContinuousAggregate::IsContinuous(stmt)) {
         throw intarkdb::Exception(ExceptionType::SYNTAX, "unsupported create view with options");
     }
     if (stmt->withCheckOption != duckdb_libpgquery::PGViewCheckOption::PG_NO_CHECK_OPTION) {
@@ -66,6 +66,16 @@ auto Binder::BindCreateViewStmt(duckdb_libpgquery::PGViewStmt *stmt) -> std::uni
 
     auto viewStmt = std::make_unique<CreateViewStatement>(std::move(viewName), std::move(queryStmt));
 
+    if (ContinuousAggregate::IsContinuous(stmt)) {
+        viewStmt->continuous = ContinuousAggregate::Create(user_, viewStmt->getViewName(), stmt);
+        auto source = catalog_.GetTable(viewStmt->continuous->SourceSchema(), viewStmt->continuous->SourceTable());
+        if (!source || !source->IsTimeScale()) {
+            throw intarkdb::Exception(ExceptionType::BINDER,
+                                      fmt::format("continuous aggregate {} must be defined over a timescale table",
+                                                  viewStmt->getViewName()));
+        }
+    }
+
     if (stmt->onconflict == duckdb_libpgquery::PG_IGNORE_ON_CONFLICT) {
         viewStmt->ignore_conflict = true;
     }
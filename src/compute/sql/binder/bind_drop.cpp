@@ -54,8 +54,16 @@ auto Binder::BindDropStmt(duckdb_libpgquery::PGDropStmt *stmt) -> std::unique_pt
 
     auto view_list = (duckdb_libpgquery::PGList *)stmt->objects->head->data.ptr_value;
     std::string name;
+    std::string schema = user_;
     if (view_list->length == 1) {
         name = ((duckdb_libpgquery::PGValue *)view_list->head->data.ptr_value)->val.str;
+    } else if (view_list->length == 2 && type == ObjectType::VIEW) {
+        schema = ((duckdb_libpgquery::PGValue *)view_list->head->data.ptr_value)->val.str;
+        name = ((duckdb_libpgquery::PGValue *)view_list->tail->data.ptr_value)->val.str;
+        if (schema != user_ && catalog_.CheckSysPrivilege(DROP_ANY_VIEW) != GS_TRUE) {
+            throw intarkdb::Exception(ExceptionType::BINDER,
+                fmt::format("user {} drop view {}.{} permission denied!", user_, schema, name));
+        }
     } else {
         throw std::invalid_argument(fmt::format("This format is not currently supported."));
     }
@@ -73,5 +81,7 @@ auto Binder::BindDropStmt(duckdb_libpgquery::PGDropStmt *stmt) -> std::unique_pt
         }
     }
 
-    return std::make_unique<DropStatement>(name, stmt->missing_ok, type);
+    auto drop_stmt = std::make_unique<DropStatement>(name, stmt->missing_ok, type);
+    drop_stmt->schema = schema;
+    return drop_stmt;
 }
@@ -75,6 +75,19 @@ auto Binder::BindRangeVarTableRef(const PGRangeVar &table_ref, bool is_select) -
     if (is_system_command_) {
         schema_name = SYS_USER_NAME;
     }
+    // dv_* performance views are generated from the live kernel counters, a real table of the same name wins
+    if (is_select && PerfViewGenerator::IsPerfView(table_ref.relname) &&
+        catalog_.GetTable(schema_name, table_ref.relname) == nullptr) {
+        cm_reset_error();
+        Binder perf_binder(this);
+        perf_binder.ParseSQL(PerfViewGenerator::Query(table_ref.relname, catalog_, RootBinder()->perf_snapshot_));
+        auto node = reinterpret_cast<PGNode *>(perf_binder.GetStatementNodes()[0]);
+        if (node->type == T_PGRawStmt) {
+            node = reinterpret_cast<PGRawStmt *>(node)->stmt;
+        }
+        return BindSubqueryTableRef(reinterpret_cast<PGSelectStmt *>(node),
+                                    table_ref.alias ? table_ref.alias->aliasname : table_ref.relname);
+    }
     std::unique_ptr<BoundBaseTable> base_table =
         BindBaseTableRef(schema_name, table_ref.relname,
                          table_ref.alias ? std::make_optional(table_ref.alias->aliasname) : std::nullopt);
@@ -115,6 +128,19 @@ auto Binder::BindRangeVarTableRef(const PGRangeVar &table_ref, bool is_select) -
             }
             return base_table;
         case DIC_TYPE_VIEW: {
+            auto &rollup_views = RootBinder()->rollup_views_;
+            auto rollup = rollup_views.find(fmt::format("{}.{}", schema_name, table_info.GetTableName()));
+            if (rollup != rollup_views.end()) {
+                // continuous aggregate, merge the materialized partial states
+                Binder rollup_binder(this);
+                rollup_binder.ParseSQL(rollup->second);
+                auto node = reinterpret_cast<PGNode *>(rollup_binder.GetStatementNodes()[0]);
+                if (node->type == T_PGRawStmt) {
+                    node = reinterpret_cast<PGRawStmt *>(node)->stmt;
+                }
+                return BindSubqueryTableRef(reinterpret_cast<PGSelectStmt *>(node),
+                                            std::string(table_info.GetTableName()));
+            }
             auto query_sql = table_info.GetTableMetaInfo().sql;
             Binder view_binder(this);
             view_binder.ParseSQL(query_sql.str);
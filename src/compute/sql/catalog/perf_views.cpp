@@ -0,0 +1,631 @@
+/*
+* Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+*
+* openGauss embedded is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+* http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+*
+* perf_views.cpp
+*
+* IDENTIFICATION
+* openGauss-embedded/src/compute/sql/catalog/perf_views.cpp
+*
+* -------------------------------------------------------------------------
+*/
+#include "catalog/perf_view.h"
+
+#include <fmt/core.h>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+#include "catalog/catalog.h"
+#include "common/exception.h"
+#include "common/statement_stats.h"
+#include "common/string_util.h"
+#include "storage/gstor/gstor_executor.h"
+#include "storage/gstor/gstor_instance.h"
+#include "storage/gstor/zekernel/kernel/common/knl_context.h"
+#include "storage/gstor/zekernel/kernel/common/knl_session.h"
+
+static const std::string PERF_VIEW_SESSIONS = "dv_sessions";
+static const std::string PERF_VIEW_SESSION_STATS = "dv_session_stats";
+static const std::string PERF_VIEW_SYS_STATS = "dv_sys_stats";
+static const std::string PERF_VIEW_WAIT_EVENTS = "dv_wait_events";
+static const std::string PERF_VIEW_SESSION_WAITS = "dv_session_waits";
+static const std::string PERF_VIEW_BUFFER_POOL = "dv_buffer_pool";
+static const std::string PERF_VIEW_BUFFER_SETS = "dv_buffer_sets";
+static const std::string PERF_VIEW_REDO_CHECKPOINT = "dv_redo_checkpoint";
+static const std::string PERF_VIEW_LOCK_WAITS = "dv_lock_waits";
+static const std::string PERF_VIEW_STATEMENTS = "dv_statements";
+
+enum class PerfColumnType { BIGINT, DOUBLE, VARCHAR };
+
+struct PerfColumn {
+    const char *name;
+    PerfColumnType type;
+};
+
+// one row of rendered sql literals
+using PerfRow = std::vector<std::string>;
+
+struct PerfStatItem {
+    const char *name;
+    uint64 knl_stat_t::*field;
+};
+
+// counters of knl_stat_t shown by dv_session_stats and dv_sys_stats, times are in microseconds
+static const PerfStatItem g_perf_stat_items[] = {
+    {"disk_reads", &knl_stat_t::disk_reads},
+    {"disk_read_time", &knl_stat_t::disk_read_time},
+    {"disk_writes", &knl_stat_t::disk_writes},
+    {"disk_write_time", &knl_stat_t::disk_write_time},
+    {"aio_reads", &knl_stat_t::aio_reads},
+    {"read_ahead_pages", &knl_stat_t::read_ahead_pages},
+    {"buffer_gets", &knl_stat_t::buffer_gets},
+    {"cr_gets", &knl_stat_t::cr_gets},
+    {"buffer_recycle_cnt", &knl_stat_t::buffer_recycle_cnt},
+    {"buffer_recycle_wait", &knl_stat_t::buffer_recycle_wait},
+    {"db_block_changes", &knl_stat_t::db_block_changes},
+    {"atomic_opers", &knl_stat_t::atomic_opers},
+    {"redo_bytes", &knl_stat_t::redo_bytes},
+    {"commits", &knl_stat_t::commits},
+    {"nowait_commits", &knl_stat_t::nowait_commits},
+    {"rollbacks", &knl_stat_t::rollbacks},
+    {"local_txn_times", &knl_stat_t::local_txn_times},
+    {"processed_rows", &knl_stat_t::processed_rows},
+    {"sorts", &knl_stat_t::sorts},
+    {"disk_sorts", &knl_stat_t::disk_sorts},
+    {"temp_allocs", &knl_stat_t::temp_allocs},
+    {"pcr_construct_count", &knl_stat_t::pcr_construct_count},
+    {"bcr_construct_count", &knl_stat_t::bcr_construct_count},
+    {"con_wait_time", &knl_stat_t::con_wait_time},
+    {"table_creates", &knl_stat_t::table_creates},
+    {"table_drops", &knl_stat_t::table_drops},
+    {"table_alters", &knl_stat_t::table_alters},
+    {"table_part_drops", &knl_stat_t::table_part_drops},
+    {"undo_free_pages", &knl_stat_t::undo_free_pages},
+    {"undo_shrink_times", &knl_stat_t::undo_shrink_times},
+    {"txn_alloc_times", &knl_stat_t::txn_alloc_times},
+    {"txn_page_waits", &knl_stat_t::txn_page_waits},
+    {"txn_page_end_waits", &knl_stat_t::txn_page_end_waits},
+};
+
+// the session fields read by the views, copied under the instance lock
+struct SessionSample {
+    uint32 id;
+    uint32 serial_id;
+    uint32 uid;
+    uint32 spid;
+    knl_session_status_t status;
+    bool8 is_waiting;
+    wait_event_t event;
+    date_t wait_begin;
+    uint16 wrmid;
+    uint32 wait_table_uid;
+    uint32 wait_table_oid;
+    bool32 wait_table;
+    uint32 wait_file;
+    uint32 wait_page;
+    knl_stat_t stat;
+};
+
+struct KernelSample {
+    knl_instance_t *kernel;
+    date_t now;
+    knl_stat_t total;  // instance counters, including those folded from closed sessions
+    std::vector<SessionSample> sessions;
+};
+
+static KernelSample TakeKernelSample(const Catalog &catalog) {
+    knl_session_t *session = EC_SESSION(catalog.GetStorageHandle()->handle);
+    instance_t *instance = (instance_t *)session->kernel->server;
+    KernelSample sample;
+    sample.kernel = session->kernel;
+    sample.now = KNL_NOW(session);
+
+    // sessions are unpublished under this lock before they are freed
+    cm_spin_lock(&instance->lock, NULL);
+    sample.total = sample.kernel->stat;
+    for (uint32 i = 0; i < instance->hwm && i < GS_MAX_SESSIONS; i++) {
+        knl_session_t *se = sample.kernel->sessions[i];
+        if (se == NULL) {
+            continue;
+        }
+        SessionSample s;
+        s.id = se->id;
+        s.serial_id = se->serial_id;
+        s.uid = se->uid;
+        s.spid = se->spid;
+        s.status = se->status;
+        s.is_waiting = se->is_waiting;
+        s.event = se->wait.event;
+        s.wait_begin = se->wait.begin_time;
+        s.wrmid = se->wrmid;
+        s.wait_table_uid = se->wtid.uid;
+        s.wait_table_oid = se->wtid.oid;
+        s.wait_table = se->wtid.is_locking;
+        s.wait_file = se->wpid.file;
+        s.wait_page = se->wpid.page;
+        s.stat = se->stat;
+        sample.sessions.push_back(s);
+    }
+    cm_spin_unlock(&instance->lock);
+
+    for (const auto &s : sample.sessions) {
+        for (const auto &item : g_perf_stat_items) {
+            sample.total.*item.field += s.stat.*item.field;
+        }
+        for (uint32 e = 0; e < WAIT_EVENT_COUNT; e++) {
+            sample.total.wait_count[e] += s.stat.wait_count[e];
+            sample.total.wait_time[e] += s.stat.wait_time[e];
+        }
+        for (uint32 i = 0; i < GS_MAX_BUF_POOL_NUM; i++) {
+            sample.total.buf_set_gets[i] += s.stat.buf_set_gets[i];
+            sample.total.buf_set_misses[i] += s.stat.buf_set_misses[i];
+        }
+    }
+    return sample;
+}
+
+// hands out deltas against the connection baseline of one view and records the new baseline,
+// counters that are not read again (closed sessions) drop out of it
+class PerfDeltaTracker {
+   public:
+    PerfDeltaTracker(PerfViewSnapshot *snapshot, const std::string &view) {
+        if (snapshot != nullptr) {
+            auto &baseline = snapshot->baselines[view];
+            prev_ = std::move(baseline);
+            baseline.clear();
+            curr_ = &baseline;
+        }
+    }
+
+    auto Delta(const std::string &key, uint64 value) -> uint64 {
+        if (curr_ == nullptr) {
+            return value;
+        }
+        (*curr_)[key] = value;
+        auto iter = prev_.find(key);
+        if (iter == prev_.end() || iter->second > value) {
+            return value;
+        }
+        return value - iter->second;
+    }
+
+   private:
+    std::unordered_map<std::string, uint64_t> prev_;
+    std::unordered_map<std::string, uint64_t> *curr_ = nullptr;
+};
+
+static std::string Literal(uint64 value) { return std::to_string(value); }
+
+static std::string Literal(double value) { return fmt::format("{:.6f}", value); }
+
+static std::string Literal(const std::string &value) {
+    return "'" + intarkdb::StringUtil::Replace(value, "'", "''") + "'";
+}
+
+static const std::string NULL_LITERAL = "NULL";
+
+static const char *SessionStatusName(knl_session_status_t status) {
+    switch (status) {
+        case SESSION_ACTIVE:
+            return "ACTIVE";
+        case SESSION_SUSPENSION:
+            return "SUSPENSION";
+        default:
+            return "INACTIVE";
+    }
+}
+
+static uint64 WaitElapsed(const KernelSample &sample, const SessionSample &s) {
+    return (s.wait_begin != 0 && sample.now > s.wait_begin) ? (uint64)(sample.now - s.wait_begin) : 0;
+}
+
+static double HitRatio(uint64 gets, uint64 reads) {
+    return (gets == 0 || reads >= gets) ? 0.0 : (double)(gets - reads) / gets;
+}
+
+// select over a VALUES list, the casts pin the column types whatever the literals look like
+static std::string RenderQuery(const std::string &view, const std::vector<PerfColumn> &columns,
+                               std::vector<PerfRow> rows) {
+    std::vector<std::string> select_list;
+    PerfRow empty_row;
+    for (size_t i = 0; i < columns.size(); i++) {
+        const char *type = "VARCHAR";
+        empty_row.push_back("''");
+        if (columns[i].type == PerfColumnType::BIGINT) {
+            type = "BIGINT";
+            empty_row.back() = "0";
+        } else if (columns[i].type == PerfColumnType::DOUBLE) {
+            type = "DOUBLE";
+            empty_row.back() = "0.0";
+        }
+        select_list.push_back(fmt::format("CAST(col{} AS {}) AS \"{}\"", i, type, columns[i].name));
+    }
+
+    // VALUES can not be empty, keep the column types with a row that is filtered out
+    std::string where;
+    if (rows.empty()) {
+        rows.push_back(std::move(empty_row));
+        where = " WHERE 1 = 0";
+    }
+    std::vector<std::string> values;
+    values.reserve(rows.size());
+    for (const auto &row : rows) {
+        values.push_back(fmt::format("({})", fmt::join(row, ", ")));
+    }
+    return fmt::format("SELECT {} FROM (VALUES {}) AS {}{}", fmt::join(select_list, ", "), fmt::join(values, ", "),
+                       view, where);
+}
+
+static std::string QuerySessions(const KernelSample &sample) {
+    std::vector<PerfColumn> columns = {
+        {"sid", PerfColumnType::BIGINT},        {"serial", PerfColumnType::BIGINT},
+        {"user_id", PerfColumnType::BIGINT},    {"spid", PerfColumnType::BIGINT},
+        {"status", PerfColumnType::VARCHAR},    {"wait_event", PerfColumnType::VARCHAR},
+        {"wait_time_us", PerfColumnType::BIGINT},
+    };
+    std::vector<PerfRow> rows;
+    for (const auto &s : sample.sessions) {
+        bool waiting = s.is_waiting && s.event < WAIT_EVENT_COUNT;
+        rows.push_back({Literal((uint64)s.id), Literal((uint64)s.serial_id), Literal((uint64)s.uid),
+                        Literal((uint64)s.spid), Literal(std::string(SessionStatusName(s.status))),
+                        Literal(std::string(waiting ? knl_get_event_desc(s.event)->name : "")),
+                        Literal(waiting ? WaitElapsed(sample, s) : 0)});
+    }
+    return RenderQuery(PERF_VIEW_SESSIONS, columns, std::move(rows));
+}
+
+static std::string QuerySessionStats(const KernelSample &sample, PerfViewSnapshot *snapshot) {
+    std::vector<PerfColumn> columns = {
+        {"sid", PerfColumnType::BIGINT},  {"serial", PerfColumnType::BIGINT}, {"name", PerfColumnType::VARCHAR},
+        {"value", PerfColumnType::BIGINT}, {"delta", PerfColumnType::BIGINT},
+    };
+    PerfDeltaTracker tracker(snapshot, PERF_VIEW_SESSION_STATS);
+    std::vector<PerfRow> rows;
+    for (const auto &s : sample.sessions) {
+        for (const auto &item : g_perf_stat_items) {
+            uint64 value = s.stat.*item.field;
+            uint64 delta = tracker.Delta(fmt::format("{}.{}.{}", s.id, s.serial_id, item.name), value);
+            rows.push_back({Literal((uint64)s.id), Literal((uint64)s.serial_id), Literal(std::string(item.name)),
+                            Literal(value), Literal(delta)});
+        }
+    }
+    return RenderQuery(PERF_VIEW_SESSION_STATS, columns, std::move(rows));
+}
+
+static std::string QuerySysStats(const KernelSample &sample, PerfViewSnapshot *snapshot) {
+    std::vector<PerfColumn> columns = {
+        {"name", PerfColumnType::VARCHAR}, {"value", PerfColumnType::BIGINT}, {"delta", PerfColumnType::BIGINT},
+    };
+    PerfDeltaTracker tracker(snapshot, PERF_VIEW_SYS_STATS);
+    std::vector<PerfRow> rows;
+    for (const auto &item : g_perf_stat_items) {
+        uint64 value = sample.total.*item.field;
+        rows.push_back({Literal(std::string(item.name)), Literal(value), Literal(tracker.Delta(item.name, value))});
+    }
+    return RenderQuery(PERF_VIEW_SYS_STATS, columns, std::move(rows));
+}
+
+static std::vector<PerfColumn> WaitEventColumns(bool per_session) {
+    std::vector<PerfColumn> columns;
+    if (per_session) {
+        columns.push_back({"sid", PerfColumnType::BIGINT});
+        columns.push_back({"serial", PerfColumnType::BIGINT});
+    }
+    columns.insert(columns.end(), {
+                                      {"event", PerfColumnType::VARCHAR},
+                                      {"wait_class", PerfColumnType::VARCHAR},
+                                      {"total_waits", PerfColumnType::BIGINT},
+                                      {"time_waited_us", PerfColumnType::BIGINT},
+                                      {"delta_waits", PerfColumnType::BIGINT},
+                                      {"delta_time_us", PerfColumnType::BIGINT},
+                                  });
+    return columns;
+}
+
+static void AddWaitEventRow(const knl_stat_t &stat, uint32 event, const std::string &key_prefix,
+                            PerfDeltaTracker &tracker, PerfRow &&prefix, std::vector<PerfRow> &rows) {
+    const wait_event_desc_t *desc = knl_get_event_desc((uint16)event);
+    std::string key = key_prefix + desc->name;
+    PerfRow row = std::move(prefix);
+    row.push_back(Literal(std::string(desc->name)));
+    row.push_back(Literal(std::string(desc->wait_class)));
+    row.push_back(Literal(stat.wait_count[event]));
+    row.push_back(Literal(stat.wait_time[event]));
+    row.push_back(Literal(tracker.Delta(key + ".waits", stat.wait_count[event])));
+    row.push_back(Literal(tracker.Delta(key + ".time", stat.wait_time[event])));
+    rows.push_back(std::move(row));
+}
+
+static std::string QueryWaitEvents(const KernelSample &sample, PerfViewSnapshot *snapshot) {
+    PerfDeltaTracker tracker(snapshot, PERF_VIEW_WAIT_EVENTS);
+    std::vector<PerfRow> rows;
+    for (uint32 e = 0; e < WAIT_EVENT_COUNT; e++) {
+        AddWaitEventRow(sample.total, e, "", tracker, {}, rows);
+    }
+    return RenderQuery(PERF_VIEW_WAIT_EVENTS, WaitEventColumns(false), std::move(rows));
+}
+
+// only events a session has waited on
+static std::string QuerySessionWaits(const KernelSample &sample, PerfViewSnapshot *snapshot) {
+    PerfDeltaTracker tracker(snapshot, PERF_VIEW_SESSION_WAITS);
+    std::vector<PerfRow> rows;
+    for (const auto &s : sample.sessions) {
+        for (uint32 e = 0; e < WAIT_EVENT_COUNT; e++) {
+            if (s.stat.wait_count[e] == 0) {
+                continue;
+            }
+            AddWaitEventRow(s.stat, e, fmt::format("{}.{}.", s.id, s.serial_id), tracker,
+                            {Literal((uint64)s.id), Literal((uint64)s.serial_id)}, rows);
+        }
+    }
+    return RenderQuery(PERF_VIEW_SESSION_WAITS, WaitEventColumns(true), std::move(rows));
+}
+
+// one row for the whole pool, see dv_buffer_sets for each buffer set
+static std::string QueryBufferPool(const KernelSample &sample, PerfViewSnapshot *snapshot) {
+    std::vector<PerfColumn> columns = {
+        {"buffer_sets", PerfColumnType::BIGINT},   {"capacity", PerfColumnType::BIGINT},
+        {"hwm", PerfColumnType::BIGINT},           {"main_list_pages", PerfColumnType::BIGINT},
+        {"scan_list_pages", PerfColumnType::BIGINT}, {"write_list_pages", PerfColumnType::BIGINT},
+        {"dirty_pages", PerfColumnType::BIGINT},   {"buffer_gets", PerfColumnType::BIGINT},
+        {"disk_reads", PerfColumnType::BIGINT},    {"hit_ratio", PerfColumnType::DOUBLE},
+        {"delta_buffer_gets", PerfColumnType::BIGINT}, {"delta_disk_reads", PerfColumnType::BIGINT},
+        {"delta_hit_ratio", PerfColumnType::DOUBLE},
+    };
+    const buf_context_t *ctx = &sample.kernel->buf_ctx;
+    uint64 capacity = 0;
+    uint64 hwm = 0;
+    uint64 main_pages = 0;
+    uint64 scan_pages = 0;
+    uint64 write_pages = 0;
+    for (uint32 i = 0; i < ctx->buf_set_count; i++) {
+        const buf_set_t *set = &ctx->buf_set[i];
+        capacity += set->capacity;
+        hwm += set->hwm;
+        main_pages += set->main_list.count;
+        scan_pages += set->scan_list.count;
+        write_pages += set->write_list.count;
+    }
+    PerfDeltaTracker tracker(snapshot, PERF_VIEW_BUFFER_POOL);
+    uint64 gets = sample.total.buffer_gets;
+    uint64 reads = sample.total.disk_reads;
+    uint64 delta_gets = tracker.Delta("buffer_gets", gets);
+    uint64 delta_reads = tracker.Delta("disk_reads", reads);
+    std::vector<PerfRow> rows = {{
+        Literal((uint64)ctx->buf_set_count), Literal(capacity), Literal(hwm), Literal(main_pages),
+        Literal(scan_pages), Literal(write_pages), Literal((uint64)sample.kernel->ckpt_ctx.queue.count),
+        Literal(gets), Literal(reads), Literal(HitRatio(gets, reads)), Literal(delta_gets), Literal(delta_reads),
+        Literal(HitRatio(delta_gets, delta_reads)),
+    }};
+    return RenderQuery(PERF_VIEW_BUFFER_POOL, columns, std::move(rows));
+}
+
+enum class PageClass { INDEX, HEAP, LOB, UNDO, OTHER, COUNT };
+
+static PageClass GetPageClass(uint8 type) {
+    switch (type) {
+        case PAGE_TYPE_BTREE_HEAD:
+        case PAGE_TYPE_BTREE_NODE:
+        case PAGE_TYPE_PCRB_NODE:
+            return PageClass::INDEX;
+        case PAGE_TYPE_HEAP_HEAD:
+        case PAGE_TYPE_HEAP_MAP:
+        case PAGE_TYPE_HEAP_DATA:
+        case PAGE_TYPE_PCRH_DATA:
+            return PageClass::HEAP;
+        case PAGE_TYPE_LOB_HEAD:
+        case PAGE_TYPE_LOB_DATA:
+            return PageClass::LOB;
+        case PAGE_TYPE_UNDO_HEAD:
+        case PAGE_TYPE_TXN:
+        case PAGE_TYPE_UNDO:
+            return PageClass::UNDO;
+        default:
+            return PageClass::OTHER;
+    }
+}
+
+// one row per buffer set, the cached pages are classified by a racy walk over the ctrls
+static std::string QueryBufferSets(const KernelSample &sample, PerfViewSnapshot *snapshot) {
+    std::vector<PerfColumn> columns = {
+        {"set_id", PerfColumnType::BIGINT},         {"capacity", PerfColumnType::BIGINT},
+        {"hwm", PerfColumnType::BIGINT},            {"main_list_pages", PerfColumnType::BIGINT},
+        {"scan_list_pages", PerfColumnType::BIGINT}, {"write_list_pages", PerfColumnType::BIGINT},
+        {"index_pages", PerfColumnType::BIGINT},    {"heap_pages", PerfColumnType::BIGINT},
+        {"lob_pages", PerfColumnType::BIGINT},      {"undo_pages", PerfColumnType::BIGINT},
+        {"other_pages", PerfColumnType::BIGINT},    {"buffer_gets", PerfColumnType::BIGINT},
+        {"misses", PerfColumnType::BIGINT},         {"hit_ratio", PerfColumnType::DOUBLE},
+        {"ghost_hits", PerfColumnType::BIGINT},     {"promotions", PerfColumnType::BIGINT},
+        {"demotions", PerfColumnType::BIGINT},      {"evictions", PerfColumnType::BIGINT},
+        {"delta_buffer_gets", PerfColumnType::BIGINT}, {"delta_misses", PerfColumnType::BIGINT},
+        {"delta_hit_ratio", PerfColumnType::DOUBLE},
+    };
+    buf_context_t *ctx = &sample.kernel->buf_ctx;
+    PerfDeltaTracker tracker(snapshot, PERF_VIEW_BUFFER_SETS);
+    std::vector<PerfRow> rows;
+    for (uint32 i = 0; i < ctx->buf_set_count; i++) {
+        buf_set_t *set = &ctx->buf_set[i];
+        uint64 pages[(int)PageClass::COUNT] = {0};
+        uint32 hwm = set->hwm;
+        for (uint32 j = 0; j < hwm; j++) {
+            const buf_ctrl_t *ctrl = &set->ctrls[j];
+            if (ctrl->bucket_id != GS_INVALID_ID32 && ctrl->load_status == BUF_IS_LOADED) {
+                pages[(int)GetPageClass(ctrl->page->type)]++;
+            }
+        }
+        uint64 gets = sample.total.buf_set_gets[i];
+        uint64 misses = sample.total.buf_set_misses[i];
+        uint64 delta_gets = tracker.Delta(fmt::format("buffer_gets.{}", i), gets);
+        uint64 delta_misses = tracker.Delta(fmt::format("misses.{}", i), misses);
+        rows.push_back({
+            Literal((uint64)i), Literal((uint64)set->capacity), Literal((uint64)hwm),
+            Literal((uint64)set->main_list.count), Literal((uint64)set->scan_list.count),
+            Literal((uint64)set->write_list.count), Literal(pages[(int)PageClass::INDEX]),
+            Literal(pages[(int)PageClass::HEAP]), Literal(pages[(int)PageClass::LOB]),
+            Literal(pages[(int)PageClass::UNDO]), Literal(pages[(int)PageClass::OTHER]), Literal(gets),
+            Literal(misses), Literal(HitRatio(gets, misses)), Literal((uint64)cm_atomic_get(&set->stat.ghost_hits)),
+            Literal((uint64)cm_atomic_get(&set->stat.promotions)), Literal((uint64)cm_atomic_get(&set->stat.demotions)),
+            Literal((uint64)cm_atomic_get(&set->stat.evictions)), Literal(delta_gets), Literal(delta_misses),
+            Literal(HitRatio(delta_gets, delta_misses)),
+        });
+    }
+    return RenderQuery(PERF_VIEW_BUFFER_SETS, columns, std::move(rows));
+}
+
+static std::string QueryRedoCheckpoint(const KernelSample &sample, PerfViewSnapshot *snapshot) {
+    std::vector<PerfColumn> columns = {
+        {"curr_lfn", PerfColumnType::BIGINT},          {"flushed_lfn", PerfColumnType::BIGINT},
+        {"curr_asn", PerfColumnType::BIGINT},          {"curr_block_id", PerfColumnType::BIGINT},
+        {"trunc_lfn", PerfColumnType::BIGINT},         {"lrp_lfn", PerfColumnType::BIGINT},
+        {"ckpt_lag_lfn", PerfColumnType::BIGINT},      {"ckpt_queue_pages", PerfColumnType::BIGINT},
+        {"redo_flush_times", PerfColumnType::BIGINT},  {"redo_flush_bytes", PerfColumnType::BIGINT},
+        {"redo_flush_time_us", PerfColumnType::BIGINT}, {"log_switches", PerfColumnType::BIGINT},
+        {"ckpt_tasks", PerfColumnType::BIGINT},        {"ckpt_flush_pages", PerfColumnType::BIGINT},
+        {"ckpt_disk_writes", PerfColumnType::BIGINT},  {"ckpt_disk_write_time_us", PerfColumnType::BIGINT},
+        {"double_writes", PerfColumnType::BIGINT},     {"delta_redo_flush_bytes", PerfColumnType::BIGINT},
+        {"delta_ckpt_flush_pages", PerfColumnType::BIGINT},
+        {"rcy_replay_bytes", PerfColumnType::BIGINT},  {"rcy_replay_time_us", PerfColumnType::BIGINT},
+        {"rcy_replay_processes", PerfColumnType::BIGINT},
+    };
+    const log_context_t *redo = &sample.kernel->redo_ctx;
+    const ckpt_context_t *ckpt = &sample.kernel->ckpt_ctx;
+    uint64 curr_lfn = redo->lfn;
+    uint64 trunc_lfn = ckpt->queue.trunc_point.lfn;
+    uint64 ckpt_tasks = 0;
+    uint64 ckpt_pages = 0;
+    for (uint32 i = 0; i < CKPT_MODE_NUM; i++) {
+        ckpt_tasks += ckpt->stat.task_count[i];
+        ckpt_pages += ckpt->stat.flush_pages[i];
+    }
+    PerfDeltaTracker tracker(snapshot, PERF_VIEW_REDO_CHECKPOINT);
+    std::vector<PerfRow> rows = {{
+        Literal(curr_lfn), Literal((uint64)redo->flushed_lfn), Literal((uint64)redo->curr_point.asn),
+        Literal((uint64)redo->curr_point.block_id), Literal(trunc_lfn), Literal((uint64)ckpt->lrp_point.lfn),
+        Literal(curr_lfn > trunc_lfn ? curr_lfn - trunc_lfn : 0), Literal((uint64)ckpt->queue.count),
+        Literal(redo->stat.flush_times), Literal(redo->stat.flush_bytes), Literal(redo->stat.flush_elapsed),
+        Literal(redo->stat.switch_count), Literal(ckpt_tasks), Literal(ckpt_pages), Literal(ckpt->stat.disk_writes),
+        Literal(ckpt->stat.disk_write_time), Literal(ckpt->stat.double_writes),
+        Literal(tracker.Delta("redo_flush_bytes", redo->stat.flush_bytes)),
+        Literal(tracker.Delta("ckpt_flush_pages", ckpt_pages)),
+        // crash recovery of the last startup
+        Literal(redo->replay_stat.replay_bytes), Literal(redo->replay_stat.replay_elapsed),
+        Literal((uint64)redo->replay_stat.replay_processes),
+    }};
+    return RenderQuery(PERF_VIEW_REDO_CHECKPOINT, columns, std::move(rows));
+}
+
+// sessions blocked on a transaction, table or itl lock right now
+static std::string QueryLockWaits(const KernelSample &sample) {
+    std::vector<PerfColumn> columns = {
+        {"sid", PerfColumnType::BIGINT},          {"serial", PerfColumnType::BIGINT},
+        {"wait_event", PerfColumnType::VARCHAR},  {"holder_sid", PerfColumnType::BIGINT},
+        {"table_uid", PerfColumnType::BIGINT},    {"table_oid", PerfColumnType::BIGINT},
+        {"wait_page", PerfColumnType::VARCHAR},   {"wait_time_us", PerfColumnType::BIGINT},
+    };
+    std::vector<PerfRow> rows;
+    for (const auto &s : sample.sessions) {
+        bool row_wait = s.wrmid != GS_INVALID_ID16;
+        bool page_wait = s.wait_file < INVALID_FILE_ID;
+        if (!row_wait && !page_wait && !s.wait_table) {
+            continue;
+        }
+        std::string holder = NULL_LITERAL;
+        if (row_wait && s.wrmid < GS_MAX_RMS && sample.kernel->rms[s.wrmid] != NULL) {
+            holder = Literal((uint64)sample.kernel->rms[s.wrmid]->sid);
+        }
+        bool waiting = s.is_waiting && s.event < WAIT_EVENT_COUNT;
+        rows.push_back({
+            Literal((uint64)s.id), Literal((uint64)s.serial_id),
+            Literal(std::string(waiting ? knl_get_event_desc(s.event)->name : "")), holder,
+            s.wait_table ? Literal((uint64)s.wait_table_uid) : NULL_LITERAL,
+            s.wait_table ? Literal((uint64)s.wait_table_oid) : NULL_LITERAL,
+            Literal(page_wait ? fmt::format("{}-{}", s.wait_file, s.wait_page) : std::string()),
+            Literal(waiting ? WaitElapsed(sample, s) : 0),
+        });
+    }
+    return RenderQuery(PERF_VIEW_LOCK_WAITS, columns, std::move(rows));
+}
+
+// one row per statement fingerprint, the most expensive first
+static std::string QueryStatements() {
+    std::vector<PerfColumn> columns = {
+        {"fingerprint", PerfColumnType::VARCHAR},  {"query", PerfColumnType::VARCHAR},
+        {"calls", PerfColumnType::BIGINT},         {"errors", PerfColumnType::BIGINT},
+        {"total_time_us", PerfColumnType::BIGINT}, {"min_time_us", PerfColumnType::BIGINT},
+        {"max_time_us", PerfColumnType::BIGINT},   {"mean_time_us", PerfColumnType::DOUBLE},
+        {"p50_time_us", PerfColumnType::BIGINT},   {"p95_time_us", PerfColumnType::BIGINT},
+        {"p99_time_us", PerfColumnType::BIGINT},   {"rows", PerfColumnType::BIGINT},
+    };
+    auto entries = StatementStats::GetInstance().Snapshot();
+    std::sort(entries.begin(), entries.end(),
+              [](const auto &a, const auto &b) { return a.second.total_time_us > b.second.total_time_us; });
+    std::vector<PerfRow> rows;
+    rows.reserve(entries.size());
+    // StatementStats counts in uint64_t, which is not the kernel uint64 on every platform
+    auto number = [](uint64_t value) { return Literal((uint64)value); };
+    for (const auto &[id, entry] : entries) {
+        // the percentiles are bucket bounds, keep them inside the observed range
+        auto percentile = [&entry = entry, &number](double fraction) {
+            return number(std::clamp(entry.latency.Percentile(fraction), entry.min_time_us, entry.max_time_us));
+        };
+        rows.push_back({
+            Literal(fmt::format("{:016x}", id)), Literal(entry.text), number(entry.calls), number(entry.errors),
+            number(entry.total_time_us), number(entry.min_time_us), number(entry.max_time_us),
+            Literal((double)entry.total_time_us / entry.calls), percentile(0.5), percentile(0.95), percentile(0.99),
+            number(entry.rows),
+        });
+    }
+    return RenderQuery(PERF_VIEW_STATEMENTS, columns, std::move(rows));
+}
+
+bool PerfViewGenerator::IsPerfView(const std::string &name) {
+    static const std::unordered_set<std::string> views = {
+        PERF_VIEW_SESSIONS,    PERF_VIEW_SESSION_STATS, PERF_VIEW_SYS_STATS,       PERF_VIEW_WAIT_EVENTS,
+        PERF_VIEW_SESSION_WAITS, PERF_VIEW_BUFFER_POOL, PERF_VIEW_BUFFER_SETS, PERF_VIEW_REDO_CHECKPOINT,
+        PERF_VIEW_LOCK_WAITS, PERF_VIEW_STATEMENTS,
+    };
+    return views.count(intarkdb::StringUtil::Lower(name)) > 0;
+}
+
+std::string PerfViewGenerator::Query(const std::string &name, const Catalog &catalog, PerfViewSnapshot *snapshot) {
+    auto view = intarkdb::StringUtil::Lower(name);
+    if (view == PERF_VIEW_STATEMENTS) {
+        return QueryStatements();
+    }
+    auto sample = TakeKernelSample(catalog);
+    if (view == PERF_VIEW_SESSIONS) {
+        return QuerySessions(sample);
+    } else if (view == PERF_VIEW_SESSION_STATS) {
+        return QuerySessionStats(sample, snapshot);
+    } else if (view == PERF_VIEW_SYS_STATS) {
+        return QuerySysStats(sample, snapshot);
+    } else if (view == PERF_VIEW_WAIT_EVENTS) {
+        return QueryWaitEvents(sample, snapshot);
+    } else if (view == PERF_VIEW_SESSION_WAITS) {
+        return QuerySessionWaits(sample, snapshot);
+    } else if (view == PERF_VIEW_BUFFER_POOL) {
+        return QueryBufferPool(sample, snapshot);
+    } else if (view == PERF_VIEW_BUFFER_SETS) {
+        return QueryBufferSets(sample, snapshot);
+    } else if (view == PERF_VIEW_REDO_CHECKPOINT) {
+        return QueryRedoCheckpoint(sample, snapshot);
+    } else if (view == PERF_VIEW_LOCK_WAITS) {
+        return QueryLockWaits(sample);
+    }
+    throw intarkdb::Exception(ExceptionType::CATALOG, fmt::format("performance view {} not exists", name));
+}
@@ -24,11 +24,14 @@
 #include "catalog/table_info.h"
 
 #include <algorithm>
+#include <cctype>
+#include <cstdlib>
 #include <string_view>
 #include <vector>
 
 #include "catalog/column.h"
 #include "common/string_util.h"
+#include "type/timestamp_t.h"
 
 bool IsValidTableName(std::string_view name) {
     bool have_char = false;
@@ -121,6 +124,27 @@ const exp_table_part_t* TableInfo::GetTablePartByTimestamp(uint64_t ts_us) const
     return rs;
 }
 
+bool TableInfo::IsHourlyPartition() const {
+    const auto& interval = meta_->part_table.desc.interval;
+    if (!meta_->parted || interval.str == nullptr || interval.len < 2) {
+        return false;
+    }
+    std::string text(interval.str, interval.len);
+    auto count = std::strtoll(text.substr(0, text.size() - 1).c_str(), nullptr, 10);
+    int64_t unit = 0;
+    switch (std::tolower(static_cast<unsigned char>(text.back()))) {
+        case GS_TIME_SUFFIX_HOUR:
+            unit = Interval::MICROS_PER_HOUR;
+            break;
+        case GS_TIME_SUFFIX_DAY:
+            unit = Interval::MICROS_PER_DAY;
+            break;
+        default:
+            return false;
+    }
+    return count > 0 && count * unit < Interval::MICROS_PER_DAY;
+}
+
 const exp_table_part_t* TableInfo::GetTablePartByName(const std::string& part_name) const {
     if (!meta_->parted) {
         GS_LOG_RUN_WAR("table is not a part table!\n");
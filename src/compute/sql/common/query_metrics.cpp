@@ -0,0 +1,140 @@
+/*
+* Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+*
+* openGauss embedded is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+* http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+*
+* query_metrics.cpp
+*
+* IDENTIFICATION
+* openGauss-embedded/src/compute/sql/common/query_metrics.cpp
+*
+* -------------------------------------------------------------------------
+*/
+#include "common/query_metrics.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+struct TypeShard {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> errors{0};
+    std::atomic<uint64_t> latency_sum_us{0};
+    std::array<std::atomic<uint64_t>, QueryMetrics::BUCKET_COUNT> buckets{};
+};
+
+// only the owning thread writes a shard, so a relaxed load and store is enough to count,
+// the atomics just keep the concurrent reads of Collect well defined
+struct MetricsShard {
+    std::array<TypeShard, QueryMetrics::STATEMENT_TYPE_COUNT> types;
+};
+
+inline void Bump(std::atomic<uint64_t> &counter, uint64_t n) {
+    counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+// shards outlive their threads: an exiting thread hands its shard to the next new thread,
+// which keeps counting on top of it, so the sums never go backwards
+class ShardRegistry {
+   public:
+    MetricsShard *Acquire() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_.empty()) {
+            auto shard = free_.back();
+            free_.pop_back();
+            return shard;
+        }
+        shards_.push_back(std::make_unique<MetricsShard>());
+        return shards_.back().get();
+    }
+
+    void Release(MetricsShard *shard) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_.push_back(shard);
+    }
+
+    QueryMetrics::Snapshot Sum() {
+        QueryMetrics::Snapshot snapshot;
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto &shard : shards_) {
+            for (size_t t = 0; t < QueryMetrics::STATEMENT_TYPE_COUNT; t++) {
+                auto &src = shard->types[t];
+                auto &dst = snapshot[t];
+                dst.count += src.count.load(std::memory_order_relaxed);
+                dst.errors += src.errors.load(std::memory_order_relaxed);
+                dst.latency_sum_us += src.latency_sum_us.load(std::memory_order_relaxed);
+                for (size_t b = 0; b < QueryMetrics::BUCKET_COUNT; b++) {
+                    dst.buckets[b] += src.buckets[b].load(std::memory_order_relaxed);
+                }
+            }
+        }
+        return snapshot;
+    }
+
+   private:
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<MetricsShard>> shards_;
+    std::vector<MetricsShard *> free_;
+};
+
+// never destroyed, threads may still exit after static destruction has started
+ShardRegistry &Registry() {
+    static ShardRegistry *registry = new ShardRegistry();
+    return *registry;
+}
+
+struct ThreadShard {
+    MetricsShard *shard = nullptr;
+
+    ~ThreadShard() {
+        if (shard != nullptr) {
+            Registry().Release(shard);
+        }
+    }
+
+    MetricsShard *Get() {
+        if (shard == nullptr) {
+            shard = Registry().Acquire();
+        }
+        return shard;
+    }
+};
+
+thread_local ThreadShard t_shard;
+
+}  // namespace
+
+constexpr std::array<uint64_t, 12> QueryMetrics::LATENCY_BUCKETS_US;
+
+void QueryMetrics::Record(StatementType type, uint64_t elapsed_us, bool failed) {
+    auto idx = static_cast<size_t>(type);
+    if (idx >= STATEMENT_TYPE_COUNT) {
+        idx = static_cast<size_t>(StatementType::INVALID_STATEMENT);
+    }
+    auto &counters = t_shard.Get()->types[idx];
+    auto bucket = std::lower_bound(LATENCY_BUCKETS_US.begin(), LATENCY_BUCKETS_US.end(), elapsed_us) -
+                  LATENCY_BUCKETS_US.begin();
+
+    Bump(counters.count, 1);
+    if (failed) {
+        Bump(counters.errors, 1);
+    }
+    Bump(counters.latency_sum_us, elapsed_us);
+    Bump(counters.buckets[bucket], 1);
+}
+
+QueryMetrics::Snapshot QueryMetrics::Collect() { return Registry().Sum(); }
@@ -1,77 +1,277 @@
 /*
-* Copyright (c) GBA-NCTI-ISDC. 2022-2024.
-*
-* openGauss embedded is licensed under Mulan PSL v2.
-* You can use this software according to the terms and conditions of the Mulan PSL v2.
-* You may obtain a copy of Mulan PSL v2 at:
-*
-* http://license.coscl.org.cn/MulanPSL2
-*
-* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
-* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
-* MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
-* See the Mulan PSL v2 for more details.
-* -------------------------------------------------------------------------
-*
-* stat.cpp
-*
-* IDENTIFICATION
-* openGauss-embedded/src/compute/sql/common/stat.cpp
-*
-* -------------------------------------------------------------------------
-*/
-
-#ifdef TIMESTAT
-#include <iostream>
+ * Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+ *
+ * openGauss embedded is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ * http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ *
+ * stat.cpp
+ *
+ * IDENTIFICATION
+ * openGauss-embedded/src/compute/sql/common/stat.cpp
+ *
+ * -------------------------------------------------------------------------
+ */
 #include "common/stat.h"
 
-std::mutex TimeStatistics::time_stat_mutex_;
+#include <fmt/format.h>
 
-std::unordered_map<std::string, int64_t> g_time_statistics;
-std::vector<std::string> g_tstat_keyorder;
-TimeStatistics::TimeStatistics() {
-    gettimeofday(&start_, NULL);
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "common/exception.h"
+#include "storage/gstor/zekernel/common/cm_file.h"
+#include "storage/gstor/zekernel/kernel/common/knl_session.h"
+
+std::atomic<bool> Tracer::enabled_{false};
+
+namespace {
+
+struct TraceSpan {
+    const char *name;
+    const char *category;
+    uint64_t start_ns;
+    uint64_t end_ns;
+};
+
+// written only by its owning thread. head counts every span ever recorded in the capture,
+// the slot of span i is i % RING_CAPACITY
+struct TraceRing {
+    uint32_t tid = 0;
+    std::atomic<uint64_t> capture{0};
+    std::atomic<uint64_t> head{0};
+    std::array<TraceSpan, Tracer::RING_CAPACITY> spans;
+};
+
+// rings outlive their threads and are handed to the next new thread, like the query metrics shards
+class RingRegistry {
+   public:
+    TraceRing *Acquire() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_.empty()) {
+            auto ring = free_.back();
+            free_.pop_back();
+            return ring;
+        }
+        rings_.push_back(std::make_unique<TraceRing>());
+        rings_.back()->tid = static_cast<uint32_t>(rings_.size());
+        return rings_.back().get();
+    }
+
+    void Release(TraceRing *ring) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_.push_back(ring);
+    }
+
+    // copies the spans recorded during the given capture, a span the owner was overwriting while
+    // it was copied is left out
+    std::vector<std::pair<uint32_t, TraceSpan>> Collect(uint64_t capture) {
+        std::vector<std::pair<uint32_t, TraceSpan>> result;
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto &ring : rings_) {
+            if (ring->capture.load(std::memory_order_acquire) != capture) {
+                continue;
+            }
+            auto end = ring->head.load(std::memory_order_acquire);
+            auto begin = end > Tracer::RING_CAPACITY ? end - Tracer::RING_CAPACITY : 0;
+            std::vector<TraceSpan> copy;
+            copy.reserve(end - begin);
+            for (auto i = begin; i < end; i++) {
+                copy.push_back(ring->spans[i % Tracer::RING_CAPACITY]);
+            }
+            auto overwritten = ring->head.load(std::memory_order_acquire) + 1;
+            auto first_valid = overwritten > Tracer::RING_CAPACITY ? overwritten - Tracer::RING_CAPACITY : 0;
+            for (auto i = std::max(begin, first_valid); i < end; i++) {
+                result.emplace_back(ring->tid, copy[i - begin]);
+            }
+        }
+        return result;
+    }
+
+   private:
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<TraceRing>> rings_;
+    std::vector<TraceRing *> free_;
+};
+
+// never destroyed, threads may still exit after static destruction has started
+RingRegistry &Registry() {
+    static RingRegistry *registry = new RingRegistry();
+    return *registry;
 }
 
-TimeStatistics::TimeStatistics(std::string func_name) {
-    gettimeofday(&start_, NULL);
-    func_name_ = func_name;
+struct ThreadRing {
+    TraceRing *ring = nullptr;
+    uint64_t wait_start_ns = 0;
+
+    ~ThreadRing() {
+        if (ring != nullptr) {
+            Registry().Release(ring);
+        }
+    }
+
+    TraceRing *Get() {
+        if (ring == nullptr) {
+            ring = Registry().Acquire();
+        }
+        return ring;
+    }
+};
+
+thread_local ThreadRing t_ring;
+
+// serializes Start and Stop, the recording path never takes it
+std::mutex g_control_mutex;
+std::atomic<uint64_t> g_capture{0};
+uint64_t g_capture_start_ns = 0;
+std::string g_trace_dir;
+
+// json is buffered and written in pieces of this size
+constexpr size_t TRACE_WRITE_CHUNK = 1024 * 1024;
+
+// kernel waits begin and end on the session's own thread and never nest
+void TraceKernelWait(wait_event_t event, bool32 begin) {
+    if (!Tracer::Enabled()) {
+        t_ring.wait_start_ns = 0;
+        return;
+    }
+    if (begin) {
+        t_ring.wait_start_ns = Tracer::NowNanos();
+    } else if (t_ring.wait_start_ns != 0) {
+        Tracer::Record(knl_get_event_desc(event)->name, TRACE_CAT_WAIT, t_ring.wait_start_ns, Tracer::NowNanos());
+        t_ring.wait_start_ns = 0;
+    }
+}
+
+void WriteJsonString(std::string &out, const char *text) {
+    out += '"';
+    for (auto p = text; *p != '\0'; p++) {
+        auto c = static_cast<unsigned char>(*p);
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += *p;
+        } else if (c < 0x20) {
+            out += fmt::format("\\u{:04x}", c);
+        } else {
+            out += *p;
+        }
+    }
+    out += '"';
 }
 
-void TimeStatistics::Record(std::string name) {
-    struct timeval record_point;
-    gettimeofday(&record_point, NULL);
-    times_.push_back({name, record_point});
+// the name is used below the trace directory only, so nothing may lead out of it
+bool IsPlainFileName(const std::string &name) {
+    return !name.empty() && name.find_first_of("/\\") == std::string::npos && name.find("..") == std::string::npos &&
+           name.size() <= GS_MAX_FILE_NAME_LEN;
 }
 
-TimeStatistics::~TimeStatistics() {
-    struct timeval end_point;
-    gettimeofday(&end_point, NULL);
-    int64_t cost = CalCostTime(&start_, &end_point);
-    std::lock_guard<std::mutex> lock(TimeStatistics::time_stat_mutex_);
-    if (g_time_statistics.find(func_name_) == g_time_statistics.end()){
-        g_time_statistics[func_name_] = cost;
-        g_tstat_keyorder.push_back(func_name_);
-    } else {
-        g_time_statistics[func_name_] += cost;
+// an existing file is never replaced, the caller may not overwrite what someone else left there
+int32 CreateTraceFile(const std::string &file_name) {
+    if (!IsPlainFileName(file_name)) {
+        throw intarkdb::Exception(ExceptionType::INVALID_INPUT,
+                                  fmt::format("trace file {} must be a file name without a directory", file_name));
+    }
+    if (g_trace_dir.empty()) {
+        throw intarkdb::Exception(ExceptionType::IO, "no database is open to hold the trace file");
+    }
+    if (!cm_dir_exist(g_trace_dir.c_str()) && cm_create_dir_ex(g_trace_dir.c_str()) != GS_SUCCESS) {
+        cm_reset_error();
+        throw intarkdb::Exception(ExceptionType::IO, fmt::format("can not create trace directory {}", g_trace_dir));
     }
+    auto path = g_trace_dir + "/" + file_name;
+    int32 file = GS_NULL_FILE;
+    if (cm_open_file(path.c_str(), O_CREAT | O_EXCL | O_WRONLY | O_BINARY, &file) != GS_SUCCESS) {
+        cm_reset_error();
+        throw intarkdb::Exception(ExceptionType::IO, fmt::format("can not create trace file {}", path));
+    }
+    return file;
 }
 
-void TimeStatistics::Print() {
-    std::cout << times_[0].first << " cost: " << CalCostTime(&start_, &times_[0].second) << " us" << std::endl;
-    for (size_t i=1;i<times_.size();i++) {
-        std::cout << times_[i].first << " cost: " << CalCostTime(&times_[i-1].second, &times_[i].second) << " us" << std::endl;
+void WriteTraceChunk(int32 file, std::string &out, size_t min_size) {
+    if (out.size() < min_size) {
+        return;
+    }
+    if (cm_write_file(file, out.data(), static_cast<int32>(out.size())) != GS_SUCCESS) {
+        cm_reset_error();
+        cm_close_file(file);
+        throw intarkdb::Exception(ExceptionType::IO, "can not write trace file");
     }
+    out.clear();
 }
 
-int64_t TimeStatistics::CalCostTime(struct timeval *begin_time, struct timeval *end_time) {
-    return (end_time->tv_sec*1000000+end_time->tv_usec) - (begin_time->tv_sec*1000000+begin_time->tv_usec);
+}  // namespace
+
+bool Tracer::Start() {
+    std::lock_guard<std::mutex> lock(g_control_mutex);
+    if (enabled_.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    g_knl_callback.trace_wait = TraceKernelWait;
+    g_capture_start_ns = NowNanos();
+    g_capture.fetch_add(1, std::memory_order_release);
+    enabled_.store(true, std::memory_order_release);
+    return true;
 }
 
-void TimeStatisticsPrint() {
-    for (auto& key : g_tstat_keyorder) {
-        std::cout << key << " cost: " << g_time_statistics[key] << " us" << std::endl;
+void Tracer::SetHome(const std::string &home) {
+    std::lock_guard<std::mutex> lock(g_control_mutex);
+    if (g_trace_dir.empty()) {
+        g_trace_dir = home + "/trace";
     }
 }
 
-#endif
\ No newline at end of file
+uint64_t Tracer::Stop(const std::string &file_name) {
+    std::lock_guard<std::mutex> lock(g_control_mutex);
+    auto file = CreateTraceFile(file_name);
+    enabled_.store(false, std::memory_order_release);
+    // moving on to the next capture id also keeps a second Stop from writing the same spans again
+    auto spans = Registry().Collect(g_capture.fetch_add(1, std::memory_order_acq_rel));
+
+    // chrome trace event format, complete events with microsecond timestamps from the capture start
+    std::string out = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    uint64_t written = 0;
+    for (const auto &[tid, span] : spans) {
+        if (span.start_ns < g_capture_start_ns) {
+            continue;
+        }
+        out += written == 0 ? "\n{\"name\":" : ",\n{\"name\":";
+        WriteJsonString(out, span.name);
+        out += ",\"cat\":";
+        WriteJsonString(out, span.category);
+        out += fmt::format(",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,\"tid\":{}}}",
+                           (span.start_ns - g_capture_start_ns) / 1e3, (span.end_ns - span.start_ns) / 1e3, tid);
+        written++;
+        WriteTraceChunk(file, out, TRACE_WRITE_CHUNK);
+    }
+    out += "\n]}\n";
+    WriteTraceChunk(file, out, 0);
+    cm_close_file(file);
+    return written;
+}
+
+void Tracer::Record(const char *name, const char *category, uint64_t start_ns, uint64_t end_ns) {
+    // a scope that outlived the capture is dropped, it would otherwise open the next one
+    if (!Enabled()) {
+        return;
+    }
+    auto ring = t_ring.Get();
+    auto capture = g_capture.load(std::memory_order_acquire);
+    if (ring->capture.load(std::memory_order_relaxed) != capture) {
+        ring->head.store(0, std::memory_order_relaxed);
+        ring->capture.store(capture, std::memory_order_release);
+    }
+    auto head = ring->head.load(std::memory_order_relaxed);
+    ring->spans[head % RING_CAPACITY] = {name, category, start_ns, end_ns};
+    ring->head.store(head + 1, std::memory_order_release);
+}
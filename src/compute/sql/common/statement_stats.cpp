@@ -0,0 +1,212 @@
+/*
+* Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+*
+* openGauss embedded is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+* http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+*
+* statement_stats.cpp
+*
+* IDENTIFICATION
+* openGauss-embedded/src/compute/sql/common/statement_stats.cpp
+*
+* -------------------------------------------------------------------------
+*/
+#include "common/statement_stats.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <functional>
+
+// normalized text kept per entry, the fingerprint id still covers the whole statement
+static constexpr size_t MAX_TEXT_LENGTH = 1024;
+
+uint32_t LatencyHistogram::BucketOf(uint64_t value_us) {
+    if (value_us < LINEAR_BUCKETS) {
+        return static_cast<uint32_t>(value_us);
+    }
+    if ((value_us >> MAX_EXPONENT) != 0) {
+        return BUCKET_COUNT - 1;
+    }
+    uint32_t exponent = 3;
+    while ((value_us >> (exponent + 1)) != 0) {
+        exponent++;
+    }
+    // the two bits below the leading one pick the sub bucket
+    uint32_t sub = static_cast<uint32_t>(value_us >> (exponent - 2)) & (SUB_BUCKETS - 1);
+    return LINEAR_BUCKETS + (exponent - 3) * SUB_BUCKETS + sub;
+}
+
+uint64_t LatencyHistogram::BucketUpperBound(uint32_t bucket) {
+    if (bucket < LINEAR_BUCKETS) {
+        return bucket;
+    }
+    uint32_t exponent = 3 + (bucket - LINEAR_BUCKETS) / SUB_BUCKETS;
+    uint64_t sub = (bucket - LINEAR_BUCKETS) % SUB_BUCKETS;
+    return ((SUB_BUCKETS + sub + 1) << (exponent - 2)) - 1;
+}
+
+void LatencyHistogram::Record(uint64_t value_us) {
+    counts_[BucketOf(value_us)]++;
+    total_++;
+}
+
+uint64_t LatencyHistogram::Percentile(double fraction) const {
+    if (total_ == 0) {
+        return 0;
+    }
+    auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(fraction * total_)));
+    uint64_t seen = 0;
+    for (uint32_t b = 0; b < BUCKET_COUNT; b++) {
+        seen += counts_[b];
+        if (seen >= rank) {
+            return BucketUpperBound(b);
+        }
+    }
+    return BucketUpperBound(BUCKET_COUNT - 1);
+}
+
+static bool IsIdentifierChar(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '$' || static_cast<unsigned char>(c) >= 0x80;
+}
+
+// literals become '?', comments and runs of spaces become a single space, the rest is lower cased
+// except quoted identifiers
+StatementFingerprint StatementStats::Fingerprint(const std::string &sql) {
+    std::string text;
+    text.reserve(sql.size());
+    bool pending_space = false;
+    auto emit = [&](char c) {
+        if (pending_space && !text.empty()) {
+            text.push_back(' ');
+        }
+        pending_space = false;
+        text.push_back(c);
+    };
+
+    size_t i = 0;
+    size_t n = sql.size();
+    while (i < n) {
+        char c = sql[i];
+        char next = i + 1 < n ? sql[i + 1] : '\0';
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            pending_space = true;
+            i++;
+        } else if (c == '-' && next == '-') {
+            while (i < n && sql[i] != '\n') {
+                i++;
+            }
+            pending_space = true;
+        } else if (c == '/' && next == '*') {
+            auto end = sql.find("*/", i + 2);
+            i = end == std::string::npos ? n : end + 2;
+            pending_space = true;
+        } else if (c == '\'') {
+            for (i++; i < n; i++) {
+                if (sql[i] == '\'') {
+                    if (i + 1 < n && sql[i + 1] == '\'') {
+                        i++;
+                        continue;
+                    }
+                    i++;
+                    break;
+                }
+            }
+            emit('?');
+        } else if (c == '"') {
+            emit(c);
+            for (i++; i < n; i++) {
+                text.push_back(sql[i]);
+                if (sql[i] == '"') {
+                    i++;
+                    break;
+                }
+            }
+        } else if ((std::isdigit(static_cast<unsigned char>(c)) ||
+                    (c == '.' && std::isdigit(static_cast<unsigned char>(next)))) &&
+                   (pending_space || text.empty() || !IsIdentifierChar(text.back()))) {
+            for (i++; i < n; i++) {
+                char d = sql[i];
+                bool exponent_sign = (d == '+' || d == '-') && (sql[i - 1] == 'e' || sql[i - 1] == 'E');
+                if (!std::isalnum(static_cast<unsigned char>(d)) && d != '.' && !exponent_sign) {
+                    break;
+                }
+            }
+            emit('?');
+        } else {
+            emit(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+            i++;
+        }
+    }
+    while (!text.empty() && (text.back() == ';' || text.back() == ' ')) {
+        text.pop_back();
+    }
+
+    StatementFingerprint fingerprint;
+    fingerprint.id = std::hash<std::string>()(text);
+    fingerprint.text = std::move(text);
+    return fingerprint;
+}
+
+StatementStats &StatementStats::GetInstance() {
+    // never destroyed, statements may still finish while the process exits
+    static StatementStats *stats = new StatementStats();
+    return *stats;
+}
+
+void StatementStats::Record(const StatementFingerprint &fingerprint, uint64_t elapsed_us, uint64_t rows,
+                            bool failed) {
+    auto &stripe = stripes_[fingerprint.id % STRIPE_COUNT];
+    std::lock_guard<std::mutex> lock(stripe.mutex);
+    auto iter = stripe.entries.find(fingerprint.id);
+    if (iter == stripe.entries.end()) {
+        if (stripe.entries.size() >= MAX_ENTRIES / STRIPE_COUNT) {
+            auto victim = std::min_element(
+                stripe.entries.begin(), stripe.entries.end(),
+                [](const auto &a, const auto &b) { return a.second.last_call < b.second.last_call; });
+            stripe.entries.erase(victim);
+        }
+        iter = stripe.entries.emplace(fingerprint.id, StatementStatsEntry()).first;
+        iter->second.text = fingerprint.text.substr(0, MAX_TEXT_LENGTH);
+    }
+
+    auto &entry = iter->second;
+    entry.calls++;
+    entry.last_call = ++stripe.tick;
+    if (failed) {
+        entry.errors++;
+    }
+    entry.total_time_us += elapsed_us;
+    entry.min_time_us = std::min(entry.min_time_us, elapsed_us);
+    entry.max_time_us = std::max(entry.max_time_us, elapsed_us);
+    entry.rows += rows;
+    entry.latency.Record(elapsed_us);
+}
+
+std::vector<std::pair<uint64_t, StatementStatsEntry>> StatementStats::Snapshot() {
+    std::vector<std::pair<uint64_t, StatementStatsEntry>> result;
+    for (auto &stripe : stripes_) {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        result.insert(result.end(), stripe.entries.begin(), stripe.entries.end());
+    }
+    return result;
+}
+
+uint64_t StatementStats::Reset() {
+    uint64_t count = 0;
+    for (auto &stripe : stripes_) {
+        std::lock_guard<std::mutex> lock(stripe.mutex);
+        count += stripe.entries.size();
+        stripe.entries.clear();
+    }
+    return count;
+}
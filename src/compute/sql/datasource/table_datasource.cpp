@@ -33,6 +33,7 @@
 #include "storage/db_handle.h"
 #include "storage/gstor/gstor_executor.h"
 #include "storage/gstor/zekernel/common/cm_log.h"
+#include "storage/gstor/zekernel/common/cm_timezone.h"
 #include "type/type_id.h"
 #include "type/type_system.h"
 #include "common/stat.h"
@@ -120,6 +121,7 @@ static auto InitCondition(const IndexMatchInfo& info, std::vector<Value>& cache_
 }
 
 auto TableDataSource::Init() -> void {
+    index_inited_ = true;
     // preapre index match info
     if (!index_bind_data_.use_index) {
         return;
@@ -171,12 +173,14 @@ auto TableDataSource::CommonTableNext() -> std::tuple<intarkdb::RowContainerPtr,
             throw std::runtime_error("open table fail");
         }
         if (idx_slot_ != GS_INVALID_ID32) {
-            ret = gstor_open_cursor_ex(((db_handle_t*)handle_)->handle, table_name.c_str(), index_column_count_,
-                                       condition_count_, conditions_.data(), &eof, idx_slot_, action_, idx_,
-                                       lock_clause_);
+            ret = TRACE_STORAGE_CALL("gstor_open_cursor_ex",
+                                     gstor_open_cursor_ex(((db_handle_t*)handle_)->handle, table_name.c_str(),
+                                                          index_column_count_, condition_count_, conditions_.data(),
+                                                          &eof, idx_slot_, action_, idx_, lock_clause_));
         } else {
-            ret = gstor_open_cursor_ex(((db_handle_t*)handle_)->handle, table_name.c_str(), 0, 0, nullptr, &eof, -1,
-                                       action_, idx_, lock_clause_);
+            ret = TRACE_STORAGE_CALL("gstor_open_cursor_ex",
+                                     gstor_open_cursor_ex(((db_handle_t*)handle_)->handle, table_name.c_str(), 0, 0,
+                                                          nullptr, &eof, -1, action_, idx_, lock_clause_));
         }
         if (ret != GS_SUCCESS) {
             throw std::runtime_error("fail to open cursor");
@@ -184,7 +188,7 @@ auto TableDataSource::CommonTableNext() -> std::tuple<intarkdb::RowContainerPtr,
         first_ = false;
     }
 
-    auto ret = gstor_cursor_next(((db_handle_t*)handle_)->handle, &eof, idx_);
+    auto ret = TRACE_STORAGE_CALL("gstor_cursor_next", gstor_cursor_next(((db_handle_t*)handle_)->handle, &eof, idx_));
     if (ret != GS_SUCCESS) {
         int32_t err_code;
         const char* message = nullptr;
@@ -198,8 +202,10 @@ auto TableDataSource::CommonTableNext() -> std::tuple<intarkdb::RowContainerPtr,
         first_ = true;
     } else {
         scan_count_++;
-        ret = gstor_cursor_fetch(((db_handle_t*)handle_)->handle, col_size,
-                                 const_cast<exp_column_def_t*>(col_defs.data()), &res_row_count, &res_row_list, idx_);
+        ret = TRACE_STORAGE_CALL("gstor_cursor_fetch",
+                                 gstor_cursor_fetch(((db_handle_t*)handle_)->handle, col_size,
+                                                    const_cast<exp_column_def_t*>(col_defs.data()), &res_row_count,
+                                                    &res_row_list, idx_));
         if (ret != GS_SUCCESS) {
             throw std::runtime_error("fail to get table data");
         }
@@ -234,12 +240,14 @@ auto TableDataSource::PartitionTableNext() -> std::tuple<intarkdb::RowContainerP
             throw std::runtime_error("open table fail");
         }
         if (idx_slot_ != GS_INVALID_ID32) {
-            ret = gstor_open_cursor_ex(((db_handle_t*)handle_)->handle, table_name.c_str(), index_column_count_,
-                                       condition_count_, conditions_.data(), &eof, idx_slot_, action_, idx_,
-                                       lock_clause_);
+            ret = TRACE_STORAGE_CALL("gstor_open_cursor_ex",
+                                     gstor_open_cursor_ex(((db_handle_t*)handle_)->handle, table_name.c_str(),
+                                                          index_column_count_, condition_count_, conditions_.data(),
+                                                          &eof, idx_slot_, action_, idx_, lock_clause_));
         } else {
-            ret = gstor_open_cursor_ex(((db_handle_t*)handle_)->handle, table_name.c_str(), 0, 0, nullptr, &eof, -1,
-                                       action_, idx_, lock_clause_);
+            ret = TRACE_STORAGE_CALL("gstor_open_cursor_ex",
+                                     gstor_open_cursor_ex(((db_handle_t*)handle_)->handle, table_name.c_str(), 0, 0,
+                                                          nullptr, &eof, -1, action_, idx_, lock_clause_));
         }
         if (ret != GS_SUCCESS) {
             throw std::runtime_error("fail to open cursor");
@@ -247,7 +255,7 @@ auto TableDataSource::PartitionTableNext() -> std::tuple<intarkdb::RowContainerP
         first_ = false;
     }
 
-    auto ret = gstor_cursor_next(((db_handle_t*)handle_)->handle, &eof, idx_);
+    auto ret = TRACE_STORAGE_CALL("gstor_cursor_next", gstor_cursor_next(((db_handle_t*)handle_)->handle, &eof, idx_));
     if (eof == GS_TRUE) {
         scan_partition_no_++;
         if (scan_partition_no_ < meta.GetTablePartCount()) {
@@ -259,8 +267,10 @@ auto TableDataSource::PartitionTableNext() -> std::tuple<intarkdb::RowContainerP
     }
     scan_count_++;
 
-    ret = gstor_cursor_fetch(((db_handle_t*)handle_)->handle, col_size, const_cast<exp_column_def_t*>(col_defs.data()),
-                             &res_row_count, &res_row_list, idx_);
+    ret = TRACE_STORAGE_CALL("gstor_cursor_fetch",
+                             gstor_cursor_fetch(((db_handle_t*)handle_)->handle, col_size,
+                                                const_cast<exp_column_def_t*>(col_defs.data()), &res_row_count,
+                                                &res_row_list, idx_));
     if (ret != GS_SUCCESS) {
         throw std::runtime_error("fail to get table data");
     }
@@ -300,8 +310,9 @@ void TableDataSource::Insert(const std::vector<Column>& columns) {
     }
 
     //
-    ret = gstor_executor_insert_row(((db_handle_t*)handle_)->handle, table_name.c_str(), column_count,
-                                    row_column_list_.get());
+    ret = TRACE_STORAGE_CALL("gstor_executor_insert_row",
+                             gstor_executor_insert_row(((db_handle_t*)handle_)->handle, table_name.c_str(),
+                                                       column_count, row_column_list_.get()));
     if (ret != GS_SUCCESS) {
         int32_t err_code;
         const char* message = nullptr;
@@ -316,7 +327,6 @@ void TableDataSource::Insert(const std::vector<Column>& columns) {
 void TableDataSource::BatchInsert(std::vector<std::vector<Column>>& insert_rows,
                                 const std::string &part_name, uint32_t part_no,
                                 bool32 is_ignore) {
-    TIMESTATISTICS;
     const auto& table_name = table_->GetBoundTableName();
     uint32_t row_count = insert_rows.size();
     uint32_t column_count = insert_rows[0].size();
@@ -331,8 +341,9 @@ void TableDataSource::BatchInsert(std::vector<std::vector<Column>>& insert_rows,
         row_list[row_i].row_column_list = row_column_list.data();
     }
 
-    auto ret = gstor_batch_insert_row(((db_handle_t*)handle_)->handle, table_name.c_str(), row_count, row_list.get(),
-                                        part_no, is_ignore);
+    auto ret = TRACE_STORAGE_CALL("gstor_batch_insert_row",
+                                  gstor_batch_insert_row(((db_handle_t*)handle_)->handle, table_name.c_str(), row_count,
+                                                         row_list.get(), part_no, is_ignore));
     if (ret != GS_SUCCESS) {
         int32_t err_code;
         const char* message = nullptr;
@@ -351,8 +362,9 @@ void TableDataSource::BatchInsert(std::vector<std::vector<Column>>& insert_rows,
                 throw std::runtime_error("refresh part_no fail");
             }
 
-            ret = gstor_batch_insert_row(((db_handle_t*)handle_)->handle, table_name.c_str(), row_count, row_list.get(),
-                                         part_no, is_ignore);
+            ret = TRACE_STORAGE_CALL("gstor_batch_insert_row",
+                                     gstor_batch_insert_row(((db_handle_t*)handle_)->handle, table_name.c_str(),
+                                                            row_count, row_list.get(), part_no, is_ignore));
             if (ret != GS_SUCCESS) {
                 cm_get_error(&err_code, &message, nullptr);
                 std::string msg = message;
@@ -371,7 +383,8 @@ void TableDataSource::BatchInsert(std::vector<std::vector<Column>>& insert_rows,
 }
 
 void TableDataSource::Delete() {
-    auto ret = gstor_executor_delete(((db_handle_t*)handle_)->handle, idx_);
+    auto ret =
+        TRACE_STORAGE_CALL("gstor_executor_delete", gstor_executor_delete(((db_handle_t*)handle_)->handle, idx_));
     if (ret != GS_SUCCESS) {
         int32_t err_code;
         const char* message = nullptr;
@@ -384,7 +397,8 @@ void TableDataSource::Delete() {
 }
 
 void TableDataSource::Update(int column_count, exp_column_def_t* column_list) {
-    auto ret = gstor_executor_update(((db_handle_t*)handle_)->handle, column_count, column_list, idx_);
+    auto ret = TRACE_STORAGE_CALL("gstor_executor_update", gstor_executor_update(((db_handle_t*)handle_)->handle,
+                                                                                 column_count, column_list, idx_));
     if (ret != GS_SUCCESS) {
         int32_t err_code;
         const char* message = nullptr;
@@ -409,6 +423,52 @@ auto TableDataSource::NeedParitionScan() const -> bool {
            (IsParitionTable() && idx_slot_ == GS_INVALID_ID32);
 }
 
+auto TableDataSource::PartitionLowerBound(size_t col_idx) const -> std::optional<Value> {
+    const auto& table_info = table_->GetTableInfo();
+    const auto& meta = table_info.GetTableMetaInfo();
+    if (!NeedParitionScan() || !table_info.IsTimeScale() || meta.part_table.desc.parttype != PART_TYPE_RANGE ||
+        meta.part_table.desc.partkeys != 1 || meta.part_table.keycols[0].column_id != col_idx ||
+        col_idx >= meta.column_count || meta.columns[col_idx].col_type != GS_TYPE_TIMESTAMP) {
+        return std::nullopt;
+    }
+    // crosspart 表整批写入第一行所在的分区, 分区内的行可能早于分区下界
+    if (meta.part_table.desc.is_crosspart) {
+        return std::nullopt;
+    }
+    // 分区按上界有序, 前一个分区的上界即当前分区的下界
+    if (scan_partition_no_ == 0 || scan_partition_no_ > table_info.GetTablePartCount()) {
+        return std::nullopt;
+    }
+    auto prev = table_info.GetTablePartByIdx(scan_partition_no_ - 1);
+    if (prev == NULL || prev->desc.hiboundval.str == NULL) {
+        return std::nullopt;
+    }
+    // 分区上界是按本地时区 mktime 得到的秒数, 先还原成墙上时间, 再按数据库时区换算成存储的时间戳
+    time_t hibound = ::atoll(prev->desc.hiboundval.str) / MICROSECS_PER_SECOND_LL;
+    struct tm hibound_tm;
+    if (localtime_r(&hibound, &hibound_tm) == NULL) {
+        return std::nullopt;
+    }
+    timestamp_stor_t bound;
+    bound.ts = (static_cast<int64_t>(hibound) + hibound_tm.tm_gmtoff) * MICROSECS_PER_SECOND_LL -
+               TIMEZONE_GET_MICROSECOND(cm_get_db_timezone());
+    return ValueFactory::ValueTimeStamp(bound);
+}
+
+auto TableDataSource::IndexOrder() const -> std::vector<size_t> {
+    auto slot = idx_slot_;
+    if (!index_inited_ && index_bind_data_.use_index) {
+        slot = index_bind_data_.index_slot;
+    }
+    const auto& meta = table_->GetTableInfo().GetTableMetaInfo();
+    // 分区索引只在每个分区内有序
+    if (slot == GS_INVALID_ID32 || slot >= meta.index_count || (IsParitionTable() && IsParitionIndex(slot))) {
+        return {};
+    }
+    const auto& index = meta.indexes[slot];
+    return std::vector<size_t>(index.col_ids, index.col_ids + index.col_count);
+}
+
 int32_t TableDataSource::AutoAddPartition(std::string table_name, std::string part_key, part_type_t part_type) {
     std::string part_name = table_name + "_" + part_key;
     exp_altable_def_t altable_def;
@@ -537,3 +537,112 @@ auto date_format(const std::vector<Value>& values) -> Value {
 
     return ValueFactory::ValueVarchar(result);
 }
+
+// statement eg : select time_bucket(INTERVAL 5 minute, ts), count(*) from a group by 1;
+// statement eg : select time_bucket('15 minutes', ts, '2024-01-01 00:05:00') from a;
+// TIME_BUCKET(INTERVAL, value, unit, ts [, origin]) 或 TIME_BUCKET('n unit', ts [, origin])
+// 返回ts所在分桶的起始时间, 分桶从origin开始按固定宽度划分, origin缺省为 2000-01-03 00:00:00 (周一)
+// 只支持固定宽度的单位: MICROSECOND、MILLISECOND、SECOND、MINUTE、HOUR、DAY、WEEK
+constexpr int64_t TIME_BUCKET_DEFAULT_ORIGIN = 946857600LL * MICROSECS_PER_SECOND_LL;  // 2000-01-03 00:00:00
+constexpr size_t TIME_BUCKET_INTERVAL_ARGS = 3;
+
+static auto TimeBucketUnitWidth(const std::string& unit_input) -> int64_t {
+    auto unit = intarkdb::StringUtil::Upper(unit_input);
+    if (unit.size() > 1 && unit.back() == 'S' && unit != "US" && unit != "MS") {
+        unit.pop_back();
+    }
+    if (unit == INTERVAL_TYPE_MICROSECOND || unit == "US") {
+        return 1;
+    } else if (unit == INTERVAL_TYPE_MILLISECOND || unit == "MS") {
+        return MICROSECS_PER_MILLISEC;
+    } else if (unit == INTERVAL_TYPE_SECOND || unit == "SEC" || unit == "S") {
+        return MICROSECS_PER_SECOND_LL;
+    } else if (unit == INTERVAL_TYPE_MINUTE || unit == "MIN" || unit == "M") {
+        return SECONDS_PER_MIN * MICROSECS_PER_SECOND_LL;
+    } else if (unit == INTERVAL_TYPE_HOUR || unit == "H") {
+        return SECONDS_PER_HOUR * MICROSECS_PER_SECOND_LL;
+    } else if (unit == INTERVAL_TYPE_DAY || unit == "D") {
+        return UNITS_PER_DAY;
+    } else if (unit == INTERVAL_TYPE_WEEK || unit == "W") {
+        return DAYS_OF_WEEK * UNITS_PER_DAY;
+    }
+    throw intarkdb::Exception(ExceptionType::EXECUTOR,
+                              "time_bucket function not support interval unit : " + unit_input +
+                                  ", must be a fixed width unit from MICROSECOND to WEEK");
+}
+
+// 'n unit' 形式的分桶宽度, 如 '5 minutes'、'1h'
+static auto TimeBucketParseWidth(const std::string& interval) -> std::pair<int64_t, std::string> {
+    size_t pos = 0;
+    while (pos < interval.size() && isspace(interval[pos])) {
+        pos++;
+    }
+    size_t num_begin = pos;
+    while (pos < interval.size() && isdigit(interval[pos])) {
+        pos++;
+    }
+    if (num_begin == pos) {
+        throw intarkdb::Exception(ExceptionType::EXECUTOR, "time_bucket function invalid interval : " + interval);
+    }
+    auto count = std::stoll(interval.substr(num_begin, pos - num_begin));
+    while (pos < interval.size() && isspace(interval[pos])) {
+        pos++;
+    }
+    auto unit = interval.substr(pos);
+    while (!unit.empty() && isspace(unit.back())) {
+        unit.pop_back();
+    }
+    return {count, unit};
+}
+
+static auto TimeBucketTimestamp(const Value& value, const std::string& name) -> int64_t {
+    Value ts_value = value;
+    if (ts_value.GetType() != GStorDataType::GS_TYPE_DATE && ts_value.GetType() != GStorDataType::GS_TYPE_TIMESTAMP) {
+        if (ts_value.GetType() != GStorDataType::GS_TYPE_VARCHAR) {
+            throw intarkdb::Exception(ExceptionType::EXECUTOR,
+                                      "time_bucket function parameter " + name + " is not a valid timestamp");
+        }
+        ts_value = DataType::GetTypeInstance(GStorDataType::GS_TYPE_TIMESTAMP)->CastValue(ts_value);
+    }
+    return ts_value.GetCastAs<timestamp_stor_t>().ts;
+}
+
+auto time_bucket(const std::vector<Value>& values) -> Value {
+    int64_t count = 0;
+    std::string unit;
+    size_t ts_idx = 0;
+    if (!values.empty() && values[0].GetType() == GStorDataType::GS_TYPE_VARCHAR &&
+        intarkdb::StringUtil::Upper(values[0].ToString()) == "INTERVAL" && values.size() > TIME_BUCKET_INTERVAL_ARGS) {
+        // INTERVAL 表达式被拆为3个value
+        count = DataType::GetTypeInstance(GStorDataType::GS_TYPE_BIGINT)->CastValue(values[1]).GetCastAs<int64_t>();
+        unit = values[2].ToString();
+        ts_idx = TIME_BUCKET_INTERVAL_ARGS;
+    } else if (!values.empty()) {
+        std::tie(count, unit) = TimeBucketParseWidth(values[0].ToString());
+        ts_idx = 1;
+    }
+    if (ts_idx == 0 || values.size() < ts_idx + 1 || values.size() > ts_idx + 2) {
+        throw intarkdb::Exception(ExceptionType::EXECUTOR,
+                                  "time_bucket function parameter number error, must be (interval, ts [, origin])");
+    }
+    if (count <= 0) {
+        throw intarkdb::Exception(ExceptionType::EXECUTOR, "time_bucket function interval must be greater than 0");
+    }
+    auto width = count * TimeBucketUnitWidth(unit);
+
+    if (values[ts_idx].IsNull() || (values.size() > ts_idx + 1 && values[ts_idx + 1].IsNull())) {
+        return ValueFactory::ValueNull(intarkdb::NewLogicalType(GStorDataType::GS_TYPE_TIMESTAMP));
+    }
+    auto ts = TimeBucketTimestamp(values[ts_idx], "ts");
+    // 缺省origin按本地时区对齐, 天和周的分桶从本地零点开始
+    int64_t origin = TIME_BUCKET_DEFAULT_ORIGIN - TIMEZONE_GET_MICROSECOND(cm_get_db_timezone());
+    if (values.size() > ts_idx + 1) {
+        origin = TimeBucketTimestamp(values[ts_idx + 1], "origin");
+    }
+
+    auto offset = (ts - origin) % width;
+    if (offset < 0) {
+        offset += width;
+    }
+    return ValueFactory::ValueTimeStamp(timestamp_stor_t{ts - offset});
+}
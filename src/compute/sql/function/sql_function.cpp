@@ -30,6 +30,8 @@
 #include "cm_date.h"
 #include "common/default_value.h"
 #include "common/exception.h"
+#include "common/stat.h"
+#include "common/statement_stats.h"
 #include "common/string_util.h"
 #include "function/date/date_function.h"
 #include "type/type_str.h"
@@ -613,6 +615,28 @@ auto sql_typeof(const std::vector<Value>& values) -> Value {
     return ValueFactory::ValueVarchar(fmt::format("{}", values[0].GetType()));
 }
 
+// forgets the statistics shown by dv_statements, returns how many statements were dropped
+auto sql_dv_statements_reset = [](const std::vector<Value>&) -> Value {
+    return ValueFactory::ValueBigInt(static_cast<int64_t>(StatementStats::GetInstance().Reset()));
+};
+
+// starts a trace capture, false if one is already running
+auto sql_trace_start = [](const std::vector<Value>& values) -> Value {
+    if (!values.empty()) {
+        throw intarkdb::Exception(ExceptionType::EXECUTOR, "trace_start function parameter number error");
+    }
+    return ValueFactory::ValueBool(Tracer::Start());
+};
+
+// ends the capture and writes it as chrome trace json to a new file of the trace directory below the
+// database home, returns the spans written
+auto sql_trace_stop = [](const std::vector<Value>& values) -> Value {
+    if (values.size() != 1 || values[0].IsNull()) {
+        throw intarkdb::Exception(ExceptionType::EXECUTOR, "trace_stop function needs the trace file name");
+    }
+    return ValueFactory::ValueBigInt(static_cast<int64_t>(Tracer::Stop(values[0].GetCastAs<std::string>())));
+};
+
 const char* INDEX_TYPE_PRI = "PRI";
 const char* INDEX_TYPE_UNI = "UNI";
 const char* INDEX_TYPE_MUL = "MUL";
@@ -670,6 +694,7 @@ const std::map<std::string, FuncInfo> SQLFunction::FUNC_MAP = {
     {"date_add", {date_add, GS_TYPE_VARCHAR}},
     {"date_sub", {date_sub, GS_TYPE_VARCHAR}},
     {"date_format", {date_format, GS_TYPE_VARCHAR}},
+    {"time_bucket", {time_bucket, GS_TYPE_TIMESTAMP}},
 
     // timestamp function
     {"now", {now, GS_TYPE_TIMESTAMP}},
@@ -696,6 +721,10 @@ const std::map<std::string, FuncInfo> SQLFunction::FUNC_MAP = {
     {"random", {sql_random, GS_TYPE_REAL}},
     // type function
     {"typeof",{sql_typeof,GS_TYPE_VARCHAR}},
+    // statistics function
+    {"dv_statements_reset", {sql_dv_statements_reset, GS_TYPE_BIGINT}},
+    {"trace_start", {sql_trace_start, GS_TYPE_BOOLEAN}},
+    {"trace_stop", {sql_trace_stop, GS_TYPE_BIGINT}},
 
     // 内置特殊函数
     {"_to_type_string", {sql_to_type_string, GS_TYPE_VARCHAR}},                    // typeId -> string
@@ -64,6 +64,7 @@
 #include "binder/table_ref/bound_subquery.h"
 #include "binder/over_clause.h"
 #include "catalog/catalog.h"
+#include "catalog/perf_view.h"
 #include "nodes/parsenodes.hpp"
 #include "nodes/pg_list.hpp"
 #include "pg_definitions.hpp"
@@ -93,6 +94,12 @@ class Binder {
     std::string GetUser() { return user_; }
     void SetUser(std::string user) { user_ = user; }
 
+    // continuous aggregate views read from their materialized table: schema.view -> query
+    void SetRollupViews(std::unordered_map<std::string, std::string> views) { rollup_views_ = std::move(views); }
+
+    // baseline for the delta columns of the dv_* performance views
+    void SetPerfViewSnapshot(PerfViewSnapshot *snapshot) { perf_snapshot_ = snapshot; }
+
     // bind statement
     auto BindSQLStmt(duckdb_libpgquery::PGNode *stmt) -> std::unique_ptr<BoundStatement>;
     auto BindColumnRef(duckdb_libpgquery::PGColumnRef *node) -> std::unique_ptr<BoundExpression>;
@@ -280,6 +287,9 @@ class Binder {
 
     uint32_t n_param_ = 0;
 
+    std::unordered_map<std::string, std::string> rollup_views_;
+    PerfViewSnapshot *perf_snapshot_ = nullptr;
+
     Binder *parent_binder_ = nullptr;
 
     bool check_column_exist_{true};  // FIXME: 应该显示在BindExpression函数中指定
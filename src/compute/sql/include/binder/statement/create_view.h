@@ -25,6 +25,7 @@
 #include "binder/bound_statement.h"
 #include "binder/statement/select_statement.h"
 #include "catalog/column.h"
+#include "main/continuous_aggregate.h"
 
 class CreateViewStatement : public BoundStatement {
    public:
@@ -35,6 +36,8 @@ class CreateViewStatement : public BoundStatement {
     std::unique_ptr<BoundStatement> getBoundSTMT() { return std::move(stmt_); }
 
     bool ignore_conflict{false};
+    // set for CREATE VIEW ... WITH (continuous)
+    ContinuousAggregatePtr continuous;
 
    private:
     std::string viewName_;
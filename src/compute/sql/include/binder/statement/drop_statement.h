@@ -35,4 +35,6 @@ class DropStatement : public BoundStatement {
     std::string name;
     bool if_exists = false;
     ObjectType type;
+    // the schema the object is dropped from, the current user unless the name is qualified
+    std::string schema;
 };
\ No newline at end of file
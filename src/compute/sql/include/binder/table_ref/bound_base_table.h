@@ -63,7 +63,7 @@ class BoundBaseTable : public BoundQuerySource {
     uint32_t GetSpaceId() const { return meta_->GetSpaceId(); }
 
     // user
-    std::string GetSchema() { return schema_; }
+    std::string GetSchema() const { return schema_; }
    private:
     // schema
     std::string schema_;
@@ -0,0 +1,49 @@
+/*
+* Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+*
+* openGauss embedded is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+* http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+*
+* perf_view.h
+*
+* IDENTIFICATION
+* openGauss-embedded/src/compute/sql/include/catalog/perf_view.h
+*
+* -------------------------------------------------------------------------
+*/
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+class Catalog;
+
+// counters seen by the previous read of each performance view, owned by a connection.
+// the delta columns of a view report the change since the same connection last read it.
+struct PerfViewSnapshot {
+    // view name -> counter key -> value at the previous read
+    std::unordered_map<std::string, std::unordered_map<std::string, uint64_t>> baselines;
+};
+
+// dv_* performance views over the kernel session statistics, wait events, buffer pool,
+// redo/checkpoint progress, lock waits and the statement statistics of common/statement_stats.h.
+// they are not stored in the dictionary: when a query names one, the binder reads the live
+// counters and binds the generated select instead.
+// the counters are taken at bind time, so a prepared statement over a view keeps its first snapshot.
+class PerfViewGenerator {
+   public:
+    static bool IsPerfView(const std::string &name);
+
+    // snapshot is nullable, without one the delta columns equal the cumulative counters
+    static std::string Query(const std::string &name, const Catalog &catalog, PerfViewSnapshot *snapshot);
+};
@@ -95,6 +95,8 @@ class TableInfo {
     uint32_t GetSpaceId() const { return meta_->space_id; }
     uint32_t GetTableId() const { return meta_->id; }
     bool IsTimeScale() const { return meta_->is_timescale == GS_TRUE; }
+    // the partition key has an hour part, YYYYMMDDHH, when the interval is shorter than a day, e.g. '1h'
+    bool IsHourlyPartition() const;
     std::string_view GetTableName() const { return table_name; }
 
     EXPORT_API const exp_column_def_t* GetColumnByName(const std::string& col_name) const;
@@ -0,0 +1,54 @@
+/*
+* Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+*
+* openGauss embedded is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+* http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+*
+* query_metrics.h
+*
+* IDENTIFICATION
+* openGauss-embedded/src/compute/sql/include/common/query_metrics.h
+*
+* -------------------------------------------------------------------------
+*/
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "binder/statement_type.h"
+#include "common/winapi.h"
+
+// process wide statement counters of the sql engine, fed by Connection::Query, Connection::QueryIterator
+// and PreparedStatement::Execute. every thread writes its own shard without locking, Collect sums the
+// shards, so the counters are monotonic but a scrape may miss statements finished at the same moment.
+class QueryMetrics {
+   public:
+    // upper bounds of the latency histogram buckets in microseconds, one more bucket catches the rest
+    static constexpr std::array<uint64_t, 12> LATENCY_BUCKETS_US = {
+        100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 1000000, 10000000};
+    static constexpr size_t BUCKET_COUNT = LATENCY_BUCKETS_US.size() + 1;
+    static constexpr size_t STATEMENT_TYPE_COUNT = static_cast<size_t>(StatementType::SYNONYM_STATEMENT) + 1;
+
+    struct TypeCounters {
+        uint64_t count{0};
+        uint64_t errors{0};
+        uint64_t latency_sum_us{0};
+        std::array<uint64_t, BUCKET_COUNT> buckets{};  // not cumulative
+    };
+
+    using Snapshot = std::array<TypeCounters, STATEMENT_TYPE_COUNT>;
+
+    EXPORT_API static void Record(StatementType type, uint64_t elapsed_us, bool failed);
+
+    EXPORT_API static Snapshot Collect();
+};
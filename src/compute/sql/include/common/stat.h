@@ -22,45 +22,81 @@
  */
 #pragma once
 
-#ifdef TIMESTAT
-#include <vector>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <string>
-#include <sys/time.h>
-#include <unistd.h>
-#include <unordered_map>
-#include <mutex>
 
 #include "common/winapi.h"
 
-extern std::unordered_map<std::string, int64_t> g_time_statistics;
-class TimeStatistics {
-public:
-    INTARKDB_EXTENSION_API TimeStatistics();
-    INTARKDB_EXTENSION_API TimeStatistics(std::string func_name);
+// categories of the trace events, shown as "cat" in the chrome trace viewer
+#define TRACE_CAT_PHASE "phase"
+#define TRACE_CAT_OPERATOR "operator"
+#define TRACE_CAT_STORAGE "gstor"
+#define TRACE_CAT_WAIT "wait"
 
-    INTARKDB_EXTENSION_API void Record(std::string name);
+// process wide tracer. every thread records into its own ring of the last RING_CAPACITY
+// spans, so nothing is shared on the recording path and a long capture keeps the newest spans.
+// while stopped a traced scope costs one relaxed load.
+class Tracer {
+   public:
+    static constexpr uint32_t RING_CAPACITY = 16384;
 
-    INTARKDB_EXTENSION_API ~TimeStatistics();
+    static bool Enabled() { return enabled_.load(std::memory_order_relaxed); }
 
-    void Print();
+    static uint64_t NowNanos() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
 
-    int64_t CalCostTime(struct timeval *begin_time, struct timeval *end_time);
+    // drops the spans of the previous capture and starts recording, false if already running
+    EXPORT_API static bool Start();
 
-private:
-    struct timeval start_; 
-    std::string func_name_;
-    std::vector<std::pair<std::string, struct timeval>> times_;
-    static std::mutex time_stat_mutex_;
+    // trace files go to the trace directory below this database home, the first database opened sets it
+    EXPORT_API static void SetHome(const std::string &home);
+
+    // stops recording and writes the capture as chrome trace json to a new file of the trace directory,
+    // returns the spans written. throws, and keeps recording, if the name is not a plain file name or the
+    // file already exists
+    EXPORT_API static uint64_t Stop(const std::string &file_name);
+
+    // name and category must be string literals or otherwise outlive the capture
+    EXPORT_API static void Record(const char *name, const char *category, uint64_t start_ns, uint64_t end_ns);
+
+   private:
+    static std::atomic<bool> enabled_;
+};
+
+class TraceScope {
+   public:
+    TraceScope(const char *name, const char *category)
+        : name_(name), category_(category), start_ns_(Tracer::Enabled() ? Tracer::NowNanos() : 0) {}
+
+    ~TraceScope() {
+        if (start_ns_ != 0) {
+            Tracer::Record(name_, category_, start_ns_, Tracer::NowNanos());
+        }
+    }
+
+    TraceScope(const TraceScope &) = delete;
+    TraceScope &operator=(const TraceScope &) = delete;
+
+   private:
+    const char *name_;
+    const char *category_;
+    uint64_t start_ns_;
 };
 
-INTARKDB_EXTENSION_API void TimeStatisticsPrint();
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
 
-#define TIMESTATISTICS TimeStatistics cost_stat(__func__)
-#define TIMESTATISTICSWITHNAME(name) TimeStatistics cost_stat(name)
-#define TIMESTATISTICSPRINT TimeStatisticsPrint()
-#else
-#define TIMESTATISTICS
-#define TIMESTATISTICSWITHNAME(name)
+// traces the enclosing scope as one span
+#define TRACE_SCOPE(name, category) TraceScope TRACE_CONCAT(trace_scope_, __LINE__)(name, category)
 
-#define TIMESTATISTICSPRINT
-#endif
+// traces one call into the storage engine and passes its result through
+#define TRACE_STORAGE_CALL(name, call)        \
+    ([&] {                                    \
+        TRACE_SCOPE(name, TRACE_CAT_STORAGE); \
+        return call;                          \
+    }())
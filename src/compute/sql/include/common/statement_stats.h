@@ -0,0 +1,107 @@
+/*
+* Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+*
+* openGauss embedded is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+* http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+*
+* statement_stats.h
+*
+* IDENTIFICATION
+* openGauss-embedded/src/compute/sql/include/common/statement_stats.h
+*
+* -------------------------------------------------------------------------
+*/
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/winapi.h"
+
+// statements with the same text once literals, comments and spacing are stripped
+struct StatementFingerprint {
+    uint64_t id{0};
+    std::string text;
+};
+
+// log-linear latency histogram in microseconds: exact below 8us, then four sub buckets per power of two,
+// so a percentile read from it is within 25% of the recorded value
+class LatencyHistogram {
+   public:
+    static constexpr uint32_t LINEAR_BUCKETS = 8;
+    static constexpr uint32_t SUB_BUCKETS = 4;
+    static constexpr uint32_t MAX_EXPONENT = 36;  // ~19 hours, longer calls share the last bucket
+    static constexpr uint32_t BUCKET_COUNT = LINEAR_BUCKETS + (MAX_EXPONENT - 3) * SUB_BUCKETS;
+
+    void Record(uint64_t value_us);
+    // upper bound of the bucket holding the given fraction of the calls, 0 when empty
+    uint64_t Percentile(double fraction) const;
+
+    static uint32_t BucketOf(uint64_t value_us);
+    static uint64_t BucketUpperBound(uint32_t bucket);
+
+   private:
+    uint64_t total_{0};
+    std::array<uint32_t, BUCKET_COUNT> counts_{};
+};
+
+struct StatementStatsEntry {
+    std::string text;
+    uint64_t calls{0};
+    uint64_t errors{0};
+    uint64_t total_time_us{0};
+    uint64_t min_time_us{UINT64_MAX};
+    uint64_t max_time_us{0};
+    uint64_t rows{0};
+    uint64_t last_call{0};  // tick of the stripe at the latest call
+    LatencyHistogram latency;
+};
+
+// per fingerprint statistics of the statements run through the sql engine, the counterpart of
+// pg_stat_statements read through the dv_statements view. entries live in striped maps so calls of
+// different statements rarely meet on a lock, and the entry of a stripe called least recently is
+// evicted when it is full, so a new statement is not pushed out by the ones that were hot long ago.
+class StatementStats {
+   public:
+    static constexpr size_t MAX_ENTRIES = 5000;
+
+    EXPORT_API static StatementStats &GetInstance();
+
+    EXPORT_API static StatementFingerprint Fingerprint(const std::string &sql);
+
+    EXPORT_API void Record(const StatementFingerprint &fingerprint, uint64_t elapsed_us, uint64_t rows,
+                           bool failed);
+
+    // copy of all entries keyed by fingerprint id
+    EXPORT_API std::vector<std::pair<uint64_t, StatementStatsEntry>> Snapshot();
+
+    // drops every entry, returns how many there were
+    EXPORT_API uint64_t Reset();
+
+   private:
+    static constexpr size_t STRIPE_COUNT = 16;
+
+    struct Stripe {
+        std::mutex mutex;
+        std::unordered_map<uint64_t, StatementStatsEntry> entries;
+        uint64_t tick{0};  // calls recorded in the stripe
+    };
+
+    StatementStats() = default;
+
+    std::array<Stripe, STRIPE_COUNT> stripes_;
+};
@@ -24,6 +24,7 @@
 
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <tuple>
 
@@ -125,6 +126,12 @@ class TableDataSource : public DataSource {
 
     auto CommonTableNext() -> std::tuple<intarkdb::RowContainerPtr, knl_cursor_t*, bool>;
 
+    // 按分区顺序扫描非 crosspart 的时序表时, 剩余的行在分区键上都不小于当前分区的下界
+    auto PartitionLowerBound(size_t col_idx) const -> std::optional<Value>;
+
+    // 非分区索引扫描按索引列有序返回, 初始化前按选定的索引预估
+    auto IndexOrder() const -> std::vector<size_t>;
+
     void Reset() {
         first_ = true;
         scan_count_ = 0;
@@ -146,6 +153,7 @@ class TableDataSource : public DataSource {
     std::vector<Value> cache_values_;
     IndexMatchInfo index_bind_data_;
     uint32_t idx_slot_{GS_INVALID_ID32};
+    bool index_inited_{false};
     int index_column_count_{0};
     int condition_count_{0};
     int scan_count_{0};  // 扫描行数
@@ -37,3 +37,4 @@ auto date_add(const std::vector<Value>& values) -> Value;
 auto date_sub(const std::vector<Value>& values) -> Value;
 bool IsDateFormatToken(const std::string &s);
 auto date_format(const std::vector<Value>& values) -> Value;
+auto time_bucket(const std::vector<Value>& values) -> Value;
@@ -32,9 +32,12 @@
 #include <functional>
 
 #include "common/winapi.h"
+#include "main/continuous_aggregate.h"
 #include "storage/db_handle.h"
 #include "storage/gstor/gstor_executor.h"
 
+class KvHashTables;
+
 struct StreamAggRunContext {
     std::mutex m;
     std::condition_variable cv;
@@ -63,6 +66,17 @@ class BaseStorage {
 
     uint64_t get_sql_engine_memory_limit();
 
+    std::shared_ptr<ContinuousAggregates> get_continuous_aggregates() { return continuous_aggregates_; }
+
+    // created by the kv layer on first use, the storage only keeps the tables alive until it closes
+    std::shared_ptr<KvHashTables> get_kv_hash_tables(const std::function<std::shared_ptr<KvHashTables>()>& create) {
+        std::lock_guard<std::mutex> guard(kv_hash_tables_mutex_);
+        if (kv_hash_tables_ == nullptr) {
+            kv_hash_tables_ = create();
+        }
+        return kv_hash_tables_;
+    }
+
     using StreamAggFunc = std::function<void(StreamAggRunContext&)>;
   
    private:
@@ -125,5 +139,12 @@ class BaseStorage {
 
     // database operation handle pool
     handle_pool_t handle_pool;
+
+    // continuous aggregates of this database
+    std::shared_ptr<ContinuousAggregates> continuous_aggregates_ = std::make_shared<ContinuousAggregates>();
+
+    // hash indexed memory kv tables of this database
+    std::mutex kv_hash_tables_mutex_;
+    std::shared_ptr<KvHashTables> kv_hash_tables_;
     
 };
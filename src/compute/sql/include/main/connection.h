@@ -23,12 +23,18 @@
 #pragma once
 
 #include <iostream>
+#include <map>
 #include <memory>
+#include <set>
+#include <unordered_map>
 
 #include "binder/statement/transaction_statement.h"
 #include "catalog/catalog.h"
+#include "catalog/perf_view.h"
 #include "common/record_batch.h"
 #include "common/record_streaming.h"
+#include "common/statement_stats.h"
+#include "main/continuous_aggregate.h"
 #include "main/database.h"
 #include "main/prepare_statement.h"
 #ifdef ENABLE_PG_QUERY
@@ -113,6 +119,11 @@ class Connection {
    
     void Rollback();
 
+    // continuous aggregate maintenance, see main/continuous_aggregate.h
+    void TrackContinuousAggregateSource(const BoundStatement& stmt, const PhysicalPlanPtr& plan);
+    void CollectContinuousAggregateInvalidation(const PhysicalPlanPtr& plan);
+    void PublishContinuousAggregateInvalidation();
+
    public:
     EXPORT_API void* GetStorageHandle() { return handle_; }
     std::weak_ptr<IntarkDB> GetStorageInstance() { return instance_; }
@@ -124,9 +135,23 @@ class Connection {
 
     UserInfo GetUser() const { return user_; }
 
+    // feeds QueryMetrics and StatementStats once a statement has finished
+    void RecordStatementMetrics(const StatementFingerprint& fingerprint, StatementType type, int64_t elapsed_us,
+                                RecordIterator& result);
+
    private:
     void SetBeginTransaction(TransactionType type);
 
+    // runs sql generated by the engine, the parse tree lives until the caller clears the parser
+    std::unique_ptr<RecordBatch> ExecuteInternal(const std::string& sql);
+
+    auto ContinuousAggregateRegistry() -> std::shared_ptr<ContinuousAggregates>;
+    void LoadContinuousAggregates(ContinuousAggregates& caggs);
+    auto PrepareContinuousAggregates(const ParsedStatement& stmt) -> ParsedStatement;
+    auto RefreshContinuousAggregate(ContinuousAggregates& caggs, const ContinuousAggregate& cagg) -> bool;
+    void CreateContinuousAggregate(const ContinuousAggregatePtr& cagg);
+    void DropContinuousAggregate(const std::string& schema, const std::string& view_name);
+
     std::weak_ptr<IntarkDB> instance_;
     void* handle_{NULL};
     int conn_id_;
@@ -144,4 +169,12 @@ class Connection {
     UserInfo user_;
 
     std::string path_;
+
+    // continuous aggregate views bound to their materialized table by the next BindSQLStmt, by schema.view
+    std::unordered_map<std::string, std::string> rollup_views_;
+    // counters seen by the previous read of each dv_* performance view
+    PerfViewSnapshot perf_snapshot_;
+    // source table partitions changed by the current transaction, published on commit, by (schema, table)
+    std::map<std::pair<std::string, std::string>, std::set<std::string>> pending_parts_;
+    std::set<std::pair<std::string, std::string>> pending_rebuild_;
 };
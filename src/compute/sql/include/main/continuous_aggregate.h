@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+ *
+ * openGauss embedded is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ * http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ *
+ * continuous_aggregate.h
+ *
+ * IDENTIFICATION
+ * openGauss-embedded/src/compute/sql/include/main/continuous_aggregate.h
+ *
+ * -------------------------------------------------------------------------
+ */
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace duckdb_libpgquery {
+struct PGViewStmt;
+struct PGSelectStmt;
+struct PGNode;
+};
+
+// CREATE VIEW v WITH (continuous) AS SELECT keys, aggs FROM <timescale table> GROUP BY keys
+//
+// The partial aggregate states of every source partition are materialized into table _cagg_<v>,
+// one row per (group keys, partition). Reading the view merges the partial states of all
+// partitions, inserts only invalidate the partitions they touched.
+//
+// Partial states are not merged as rows arrive. The first read after a commit recomputes every
+// invalidated partition from the raw rows of that partition, on the query path and under one
+// refresh mutex per database, so a reader following each insert batch still scans the whole
+// current hour or day. An UPDATE or DELETE of the source, or a restart, rebuilds the whole table.
+//
+// Source tables are identified by schema and name as the binder resolves them, the schema is the
+// one written in the statement or the current user.
+const std::string CAGG_OPTION = "continuous";
+const std::string CAGG_TABLE_PREFIX = "_cagg_";
+const std::string CAGG_PART_COLUMN = "_part";
+
+class ContinuousAggregate {
+   public:
+    // partial state kept in the materialized table, merged by SUM / MIN / MAX
+    struct State {
+        std::string func;  // count / sum / min / max
+        std::string arg;   // deparsed argument, "*" for count(*)
+    };
+
+    struct Target {
+        std::string name;
+        std::string func;  // empty for a group key
+        size_t key_idx = 0;
+        std::vector<size_t> states;
+    };
+
+    // throws if the view is not a supported continuous aggregate
+    static auto Create(const std::string& owner, const std::string& view_name, duckdb_libpgquery::PGViewStmt* stmt)
+        -> std::unique_ptr<ContinuousAggregate>;
+    static auto IsContinuous(duckdb_libpgquery::PGViewStmt* stmt) -> bool;
+    // (schema, lower cased name) of the tables and views a statement reads
+    static auto ReferencedTables(duckdb_libpgquery::PGNode* stmt, const std::string& default_schema)
+        -> std::set<std::pair<std::string, std::string>>;
+
+    const std::string& Owner() const { return owner_; }
+    const std::string& ViewName() const { return view_name_; }
+    const std::string& SourceSchema() const { return source_schema_; }
+    const std::string& SourceTable() const { return source_table_; }
+    const std::string& MaterializedTable() const { return mat_table_; }
+    // schema qualified and quoted, the materialized table lives in the schema of the view
+    auto MaterializedTableRef() const -> std::string;
+
+    // SELECT over the materialized table producing the view's rows
+    auto MaterializedQuery() const -> std::string;
+    // INSERT INTO the materialized table the partial states of one source partition
+    auto RefreshQuery(const std::string& time_column, const std::string& part_key, const std::string& lower,
+                      const std::string& upper) const -> std::string;
+    // partial state select used to derive the column types of the materialized table
+    auto PartialQuery() const -> std::string;
+    auto MaterializedColumnNames() const -> std::vector<std::string>;
+    // INSERT INTO the materialized table the partial states of every source partition
+    auto RebuildQuery(const std::string& time_column, bool hourly) const -> std::string;
+
+    // rewrite an aggregate query over the source table to read the materialized table,
+    // returns nullopt if the query can not be answered by this continuous aggregate
+    auto RewriteQuery(duckdb_libpgquery::PGSelectStmt* stmt, const std::string& default_schema) const
+        -> std::optional<std::string>;
+
+   private:
+    // column of the materialized table holding the idx-th group key
+    auto KeyColumn(size_t idx) const -> std::string;
+    auto KeyColumns() const -> std::string;
+    auto SourceTableRef() const -> std::string;
+    auto AddState(const std::string& func, const std::string& arg) -> size_t;
+    auto MergeExpr(const std::string& func, const std::vector<size_t>& states) const -> std::string;
+    auto FindState(const std::string& func, const std::string& arg) const -> std::optional<size_t>;
+
+    std::string owner_;
+    std::string view_name_;
+    std::string source_schema_;
+    std::string source_table_;
+    std::string mat_table_;
+    std::vector<std::string> keys_;
+    std::vector<State> states_;
+    std::vector<Target> targets_;
+};
+
+using ContinuousAggregatePtr = std::shared_ptr<ContinuousAggregate>;
+
+// continuous aggregates of one database, shared by all connections
+class ContinuousAggregates {
+   public:
+    // the registry is filled from SYS_VIEWS once per process by the first connection
+    bool Loaded() const { return loaded_; }
+    void SetLoaded() { loaded_ = true; }
+    bool Empty() const { return count_ == 0; }
+
+    // a registered continuous aggregate is rebuilt from all source partitions on first refresh. The
+    // invalidations are kept in memory only, so this is also what catches up with rows inserted
+    // before a restart that no refresh had seen yet
+    void Register(ContinuousAggregatePtr cagg);
+    void Unregister(const std::string& owner, const std::string& view_name);
+    auto Find(const std::string& owner, const std::string& view_name) -> ContinuousAggregatePtr;
+    auto FindBySource(const std::string& schema, const std::string& table) -> std::vector<ContinuousAggregatePtr>;
+
+    // called after commit with the partitions modified by the transaction
+    void Invalidate(const std::string& schema, const std::string& table, const std::set<std::string>& part_keys);
+    void InvalidateAll(const std::string& schema, const std::string& table);
+
+    // true if the materialized table matches the source table
+    auto IsClean(const ContinuousAggregate& cagg) -> bool;
+    // takes the pending partitions, the aggregate stays unclean until FinishRefresh
+    auto BeginRefresh(const ContinuousAggregate& cagg, std::set<std::string>& part_keys, bool& rebuild) -> bool;
+    // on failure the taken partitions are invalidated again
+    void FinishRefresh(const ContinuousAggregate& cagg, bool success, const std::set<std::string>& part_keys,
+                       bool rebuild);
+
+    // serializes the refresh of materialized tables
+    std::mutex& RefreshMutex() { return refresh_mutex_; }
+
+   private:
+    struct Entry {
+        ContinuousAggregatePtr cagg;
+        std::set<std::string> dirty_parts;
+        bool rebuild = true;
+        bool refreshing = false;
+    };
+
+    static auto Key(const std::string& owner, const std::string& name) -> std::string { return owner + "." + name; }
+
+    std::mutex mutex_;
+    std::mutex refresh_mutex_;
+    std::atomic<bool> loaded_{false};
+    std::atomic<size_t> count_{0};
+    std::map<std::string, Entry> entries_;
+};
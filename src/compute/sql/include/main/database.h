@@ -23,6 +23,7 @@
 #pragma once
 
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <stdexcept>
@@ -37,6 +38,8 @@ const uint32_t MAX_DB_INSTANCE_COUNT = 32;
 const std::string constant_db_name = "intarkdb";
 
 class BaseStorage;
+class ContinuousAggregates;
+class KvHashTables;
 
 namespace intarkdb {
 class IntarkDBInValidException : public std::runtime_error {
@@ -78,6 +81,11 @@ class IntarkDB {
 
     virtual int GetId(void* handle) = 0;
 
+    virtual std::shared_ptr<ContinuousAggregates> GetContinuousAggregates() = 0;
+    // create builds the tables on the first call for this database
+    virtual std::shared_ptr<KvHashTables> GetKvHashTables(
+        const std::function<std::shared_ptr<KvHashTables>()>& create) = 0;
+
     void SetLastInsertRowid(int64_t rowid) {
         cm_spin_lock(&last_insert_rowid_lock, NULL);
         last_insert_rowid = rowid;
@@ -23,6 +23,8 @@
 #pragma once
 
 #include "binder/bound_statement.h"
+#include "common/record_streaming.h"
+#include "common/statement_stats.h"
 #include "planner/expressions/column_param_expression.h"
 #include "planner/physical_plan/physical_plan.h"
 
@@ -63,6 +65,10 @@ class PreparedStatement {
     // !Execute
     EXPORT_API std::unique_ptr<RecordBatch> Execute(const std::vector<Value>& values);
 
+    // binds the values and returns an iterator over the result of a select instead of materializing it. The
+    // iterator shares the plan of the statement, it is invalidated by the next Execute/ExecuteStreaming
+    EXPORT_API std::unique_ptr<RecordStreaming> ExecuteStreaming(const std::vector<Value>& values);
+
     std::vector<const ColumnParamExpression*> params;
 
    public:
@@ -88,4 +94,7 @@ class PreparedStatement {
     uint64_t limit_rows_ex = 0;
 
     bool is_recordbatch_select = false;
+
+    // normalized sql_ for StatementStats, computed by the first Execute
+    StatementFingerprint fingerprint_;
 };
@@ -42,6 +42,7 @@ class DropPlan : public LogicalPlan {
     std::string name;
     bool if_exists = false;
     ObjectType type;
+    std::string schema;
 
    private:
     LogicalPlanPtr child_;
@@ -26,8 +26,10 @@
 #include <set>
 #include <vector>
 
+#include "common/distinct_keys.h"
 #include "common/hash_util.h"
 #include "common/memory/memory_manager.h"
+#include "function/aggregate/aggregate_func.h"
 #include "planner/expressions/column_value_expression.h"
 #include "planner/physical_plan/distinct_exec.h"
 #include "planner/physical_plan/physical_plan.h"
@@ -65,12 +67,20 @@ class AggregateExec : public PhysicalPlan {
         }
     }
 
-   private:
+   protected:
+    void InitAggFuncs();
+    auto GroupKey(const Record& record) const -> DistinctKey;
+    // first 为 true 时创建分组的聚合上下文, 否则累加到已有的上下文
+    void UpdateGroup(const Record& record, std::vector<AggContext>& ctxs, bool first);
+    // 输出一个分组的结果行
+    void EmitGroup(const DistinctKey& key, std::vector<AggContext>& ctxs, std::vector<Record>& out) const;
+
     Schema schema_;
     PhysicalPlanPtr child_;
     std::vector<std::unique_ptr<Expression>> groups_;     // 聚合条件
     std::vector<std::string> ops_;                        // 聚合函数字符串
     std::vector<std::unique_ptr<Expression>> be_groups_;  // 聚合函数表达式
+    std::vector<std::unique_ptr<AggFunc>> agg_funcs_;   // 与 be_groups_ 一对应多
     std::vector<Record> results_;
     size_t idx_{0};
     bool init_{false};
@@ -30,11 +30,12 @@
 
 class DropExec : public PhysicalPlan {
    public:
-    DropExec(const Catalog & catalog, std::string name, bool if_exists, ObjectType type)
+    DropExec(const Catalog & catalog, std::string name, bool if_exists, ObjectType type, std::string schema = "")
         : catalog_(const_cast<Catalog &>(catalog)),
         name(name),
         if_exists(if_exists),
-        type(type) {}
+        type(type),
+        drop_schema(schema) {}
 
     virtual Schema GetSchema() const override { return {schema_}; };
 
@@ -56,5 +57,7 @@ class DropExec : public PhysicalPlan {
     std::string name;
     bool if_exists = false;
     ObjectType type;
+    // empty for the current user
+    std::string drop_schema;
     Schema schema_;
 };
\ No newline at end of file
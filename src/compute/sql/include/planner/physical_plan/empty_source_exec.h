@@ -46,6 +46,7 @@ class EmptySourceExec : public PhysicalPlan {
     virtual std::string ToString() const override { return "EmptySourceExec"; }
 
     virtual auto Next() -> std::tuple<Record, knl_cursor_t*, bool> override {
+        TRACE_SCOPE("EmptySourceExec::Next", TRACE_CAT_OPERATOR);
         if (idx_ < total_count_) {
             ++idx_;
             return std::make_tuple(Record(), nullptr, false);
@@ -44,6 +44,7 @@ class FastScanExec : public PhysicalPlan {
     virtual std::string ToString() const override { return "FastScanExec"; }
 
     virtual auto Next() -> std::tuple<Record, knl_cursor_t*, bool> override {
+        TRACE_SCOPE("FastScanExec::Next", TRACE_CAT_OPERATOR);
         if (first_) {
             auto val = ValueFactory::ValueBigInt(source_->Rows());
             first_ = false;
@@ -40,6 +40,12 @@ class FilterExec : public PhysicalPlan {
 
     virtual auto Next() -> std::tuple<Record, knl_cursor_t*, bool> override;
 
+    virtual auto LowerBoundOf(size_t col_idx) const -> std::optional<Value> override {
+        return child_->LowerBoundOf(col_idx);
+    }
+
+    virtual auto OrderedBy() const -> std::vector<size_t> override { return child_->OrderedBy(); }
+
     virtual auto ResetNext() -> void override {
         child_->ResetNext();
         if (expr_) {
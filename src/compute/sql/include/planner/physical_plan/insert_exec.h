@@ -23,7 +23,9 @@
 #pragma once
 
 #include <map>
+#include <set>
 #include <unordered_set>
+#include <utility>
 
 #include "binder/statement/insert_statement.h"
 #include "datasource/table_datasource.h"
@@ -70,6 +72,15 @@ class InsertExec : public PhysicalPlan {
 
     void GetPartitionKey() ;
 
+    auto PartitionKeyOf(const Value &value) const -> std::string;
+
+    const std::string &GetTableName() const { return source_->GetTableRef().GetBoundTableName(); }
+    std::string GetSchemaName() const { return source_->GetTableRef().GetSchema(); }
+
+    // record the partition keys of inserted rows, used to invalidate continuous aggregates
+    void SetTrackPartitions(bool track) { track_partitions_ = track; }
+    auto TakeTouchedPartitions() -> std::set<std::string> { return std::exchange(touched_partitions_, {}); }
+
     void GetBoundValue(std::vector<Value> &row_in, std::vector<Column> &column_list, std::vector<Value> &autoincrement_list,
       std::vector<Value>& values) ;
 
@@ -103,7 +114,7 @@ class InsertExec : public PhysicalPlan {
     bool32 m_auto_addpart = GS_FALSE;
     bool32 m_is_crosspart = GS_FALSE;
     int32_t m_part_key_col_slot = -1;
-    std::string m_part_interval;
+    bool m_part_hourly = false;
     part_type_t m_part_type;
 
     std::string m_part_key_key_ = "-1";
@@ -117,5 +128,8 @@ class InsertExec : public PhysicalPlan {
 
     bool is_auto_commit_ = false;
 
+    bool track_partitions_ = false;
+    std::set<std::string> touched_partitions_;
+
     bool32 is_insert_or_ignore = GS_FALSE;
 };
@@ -66,6 +66,7 @@ class LimitExec : public PhysicalPlan {
     }
 
     virtual auto Next() -> std::tuple<Record, knl_cursor_t*, bool> override {
+        TRACE_SCOPE("LimitExec::Next", TRACE_CAT_OPERATOR);
         if (!init_) {
             Init();
         }
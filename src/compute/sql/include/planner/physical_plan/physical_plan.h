@@ -25,12 +25,14 @@
 #include <fmt/format.h>
 
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include "catalog/schema.h"
 #include "common/record_batch.h"
+#include "common/stat.h"
 
 class PhysicalPlan;
 using PhysicalPlanPtr = std::shared_ptr<PhysicalPlan>;
@@ -64,6 +66,14 @@ class PhysicalPlan {
 
     virtual void SetAutoCommit(bool auto_commit) {}
     virtual bool IsAutoCommit() { return false; }
+
+    // a value that every row not yet returned is greater than or equal to on column col_idx,
+    // nullopt if the plan knows nothing about the order of its output
+    virtual auto LowerBoundOf(size_t col_idx) const -> std::optional<Value> { return std::nullopt; }
+
+    // output columns the rows are sorted on, most significant first. rows with equal values
+    // on any prefix of these columns are returned adjacently
+    virtual auto OrderedBy() const -> std::vector<size_t> { return {}; }
 };
 
 template <typename T>
@@ -36,6 +36,10 @@ class ProjectionExec : public PhysicalPlan {
 
     virtual auto Next() -> std::tuple<Record, knl_cursor_t*, bool> override;
 
+    virtual auto LowerBoundOf(size_t col_idx) const -> std::optional<Value> override;
+
+    virtual auto OrderedBy() const -> std::vector<size_t> override;
+
     // depercated
     virtual auto Execute() const -> RecordBatch override { return RecordBatch({}); }
 
@@ -48,6 +48,12 @@ class SeqScanExec : public PhysicalPlan {
 
     virtual auto Next() -> std::tuple<Record, knl_cursor_t*, bool> override;
 
+    virtual auto LowerBoundOf(size_t col_idx) const -> std::optional<Value> override {
+        return source_->PartitionLowerBound(col_idx);
+    }
+
+    virtual auto OrderedBy() const -> std::vector<size_t> override { return source_->IndexOrder(); }
+
     void ResetNext() override {
         source_->Reset();
         for (auto& pred : predicates_) {
@@ -50,6 +50,9 @@ class ShowExec : public PhysicalPlan {
     void ShowAll(RecordBatch &rb_out);
     void ShowVariables(RecordBatch &rb_out);
     void ShowUsers(RecordBatch &rb_out);
+    void ShowRetention(RecordBatch &rb_out);
+    void ShowCommit(RecordBatch &rb_out);
+    void ShowKvExpire(RecordBatch &rb_out);
 
     std::string db_path;
     std::string variable_name_;
@@ -26,6 +26,7 @@
 
 #include "binder/bound_sort.h"
 #include "common/memory/memory_manager.h"
+#include "planner/expressions/column_value_expression.h"
 #include "planner/expressions/expression.h"
 #include "planner/physical_plan/physical_plan.h"
 
@@ -88,6 +89,7 @@ class SortExec : public PhysicalPlan {
     }
 
     virtual auto Next() -> std::tuple<Record, knl_cursor_t *, bool> override {
+        TRACE_SCOPE("SortExec::Next", TRACE_CAT_OPERATOR);
         if (!init_) {
             Init();
         }
@@ -98,6 +100,19 @@ class SortExec : public PhysicalPlan {
         return {Record{}, nullptr, true};
     }
 
+    virtual auto OrderedBy() const -> std::vector<size_t> override {
+        // 排序键中直接引用列的前缀
+        std::vector<size_t> order;
+        for (const auto &expr : exprs_) {
+            auto col = dynamic_cast<const ColumnValueExpression *>(expr.get());
+            if (col == nullptr) {
+                break;
+            }
+            order.push_back(col->GetColIdx());
+        }
+        return order;
+    }
+
     virtual void ResetNext() override {
         idx_ = 0;
         init_ = false;
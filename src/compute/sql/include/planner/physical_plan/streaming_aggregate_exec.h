@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+ *
+ * openGauss embedded is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ * http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ *
+ * streaming_aggregate_exec.h
+ *
+ * IDENTIFICATION
+ * openGauss-embedded/src/compute/sql/include/planner/physical_plan/streaming_aggregate_exec.h
+ *
+ * -------------------------------------------------------------------------
+ */
+#pragma once
+
+#include <optional>
+
+#include "planner/physical_plan/aggregate_exec.h"
+
+// 子节点的输出在分组键上有序时, 分组一经关闭立即输出并释放, 内存中只保留尚未关闭的分组。
+// 1. 分组键都是子节点按序返回的列(OrderedBy, 如索引扫描、SortExec), 分组键变化时关闭前一个分组;
+// 2. 分组键中有一个是子节点有序列的单调函数(如 time_bucket(interval, ts)), 子节点报告该列的
+//    下界(LowerBoundOf), 分组键小于 f(下界) 的分组不会再有新行。
+// 子节点在运行时不再有序(如索引条件初始化失败退化为全表扫描)时, 退化为 AggregateExec 的行为。
+class StreamingAggregateExec : public AggregateExec {
+   public:
+    // 按分组键有序的输入
+    StreamingAggregateExec(std::vector<std::unique_ptr<Expression>> groupby, std::vector<std::string> ops,
+                           std::vector<std::unique_ptr<Expression>> be_group, const std::vector<bool>& distincts,
+                           Schema schema, PhysicalPlanPtr child);
+    // 按 order_col 列的下界推进的输入
+    StreamingAggregateExec(std::vector<std::unique_ptr<Expression>> groupby, std::vector<std::string> ops,
+                           std::vector<std::unique_ptr<Expression>> be_group, const std::vector<bool>& distincts,
+                           Schema schema, PhysicalPlanPtr child, size_t order_col, size_t bucket_key_idx);
+
+    // 分组键都是列引用, 且恰好是 child 输出有序列的前缀
+    static auto IsGroupedInput(const std::vector<std::unique_ptr<Expression>>& groupby, const PhysicalPlan& child)
+        -> bool;
+
+    virtual std::string ToString() const override { return "StreamingAggregateExec"; }
+
+    virtual auto Next() -> std::tuple<Record, knl_cursor_t*, bool> override;
+
+   private:
+    void Start();
+    // 输出分组键小于 f(bound) 的分组
+    void CloseGroups(const Value& bound);
+
+    std::optional<size_t> order_col_;  // 子节点中有序的列
+    size_t bucket_key_idx_{0};         // 依赖 order_col_ 的分组键
+    bool sorted_{false};               // 输入在分组键上有序
+    bool checked_{false};
+    DistinctKeySortedMap<std::vector<AggContext>> open_groups_;
+    std::optional<Value> watermark_;
+    bool child_eof_{false};
+};
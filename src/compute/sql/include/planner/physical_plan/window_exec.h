@@ -177,6 +177,7 @@ class WindowExec : public PhysicalPlan {
     virtual std::string ToString() const override { return "WindowExec"; }
 
     virtual auto Next() -> std::tuple<Record, knl_cursor_t*, bool> override {
+        TRACE_SCOPE("WindowExec::Next", TRACE_CAT_OPERATOR);
         if (first_) {
             init();
         }
@@ -26,6 +26,8 @@
 #include <fmt/core.h>
 #include <fmt/ranges.h>
 
+#include <algorithm>
+#include <cctype>
 #include <iostream>
 #include <random>
 #include <set>
@@ -47,11 +49,13 @@
 #include "common/csv_util.h"
 #include "common/default_value.h"
 #include "common/gstor_exception.h"
+#include "common/query_metrics.h"
 #include "common/record_batch.h"
 #include "common/string_util.h"
 #include "common/exception.h"
 #include "function/pragma/pragma_queries.h"
 #include "planner/optimizer/optimizer.h"
+#include "planner/physical_plan/insert_exec.h"
 #include "planner/planner.h"
 #include "storage/gstor/zekernel/common/cm_log.h"
 #include "type/type_str.h"
@@ -148,6 +152,7 @@ std::unique_ptr<PreparedStatement> Connection::Prepare(const std::string& query)
 }
 
 std::vector<ParsedStatement> Connection::ParseStatementsInternal(const std::string& query_input) {
+    TRACE_SCOPE("Connection::Parse", TRACE_CAT_PHASE);
 #ifdef ENABLE_PG_QUERY
     auto query_utf8_view = intarkdb::UTF8StringView(query_input);
     if (!query_utf8_view.IsUTF8()) {
@@ -178,9 +183,12 @@ std::vector<ParsedStatement> Connection::ParseStatementsInternal(const std::stri
 
 std::unique_ptr<BoundStatement> Connection::BindSQLStmt(const ParsedStatement& stmt, const std::string& query)
 {
+    TRACE_SCOPE("Connection::Bind", TRACE_CAT_PHASE);
 #ifdef ENABLE_PG_QUERY
     Binder binder = CreateBinder();
     binder.SetUser(user_.GetName());
+    binder.SetRollupViews(std::exchange(rollup_views_, {}));
+    binder.SetPerfViewSnapshot(&perf_snapshot_);
     auto statement = binder.BindSQLStmt(stmt.stmt);
     statement->n_param = binder.ParamCount();
     statement->query = query;
@@ -264,13 +272,15 @@ std::unique_ptr<RecordBatch> Connection::Query(const char* query) {
     // end statistical time
 
     std::unique_ptr<RecordBatch> result = std::make_unique<RecordBatch>(Schema());
+    StatementType stmt_type = StatementType::INVALID_STATEMENT;
     try {
         auto statements = ParseStatementsInternal(query);
         if (statements.empty()) {
             throw std::runtime_error("No statement to execute!");
         }
         for (auto& statement : statements) {
-            auto bound_statement = BindSQLStmt(statement, query);
+            auto bound_statement = BindSQLStmt(PrepareContinuousAggregates(statement), query);
+            stmt_type = bound_statement->Type();
             result = ExecuteStatement(query, std::move(bound_statement));
         }
     } catch (const std::exception& e) {
@@ -287,11 +297,13 @@ std::unique_ptr<RecordBatch> Connection::Query(const char* query) {
     // statistical time
     struct timeval tv_end;
     cm_gettimeofday(&tv_end);
-    auto nsec = tv_end.tv_sec - tv_begin.tv_sec;
-    if (nsec > LONG_SQL_TIME) {
-        auto nusec = tv_end.tv_usec - tv_begin.tv_usec;
-        GS_LOG_RUN_WAR("[SQL_TIME:(%ld秒)(%ld微秒)][Query SQL]:%s", nsec, nusec, query);
+    int64_t elapsed_us = std::max<int64_t>(
+        0, (tv_end.tv_sec - tv_begin.tv_sec) * MICROSECS_PER_SECOND_LL + (tv_end.tv_usec - tv_begin.tv_usec));
+    if (elapsed_us > LONG_SQL_TIME * MICROSECS_PER_SECOND_LL) {
+        GS_LOG_RUN_WAR("[SQL_TIME:(%lld秒)(%lld微秒)][Query SQL]:%s", (long long)(elapsed_us / MICROSECS_PER_SECOND_LL),
+                       (long long)(elapsed_us % MICROSECS_PER_SECOND_LL), query);
     }
+    RecordStatementMetrics(StatementStats::Fingerprint(query), stmt_type, elapsed_us, *result);
     // end statistical time
 
 #ifdef _MSC_VER
@@ -310,13 +322,15 @@ std::unique_ptr<RecordIterator> Connection::QueryIterator(const char* query) {
     // end statistical time
 
     std::unique_ptr<RecordIterator> result = nullptr;
+    StatementType stmt_type = StatementType::INVALID_STATEMENT;
     try {
         auto stmts = ParseStatementsInternal(query);
         if (stmts.empty()) {
             throw std::runtime_error("No statement to execute!");
         }
         for (auto& stmt : stmts) {
-            auto bound_stmt = BindSQLStmt(stmt, query);
+            auto bound_stmt = BindSQLStmt(PrepareContinuousAggregates(stmt), query);
+            stmt_type = bound_stmt->Type();
             if (bound_stmt->Type() == StatementType::SELECT_STATEMENT) {
                 result = ExecuteStatementStreaming(std::move(bound_stmt));
             } else {
@@ -350,11 +364,13 @@ std::unique_ptr<RecordIterator> Connection::QueryIterator(const char* query) {
     // statistical time
     struct timeval tv_end;
     cm_gettimeofday(&tv_end);
-    auto nsec = tv_end.tv_sec - tv_begin.tv_sec;
-    if (nsec > LONG_SQL_TIME) {
-        auto nusec = tv_end.tv_usec - tv_begin.tv_usec;
-        GS_LOG_RUN_WAR("[SQL_TIME:(%ld秒)(%ld微秒)][Query SQL]:%s", nsec, nusec, query);
+    int64_t elapsed_us = std::max<int64_t>(
+        0, (tv_end.tv_sec - tv_begin.tv_sec) * MICROSECS_PER_SECOND_LL + (tv_end.tv_usec - tv_begin.tv_usec));
+    if (elapsed_us > LONG_SQL_TIME * MICROSECS_PER_SECOND_LL) {
+        GS_LOG_RUN_WAR("[SQL_TIME:(%lld秒)(%lld微秒)][Query SQL]:%s", (long long)(elapsed_us / MICROSECS_PER_SECOND_LL),
+                       (long long)(elapsed_us % MICROSECS_PER_SECOND_LL), query);
     }
+    RecordStatementMetrics(StatementStats::Fingerprint(query), stmt_type, elapsed_us, *result);
     // end statistical time
 
 #ifdef _MSC_VER
@@ -365,6 +381,19 @@ std::unique_ptr<RecordIterator> Connection::QueryIterator(const char* query) {
     return result;
 }
 
+void Connection::RecordStatementMetrics(const StatementFingerprint& fingerprint, StatementType type,
+                                        int64_t elapsed_us, RecordIterator& result) {
+    bool failed = result.GetRetCode() != 0;
+    // a streamed select has not produced its rows yet
+    uint64_t rows = 0;
+    if (result.GetIteratorType() == RecordIteratorType::Batch) {
+        auto& batch = static_cast<RecordBatch&>(result);
+        rows = batch.GetRecordBatchType() == RecordBatchType::Select ? batch.RowCount() : batch.GetEffectRow();
+    }
+    QueryMetrics::Record(type, elapsed_us, failed);
+    StatementStats::GetInstance().Record(fingerprint, elapsed_us, rows, failed);
+}
+
 std::unique_ptr<RecordStreaming> Connection::ExecuteStatementStreaming(std::unique_ptr<BoundStatement> statement) {
     if (statement && statement->Type() == StatementType::SELECT_STATEMENT) {
         try {
@@ -389,6 +418,7 @@ std::unique_ptr<RecordStreaming> Connection::ExecuteStatementStreaming(std::uniq
 
 std::unique_ptr<RecordBatch> Connection::ExecuteStatement(const std::string& query,
                                                           std::unique_ptr<BoundStatement> statement) {
+    TRACE_SCOPE("Connection::ExecuteStatement", TRACE_CAT_PHASE);
     std::unique_ptr<RecordBatch> result = std::make_unique<RecordBatch>(Schema());
     intarkdb::Optimizer optimizer;
     switch (statement->Type()) {
@@ -447,21 +477,26 @@ std::unique_ptr<RecordBatch> Connection::ExecuteStatement(const std::string& que
             auto logical_plan = planner.PlanInsert(insert_stmt);
             logical_plan = optimizer.OptimizeLogicalPlan(logical_plan);
             auto physical_plan = planner.CreatePhysicalPlan(logical_plan);
+            TrackContinuousAggregateSource(insert_stmt, physical_plan);
             {
                 physical_plan->SetAutoCommit(IsAutoCommit());
                 physical_plan->SetNeedResultSetEx(is_need_result_ex);
                 physical_plan->Execute(*result);
                 result->SetRecordBatchType(RecordBatchType::Insert);
             }
+            CollectContinuousAggregateInvalidation(physical_plan);
             if (IsAutoCommit()) {
-                gstor_commit(((db_handle_t*)handle_)->handle);
+                TRACE_STORAGE_CALL("gstor_commit", gstor_commit(((db_handle_t*)handle_)->handle));
+                PublishContinuousAggregateInvalidation();
             }
             break;
         }
         case StatementType::DELETE_STATEMENT: {
             auto& delete_stmt = dynamic_cast<DeleteStatement&>(*statement);
+            TrackContinuousAggregateSource(delete_stmt, nullptr);
             // check if truncate statement
             if (TruncateTable(query, delete_stmt, false)) {
+                PublishContinuousAggregateInvalidation();
                 break;
             }
 
@@ -478,7 +513,8 @@ std::unique_ptr<RecordBatch> Connection::ExecuteStatement(const std::string& que
                 result->SetEffectRow(r.GetEffectRow());
             }
             if (IsAutoCommit()) {
-                gstor_commit(((db_handle_t*)handle_)->handle);
+                TRACE_STORAGE_CALL("gstor_commit", gstor_commit(((db_handle_t*)handle_)->handle));
+                PublishContinuousAggregateInvalidation();
             }
             break;
         }
@@ -492,6 +528,9 @@ std::unique_ptr<RecordBatch> Connection::ExecuteStatement(const std::string& que
                 throw std::runtime_error("transaction err");
             }
             SetBeginTransaction(transaction_stmt.type);
+            if (transaction_stmt.type == TransactionType::COMMIT || transaction_stmt.type == TransactionType::ROLLBACK) {
+                PublishContinuousAggregateInvalidation();
+            }
             break;
         }
         case StatementType::SET_STATEMENT: {
@@ -509,6 +548,7 @@ std::unique_ptr<RecordBatch> Connection::ExecuteStatement(const std::string& que
         }
         case StatementType::UPDATE_STATEMENT: {
             auto& update_stmt = dynamic_cast<UpdateStatement&>(*statement);
+            TrackContinuousAggregateSource(update_stmt, nullptr);
             Planner planner = CreatePlanner();
             auto logical_plan = planner.PlanUpdate(update_stmt);
 
@@ -521,7 +561,8 @@ std::unique_ptr<RecordBatch> Connection::ExecuteStatement(const std::string& que
                 result->SetEffectRow(r.GetEffectRow());
             }
             if (IsAutoCommit()) {
-                gstor_commit(((db_handle_t*)handle_)->handle);
+                TRACE_STORAGE_CALL("gstor_commit", gstor_commit(((db_handle_t*)handle_)->handle));
+                PublishContinuousAggregateInvalidation();
             }
             break;
         }
@@ -561,6 +602,9 @@ std::unique_ptr<RecordBatch> Connection::ExecuteStatement(const std::string& que
             if (r.GetRetCode() != GS_SUCCESS) {
                 throw intarkdb::Exception(ExceptionType::EXECUTOR,r.GetRetMsg());
             }
+            if (drop_stmt.type == ObjectType::VIEW) {
+                DropContinuousAggregate(drop_stmt.schema, drop_stmt.name);
+            }
             break;
         }
         case StatementType::CTAS_STATEMENT: {
@@ -583,9 +627,13 @@ std::unique_ptr<RecordBatch> Connection::ExecuteStatement(const std::string& que
             // FIXME: 这个columns有什么必要？
             const auto& schema = physical_plan->GetSchema();
             auto columns = schema.GetColumns();
+            bool view_exists = GetTableInfo(view_stmt.getViewName()) != nullptr;
             if (CreateView(view_stmt.getViewName(), columns, query, view_stmt.ignore_conflict) != GS_SUCCESS) {
                 throw std::runtime_error("CreateView err");
             }
+            if (view_stmt.continuous && !view_exists) {
+                CreateContinuousAggregate(view_stmt.continuous);
+            }
             break;
         }
         case StatementType::COPY_STATEMENT: {
@@ -792,7 +840,7 @@ int Connection::CtasTable(CtasStatement& stmt, RecordBatch& result) {
         throw std::runtime_error("unknown error.");
     }
     if (IsAutoCommit()) {
-        gstor_commit(((db_handle_t*)handle_)->handle);
+        TRACE_STORAGE_CALL("gstor_commit", gstor_commit(((db_handle_t*)handle_)->handle));
     }
 
     return GS_SUCCESS;
@@ -1099,7 +1147,7 @@ auto Connection::CopyTo(CopyStatement& stmt, int64_t& effect_row) -> int {
         effect_row++;
     }
     if (IsAutoCommit()) {
-        gstor_commit(((db_handle_t*)handle_)->handle);
+        TRACE_STORAGE_CALL("gstor_commit", gstor_commit(((db_handle_t*)handle_)->handle));
     }
     return GS_SUCCESS;
 };
@@ -1121,7 +1169,7 @@ auto Connection::CopyFrom(CopyStatement& stmt) -> int {
         prepare_insert_stmt->Execute(RecordToVector(r));
     }
     if (IsAutoCommit()) {
-        gstor_commit(((db_handle_t*)handle_)->handle);
+        TRACE_STORAGE_CALL("gstor_commit", gstor_commit(((db_handle_t*)handle_)->handle));
     }
     return GS_SUCCESS;
 }
@@ -1186,4 +1234,332 @@ static std::string GetTableName(const std::string& sql)
     return table_name;
 }
 
-void Connection::Rollback() { gstor_rollback(((db_handle_t*)handle_)->handle); }
+void Connection::Rollback() {
+    TRACE_STORAGE_CALL("gstor_rollback", gstor_rollback(((db_handle_t*)handle_)->handle));
+    // statements may have committed in batches before failing
+    PublishContinuousAggregateInvalidation();
+}
+
+std::unique_ptr<RecordBatch> Connection::ExecuteInternal(const std::string& sql) {
+    std::unique_ptr<RecordBatch> result;
+    for (auto& stmt : ParseStatementsInternal(sql)) {
+        result = ExecuteStatement(sql, BindSQLStmt(stmt, sql));
+        if (result->GetRetCode() != GS_SUCCESS) {
+            throw intarkdb::Exception(ExceptionType::EXECUTOR, result->GetRetMsg());
+        }
+    }
+    return result;
+}
+
+auto Connection::ContinuousAggregateRegistry() -> std::shared_ptr<ContinuousAggregates> {
+    auto instance_ptr = instance_.lock();
+    if (instance_ptr == nullptr) {
+        return nullptr;
+    }
+    auto caggs = instance_ptr->GetContinuousAggregates();
+    if (!caggs->Loaded()) {
+        std::lock_guard<std::mutex> lock(caggs->RefreshMutex());
+        if (!caggs->Loaded()) {
+            // set first, loading runs queries which look up the registry again
+            caggs->SetLoaded();
+            LoadContinuousAggregates(*caggs);
+        }
+    }
+    return caggs;
+}
+
+void Connection::LoadContinuousAggregates(ContinuousAggregates& caggs) {
+#ifdef ENABLE_PG_QUERY
+    try {
+        auto views = ExecuteInternal(
+            "SELECT U.\"NAME\", V.\"TEXT\" FROM \"SYS_VIEWS\" V JOIN \"SYS_USERS\" U ON V.\"USER#\" = U.\"ID\"");
+        for (size_t i = 0; i < views->RowCount(); ++i) {
+            auto owner = views->Row(i).Field(0).ToString();
+            auto text = views->Row(i).Field(1).ToString();
+            if (intarkdb::StringUtil::Lower(text).find(CAGG_OPTION) == std::string::npos) {
+                continue;
+            }
+            for (auto& stmt : ParseStatementsInternal(text)) {
+                auto node = stmt.stmt;
+                if (node->type == duckdb_libpgquery::T_PGRawStmt) {
+                    node = reinterpret_cast<duckdb_libpgquery::PGRawStmt*>(node)->stmt;
+                }
+                if (node->type != duckdb_libpgquery::T_PGViewStmt) {
+                    continue;
+                }
+                auto view = reinterpret_cast<duckdb_libpgquery::PGViewStmt*>(node);
+                // registered for a full rebuild on first read, rows inserted before the restart may
+                // not have been rolled up and the invalidations of the previous run are not persisted
+                if (ContinuousAggregate::IsContinuous(view)) {
+                    caggs.Register(ContinuousAggregate::Create(owner, intarkdb::StringUtil::Lower(view->view->relname),
+                                                               view));
+                }
+            }
+        }
+    } catch (const std::exception& e) {
+        GS_LOG_RUN_WAR("load continuous aggregates failed: %s", e.what());
+    }
+#endif
+}
+
+void Connection::TrackContinuousAggregateSource(const BoundStatement& stmt, const PhysicalPlanPtr& plan) {
+    auto caggs = ContinuousAggregateRegistry();
+    if (caggs == nullptr || caggs->Empty()) {
+        return;
+    }
+    switch (stmt.Type()) {
+        case StatementType::INSERT_STATEMENT: {
+            // inserts only invalidate the partitions they write
+            auto insert_exec = std::dynamic_pointer_cast<InsertExec>(plan);
+            if (insert_exec != nullptr &&
+                !caggs->FindBySource(insert_exec->GetSchemaName(), insert_exec->GetTableName()).empty()) {
+                insert_exec->SetTrackPartitions(true);
+            }
+            break;
+        }
+        case StatementType::DELETE_STATEMENT: {
+            auto& table = dynamic_cast<const DeleteStatement&>(stmt).target_table;
+            if (!caggs->FindBySource(table->GetSchema(), table->GetBoundTableName()).empty()) {
+                pending_rebuild_.emplace(table->GetSchema(), table->GetBoundTableName());
+            }
+            break;
+        }
+        case StatementType::UPDATE_STATEMENT: {
+            auto& table = dynamic_cast<const UpdateStatement&>(stmt).table;
+            if (!caggs->FindBySource(table->GetSchema(), table->GetBoundTableName()).empty()) {
+                pending_rebuild_.emplace(table->GetSchema(), table->GetBoundTableName());
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void Connection::CollectContinuousAggregateInvalidation(const PhysicalPlanPtr& plan) {
+    auto insert_exec = std::dynamic_pointer_cast<InsertExec>(plan);
+    if (insert_exec == nullptr) {
+        return;
+    }
+    auto parts = insert_exec->TakeTouchedPartitions();
+    if (!parts.empty()) {
+        pending_parts_[{insert_exec->GetSchemaName(), insert_exec->GetTableName()}].merge(parts);
+    }
+}
+
+void Connection::PublishContinuousAggregateInvalidation() {
+    if (pending_parts_.empty() && pending_rebuild_.empty()) {
+        return;
+    }
+    auto caggs = ContinuousAggregateRegistry();
+    if (caggs != nullptr) {
+        for (const auto& [table, parts] : pending_parts_) {
+            caggs->Invalidate(table.first, table.second, parts);
+        }
+        for (const auto& table : pending_rebuild_) {
+            caggs->InvalidateAll(table.first, table.second);
+        }
+    }
+    pending_parts_.clear();
+    pending_rebuild_.clear();
+}
+
+// partition key YYYYMMDD or YYYYMMDDHH to the time range it covers
+static auto PartitionRange(const std::string& key, std::string& lower, std::string& upper) -> bool {
+    if ((key.size() != 8 && key.size() != 10) ||
+        !std::all_of(key.begin(), key.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+        return false;
+    }
+    bool hourly = key.size() == 10;
+    lower = fmt::format("{}-{}-{} {}:00:00", key.substr(0, 4), key.substr(4, 2), key.substr(6, 2),
+                        hourly ? key.substr(8, 2) : "00");
+    auto ts = ValueFactory::ValueTimeStamp(lower.c_str()).GetCastAs<timestamp_stor_t>().ts;
+    ts += hourly ? Interval::MICROS_PER_HOUR : Interval::MICROS_PER_DAY;
+    upper = ValueFactory::ValueTimeStamp(timestamp_stor_t{ts}).ToString();
+    return true;
+}
+
+auto Connection::RefreshContinuousAggregate(ContinuousAggregates& caggs, const ContinuousAggregate& cagg) -> bool {
+    auto source = std::make_pair(cagg.SourceSchema(), cagg.SourceTable());
+    if (pending_parts_.count(source) > 0 || pending_rebuild_.count(source) > 0) {
+        // the materialized table can not see the changes of the running transaction
+        return false;
+    }
+    if (caggs.IsClean(cagg)) {
+        return true;
+    }
+    if (!IsAutoCommit()) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(caggs.RefreshMutex());
+    std::set<std::string> parts;
+    bool rebuild = false;
+    if (caggs.IsClean(cagg) || !caggs.BeginRefresh(cagg, parts, rebuild)) {
+        return caggs.IsClean(cagg);
+    }
+
+    auto saved_autocommit = is_autocommit_param;
+    try {
+        auto table_info = catalog_->GetTable(cagg.SourceSchema(), cagg.SourceTable());
+        if (table_info == nullptr || !table_info->IsTimeScale()) {
+            throw intarkdb::Exception(ExceptionType::CATALOG,
+                                      fmt::format("source table {} is not a timescale table", cagg.SourceTable()));
+        }
+        const auto& meta = table_info->GetTableMetaInfo();
+        std::string time_column;
+        for (uint32_t i = 0; i < meta.column_count && meta.part_table.keycols != nullptr; ++i) {
+            if (meta.columns[i].col_slot == meta.part_table.keycols->column_id) {
+                time_column = std::string(meta.columns[i].name.str, meta.columns[i].name.len);
+            }
+        }
+        if (time_column.empty()) {
+            throw intarkdb::Exception(ExceptionType::CATALOG,
+                                      fmt::format("source table {} has no partition column", cagg.SourceTable()));
+        }
+        bool hourly = table_info->IsHourlyPartition();
+
+        // the whole refresh is one transaction
+        is_autocommit_param = false;
+        if (rebuild) {
+            ExecuteInternal(fmt::format("DELETE FROM {}", cagg.MaterializedTableRef()));
+            ExecuteInternal(cagg.RebuildQuery(time_column, hourly));
+        } else {
+            for (const auto& key : parts) {
+                std::string lower;
+                std::string upper;
+                if (!PartitionRange(key, lower, upper)) {
+                    GS_LOG_RUN_WAR("continuous aggregate %s skip partition %s", cagg.ViewName().c_str(), key.c_str());
+                    continue;
+                }
+                ExecuteInternal(fmt::format("DELETE FROM {} WHERE \"{}\" = '{}'", cagg.MaterializedTableRef(),
+                                            CAGG_PART_COLUMN, key));
+                ExecuteInternal(cagg.RefreshQuery(time_column, key, lower, upper));
+            }
+        }
+        TRACE_STORAGE_CALL("gstor_commit", gstor_commit(((db_handle_t*)handle_)->handle));
+        is_autocommit_param = saved_autocommit;
+    } catch (const std::exception& e) {
+        is_autocommit_param = saved_autocommit;
+        TRACE_STORAGE_CALL("gstor_rollback", gstor_rollback(((db_handle_t*)handle_)->handle));
+        caggs.FinishRefresh(cagg, false, parts, rebuild);
+        GS_LOG_RUN_WAR("refresh continuous aggregate %s failed: %s", cagg.ViewName().c_str(), e.what());
+        return false;
+    }
+    caggs.FinishRefresh(cagg, true, parts, rebuild);
+    return true;
+}
+
+auto Connection::PrepareContinuousAggregates(const ParsedStatement& stmt) -> ParsedStatement {
+#ifdef ENABLE_PG_QUERY
+    auto caggs = ContinuousAggregateRegistry();
+    if (caggs == nullptr || caggs->Empty()) {
+        return stmt;
+    }
+    auto node = stmt.stmt;
+    if (node->type == duckdb_libpgquery::T_PGRawStmt) {
+        node = reinterpret_cast<duckdb_libpgquery::PGRawStmt*>(node)->stmt;
+    }
+    // only queries read the materialized tables
+    if (node->type != duckdb_libpgquery::T_PGSelectStmt) {
+        return stmt;
+    }
+    const auto& user = user_.GetName();
+    auto tables = ContinuousAggregate::ReferencedTables(node, user);
+
+    // an aggregate over a source table answered by a continuous aggregate
+    for (const auto& [schema, table] : tables) {
+        for (const auto& cagg : caggs->FindBySource(schema, table)) {
+            auto sql = cagg->RewriteQuery(reinterpret_cast<duckdb_libpgquery::PGSelectStmt*>(node), user);
+            if (sql.has_value() && RefreshContinuousAggregate(*caggs, *cagg)) {
+                GS_LOG_RUN_INF("[Rewrite SQL]:%s", sql->c_str());
+                auto stmts = ParseStatementsInternal(*sql);
+                return stmts.front();
+            }
+        }
+    }
+
+    // continuous aggregate views read their materialized table if it is up to date,
+    // otherwise the view definition is evaluated over the source table
+    std::unordered_map<std::string, std::string> rollup_views;
+    for (const auto& [schema, table] : tables) {
+        auto cagg = caggs->Find(schema, table);
+        if (cagg != nullptr && RefreshContinuousAggregate(*caggs, *cagg)) {
+            rollup_views.emplace(fmt::format("{}.{}", schema, table), cagg->MaterializedQuery());
+        }
+    }
+    rollup_views_ = std::move(rollup_views);
+#endif
+    return stmt;
+}
+
+void Connection::CreateContinuousAggregate(const ContinuousAggregatePtr& cagg) {
+    auto caggs = ContinuousAggregateRegistry();
+    if (caggs == nullptr) {
+        return;
+    }
+    try {
+        // the materialized table has the types of the partial states
+        auto partial_query = cagg->PartialQuery();
+        auto stmts = ParseStatementsInternal(partial_query);
+        auto bound_stmt = BindSQLStmt(stmts.front(), partial_query);
+        Planner planner = CreatePlanner();
+        auto select_plan = planner.PlanSelect(dynamic_cast<SelectStatement&>(*bound_stmt));
+        const auto& col_infos = select_plan->GetSchema().GetColumnInfos();
+        auto names = cagg->MaterializedColumnNames();
+        std::vector<Column> columns;
+        columns.reserve(col_infos.size());
+        for (size_t i = 0; i < col_infos.size() && i < names.size(); ++i) {
+            auto def = intarkdb::NewColumnDef(col_infos[i].col_type);
+            def.nullable = true;
+            def.col_slot = i;
+            columns.emplace_back(names[i], def);
+        }
+        CreateStatement create_stmt(cagg->MaterializedTable(), std::move(columns));
+        if (CreateTable(create_stmt) != GS_SUCCESS) {
+            throw intarkdb::Exception(ExceptionType::CATALOG,
+                                      fmt::format("create table {} failed", cagg->MaterializedTable()));
+        }
+        ExecuteInternal(fmt::format("CREATE INDEX \"{}_idx\" ON \"{}\"(\"{}\")", cagg->MaterializedTable(),
+                                    cagg->MaterializedTable(), CAGG_PART_COLUMN));
+        caggs->Register(cagg);
+        RefreshContinuousAggregate(*caggs, *cagg);
+    } catch (...) {
+        caggs->Unregister(cagg->Owner(), cagg->ViewName());
+        auto user = user_.GetName();
+        drop_def_t drop_info = {0};
+        drop_info.name = (char*)cagg->ViewName().c_str();
+        drop_info.if_exists = (int)true;
+        drop_info.type = DROP_TYPE_VIEW;
+        if (gstor_drop(((db_handle_t*)handle_)->handle, (char*)user.c_str(), &drop_info) != GS_SUCCESS) {
+            GS_LOG_RUN_ERR("CreateContinuousAggregate failed, drop view failed");
+        }
+        drop_info.name = (char*)cagg->MaterializedTable().c_str();
+        drop_info.type = DROP_TYPE_TABLE;
+        if (gstor_drop(((db_handle_t*)handle_)->handle, (char*)user.c_str(), &drop_info) != GS_SUCCESS) {
+            GS_LOG_RUN_ERR("CreateContinuousAggregate failed, drop table failed");
+        }
+        throw;
+    }
+}
+
+void Connection::DropContinuousAggregate(const std::string& schema, const std::string& view_name) {
+    auto caggs = ContinuousAggregateRegistry();
+    if (caggs == nullptr) {
+        return;
+    }
+    // the view and its materialized table live in the schema the view was dropped from
+    auto cagg = caggs->Find(schema, intarkdb::StringUtil::Lower(view_name));
+    if (cagg == nullptr) {
+        return;
+    }
+    caggs->Unregister(cagg->Owner(), cagg->ViewName());
+    drop_def_t drop_info = {0};
+    drop_info.name = (char*)cagg->MaterializedTable().c_str();
+    drop_info.if_exists = (int)true;
+    drop_info.type = DROP_TYPE_TABLE;
+    if (gstor_drop(((db_handle_t*)handle_)->handle, (char*)cagg->Owner().c_str(), &drop_info) != GS_SUCCESS) {
+        GS_LOG_RUN_ERR("drop materialized table %s.%s failed", cagg->Owner().c_str(),
+                       cagg->MaterializedTable().c_str());
+    }
+}
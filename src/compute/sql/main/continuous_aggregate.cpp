@@ -0,0 +1,742 @@
+/*
+ * Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+ *
+ * openGauss embedded is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ * http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ *
+ * continuous_aggregate.cpp
+ *
+ * IDENTIFICATION
+ * openGauss-embedded/src/compute/sql/main/continuous_aggregate.cpp
+ *
+ * -------------------------------------------------------------------------
+ */
+#include "main/continuous_aggregate.h"
+
+#include <fmt/core.h>
+#include <fmt/ranges.h>
+
+#include <algorithm>
+
+#include "common/exception.h"
+#include "common/string_util.h"
+#include "nodes/parsenodes.hpp"
+
+using namespace duckdb_libpgquery;
+
+static auto IsPlainIdent(const std::string& name) -> bool {
+    if (name.empty() || (name[0] >= '0' && name[0] <= '9')) {
+        return false;
+    }
+    for (auto c : name) {
+        if (!((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '_')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static auto QuoteIdent(const std::string& name) -> std::string {
+    if (IsPlainIdent(name)) {
+        return name;
+    }
+    std::string quoted = "\"";
+    for (auto c : name) {
+        if (c == '"') {
+            quoted += '"';
+        }
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+static auto QuoteString(const std::string& str) -> std::string {
+    std::string quoted = "'";
+    for (auto c : str) {
+        if (c == '\'') {
+            quoted += '\'';
+        }
+        quoted += c;
+    }
+    return quoted + "'";
+}
+
+static auto ListToStrings(PGList* list) -> std::vector<std::string> {
+    std::vector<std::string> names;
+    for (auto cell = list ? list->head : nullptr; cell != nullptr; cell = cell->next) {
+        auto node = reinterpret_cast<PGNode*>(cell->data.ptr_value);
+        if (node->type != T_PGString) {
+            throw intarkdb::Exception(ExceptionType::BINDER, "unsupported qualified name in continuous aggregate");
+        }
+        names.push_back(reinterpret_cast<PGValue*>(node)->val.str);
+    }
+    return names;
+}
+
+// prints an expression back to sql, column references lose their table qualifier so that the
+// same expression written against the view definition and an ad-hoc query compares equal
+static auto Deparse(PGNode* node) -> std::string {
+    switch (node->type) {
+        case T_PGColumnRef: {
+            auto fields = reinterpret_cast<PGColumnRef*>(node)->fields;
+            auto last = reinterpret_cast<PGNode*>(fields->tail->data.ptr_value);
+            if (last->type != T_PGString) {
+                break;
+            }
+            return QuoteIdent(reinterpret_cast<PGValue*>(last)->val.str);
+        }
+        case T_PGAConst: {
+            auto& val = reinterpret_cast<PGAConst*>(node)->val;
+            switch (val.type) {
+                case T_PGInteger:
+                    return std::to_string(val.val.ival);
+                case T_PGFloat:
+                    return val.val.str;
+                case T_PGString:
+                    return QuoteString(val.val.str);
+                case T_PGNull:
+                    return "NULL";
+                default:
+                    break;
+            }
+            break;
+        }
+        case T_PGFuncCall: {
+            auto func = reinterpret_cast<PGFuncCall*>(node);
+            if (func->agg_order || func->agg_filter || func->over || func->agg_distinct) {
+                break;
+            }
+            auto name = intarkdb::StringUtil::Lower(fmt::format("{}", fmt::join(ListToStrings(func->funcname), ".")));
+            if (func->agg_star) {
+                return name + "(*)";
+            }
+            std::vector<std::string> args;
+            for (auto cell = func->args ? func->args->head : nullptr; cell != nullptr; cell = cell->next) {
+                args.push_back(Deparse(reinterpret_cast<PGNode*>(cell->data.ptr_value)));
+            }
+            return fmt::format("{}({})", name, fmt::join(args, ", "));
+        }
+        case T_PGTypeCast: {
+            auto cast = reinterpret_cast<PGTypeCast*>(node);
+            if (cast->tryCast || cast->typeName->arrayBounds) {
+                break;
+            }
+            auto type_name = ListToStrings(cast->typeName->names).back();
+            std::vector<std::string> mods;
+            for (auto cell = cast->typeName->typmods ? cast->typeName->typmods->head : nullptr; cell != nullptr;
+                 cell = cell->next) {
+                mods.push_back(Deparse(reinterpret_cast<PGNode*>(cell->data.ptr_value)));
+            }
+            if (!mods.empty()) {
+                type_name += fmt::format("({})", fmt::join(mods, ", "));
+            }
+            return fmt::format("CAST({} AS {})", Deparse(cast->arg), type_name);
+        }
+        case T_PGAExpr: {
+            auto expr = reinterpret_cast<PGAExpr*>(node);
+            if (expr->kind != PG_AEXPR_OP) {
+                break;
+            }
+            auto op = ListToStrings(expr->name).back();
+            if (expr->lexpr == nullptr) {
+                return fmt::format("({}{})", op, Deparse(expr->rexpr));
+            }
+            return fmt::format("({} {} {})", Deparse(expr->lexpr), op, Deparse(expr->rexpr));
+        }
+        case T_PGIntervalConstant: {
+            auto interval = reinterpret_cast<PGIntervalConstant*>(node);
+            if (interval->val_type != T_PGString || interval->typmods) {
+                break;
+            }
+            return fmt::format("INTERVAL {}", QuoteString(interval->sval));
+        }
+        default:
+            break;
+    }
+    throw intarkdb::Exception(ExceptionType::BINDER, "unsupported expression in continuous aggregate");
+}
+
+// count(*) is parsed as a call with a star column argument
+static auto IsStar(PGNode* node) -> bool {
+    if (node->type == T_PGAStar) {
+        return true;
+    }
+    if (node->type != T_PGColumnRef) {
+        return false;
+    }
+    auto fields = reinterpret_cast<PGColumnRef*>(node)->fields;
+    return fields->length == 1 && reinterpret_cast<PGNode*>(fields->tail->data.ptr_value)->type == T_PGAStar;
+}
+
+// recognizes count/sum/min/max/avg calls, a distinct or filtered aggregate can not be merged
+static auto ParseAggregate(PGNode* node, std::string& func, std::string& arg) -> bool {
+    if (node->type != T_PGFuncCall) {
+        return false;
+    }
+    auto call = reinterpret_cast<PGFuncCall*>(node);
+    auto names = ListToStrings(call->funcname);
+    if (names.size() != 1) {
+        return false;
+    }
+    auto name = intarkdb::StringUtil::Lower(names[0]);
+    if (name != "count" && name != "sum" && name != "min" && name != "max" && name != "avg") {
+        return false;
+    }
+    if (call->agg_distinct || call->agg_filter || call->agg_order || call->over) {
+        throw intarkdb::Exception(ExceptionType::BINDER,
+                                  fmt::format("unsupported aggregate {} in continuous aggregate", name));
+    }
+    bool star = call->agg_star || (call->args != nullptr && call->args->length == 1 &&
+                                   IsStar(reinterpret_cast<PGNode*>(call->args->head->data.ptr_value)));
+    if (star) {
+        if (name != "count") {
+            return false;
+        }
+        arg = "*";
+    } else {
+        if (call->args == nullptr || call->args->length != 1) {
+            return false;
+        }
+        arg = Deparse(reinterpret_cast<PGNode*>(call->args->head->data.ptr_value));
+    }
+    func = name;
+    return true;
+}
+
+static auto DefaultColumnName(PGResTarget* target, const std::string& func, const std::string& arg,
+                              const std::string& expr) -> std::string {
+    if (target->name) {
+        return target->name;
+    }
+    if (target->val->type == T_PGColumnRef) {
+        auto last = reinterpret_cast<PGNode*>(reinterpret_cast<PGColumnRef*>(target->val)->fields->tail->data.ptr_value);
+        return reinterpret_cast<PGValue*>(last)->val.str;
+    }
+    if (!func.empty()) {
+        return func == "count" && arg == "*" ? "count_star" : fmt::format("{}({})", func, arg);
+    }
+    return expr;
+}
+
+static auto NthTarget(PGList* targets, int64_t idx) -> PGResTarget* {
+    int64_t i = 1;
+    for (auto cell = targets->head; cell != nullptr; cell = cell->next, ++i) {
+        if (i == idx) {
+            return reinterpret_cast<PGResTarget*>(cell->data.ptr_value);
+        }
+    }
+    return nullptr;
+}
+
+// GROUP BY items may refer to a select expression by position or by its alias
+static auto DeparseGroupItem(PGNode* item, PGList* targets) -> std::string {
+    if (item->type == T_PGAConst && reinterpret_cast<PGAConst*>(item)->val.type == T_PGInteger) {
+        auto target = NthTarget(targets, reinterpret_cast<PGAConst*>(item)->val.val.ival);
+        if (target == nullptr) {
+            throw intarkdb::Exception(ExceptionType::BINDER, "GROUP BY position is not in select list");
+        }
+        return Deparse(target->val);
+    }
+    if (item->type == T_PGColumnRef && reinterpret_cast<PGColumnRef*>(item)->fields->length == 1) {
+        auto name = Deparse(item);
+        for (auto cell = targets->head; cell != nullptr; cell = cell->next) {
+            auto target = reinterpret_cast<PGResTarget*>(cell->data.ptr_value);
+            std::string func, arg;
+            if (target->name && QuoteIdent(target->name) == name && !ParseAggregate(target->val, func, arg)) {
+                return Deparse(target->val);
+            }
+        }
+        return name;
+    }
+    return Deparse(item);
+}
+
+// the shape shared by the view definition and the queries it can answer
+static auto SimpleAggregateSource(PGSelectStmt* stmt) -> PGRangeVar* {
+    if (stmt->op != PG_SETOP_NONE || stmt->withClause || stmt->distinctClause || stmt->whereClause ||
+        stmt->havingClause || stmt->windowClause || stmt->qualifyClause || stmt->valuesLists || stmt->pivot ||
+        stmt->sampleOptions || stmt->lockingClause || stmt->intoClause) {
+        return nullptr;
+    }
+    if (stmt->fromClause == nullptr || stmt->fromClause->length != 1 || stmt->groupClause == nullptr ||
+        stmt->targetList == nullptr) {
+        return nullptr;
+    }
+    auto from = reinterpret_cast<PGNode*>(stmt->fromClause->head->data.ptr_value);
+    if (from->type != T_PGRangeVar) {
+        return nullptr;
+    }
+    return reinterpret_cast<PGRangeVar*>(from);
+}
+
+auto ContinuousAggregate::IsContinuous(PGViewStmt* stmt) -> bool {
+    for (auto cell = stmt->options ? stmt->options->head : nullptr; cell != nullptr; cell = cell->next) {
+        auto def = reinterpret_cast<PGDefElem*>(cell->data.ptr_value);
+        if (def->defname && intarkdb::StringUtil::Lower(std::string(def->defname)) == CAGG_OPTION) {
+            return true;
+        }
+    }
+    return false;
+}
+
+auto ContinuousAggregate::Create(const std::string& owner, const std::string& view_name, PGViewStmt* stmt)
+    -> std::unique_ptr<ContinuousAggregate> {
+    for (auto cell = stmt->options ? stmt->options->head : nullptr; cell != nullptr; cell = cell->next) {
+        auto def = reinterpret_cast<PGDefElem*>(cell->data.ptr_value);
+        if (def->defname == nullptr || intarkdb::StringUtil::Lower(std::string(def->defname)) != CAGG_OPTION ||
+            def->arg != nullptr) {
+            throw intarkdb::Exception(ExceptionType::SYNTAX, "unsupported create view with options");
+        }
+    }
+    if (stmt->query == nullptr || stmt->query->type != T_PGSelectStmt) {
+        throw intarkdb::Exception(ExceptionType::BINDER, "continuous aggregate must be defined by a SELECT");
+    }
+    auto select = reinterpret_cast<PGSelectStmt*>(stmt->query);
+    auto source = SimpleAggregateSource(select);
+    if (source == nullptr || select->sortClause || select->limitCount || select->limitOffset) {
+        throw intarkdb::Exception(ExceptionType::BINDER,
+                                  "continuous aggregate must be a GROUP BY query over a single table without "
+                                  "WHERE, HAVING, ORDER BY, LIMIT or DISTINCT");
+    }
+
+    auto cagg = std::make_unique<ContinuousAggregate>();
+    cagg->owner_ = owner;
+    cagg->view_name_ = view_name;
+    cagg->source_schema_ = source->schemaname ? std::string(source->schemaname) : owner;
+    cagg->source_table_ = intarkdb::StringUtil::Lower(std::string(source->relname));
+    cagg->mat_table_ = CAGG_TABLE_PREFIX + view_name;
+
+    for (auto cell = select->groupClause->head; cell != nullptr; cell = cell->next) {
+        auto key = DeparseGroupItem(reinterpret_cast<PGNode*>(cell->data.ptr_value), select->targetList);
+        if (std::find(cagg->keys_.begin(), cagg->keys_.end(), key) == cagg->keys_.end()) {
+            cagg->keys_.push_back(key);
+        }
+    }
+
+    for (auto cell = select->targetList->head; cell != nullptr; cell = cell->next) {
+        auto res = reinterpret_cast<PGResTarget*>(cell->data.ptr_value);
+        Target target;
+        std::string arg;
+        if (ParseAggregate(res->val, target.func, arg)) {
+            if (target.func == "avg") {
+                target.states.push_back(cagg->AddState("sum", arg));
+                target.states.push_back(cagg->AddState("count", arg));
+            } else {
+                target.states.push_back(cagg->AddState(target.func, arg));
+            }
+            target.name = DefaultColumnName(res, target.func, arg, "");
+        } else {
+            auto expr = Deparse(res->val);
+            auto iter = std::find(cagg->keys_.begin(), cagg->keys_.end(), expr);
+            if (iter == cagg->keys_.end()) {
+                throw intarkdb::Exception(
+                    ExceptionType::BINDER,
+                    fmt::format("select item {} of continuous aggregate must be a group key or one of "
+                                "count/sum/min/max/avg",
+                                expr));
+            }
+            target.key_idx = iter - cagg->keys_.begin();
+            target.name = DefaultColumnName(res, "", "", expr);
+        }
+        cagg->targets_.push_back(std::move(target));
+    }
+    return cagg;
+}
+
+auto ContinuousAggregate::AddState(const std::string& func, const std::string& arg) -> size_t {
+    auto idx = FindState(func, arg);
+    if (idx) {
+        return *idx;
+    }
+    states_.push_back({func, arg});
+    return states_.size() - 1;
+}
+
+auto ContinuousAggregate::FindState(const std::string& func, const std::string& arg) const
+    -> std::optional<size_t> {
+    for (size_t i = 0; i < states_.size(); ++i) {
+        if (states_[i].func == func && states_[i].arg == arg) {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
+auto ContinuousAggregate::MergeExpr(const std::string& func, const std::vector<size_t>& states) const
+    -> std::string {
+    if (func == "avg") {
+        return fmt::format("CASE WHEN SUM(s{1}) = 0 THEN NULL ELSE CAST(SUM(s{0}) AS DOUBLE) / SUM(s{1}) END",
+                           states[0], states[1]);
+    }
+    if (func == "min" || func == "max") {
+        return fmt::format("{}(s{})", intarkdb::StringUtil::Upper(func), states[0]);
+    }
+    // counts and sums of the partitions add up
+    return fmt::format("SUM(s{})", states[0]);
+}
+
+// a plain column key keeps its name in the materialized table, so the view shows the same column names
+auto ContinuousAggregate::KeyColumn(size_t idx) const -> std::string {
+    const auto& key = keys_[idx];
+    std::string name;
+    if (IsPlainIdent(key)) {
+        name = key;
+    } else if (key.size() > 2 && key.front() == '"' && key.find('"', 1) == key.size() - 1) {
+        name = key.substr(1, key.size() - 2);
+    }
+    auto generated = [](const std::string& col) {
+        return col.size() > 1 && (col[0] == 'k' || col[0] == 's') &&
+               std::all_of(col.begin() + 1, col.end(), [](char c) { return c >= '0' && c <= '9'; });
+    };
+    if (name.empty() || generated(name) || name == CAGG_PART_COLUMN) {
+        return fmt::format("k{}", idx);
+    }
+    return name;
+}
+
+auto ContinuousAggregate::KeyColumns() const -> std::string {
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < keys_.size(); ++i) {
+        keys.push_back(QuoteIdent(KeyColumn(i)));
+    }
+    return fmt::format("{}", fmt::join(keys, ", "));
+}
+
+auto ContinuousAggregate::SourceTableRef() const -> std::string {
+    return fmt::format("{}.{}", QuoteIdent(source_schema_), QuoteIdent(source_table_));
+}
+
+auto ContinuousAggregate::MaterializedTableRef() const -> std::string {
+    return fmt::format("{}.{}", QuoteIdent(owner_), QuoteIdent(mat_table_));
+}
+
+auto ContinuousAggregate::MaterializedQuery() const -> std::string {
+    std::vector<std::string> items;
+    for (const auto& target : targets_) {
+        auto expr =
+            target.func.empty() ? QuoteIdent(KeyColumn(target.key_idx)) : MergeExpr(target.func, target.states);
+        items.push_back(fmt::format("{} AS {}", expr, QuoteIdent(target.name)));
+    }
+    return fmt::format("SELECT {} FROM {} GROUP BY {}", fmt::join(items, ", "), MaterializedTableRef(),
+                       KeyColumns());
+}
+
+static auto StateExpr(const ContinuousAggregate::State& state) -> std::string {
+    return fmt::format("{}({})", state.func, state.arg);
+}
+
+auto ContinuousAggregate::PartialQuery() const -> std::string {
+    std::vector<std::string> items;
+    for (size_t i = 0; i < keys_.size(); ++i) {
+        items.push_back(fmt::format("{} AS {}", keys_[i], QuoteIdent(KeyColumn(i))));
+    }
+    for (size_t i = 0; i < states_.size(); ++i) {
+        items.push_back(fmt::format("{} AS s{}", StateExpr(states_[i]), i));
+    }
+    items.push_back(fmt::format("CAST('' AS VARCHAR(16)) AS {}", CAGG_PART_COLUMN));
+    return fmt::format("SELECT {} FROM {} GROUP BY {}", fmt::join(items, ", "), SourceTableRef(),
+                       fmt::join(keys_, ", "));
+}
+
+auto ContinuousAggregate::MaterializedColumnNames() const -> std::vector<std::string> {
+    std::vector<std::string> names;
+    for (size_t i = 0; i < keys_.size(); ++i) {
+        names.push_back(KeyColumn(i));
+    }
+    for (size_t i = 0; i < states_.size(); ++i) {
+        names.push_back(fmt::format("s{}", i));
+    }
+    names.push_back(CAGG_PART_COLUMN);
+    return names;
+}
+
+auto ContinuousAggregate::RefreshQuery(const std::string& time_column, const std::string& part_key,
+                                       const std::string& lower, const std::string& upper) const -> std::string {
+    std::vector<std::string> items(keys_.begin(), keys_.end());
+    for (const auto& state : states_) {
+        items.push_back(StateExpr(state));
+    }
+    items.push_back(QuoteString(part_key));
+    return fmt::format("INSERT INTO {} SELECT {} FROM {} WHERE {} >= {} AND {} < {} GROUP BY {}",
+                       MaterializedTableRef(), fmt::join(items, ", "), SourceTableRef(),
+                       QuoteIdent(time_column), QuoteString(lower), QuoteIdent(time_column), QuoteString(upper),
+                       fmt::join(keys_, ", "));
+}
+
+auto ContinuousAggregate::RebuildQuery(const std::string& time_column, bool hourly) const -> std::string {
+    auto part_key = fmt::format("date_format({}, '{}')", QuoteIdent(time_column), hourly ? "%Y%m%d%H" : "%Y%m%d");
+    std::vector<std::string> items(keys_.begin(), keys_.end());
+    for (const auto& state : states_) {
+        items.push_back(StateExpr(state));
+    }
+    items.push_back(part_key);
+    return fmt::format("INSERT INTO {} SELECT {} FROM {} GROUP BY {}, {}", MaterializedTableRef(),
+                       fmt::join(items, ", "), SourceTableRef(), fmt::join(keys_, ", "), part_key);
+}
+
+static void CollectTables(PGNode* node, const std::string& default_schema,
+                          std::set<std::pair<std::string, std::string>>& tables) {
+    if (node == nullptr) {
+        return;
+    }
+    switch (node->type) {
+        case T_PGRawStmt:
+            CollectTables(reinterpret_cast<PGRawStmt*>(node)->stmt, default_schema, tables);
+            break;
+        case T_PGRangeVar: {
+            auto range = reinterpret_cast<PGRangeVar*>(node);
+            tables.emplace(range->schemaname ? std::string(range->schemaname) : default_schema,
+                           intarkdb::StringUtil::Lower(std::string(range->relname)));
+            break;
+        }
+        case T_PGJoinExpr: {
+            auto join = reinterpret_cast<PGJoinExpr*>(node);
+            CollectTables(join->larg, default_schema, tables);
+            CollectTables(join->rarg, default_schema, tables);
+            break;
+        }
+        case T_PGRangeSubselect:
+            CollectTables(reinterpret_cast<PGRangeSubselect*>(node)->subquery, default_schema, tables);
+            break;
+        case T_PGCommonTableExpr:
+            CollectTables(reinterpret_cast<PGCommonTableExpr*>(node)->ctequery, default_schema, tables);
+            break;
+        case T_PGSelectStmt: {
+            auto select = reinterpret_cast<PGSelectStmt*>(node);
+            if (select->withClause != nullptr) {
+                for (auto cell = select->withClause->ctes ? select->withClause->ctes->head : nullptr; cell != nullptr;
+                     cell = cell->next) {
+                    CollectTables(reinterpret_cast<PGNode*>(cell->data.ptr_value), default_schema, tables);
+                }
+            }
+            for (auto cell = select->fromClause ? select->fromClause->head : nullptr; cell != nullptr;
+                 cell = cell->next) {
+                CollectTables(reinterpret_cast<PGNode*>(cell->data.ptr_value), default_schema, tables);
+            }
+            CollectTables(reinterpret_cast<PGNode*>(select->larg), default_schema, tables);
+            CollectTables(reinterpret_cast<PGNode*>(select->rarg), default_schema, tables);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+auto ContinuousAggregate::ReferencedTables(PGNode* node, const std::string& default_schema)
+    -> std::set<std::pair<std::string, std::string>> {
+    std::set<std::pair<std::string, std::string>> tables;
+    CollectTables(node, default_schema, tables);
+    return tables;
+}
+
+auto ContinuousAggregate::RewriteQuery(PGSelectStmt* stmt, const std::string& default_schema) const
+    -> std::optional<std::string> {
+    auto source = SimpleAggregateSource(stmt);
+    if (source == nullptr || source_table_ != intarkdb::StringUtil::Lower(std::string(source->relname)) ||
+        source_schema_ != (source->schemaname ? std::string(source->schemaname) : default_schema)) {
+        return std::nullopt;
+    }
+    try {
+        // the query must group by exactly the keys of the continuous aggregate
+        std::vector<std::string> keys;
+        for (auto cell = stmt->groupClause->head; cell != nullptr; cell = cell->next) {
+            auto key = DeparseGroupItem(reinterpret_cast<PGNode*>(cell->data.ptr_value), stmt->targetList);
+            if (std::find(keys_.begin(), keys_.end(), key) == keys_.end()) {
+                return std::nullopt;
+            }
+            if (std::find(keys.begin(), keys.end(), key) == keys.end()) {
+                keys.push_back(key);
+            }
+        }
+        if (keys.size() != keys_.size()) {
+            return std::nullopt;
+        }
+
+        std::vector<std::string> items;
+        std::vector<std::string> exprs;
+        std::vector<std::string> names;
+        for (auto cell = stmt->targetList->head; cell != nullptr; cell = cell->next) {
+            auto res = reinterpret_cast<PGResTarget*>(cell->data.ptr_value);
+            std::string func, arg, expr;
+            if (ParseAggregate(res->val, func, arg)) {
+                std::vector<size_t> states;
+                std::vector<std::pair<std::string, std::string>> needs;
+                if (func == "avg") {
+                    needs = {{"sum", arg}, {"count", arg}};
+                } else {
+                    needs = {{func, arg}};
+                }
+                for (const auto& [need_func, need_arg] : needs) {
+                    auto idx = FindState(need_func, need_arg);
+                    if (!idx) {
+                        return std::nullopt;
+                    }
+                    states.push_back(*idx);
+                }
+                expr = MergeExpr(func, states);
+                exprs.push_back(fmt::format("{}({})", func, arg));
+            } else {
+                auto key = Deparse(res->val);
+                auto iter = std::find(keys_.begin(), keys_.end(), key);
+                if (iter == keys_.end()) {
+                    return std::nullopt;
+                }
+                expr = QuoteIdent(KeyColumn(iter - keys_.begin()));
+                exprs.push_back(key);
+            }
+            names.push_back(DefaultColumnName(res, func, arg, exprs.back()));
+            items.push_back(fmt::format("{} AS {}", expr, QuoteIdent(names.back())));
+        }
+
+        // ORDER BY is translated to select list positions
+        std::vector<std::string> orders;
+        for (auto cell = stmt->sortClause ? stmt->sortClause->head : nullptr; cell != nullptr; cell = cell->next) {
+            auto sort = reinterpret_cast<PGSortBy*>(cell->data.ptr_value);
+            if (sort->sortby_nulls != PG_SORTBY_NULLS_DEFAULT || sort->sortby_dir == SORTBY_USING) {
+                return std::nullopt;
+            }
+            size_t pos = 0;
+            if (sort->node->type == T_PGAConst && reinterpret_cast<PGAConst*>(sort->node)->val.type == T_PGInteger) {
+                pos = reinterpret_cast<PGAConst*>(sort->node)->val.val.ival;
+            } else {
+                std::string func, arg;
+                auto expr = ParseAggregate(sort->node, func, arg) ? fmt::format("{}({})", func, arg)
+                                                                   : Deparse(sort->node);
+                for (size_t i = 0; i < exprs.size() && pos == 0; ++i) {
+                    if (exprs[i] == expr || QuoteIdent(names[i]) == expr) {
+                        pos = i + 1;
+                    }
+                }
+            }
+            if (pos == 0 || pos > items.size()) {
+                return std::nullopt;
+            }
+            orders.push_back(fmt::format("{}{}", pos, sort->sortby_dir == PG_SORTBY_DESC ? " DESC" : ""));
+        }
+
+        auto sql = fmt::format("SELECT {} FROM {} GROUP BY {}", fmt::join(items, ", "), MaterializedTableRef(),
+                               KeyColumns());
+        if (!orders.empty()) {
+            sql += fmt::format(" ORDER BY {}", fmt::join(orders, ", "));
+        }
+        for (auto [clause, node] : {std::make_pair("LIMIT", stmt->limitCount),
+                                    std::make_pair("OFFSET", stmt->limitOffset)}) {
+            if (node == nullptr) {
+                continue;
+            }
+            if (node->type != T_PGAConst || reinterpret_cast<PGAConst*>(node)->val.type != T_PGInteger) {
+                return std::nullopt;
+            }
+            sql += fmt::format(" {} {}", clause, reinterpret_cast<PGAConst*>(node)->val.val.ival);
+        }
+        return sql;
+    } catch (const intarkdb::Exception&) {
+        // expressions that can not be compared are answered from the source table
+        return std::nullopt;
+    }
+}
+
+void ContinuousAggregates::Register(ContinuousAggregatePtr cagg) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto key = Key(cagg->Owner(), cagg->ViewName());
+    if (entries_.find(key) != entries_.end()) {
+        return;
+    }
+    Entry entry;
+    entry.cagg = std::move(cagg);
+    entries_.emplace(key, std::move(entry));
+    count_ = entries_.size();
+}
+
+void ContinuousAggregates::Unregister(const std::string& owner, const std::string& view_name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.erase(Key(owner, view_name));
+    count_ = entries_.size();
+}
+
+auto ContinuousAggregates::Find(const std::string& owner, const std::string& view_name) -> ContinuousAggregatePtr {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entries_.find(Key(owner, view_name));
+    return iter == entries_.end() ? nullptr : iter->second.cagg;
+}
+
+auto ContinuousAggregates::FindBySource(const std::string& schema, const std::string& table)
+    -> std::vector<ContinuousAggregatePtr> {
+    std::vector<ContinuousAggregatePtr> caggs;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [_, entry] : entries_) {
+        if (entry.cagg->SourceSchema() == schema && entry.cagg->SourceTable() == table) {
+            caggs.push_back(entry.cagg);
+        }
+    }
+    return caggs;
+}
+
+void ContinuousAggregates::Invalidate(const std::string& schema, const std::string& table,
+                                      const std::set<std::string>& part_keys) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [_, entry] : entries_) {
+        if (entry.cagg->SourceSchema() == schema && entry.cagg->SourceTable() == table) {
+            entry.dirty_parts.insert(part_keys.begin(), part_keys.end());
+        }
+    }
+}
+
+void ContinuousAggregates::InvalidateAll(const std::string& schema, const std::string& table) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [_, entry] : entries_) {
+        if (entry.cagg->SourceSchema() == schema && entry.cagg->SourceTable() == table) {
+            entry.rebuild = true;
+        }
+    }
+}
+
+auto ContinuousAggregates::IsClean(const ContinuousAggregate& cagg) -> bool {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entries_.find(Key(cagg.Owner(), cagg.ViewName()));
+    if (iter == entries_.end()) {
+        return false;
+    }
+    auto& entry = iter->second;
+    return !entry.rebuild && !entry.refreshing && entry.dirty_parts.empty();
+}
+
+auto ContinuousAggregates::BeginRefresh(const ContinuousAggregate& cagg, std::set<std::string>& part_keys,
+                                        bool& rebuild) -> bool {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entries_.find(Key(cagg.Owner(), cagg.ViewName()));
+    if (iter == entries_.end()) {
+        return false;
+    }
+    auto& entry = iter->second;
+    part_keys.swap(entry.dirty_parts);
+    entry.dirty_parts.clear();
+    rebuild = entry.rebuild;
+    entry.rebuild = false;
+    entry.refreshing = true;
+    return true;
+}
+
+void ContinuousAggregates::FinishRefresh(const ContinuousAggregate& cagg, bool success,
+                                         const std::set<std::string>& part_keys, bool rebuild) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entries_.find(Key(cagg.Owner(), cagg.ViewName()));
+    if (iter == entries_.end()) {
+        return;
+    }
+    auto& entry = iter->second;
+    entry.refreshing = false;
+    if (!success) {
+        entry.dirty_parts.insert(part_keys.begin(), part_keys.end());
+        entry.rebuild = entry.rebuild || rebuild;
+    }
+}
@@ -27,6 +27,7 @@
 #include <stdexcept>
 
 #include "common/memory/memory_manager.h"
+#include "common/stat.h"
 #include "function/function.h"
 #include "main/base_storage.h"
 #include "storage/gstor/zekernel/common/cm_error.h"
@@ -46,6 +47,9 @@ class IntarkDBInstance : public IntarkDB {
     virtual status_t AllocHandle(void** handle);
     virtual bool IsDBAvailable();
     virtual int GetId(void* handle);
+    virtual std::shared_ptr<ContinuousAggregates> GetContinuousAggregates();
+    virtual std::shared_ptr<KvHashTables> GetKvHashTables(
+        const std::function<std::shared_ptr<KvHashTables>()>& create);
 
    private:
     std::shared_ptr<BaseStorage> storage_;
@@ -62,13 +66,16 @@ class IntarkDBWeakInstance : public IntarkDB {
     virtual status_t AllocHandle(void** handle);
     virtual bool IsDBAvailable();
     virtual int GetId(void* handle);
-    
+    virtual std::shared_ptr<ContinuousAggregates> GetContinuousAggregates();
+    virtual std::shared_ptr<KvHashTables> GetKvHashTables(
+        const std::function<std::shared_ptr<KvHashTables>()>& create);
+
    private:
     std::weak_ptr<BaseStorage> storage_;
 };
 
 IntarkDB::IntarkDB(const std::string& path) : path_(path) {
-    full_dbpath_ = path + constant_db_name;
+    full_dbpath_ = path + "/" + constant_db_name;
     intarkdb::FunctionContext::Init();
 }
 
@@ -109,6 +116,7 @@ std::shared_ptr<BaseStorage> IntarkDB::GetStorage(const std::string& in_path) {
     instance->Open(const_cast<char*>(in_path.c_str()));
     instance_map_[in_path] = instance;
     intarkdb::MemoryManager::GetInstance(instance->get_sql_engine_memory_limit());
+    Tracer::SetHome(in_path + "/" + constant_db_name);
     return instance;
 }
 
@@ -167,6 +175,15 @@ bool IntarkDBInstance::IsDBAvailable() { return storage_->db_is_available(); }
 
 int IntarkDBInstance::GetId(void* handle) { return storage_->get_handle_id(handle); }
 
+std::shared_ptr<ContinuousAggregates> IntarkDBInstance::GetContinuousAggregates() {
+    return storage_->get_continuous_aggregates();
+}
+
+std::shared_ptr<KvHashTables> IntarkDBInstance::GetKvHashTables(
+    const std::function<std::shared_ptr<KvHashTables>()>& create) {
+    return storage_->get_kv_hash_tables(create);
+}
+
 void IntarkDBWeakInstance::DestoryHandle(void* handle) {
     auto storage = storage_.lock();
     if (storage == nullptr) {
@@ -198,3 +215,20 @@ int IntarkDBWeakInstance::GetId(void* handle) {
     }
     return storage->get_handle_id(handle);
 }
+
+std::shared_ptr<ContinuousAggregates> IntarkDBWeakInstance::GetContinuousAggregates() {
+    auto storage = storage_.lock();
+    if (storage == nullptr) {
+        throw intarkdb::IntarkDBInValidException("base storage is invalid");
+    }
+    return storage->get_continuous_aggregates();
+}
+
+std::shared_ptr<KvHashTables> IntarkDBWeakInstance::GetKvHashTables(
+    const std::function<std::shared_ptr<KvHashTables>()>& create) {
+    auto storage = storage_.lock();
+    if (storage == nullptr) {
+        throw intarkdb::IntarkDBInValidException("base storage is invalid");
+    }
+    return storage->get_kv_hash_tables(create);
+}
@@ -21,10 +21,12 @@
  * -------------------------------------------------------------------------
  */
 #include "main/prepare_statement.h"
+#include "common/stat.h"
 #include "main/connection.h"
 #include "storage/gstor/zekernel/common/cm_log.h"
 
 std::unique_ptr<RecordBatch> PreparedStatement::Execute(const std::vector<Value>& values) {
+    TRACE_SCOPE("PreparedStatement::Execute", TRACE_CAT_PHASE);
     GS_LOG_RUN_INF("[DB:%s][Execute SQL]:%s", conn_->GetStorageInstance().lock()->GetDbPath().c_str(), sql_.c_str());
     if (LOG_RUN_INF_ON) {
         for (auto& s : values) {
@@ -72,20 +74,25 @@ std::unique_ptr<RecordBatch> PreparedStatement::Execute(const std::vector<Value>
                 break;
             }
             case StatementType::INSERT_STATEMENT: {
+                conn_->TrackContinuousAggregateSource(*unbound_statement_, physical_plan_);
                 physical_plan_->SetAutoCommit(conn_->IsAutoCommit());
                 physical_plan_->SetNeedResultSetEx(is_need_result_ex);
                 physical_plan_->Execute(*result);
                 result->SetRecordBatchType(RecordBatchType::Insert);
+                conn_->CollectContinuousAggregateInvalidation(physical_plan_);
                 if (conn_->IsAutoCommit()) {
-                    gstor_commit(((db_handle_t*)conn_->GetStorageHandle())->handle);
+                    TRACE_STORAGE_CALL("gstor_commit", gstor_commit(((db_handle_t*)conn_->GetStorageHandle())->handle));
+                    conn_->PublishContinuousAggregateInvalidation();
                 }
                 break;
             }
             case StatementType::DELETE_STATEMENT:
             case StatementType::UPDATE_STATEMENT: {
+                conn_->TrackContinuousAggregateSource(*unbound_statement_, physical_plan_);
                 *result = physical_plan_->Execute();
                 if (conn_->IsAutoCommit()) {
-                    gstor_commit(((db_handle_t*)conn_->GetStorageHandle())->handle);
+                    TRACE_STORAGE_CALL("gstor_commit", gstor_commit(((db_handle_t*)conn_->GetStorageHandle())->handle));
+                    conn_->PublishContinuousAggregateInvalidation();
                 }
                 break;
             }
@@ -118,14 +125,19 @@ std::unique_ptr<RecordBatch> PreparedStatement::Execute(const std::vector<Value>
     // statistical time
     struct timeval tv_end;
     cm_gettimeofday(&tv_end);
-    auto nsec = tv_end.tv_sec - tv_begin.tv_sec;
-    if (nsec > LONG_SQL_TIME) {
-        auto nusec = tv_end.tv_usec - tv_begin.tv_usec;
-        GS_LOG_RUN_WAR("[SQL_TIME:(%ld秒)(%ld微秒)][Query SQL]:%s", nsec, nusec, sql_.c_str());
+    int64_t elapsed_us = std::max<int64_t>(
+        0, (tv_end.tv_sec - tv_begin.tv_sec) * MICROSECS_PER_SECOND_LL + (tv_end.tv_usec - tv_begin.tv_usec));
+    if (elapsed_us > LONG_SQL_TIME * MICROSECS_PER_SECOND_LL) {
+        GS_LOG_RUN_WAR("[SQL_TIME:(%lld秒)(%lld微秒)][Query SQL]:%s", (long long)(elapsed_us / MICROSECS_PER_SECOND_LL),
+                       (long long)(elapsed_us % MICROSECS_PER_SECOND_LL), sql_.c_str());
         for (auto& s : values) {
             GS_LOG_RUN_WAR("[Bind VALUE]:%s", s.ToString().c_str());
         }
     }
+    if (fingerprint_.text.empty()) {
+        fingerprint_ = StatementStats::Fingerprint(sql_);
+    }
+    conn_->RecordStatementMetrics(fingerprint_, unbound_statement_->Type(), elapsed_us, *result);
     // end statistical time
 
 #ifdef _MSC_VER
@@ -137,6 +149,33 @@ std::unique_ptr<RecordBatch> PreparedStatement::Execute(const std::vector<Value>
     return result;
 }
 
+std::unique_ptr<RecordStreaming> PreparedStatement::ExecuteStreaming(const std::vector<Value>& values) {
+    GS_LOG_RUN_INF("[DB:%s][Execute SQL streaming]:%s", conn_->GetStorageInstance().lock()->GetDbPath().c_str(),
+                   sql_.c_str());
+    try {
+        if (!physical_plan_ || unbound_statement_->Type() != StatementType::SELECT_STATEMENT) {
+            throw std::invalid_argument("Only a prepared select can be executed as a stream.");
+        }
+        if (values.size() != n_param_) {
+            throw std::invalid_argument("Parameter count mismatch for prepared statement.");
+        }
+
+        ResetNext(physical_plan_);
+        for (auto& param : params) {
+            param->InitParam(values);
+        }
+        auto result = std::make_unique<RecordStreaming>(physical_plan_->GetSchema(), physical_plan_);
+        result->stmt_type = StatementType::SELECT_STATEMENT;
+        result->SetRecordBatchType(RecordBatchType::Select);
+        return result;
+    } catch (const std::exception& e) {
+        auto result = std::make_unique<RecordStreaming>(Schema(), nullptr);
+        result->SetRetCode(-1);
+        result->SetRetMsg(e.what());
+        return result;
+    }
+}
+
 void PreparedStatement::ResetNext(PhysicalPlanPtr plan) {
     plan->ResetNext();
     auto childs = plan->Children();
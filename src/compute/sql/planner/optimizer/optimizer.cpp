@@ -22,6 +22,7 @@
  */
 #include "planner/optimizer/optimizer.h"
 
+#include "common/stat.h"
 #include "planner/optimizer/expression_rewriter.h"
 #include "planner/optimizer/fast_scan.h"
 #include "planner/optimizer/filter_pushdown.h"
@@ -34,6 +35,7 @@ Optimizer::Optimizer() {}
 void Optimizer::RunOptimizer(OptRule type, const std::function<void()>& callback) { callback(); }
 
 auto Optimizer::OptimizeLogicalPlan(LogicalPlanPtr& plan) -> LogicalPlanPtr {
+    TRACE_SCOPE("Optimizer::OptimizeLogicalPlan", TRACE_CAT_PHASE);
     RunOptimizer(OptRule::REWRITE_EXPR, [&]() {
         ExpressionRewriter rewriter(*this);
         plan = rewriter.Rewrite(plan);
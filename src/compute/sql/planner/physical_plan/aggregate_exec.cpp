@@ -22,9 +22,7 @@
  */
 #include "planner/physical_plan/aggregate_exec.h"
 
-#include "common/distinct_keys.h"
 #include "common/exception.h"
-#include "function/aggregate/aggregate_func.h"
 #include "function/function.h"
 #include "type/type_id.h"
 
@@ -77,15 +75,98 @@ static auto AggFuncFactory(const std::string& name, bool is_disinct) -> std::uni
     throw intarkdb::Exception(ExceptionType::NOT_IMPLEMENTED, "not supported aggregate func:" + name);
 }
 
+void AggregateExec::InitAggFuncs() {
+    agg_funcs_.clear();
+    for (size_t i = 0; i < ops_.size(); ++i) {
+        agg_funcs_.push_back(AggFuncFactory(ops_[i], distincts[i]));
+    }
+}
+
+auto AggregateExec::GroupKey(const Record& record) const -> DistinctKey {
+    std::vector<Value> values;
+    values.reserve(groups_.size());
+    for (size_t i = 0; i < groups_.size(); ++i) {
+        values.push_back(groups_[i]->Evaluate(record));
+    }
+    if (values.size() == 0) {
+        values.push_back(ValueFactory::ValueInt(1));
+    }
+    return DistinctKey{values};
+}
+
+void AggregateExec::UpdateGroup(const Record& record, std::vector<AggContext>& ctxs, bool first) {
+    if (first) {
+        ctxs.resize(agg_funcs_.size());
+    }
+    auto be_groups_iter = be_groups_.begin();
+    for (size_t index = 0; index < agg_funcs_.size() && index < ctxs.size() && be_groups_iter != be_groups_.end();
+         ++index) {
+        auto& func = agg_funcs_[index];
+        auto& ctx = ctxs[index];
+        // in count_star , be_groups[i] is null
+        Value new_value =
+            (*be_groups_iter != nullptr) ? (*be_groups_iter)->Evaluate(record) : ValueFactory::ValueInt(1);
+
+        if (ops_[index] == "top" || ops_[index] == "bottom") {
+            ++be_groups_iter;
+            if (*be_groups_iter != nullptr && !(*be_groups_iter)->Evaluate(record).IsInteger()) {
+                throw intarkdb::Exception(ExceptionType::MISMATCH_TYPE, "arg 2 must be integer");
+            }
+
+            ctx.count = (*be_groups_iter != nullptr) ? (*be_groups_iter)->Evaluate(record).GetCastAs<int>() : 1;
+            if (ctx.count < 0) {
+                throw intarkdb::Exception(ExceptionType::OUT_OF_RANGE, "arg 2 must be greater than 0");
+            }
+        }
+
+        if (first) {
+            func->First(new_value, ctx);
+        } else {
+            func->Accumulate(new_value, ctx);
+        }
+        ++be_groups_iter;
+    }
+}
+
+void AggregateExec::EmitGroup(const DistinctKey& key, std::vector<AggContext>& ctxs, std::vector<Record>& out) const {
+    std::vector<std::variant<Value, std::vector<Value>>> values;
+    const auto& key_items = key.Keys();
+    values.reserve(key_items.size() + ctxs.size());
+    if (groups_.size() > 0) {
+        std::copy(key_items.begin(), key_items.end(), std::back_inserter(values));
+    }
+    for (size_t i = 0; i < ctxs.size(); ++i) {
+        values.push_back(agg_funcs_[i]->Final(ctxs[i]));
+    }
+
+    std::vector<Value> flattened_values;
+    bool agg_flag = false;
+    for (const auto& val : values) {
+        if (std::holds_alternative<Value>(val)) {
+            flattened_values.push_back(std::get<Value>(val));
+            agg_flag = true;
+        }
+        if (std::holds_alternative<std::vector<Value>>(val)) {
+            const auto& vec_val = std::get<std::vector<Value>>(val);
+            for (const auto& v : vec_val) {
+                flattened_values.clear();
+                flattened_values.push_back(v);
+                Record record(std::move(flattened_values));
+                out.push_back(std::move(record));
+            }
+        }
+    }
+    if (agg_flag) {
+        Record record(std::move(flattened_values));
+        out.push_back(std::move(record));
+    }
+}
+
 void AggregateExec::Init() {
     DistinctKeySortedMap<std::vector<AggContext>> groups_map;
 
     results_.clear();
-    std::vector<std::unique_ptr<AggFunc>> agg_funcs;
-    for (size_t i = 0; i < ops_.size(); ++i) {
-        agg_funcs.push_back(AggFuncFactory(ops_[i], distincts[i]));
-    }
-    // NOTE: agg_funcs 与 be_groups_ 一对应多
+    InitAggFuncs();
 
     while (true) {
         auto&& [record, _, eof] = child_->Next();
@@ -93,127 +174,26 @@ void AggregateExec::Init() {
             break;
         }
 
-        std::vector<Value> values;
-        values.reserve(groups_.size());
-        for (size_t i = 0; i < groups_.size(); ++i) {
-            values.push_back(groups_[i]->Evaluate(record));
-        }
-        if (values.size() == 0) {
-            values.push_back(ValueFactory::ValueInt(1));
-        }
-        DistinctKey key{values};
-
+        auto key = GroupKey(record);
         auto iter = groups_map.find(key);
         if (iter != groups_map.end()) {
-            auto& ctxs = iter->second;
-            auto func_iter = agg_funcs.begin();
-            auto ctx_iter = ctxs.begin();
-            auto be_groups_iter = be_groups_.begin();
-
-            while (func_iter != agg_funcs.end() && ctx_iter != ctxs.end() && be_groups_iter != be_groups_.end()) {
-                auto& func = *func_iter;
-                auto& ctx = *ctx_iter;
-                // 获取当前迭代器位置的元素
-                Value new_value = (*be_groups_iter != nullptr) ? (*be_groups_iter)->Evaluate(record) : ValueFactory::ValueInt(1);
-
-                // 获取索引位置
-                size_t index = std::distance(agg_funcs.begin(), func_iter);
-                if(ops_[index] == "top" || ops_[index] == "bottom") {
-                    ++be_groups_iter;
-                    if(*be_groups_iter != nullptr && !(*be_groups_iter)->Evaluate(record).IsInteger()){
-                        throw intarkdb::Exception(ExceptionType::MISMATCH_TYPE, "arg 2 must be integer");
-                    }
-
-                    ctx.count = (*be_groups_iter != nullptr) ? (*be_groups_iter)->Evaluate(record).GetCastAs<int>() : 1;
-                    if(ctx.count < 0) {
-                        throw intarkdb::Exception(ExceptionType::OUT_OF_RANGE, "arg 2 must be greater than 0");
-                    }
-                }
-
-                // 调用 Accumulate 函数
-                func->Accumulate(new_value, ctx);
-                // 移动到下一个 func, ctx 和 be_group
-                ++func_iter;
-                ++ctx_iter;
-                ++be_groups_iter;
-            }            
+            UpdateGroup(record, iter->second, false);
         } else {
             std::vector<AggContext> ctxs;
-            ctxs.reserve(agg_funcs.size());
-            auto be_groups_iter = be_groups_.begin();
-
-            for (auto it = agg_funcs.begin(); it != agg_funcs.end(); ++it) {
-                // 获取当前迭代器位置的元素
-                auto& func = *it;
-                // 创建 AggContext 对象
-                AggContext ctx;
-                // in count_star , be_groups[i] is null
-                Value new_value = (*be_groups_iter != nullptr) ? (*be_groups_iter)->Evaluate(record) : ValueFactory::ValueInt(1);
-
-                // 获取索引位置
-                size_t index = std::distance(agg_funcs.begin(), it);
-                if(ops_[index] == "top" || ops_[index] == "bottom") {
-                    ++be_groups_iter;
-                    if(*be_groups_iter != nullptr && !(*be_groups_iter)->Evaluate(record).IsInteger()){
-                        throw intarkdb::Exception(ExceptionType::MISMATCH_TYPE, "arg 2 must be integer");
-                    }
-
-                    ctx.count = (*be_groups_iter != nullptr) ? (*be_groups_iter)->Evaluate(record).GetCastAs<int>() : 1;
-                    if(ctx.count < 0) {
-                        throw intarkdb::Exception(ExceptionType::OUT_OF_RANGE, "arg 2 must be greater than 0");
-                    }
-                }
-
-                // 调用 First 函数
-                func->First(new_value, ctx);
-                // 将 ctx 移动构造到 ctxs 中
-                ctxs.emplace_back(std::move(ctx));
-                
-                ++be_groups_iter;
-            }
+            UpdateGroup(record, ctxs, true);
             groups_map.emplace(std::move(key), std::move(ctxs));
         }
     }
 
     // 构建结果
     for (auto& [key, ctxs] : groups_map) {
-        std::vector<std::variant<Value, std::vector<Value>>> values;
-        const auto& key_items = key.Keys();
-        values.reserve(key_items.size() + ctxs.size());
-        if (groups_.size() > 0) {
-            std::copy(key_items.begin(), key_items.end(), std::back_inserter(values));
-        }
-        for (size_t i = 0; i < ctxs.size(); ++i) {
-            values.push_back(agg_funcs[i]->Final(ctxs[i]));
-        }
-        
-        std::vector<Value> flattened_values;
-        bool agg_flag = false;
-        for (const auto& val : values) {
-            if (std::holds_alternative<Value>(val)) {
-                flattened_values.push_back(std::get<Value>(val));
-                agg_flag = true;
-            } 
-            if (std::holds_alternative<std::vector<Value>>(val)) {
-                const auto& vec_val = std::get<std::vector<Value>>(val);
-                for (const auto& v : vec_val) {
-                    flattened_values.clear();
-                    flattened_values.push_back(v);
-                    Record record(std::move(flattened_values));
-                    results_.push_back(std::move(record));
-                }
-            }
-        }
-        if(agg_flag){
-            Record record(std::move(flattened_values));
-            results_.push_back(std::move(record));
-        }
+        EmitGroup(key, ctxs, results_);
     }
     // 空表处理
     if (results_.size() == 0 && groups_.size() == 0) {
         std::vector<Value> values;
-        for (size_t i = 0; i < agg_funcs.size(); ++i) {
-            values.push_back(agg_funcs[i]->Default());
+        for (size_t i = 0; i < agg_funcs_.size(); ++i) {
+            values.push_back(agg_funcs_[i]->Default());
         }
         results_.emplace_back(std::move(values));
     }
@@ -222,6 +202,7 @@ void AggregateExec::Init() {
 }
 
 auto AggregateExec::Next() -> std::tuple<Record, knl_cursor_t*, bool> {
+    TRACE_SCOPE("AggregateExec::Next", TRACE_CAT_OPERATOR);
     if (!init_) {
         Init();
     }
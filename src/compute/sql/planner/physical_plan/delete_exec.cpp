@@ -29,6 +29,7 @@ auto DeleteExec::Children() const -> std::vector<PhysicalPlanPtr> { return {chil
 auto DeleteExec::ToString() const -> std::string {return "Delete";}
 
 std::tuple<Record, knl_cursor_t *, bool> DeleteExec::Next(){
+    TRACE_SCOPE("DeleteExec::Next", TRACE_CAT_OPERATOR);
   while (true) {
         auto [r, cur, eof] = child_->Next();
         if (eof) {
@@ -25,6 +25,7 @@
 Schema DistinctExec::GetSchema() const { return schema_; }
 
 auto DistinctExec::Next() -> std::tuple<Record, knl_cursor_t*, bool> {
+    TRACE_SCOPE("DistinctExec::Next", TRACE_CAT_OPERATOR);
     while (true) {
         // clear , ready for next time, avoid allocate memory again
         auto&& [record, cursor, eof] = child_->Next();
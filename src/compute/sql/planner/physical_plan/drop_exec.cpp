@@ -51,7 +51,7 @@ auto DropExec::Execute() const -> RecordBatch {
     }
 
     auto storage = catalog_.GetStorageHandle();
-    auto user = catalog_.GetUser();
+    auto user = drop_schema.empty() ? catalog_.GetUser() : drop_schema;
     auto status = gstor_drop(storage->handle, (char *)user.c_str(), &drop_info);
     if (status != GS_SUCCESS) {
         int32_t err_code;
@@ -34,6 +34,7 @@ std::vector<PhysicalPlanPtr> FilterExec::Children() const { return {child_}; }
 std::string FilterExec::ToString() const { return "Filter"; }
 
 auto FilterExec::Next() -> std::tuple<Record, knl_cursor_t*, bool> {
+    TRACE_SCOPE("FilterExec::Next", TRACE_CAT_OPERATOR);
     while (true) {
         auto&& [r, cur, eof] = child_->Next();
         if (eof) {
@@ -39,9 +39,6 @@
 #define MAX_BATCH_ROW_COUNT 255
 #define MAX_LOOP_BATCH_SIZE (MAX_BATCH_ROW_COUNT * 10)
 
-const std::string PART_INTERVAL_DAY = "1d";
-const std::string PART_INTERVAL_HOUR = "1h";
-
 Schema InsertExec::GetSchema() const { return source_->GetSchema(); }
 
 // not use
@@ -49,7 +46,7 @@ auto InsertExec::Execute() const -> RecordBatch { return RecordBatch(Schema());
 
 // batch insert
 void InsertExec::Execute(RecordBatch &rb_out) {
-    TIMESTATISTICS;
+    TRACE_SCOPE("InsertExec::Execute", TRACE_CAT_OPERATOR);
     std::vector<Value> autoincrement_list;
     std::vector<Value> default_value_list;
     if (unbound_defaults_.size() > 0) {
@@ -130,6 +127,10 @@ void InsertExec::Execute(RecordBatch &rb_out) {
             if (!m_is_crosspart || (m_is_crosspart && m_part_key_key_ == "-1")) {
                 GetPartitionKey();
             }
+            // a crosspart row is stored by the first row's key, track the key of its own value
+            if (track_partitions_) {
+                touched_partitions_.insert(m_is_crosspart ? PartitionKeyOf(m_part_key_value_) : m_part_key_key_);
+            }
         }
 
         // !grouping rows by part key and insert, if not part table, key is -1
@@ -143,7 +144,7 @@ void InsertExec::Execute(RecordBatch &rb_out) {
             autoincrement_list.clear();
             default_value_list.clear();
             if (is_auto_commit_) {
-                gstor_commit(((db_handle_t*)source_->GetStorageHandle())->handle);
+                TRACE_STORAGE_CALL("gstor_commit", gstor_commit(((db_handle_t*)source_->GetStorageHandle())->handle));
             }
         }
     }
@@ -189,7 +190,7 @@ void InsertExec::Insert(
     const std::map<std::string, std::unique_ptr<std::vector<std::vector<Column>>>> &insert_rows_map) {
     std::vector<std::vector<Column>> insert_rows;
     std::map<std::string, std::unique_ptr<std::vector<std::vector<Column>>>>::const_iterator it;
-    TIMESTATISTICS;
+    TRACE_SCOPE("InsertExec::Insert", TRACE_CAT_OPERATOR);
     bool has_lob_column = false;
     for (it = insert_rows_map.begin(); it != insert_rows_map.end(); ++it) {
         insert_rows.clear();
@@ -262,7 +263,7 @@ void InsertExec::GetTableDef(const TableInfo &table_info, const exp_table_meta &
         if (meta_info.part_table.keycols) {
             m_part_key_col_slot = meta_info.part_table.keycols->column_id;
         }
-        m_part_interval = std::string(meta_info.part_table.desc.interval.str);
+        m_part_hourly = table_info.IsHourlyPartition();
         m_part_type = meta_info.part_table.desc.parttype;
 
         for (uint32_t i = 0; i < meta_info.part_table.desc.partcnt; i++) {
@@ -322,17 +323,21 @@ void InsertExec::GetPartitionKey() {
             // !if is_crosspart, partition base on the first row
             return;
         }
-        if (m_part_key_value_.GetType() == GS_TYPE_TIMESTAMP || m_part_key_value_.GetType() == GS_TYPE_DATE) {
-            // YYYY-MM-DD HH
-            std::string str = m_part_key_value_.ToString();
-            m_part_key_key_ = str.substr(0, 4) + str.substr(5, 2) + str.substr(8, 2);
-            if (m_part_interval == PART_INTERVAL_HOUR) {
-                m_part_key_key_ += str.substr(11, 2);
-            }
-        } else {
-            m_part_key_key_ = m_part_key_value_.ToString();
+        m_part_key_key_ = PartitionKeyOf(m_part_key_value_);
+    }
+}
+
+auto InsertExec::PartitionKeyOf(const Value &value) const -> std::string {
+    if (value.GetType() == GS_TYPE_TIMESTAMP || value.GetType() == GS_TYPE_DATE) {
+        // YYYY-MM-DD HH
+        std::string str = value.ToString();
+        std::string key = str.substr(0, 4) + str.substr(5, 2) + str.substr(8, 2);
+        if (m_part_hourly) {
+            key += str.substr(11, 2);
         }
+        return key;
     }
+    return value.ToString();
 }
 
 void InsertExec::GetBoundValue(std::vector<Value>& row_in, std::vector<Column> &column_list, std::vector<Value> &autoincrement_list,
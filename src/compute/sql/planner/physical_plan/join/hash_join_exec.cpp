@@ -221,6 +221,7 @@ auto HashJoinExec::RightJoinNext() -> std::tuple<Record, knl_cursor_t*, bool> {
 }
 
 auto HashJoinExec::Next() -> std::tuple<Record, knl_cursor_t*, bool> {
+    TRACE_SCOPE("HashJoinExec::Next", TRACE_CAT_OPERATOR);
     if (join_type_ == JoinType::CrossJoin) {
         return CrossJoinNext();
     } else if (join_type_ == JoinType::LeftJoin) {
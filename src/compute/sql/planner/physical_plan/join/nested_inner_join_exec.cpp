@@ -25,6 +25,7 @@
 #include "planner/physical_plan/join/join_util.h"
 
 auto InnerJoinExec::Next() -> std::tuple<Record, knl_cursor_t*, bool> {
+    TRACE_SCOPE("InnerJoinExec::Next", TRACE_CAT_OPERATOR);
     std::tuple<Record, knl_cursor_t*, bool> result;
     if (join_type_ == JoinType::CrossJoin) {
         result = CrossJoinNext();
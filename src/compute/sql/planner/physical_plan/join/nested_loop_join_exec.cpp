@@ -73,6 +73,7 @@ auto NestedLoopJoinExec::Init() -> void {
 }
 
 auto NestedLoopJoinExec::Next() -> std::tuple<Record, knl_cursor_t*, bool> {
+    TRACE_SCOPE("NestedLoopJoinExec::Next", TRACE_CAT_OPERATOR);
     if (!init_) {
         Init();
     }
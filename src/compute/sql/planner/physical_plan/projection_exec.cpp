@@ -22,6 +22,8 @@
  */
 #include "planner/physical_plan/projection_exec.h"
 
+#include "planner/expressions/column_value_expression.h"
+
 ProjectionExec::ProjectionExec(PhysicalPlanPtr child, const Schema& schema,
                                std::vector<std::unique_ptr<Expression>> exprs)
     : child_(child), schema_(schema), exprs_(std::move(exprs)) {}
@@ -36,6 +38,7 @@ auto ProjectionExec::ToString() const -> std::string {
 }
 
 auto ProjectionExec::Next() -> std::tuple<Record, knl_cursor_t*, bool> {
+    TRACE_SCOPE("ProjectionExec::Next", TRACE_CAT_OPERATOR);
     const auto& headers = schema_.GetColumnInfos();
     auto&& [r, cur, eof] = child_->Next();
     if (eof) {
@@ -48,3 +51,41 @@ auto ProjectionExec::Next() -> std::tuple<Record, knl_cursor_t*, bool> {
     }
     return std::make_tuple(std::move(values), cur, eof);
 }
+
+// 输出列直接引用子节点的列时, 子节点的有序性可以透传
+static auto ChildColumn(const std::vector<std::unique_ptr<Expression>>& exprs, size_t idx) -> std::optional<size_t> {
+    if (idx >= exprs.size()) {
+        return std::nullopt;
+    }
+    auto col = dynamic_cast<const ColumnValueExpression*>(exprs[idx].get());
+    if (col == nullptr) {
+        return std::nullopt;
+    }
+    return col->GetColIdx();
+}
+
+auto ProjectionExec::LowerBoundOf(size_t col_idx) const -> std::optional<Value> {
+    auto child_col = ChildColumn(exprs_, col_idx);
+    if (!child_col) {
+        return std::nullopt;
+    }
+    return child_->LowerBoundOf(*child_col);
+}
+
+auto ProjectionExec::OrderedBy() const -> std::vector<size_t> {
+    std::vector<size_t> order;
+    for (auto child_col : child_->OrderedBy()) {
+        auto found = false;
+        for (size_t i = 0; i < exprs_.size(); ++i) {
+            if (ChildColumn(exprs_, i) == child_col) {
+                order.push_back(i);
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            break;
+        }
+    }
+    return order;
+}
@@ -36,6 +36,7 @@ std::string SeqScanExec::ToString() const {
 void SeqScanExec::init() { source_->Init(); }
 
 auto SeqScanExec::Next() -> std::tuple<Record, knl_cursor_t*, bool> {
+    TRACE_SCOPE("SeqScanExec::Next", TRACE_CAT_OPERATOR);
     if (!init_) {
         init();
         init_ = true;
@@ -278,7 +278,13 @@ void ShowExec::ShowVariables(RecordBatch &rb_out) {
         get_os_info(osinfo, 1024);
         row_values.push_back(Value(GStorDataType::GS_TYPE_VARCHAR, "osinfo"));
         row_values.push_back(Value(GStorDataType::GS_TYPE_VARCHAR, osinfo));
-        rb_out.AddRecord(Record(std::move(row_values)));      
+        rb_out.AddRecord(Record(std::move(row_values)));
+    } else if (variable_name == "retention") {
+        ShowRetention(rb_out);
+    } else if (variable_name == "commit") {
+        ShowCommit(rb_out);
+    } else if (variable_name == "kv_expire") {
+        ShowKvExpire(rb_out);
     }
     else {
         throw intarkdb::Exception(ExceptionType::CATALOG,
@@ -286,6 +292,118 @@ void ShowExec::ShowVariables(RecordBatch &rb_out) {
     }
 }
 
+// status of the kernel partition retention daemon
+void ShowExec::ShowRetention(RecordBatch &rb_out) {
+    knl_session_t *session = EC_SESSION(catalog_.GetStorageHandle()->handle);
+    knl_attr_t *attr = &session->kernel->attr;
+    retention_t *ctx = &session->kernel->retention_ctx;
+
+    auto date_to_str = [](date_t date) -> std::string {
+        char buf[GS_MAX_TIME_STRLEN] = {0};
+        if (date == 0 || cm_date2str(date, "yyyy-mm-dd hh24:mi:ss", buf, GS_MAX_TIME_STRLEN) != GS_SUCCESS) {
+            return "";
+        }
+        return buf;
+    };
+
+    cm_spin_lock(&ctx->lock, NULL);
+    std::vector<std::pair<std::string, std::string>> items = {
+        {"retention_interval", std::to_string(attr->part_retention_interval)},
+        {"retention_max_drops", std::to_string(attr->part_retention_max_drops)},
+        {"retention_working", ctx->working ? "true" : "false"},
+        {"retention_rounds", std::to_string(ctx->rounds)},
+        {"retention_checked_tables", std::to_string(ctx->checked_tables)},
+        {"retention_expired_parts", std::to_string(ctx->expired_parts)},
+        {"retention_dropped_parts", std::to_string(ctx->dropped_parts)},
+        {"retention_failed_drops", std::to_string(ctx->failed_drops)},
+        {"retention_last_round_time", date_to_str(ctx->last_round_time)},
+        {"retention_last_drop_time", date_to_str(ctx->last_drop_time)},
+        {"retention_last_drop_table", ctx->last_drop_table},
+        {"retention_last_drop_part", ctx->last_drop_part},
+        {"retention_last_errcode", std::to_string(ctx->last_errcode)},
+        {"retention_last_errmsg", ctx->last_errmsg},
+    };
+    cm_spin_unlock(&ctx->lock);
+
+    for (auto &item : items) {
+        std::vector<Value> row_values;
+        row_values.push_back(Value(GStorDataType::GS_TYPE_VARCHAR, item.first));
+        row_values.push_back(Value(GStorDataType::GS_TYPE_VARCHAR, item.second));
+        rb_out.AddRecord(Record(std::move(row_values)));
+    }
+}
+
+// group commit parameters and commit latency histogram
+void ShowExec::ShowCommit(RecordBatch &rb_out) {
+    knl_session_t *session = EC_SESSION(catalog_.GetStorageHandle()->handle);
+    knl_attr_t *attr = &session->kernel->attr;
+    log_stat_t *stat = &session->kernel->redo_ctx.stat;
+
+    auto average = [](uint64 total, uint64 count) -> std::string {
+        return count == 0 ? "0" : fmt::format("{:.2f}", (double)total / count);
+    };
+
+    std::vector<std::pair<std::string, std::string>> items = {
+        {"commit_delay_us", std::to_string(attr->commit_delay)},
+        {"commit_siblings", std::to_string(attr->commit_siblings)},
+        {"commit_batch_size", std::to_string(attr->commit_batch_size)},
+        {"commit_times", std::to_string(stat->commit_times)},
+        {"commit_avg_latency_us", average(stat->commit_elapsed, stat->commit_times)},
+        {"commit_batches", std::to_string(stat->commit_batches)},
+        {"commit_avg_batch_sessions", average(stat->commit_batch_sessions, stat->commit_batches)},
+        {"commit_delays", std::to_string(stat->commit_delays)},
+        {"commit_avg_delay_us", average(stat->commit_delay_elapsed, stat->commit_delays)},
+        {"redo_flush_times", std::to_string(stat->flush_times)},
+    };
+    const char *bounds[LOG_COMMIT_LATENCY_BUCKETS] = {"100us", "500us", "1ms", "5ms", "10ms", "50ms", "100ms", "inf"};
+    for (uint32 i = 0; i < LOG_COMMIT_LATENCY_BUCKETS; i++) {
+        items.emplace_back(fmt::format("commit_latency_le_{}", bounds[i]), std::to_string(stat->commit_latency[i]));
+    }
+
+    for (auto &item : items) {
+        std::vector<Value> row_values;
+        row_values.push_back(Value(GStorDataType::GS_TYPE_VARCHAR, item.first));
+        row_values.push_back(Value(GStorDataType::GS_TYPE_VARCHAR, item.second));
+        rb_out.AddRecord(Record(std::move(row_values)));
+    }
+}
+
+// status of the kernel kv key expiration daemon
+void ShowExec::ShowKvExpire(RecordBatch &rb_out) {
+    knl_session_t *session = EC_SESSION(catalog_.GetStorageHandle()->handle);
+    knl_attr_t *attr = &session->kernel->attr;
+    kv_expire_t *ctx = &session->kernel->kv_expire_ctx;
+
+    char last_round_time[GS_MAX_TIME_STRLEN] = {0};
+    cm_spin_lock(&ctx->lock, NULL);
+    if (ctx->last_round_time != 0) {
+        (void)cm_date2str(ctx->last_round_time, "yyyy-mm-dd hh24:mi:ss", last_round_time, GS_MAX_TIME_STRLEN);
+    }
+    std::vector<std::pair<std::string, std::string>> items = {
+        {"kv_expire_interval", std::to_string(attr->kv_expire_interval)},
+        {"kv_expire_batch", std::to_string(attr->kv_expire_batch)},
+        {"kv_expire_working", ctx->working ? "true" : "false"},
+        {"kv_expire_rounds", std::to_string(ctx->rounds)},
+        {"kv_expire_checked_tables", std::to_string(ctx->checked_tables)},
+        {"kv_expire_last_round_keys", std::to_string(ctx->last_round_keys)},
+        {"kv_expire_expired_keys", std::to_string(ctx->expired_keys)},
+        {"kv_expire_failed_batches", std::to_string(ctx->failed_batches)},
+        {"kv_expire_last_round_time", last_round_time},
+        {"kv_expire_last_errcode", std::to_string(ctx->last_errcode)},
+        {"kv_expire_last_errmsg", ctx->last_errmsg},
+        {"kv_expire_ttl_tables", std::to_string(ctx->table_count)},
+        {"kv_expire_idle_rounds", std::to_string(ctx->idle_rounds)},
+    };
+    cm_spin_unlock(&ctx->lock);
+
+    for (auto &item : items) {
+        std::vector<Value> row_values;
+        row_values.push_back(Value(GStorDataType::GS_TYPE_VARCHAR, item.first));
+        row_values.push_back(Value(GStorDataType::GS_TYPE_VARCHAR, item.second));
+        rb_out.AddRecord(Record(std::move(row_values)));
+    }
+}
+
 void ShowExec::ShowUsers(RecordBatch &rb_out) {
     std::vector<SchemaColumnInfo> columns = { 
             { {"__users_show", "user_name"}, "", GS_TYPE_VARCHAR, 0} };
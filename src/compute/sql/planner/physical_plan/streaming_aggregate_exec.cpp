@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+ *
+ * openGauss embedded is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ * http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ *
+ * streaming_aggregate_exec.cpp
+ *
+ * IDENTIFICATION
+ * openGauss-embedded/src/compute/sql/planner/physical_plan/streaming_aggregate_exec.cpp
+ *
+ * -------------------------------------------------------------------------
+ */
+#include "planner/physical_plan/streaming_aggregate_exec.h"
+
+#include <algorithm>
+
+StreamingAggregateExec::StreamingAggregateExec(std::vector<std::unique_ptr<Expression>> groupby,
+                                               std::vector<std::string> ops,
+                                               std::vector<std::unique_ptr<Expression>> be_group,
+                                               const std::vector<bool>& distincts, Schema schema, PhysicalPlanPtr child)
+    : AggregateExec(std::move(groupby), std::move(ops), std::move(be_group), distincts, std::move(schema), child) {}
+
+StreamingAggregateExec::StreamingAggregateExec(std::vector<std::unique_ptr<Expression>> groupby,
+                                               std::vector<std::string> ops,
+                                               std::vector<std::unique_ptr<Expression>> be_group,
+                                               const std::vector<bool>& distincts, Schema schema, PhysicalPlanPtr child,
+                                               size_t order_col, size_t bucket_key_idx)
+    : AggregateExec(std::move(groupby), std::move(ops), std::move(be_group), distincts, std::move(schema), child),
+      order_col_(order_col),
+      bucket_key_idx_(bucket_key_idx) {}
+
+auto StreamingAggregateExec::IsGroupedInput(const std::vector<std::unique_ptr<Expression>>& groupby,
+                                            const PhysicalPlan& child) -> bool {
+    if (groupby.empty()) {
+        return false;
+    }
+    std::vector<size_t> group_cols;
+    for (const auto& group : groupby) {
+        auto col = dynamic_cast<const ColumnValueExpression*>(group.get());
+        if (col == nullptr) {
+            return false;
+        }
+        group_cols.push_back(col->GetColIdx());
+    }
+    auto order = child.OrderedBy();
+    if (order.size() < group_cols.size()) {
+        return false;
+    }
+    // 分组键的顺序可以与排序列不同
+    order.resize(group_cols.size());
+    std::sort(order.begin(), order.end());
+    std::sort(group_cols.begin(), group_cols.end());
+    group_cols.erase(std::unique(group_cols.begin(), group_cols.end()), group_cols.end());
+    order.erase(std::unique(order.begin(), order.end()), order.end());
+    return order == group_cols;
+}
+
+void StreamingAggregateExec::Start() {
+    InitAggFuncs();
+    open_groups_.clear();
+    results_.clear();
+    watermark_.reset();
+    sorted_ = false;
+    checked_ = false;
+    child_eof_ = false;
+    idx_ = 0;
+    init_ = true;
+}
+
+void StreamingAggregateExec::CloseGroups(const Value& bound) {
+    // 只有 order_col_ 有值的行, 分组键表达式的其他参数都是常量
+    std::vector<Value> values(child_->GetSchema().GetColumnInfos().size(), ValueFactory::ValueNull());
+    values[*order_col_] = bound;
+    auto closed = groups_[bucket_key_idx_]->Evaluate(Record(std::move(values)));
+    if (closed.IsNull()) {
+        return;
+    }
+    for (auto iter = open_groups_.begin(); iter != open_groups_.end();) {
+        auto key = iter->first.Keys()[bucket_key_idx_];
+        if (!key.IsNull() && key.LessThan(closed) == Trivalent::TRI_TRUE) {
+            EmitGroup(iter->first, iter->second, results_);
+            iter = open_groups_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+auto StreamingAggregateExec::Next() -> std::tuple<Record, knl_cursor_t*, bool> {
+    TRACE_SCOPE("StreamingAggregateExec::Next", TRACE_CAT_OPERATOR);
+    if (!init_) {
+        Start();
+    }
+    while (idx_ >= results_.size()) {
+        results_.clear();
+        idx_ = 0;
+        if (child_eof_) {
+            init_ = false;
+            return {Record{}, nullptr, true};
+        }
+        auto&& [record, _, eof] = child_->Next();
+        if (eof) {
+            child_eof_ = true;
+            for (auto& [key, ctxs] : open_groups_) {
+                EmitGroup(key, ctxs, results_);
+            }
+            open_groups_.clear();
+            continue;
+        }
+
+        if (!checked_) {
+            // 子节点初始化后才能确认实际的扫描方式
+            sorted_ = !order_col_ && IsGroupedInput(groups_, *child_);
+            checked_ = true;
+        }
+
+        auto key = GroupKey(record);
+        auto iter = open_groups_.find(key);
+        if (iter != open_groups_.end()) {
+            UpdateGroup(record, iter->second, false);
+        } else {
+            if (sorted_) {
+                // 分组键变化, 之前的分组不会再有新行
+                for (auto& [open_key, ctxs] : open_groups_) {
+                    EmitGroup(open_key, ctxs, results_);
+                }
+                open_groups_.clear();
+            }
+            std::vector<AggContext> ctxs;
+            UpdateGroup(record, ctxs, true);
+            open_groups_.emplace(std::move(key), std::move(ctxs));
+        }
+
+        if (!order_col_) {
+            continue;
+        }
+        auto bound = child_->LowerBoundOf(*order_col_);
+        if (bound && (!watermark_ || watermark_->Equal(*bound) != Trivalent::TRI_TRUE)) {
+            watermark_ = bound;
+            CloseGroups(*bound);
+        }
+    }
+    std::tuple<Record, knl_cursor_t*, bool> r = {std::move(results_[idx_]), nullptr, false};
+    idx_++;
+    return r;
+}
@@ -23,6 +23,7 @@
 #include "planner/physical_plan/transaction_exec.h"
 
 #include "binder/statement/transaction_statement.h"
+#include "common/stat.h"
 #include "storage/db_handle.h"
 
 auto TransactionExec::Execute() const -> RecordBatch {
@@ -30,14 +31,14 @@ auto TransactionExec::Execute() const -> RecordBatch {
     int status = -1;
     switch (type) {
         case TransactionType::BEGIN_TRANSACTION:
-            status = gstor_commit(((db_handle_t*)handle)->handle);
-            status = gstor_begin(((db_handle_t*)handle)->handle);
+            status = TRACE_STORAGE_CALL("gstor_commit", gstor_commit(((db_handle_t*)handle)->handle));
+            status = TRACE_STORAGE_CALL("gstor_begin", gstor_begin(((db_handle_t*)handle)->handle));
             break;
         case TransactionType::COMMIT:
-            status = gstor_commit(((db_handle_t*)handle)->handle);
+            status = TRACE_STORAGE_CALL("gstor_commit", gstor_commit(((db_handle_t*)handle)->handle));
             break;
         case TransactionType::ROLLBACK:
-            status = gstor_rollback(((db_handle_t*)handle)->handle);
+            status = TRACE_STORAGE_CALL("gstor_rollback", gstor_rollback(((db_handle_t*)handle)->handle));
             break;
         default:
             throw std::invalid_argument(fmt::format("physical plan Transaction type {} not implemented yet",
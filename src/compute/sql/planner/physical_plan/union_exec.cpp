@@ -191,6 +191,7 @@ auto UnionExec::ExceptNext() -> std::tuple<Record, knl_cursor_t*, bool> {
 }
 
 auto UnionExec::Next() -> std::tuple<Record, knl_cursor_t*, bool> {
+    TRACE_SCOPE("UnionExec::Next", TRACE_CAT_OPERATOR);
     if (set_op_type_ == SetOperationType::UNION) {
         return UnionNext();
     } else if (set_op_type_ == SetOperationType::INTERSECT) {
@@ -203,6 +204,7 @@ auto UnionExec::Next() -> std::tuple<Record, knl_cursor_t*, bool> {
 }
 
 auto UnionJoinExec::Next() -> std::tuple<Record, knl_cursor_t*, bool> {
+    TRACE_SCOPE("UnionJoinExec::Next", TRACE_CAT_OPERATOR);
     if (!left_eof_) {
         while (true) {
             auto&& [record, cursor, eof] = left_->Next();
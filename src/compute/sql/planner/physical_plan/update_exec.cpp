@@ -30,6 +30,7 @@ auto UpdateExec::Children() const -> std::vector<PhysicalPlanPtr> { return {chil
 auto UpdateExec::ToString() const -> std::string {return "Update";}
 
 std::tuple<Record, knl_cursor_t *, bool> UpdateExec::Next(){
+    TRACE_SCOPE("UpdateExec::Next", TRACE_CAT_OPERATOR);
   while (true) {
         auto [r, cur, eof] = children_[0]->Next();
         if (eof) {
@@ -54,6 +54,7 @@ void ValuesExec::Execute(RecordBatch &rb) {
 }
 
 auto ValuesExec::Next() -> std::tuple<Record, knl_cursor_t *, bool> {
+    TRACE_SCOPE("ValuesExec::Next", TRACE_CAT_OPERATOR);
     Record rd;
     bool eof = true;
     if (idx_ < insert_values_.size()) {
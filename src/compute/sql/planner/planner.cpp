@@ -24,6 +24,7 @@
 
 #include <fmt/core.h>
 
+#include <optional>
 #include <set>
 #include <stdexcept>
 #include <utility>
@@ -52,6 +53,7 @@
 #include "common/compare_type.h"
 #include "common/exception.h"
 #include "common/expression_util.h"
+#include "common/stat.h"
 #include "planner/expression_iterator.h"
 #include "planner/expressions/case_expression.h"
 #include "planner/expressions/cast_expression.h"
@@ -112,6 +114,7 @@
 #include "planner/physical_plan/set_exec.h"
 #include "planner/physical_plan/show_exec.h"
 #include "planner/physical_plan/sort_exec.h"
+#include "planner/physical_plan/streaming_aggregate_exec.h"
 #include "planner/physical_plan/synonym_exec.h"
 #include "planner/physical_plan/transaction_exec.h"
 #include "planner/physical_plan/union_exec.h"
@@ -1132,7 +1135,52 @@ auto Planner::CreateProjectionExec(std::shared_ptr<ProjectionPlan> project_plan)
     return std::make_shared<ProjectionExec>(sub, Schema(std::move(cols)), std::move(exprs));
 }
 
+// time_bucket(interval, ts [, origin]) 中 interval 与 origin 为常量时, 分组键随 ts 单调不减,
+// 返回 (分组键下标, ts 在子节点中的列下标)
+static auto FindTimeBucketKey(const AggregatePlan& agg_plan) -> std::optional<std::pair<size_t, size_t>> {
+    for (size_t i = 0; i < agg_plan.group_by_.size(); ++i) {
+        const BoundExpression* group_expr = agg_plan.group_by_[i].get();
+        // GROUP BY 别名时分组键是别名表达式
+        if (group_expr->Type() == ExpressionType::ALIAS) {
+            group_expr = static_cast<const BoundAlias*>(group_expr)->child_.get();
+        }
+        if (group_expr->Type() != ExpressionType::FUNC_CALL) {
+            continue;
+        }
+        const auto& func_expr = static_cast<const BoundFuncExpr&>(*group_expr);
+        if (func_expr.funcname != "time_bucket" || func_expr.args.empty()) {
+            continue;
+        }
+        // INTERVAL n unit 绑定后展开为三个常量, 分组键中只允许时间列一个列引用.
+        // 常量的值在生成物理表达式时已被取走, 不能按值判断参数形式
+        size_t ts_idx = func_expr.args.size();
+        bool const_args = true;
+        for (size_t j = 0; j < func_expr.args.size(); ++j) {
+            auto type = func_expr.args[j]->Type();
+            if (type == ExpressionType::COLUMN_REF && ts_idx == func_expr.args.size()) {
+                ts_idx = j;
+            } else if (type != ExpressionType::LITERAL) {
+                const_args = false;
+            }
+        }
+        if (ts_idx == func_expr.args.size()) {
+            continue;
+        }
+        const auto& ts_ref = static_cast<const BoundColumnRef&>(*func_expr.args[ts_idx]);
+        if (!const_args || ts_ref.IsOuter()) {
+            continue;
+        }
+        auto col_idx = agg_plan.GetLastPlan()->GetSchema().GetIdxByNameWithoutException(ts_ref.GetName());
+        if (col_idx == INVALID_COLUMN_INDEX) {
+            continue;
+        }
+        return std::make_pair(i, static_cast<size_t>(col_idx));
+    }
+    return std::nullopt;
+}
+
 auto Planner::CreatePhysicalPlan(const LogicalPlanPtr& plan) -> PhysicalPlanPtr {
+    TRACE_SCOPE("Planner::CreatePhysicalPlan", TRACE_CAT_PHASE);
     switch (plan->Type()) {
         case LogicalPlanType::EmptySource: {
             std::shared_ptr<EmptySourcePlan> empty_plan = std::dynamic_pointer_cast<EmptySourcePlan>(plan);
@@ -1223,7 +1271,8 @@ auto Planner::CreatePhysicalPlan(const LogicalPlanPtr& plan) -> PhysicalPlanPtr
         }
         case LogicalPlanType::Drop: {
             std::shared_ptr<DropPlan> values = std::dynamic_pointer_cast<DropPlan>(plan);
-            return std::make_shared<DropExec>(catalog_, values->name, values->if_exists, values->type);
+            return std::make_shared<DropExec>(catalog_, values->name, values->if_exists, values->type,
+                                              values->schema);
         }
         case LogicalPlanType::NestedLoopJoin: {
             std::shared_ptr<NestedLoopJoinPlan> join_ref = std::dynamic_pointer_cast<NestedLoopJoinPlan>(plan);
@@ -1276,7 +1325,18 @@ auto Planner::CreatePhysicalPlan(const LogicalPlanPtr& plan) -> PhysicalPlanPtr
             for (size_t i = idx; i < columns.size(); ++i) {
                 cols.emplace_back(columns[i]);
             }
+            // 创建子节点会取走扫描计划中的表, 需要先查找分组键
+            auto bucket_key = FindTimeBucketKey(*agg_plan);
             auto child = CreatePhysicalPlan(agg_plan->GetLastPlan());
+            if (bucket_key) {
+                return std::make_shared<StreamingAggregateExec>(
+                    std::move(group_exprs), ops, std::move(agg_exprs), agg_plan->distincts, Schema(std::move(cols)),
+                    child, bucket_key->second, bucket_key->first);
+            }
+            if (StreamingAggregateExec::IsGroupedInput(group_exprs, *child)) {
+                return std::make_shared<StreamingAggregateExec>(std::move(group_exprs), ops, std::move(agg_exprs),
+                                                                agg_plan->distincts, Schema(std::move(cols)), child);
+            }
             return std::make_shared<AggregateExec>(std::move(group_exprs), ops, std::move(agg_exprs),
                                                    agg_plan->distincts, Schema(std::move(cols)), child);
         }
@@ -1420,6 +1480,7 @@ auto Planner::PlanUpdate(UpdateStatement& statement) -> LogicalPlanPtr {
 auto Planner::PlanDrop(DropStatement& statement) -> LogicalPlanPtr {
     LogicalPlanPtr plan =
         std::make_shared<DropPlan>(LogicalPlanType::Drop, statement.name, statement.if_exists, statement.type);
+    std::static_pointer_cast<DropPlan>(plan)->schema = statement.schema;
 
     return plan;
 }
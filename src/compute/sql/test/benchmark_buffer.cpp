@@ -0,0 +1,88 @@
+/*
+* Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+*
+* openGauss embedded is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+* http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+*
+* benchmark_buffer.cpp
+*
+* IDENTIFICATION
+* openGauss-embedded/src/compute/sql/test/benchmark_buffer.cpp
+*
+* -------------------------------------------------------------------------
+*/
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "main/connection.h"
+#include "main/database.h"
+
+// primary key lookups read the same index root and branch pages, which makes buffer lookup and latching the
+// contended path when sessions run in parallel
+const std::string kTableName("buffer_bench");
+const int kRows = 100000;
+
+std::shared_ptr<IntarkDB> db_instance = nullptr;
+
+void setup() {
+    db_instance = std::shared_ptr<IntarkDB>(IntarkDB::GetInstance("./"));
+    db_instance->Init();
+
+    Connection conn(db_instance);
+    conn.Init();
+    conn.Query(fmt::format("drop table if exists {};", kTableName).c_str());
+    conn.Query(fmt::format("create table {} (id integer PRIMARY KEY, val varchar(100));", kTableName).c_str());
+    conn.Query("begin;");
+    for (int i = 0; i < kRows; ++i) {
+        conn.Query(fmt::format("insert into {} values({}, 'value_{}');", kTableName, i, i).c_str());
+    }
+    conn.Query("commit;");
+}
+
+static void bench_point_select(benchmark::State& state)
+{
+    // each thread has its own session, only the buffer pool is shared
+    Connection conn(db_instance);
+    conn.Init();
+
+    std::default_random_engine generator(state.thread_index());
+    std::uniform_int_distribution<int> id_v(0, state.range(0) - 1);
+
+    for (auto _: state) {
+        std::string select_q(fmt::format("select val from {} where id = {};", kTableName, id_v(generator)));
+        auto result = conn.Query(select_q.c_str());
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bench_point_select)
+    ->Arg(100)      // state.range(0) - hot rows, a few pages
+    ->Arg(kRows)    // the whole table, still in buffer
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+int main(int argc, char** argv) {
+    char arg0_default[] = "benchmark";
+    char* args_default = arg0_default;
+    if (!argv) {
+      argc = 1;
+      argv = &args_default;
+    }
+    setup();
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
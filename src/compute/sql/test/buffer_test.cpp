@@ -0,0 +1,185 @@
+/*
+* Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+*
+* openGauss embedded is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+* http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+*
+* buffer_test.cpp
+*
+* IDENTIFICATION
+* openGauss-embedded/src/compute/sql/test/buffer_test.cpp
+*
+* -------------------------------------------------------------------------
+*/
+// test for the buffer pool under concurrent shared readers, exclusive writers and eviction
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "main/connection.h"
+#include "main/database.h"
+
+// a small pool, the cold table does not fit into it so that its scans keep evicting pages
+const char *kBufferPath = "./buffer_db";
+const int kHotRows = 200;
+const int kColdRows = 120000;
+const int kColdBatch = 500;
+const int kReaders = 8;
+const int kWriters = 2;
+const int kScanners = 2;
+const int kRunSeconds = 5;
+
+class BufferTest : public ::testing::Test {
+   protected:
+    BufferTest() {}
+    ~BufferTest() {}
+    static void SetUpTestSuite() {
+        std::string cfg_path = std::string(kBufferPath) + "/intarkdb/cfg";
+        system(fmt::format("rm -rf {} && mkdir -p {}", kBufferPath, cfg_path).c_str());
+        std::ofstream ini(cfg_path + "/intarkdb.ini");
+        ini << "DATA_BUFFER_SIZE = 10M" << std::endl;
+        ini.close();
+
+        db_instance = std::shared_ptr<IntarkDB>(IntarkDB::GetInstance(kBufferPath));
+        db_instance->Init();
+        conn = std::make_unique<Connection>(db_instance);
+        conn->Init();
+    }
+
+    static void TearDownTestSuite() {
+        conn.reset();
+    }
+
+    void SetUp() override {}
+
+    static std::shared_ptr<IntarkDB> db_instance;
+    static std::unique_ptr<Connection> conn;
+};
+
+std::shared_ptr<IntarkDB> BufferTest::db_instance = nullptr;
+std::unique_ptr<Connection> BufferTest::conn = nullptr;
+
+static uint64_t BufferPoolColumn(Connection &conn, const char *column) {
+    auto result = conn.Query(fmt::format("select {} from dv_buffer_pool", column).c_str());
+    EXPECT_TRUE(result->GetRetCode() == GS_SUCCESS) << result->GetRetMsg();
+    return result->RowRef(0).Field(0).GetCastAs<uint64_t>();
+}
+
+// point selects take the pages of the hot index and rows in shared mode while writers latch the same pages
+// exclusively and full scans of the cold table recycle the rest of the pool. every row is updated as a whole,
+// so a reader must never see its two columns differ
+TEST_F(BufferTest, HotPagesUnderWritersAndEviction) {
+    ASSERT_TRUE(conn->Query("create table buf_hot (id int primary key, a int, b int)")->GetRetCode() == GS_SUCCESS);
+    ASSERT_TRUE(conn->Query("create table buf_cold (id int, pad varchar(200))")->GetRetCode() == GS_SUCCESS);
+    conn->Query("begin");
+    for (int i = 0; i < kHotRows; i++) {
+        ASSERT_TRUE(conn->Query(fmt::format("insert into buf_hot values ({}, 0, 0)", i).c_str())->GetRetCode() ==
+                    GS_SUCCESS);
+    }
+    std::string pad(200, 'x');
+    for (int i = 0; i < kColdRows; i += kColdBatch) {
+        std::vector<std::string> values;
+        for (int j = i; j < i + kColdBatch; j++) {
+            values.push_back(fmt::format("({}, '{}')", j, pad));
+        }
+        ASSERT_TRUE(conn->Query(fmt::format("insert into buf_cold values {}", fmt::join(values, ", ")).c_str())
+                        ->GetRetCode() == GS_SUCCESS);
+    }
+    ASSERT_TRUE(conn->Query("commit")->GetRetCode() == GS_SUCCESS);
+
+    auto disk_reads = BufferPoolColumn(*conn, "disk_reads");
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> reads{0};
+    std::atomic<uint64_t> updates{0};
+    std::atomic<uint64_t> scans{0};
+    std::atomic<uint64_t> errors{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kReaders; t++) {
+        threads.emplace_back([&, t] {
+            Connection session(db_instance);
+            session.Init();
+            std::default_random_engine generator(t);
+            std::uniform_int_distribution<int> id(0, kHotRows - 1);
+            while (!stop.load()) {
+                auto result =
+                    session.Query(fmt::format("select a, b from buf_hot where id = {}", id(generator)).c_str());
+                if (result->GetRetCode() != GS_SUCCESS || result->RowCount() != 1 ||
+                    result->RowRef(0).Field(0).GetCastAs<int64_t>() !=
+                        result->RowRef(0).Field(1).GetCastAs<int64_t>()) {
+                    errors++;
+                }
+                reads++;
+            }
+        });
+    }
+    for (int t = 0; t < kWriters; t++) {
+        threads.emplace_back([&, t] {
+            Connection session(db_instance);
+            session.Init();
+            std::default_random_engine generator(kReaders + t);
+            std::uniform_int_distribution<int> id(0, kHotRows - 1);
+            while (!stop.load()) {
+                auto result = session.Query(
+                    fmt::format("update buf_hot set a = a + 1, b = b + 1 where id = {}", id(generator)).c_str());
+                if (result->GetRetCode() != GS_SUCCESS) {
+                    errors++;
+                    continue;
+                }
+                updates++;
+            }
+        });
+    }
+    for (int t = 0; t < kScanners; t++) {
+        threads.emplace_back([&] {
+            Connection session(db_instance);
+            session.Init();
+            while (!stop.load()) {
+                auto result = session.Query("select count(*) from buf_cold");
+                if (result->GetRetCode() != GS_SUCCESS ||
+                    result->RowRef(0).Field(0).GetCastAs<int64_t>() != kColdRows) {
+                    errors++;
+                }
+                scans++;
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::seconds(kRunSeconds));
+    stop = true;
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(errors.load(), 0);
+    EXPECT_GT(reads.load(), 0);
+    EXPECT_GT(updates.load(), 0);
+    EXPECT_GT(scans.load(), 0);
+    // the cold table is larger than the pool, its scans kept reading pages that had been evicted
+    EXPECT_GT(BufferPoolColumn(*conn, "disk_reads"), disk_reads);
+
+    auto result = conn->Query("select count(*), sum(a), sum(b) from buf_hot");
+    ASSERT_TRUE(result->GetRetCode() == GS_SUCCESS) << result->GetRetMsg();
+    EXPECT_EQ(result->RowRef(0).Field(0).GetCastAs<int64_t>(), kHotRows);
+    EXPECT_EQ(result->RowRef(0).Field(1).GetCastAs<uint64_t>(), updates.load());
+    EXPECT_EQ(result->RowRef(0).Field(2).GetCastAs<uint64_t>(), updates.load());
+}
+
+int main(int argc, char** argv) {
+    ::testing::GTEST_FLAG(output) = "xml";
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
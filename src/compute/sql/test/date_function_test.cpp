@@ -208,4 +208,80 @@ TEST_F(DateFunctionTest, date_sub_month) {
     EXPECT_EQ(detail.year, 2023);
     EXPECT_EQ(detail.mon, 2);
     EXPECT_EQ(detail.day, 28);
-}
\ No newline at end of file
+}
+
+TEST_F(DateFunctionTest, time_bucket) {
+    auto r = conn->Query("select time_bucket(interval 15 minute, '2024-01-01 10:07:33'::timestamp)");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    EXPECT_EQ(r->RowCount(), 1);
+    auto date = r->Row(0).Field(0).GetCastAs<timestamp_stor_t>();
+    date_detail_t detail;
+    date.ts += TIMEZONE_GET_MICROSECOND(cm_get_db_timezone());
+    date.ts += CM_UNIX_EPOCH;
+    cm_decode_date(date.ts, &detail);
+    EXPECT_EQ(detail.hour, 10);
+    EXPECT_EQ(detail.min, 0);
+    EXPECT_EQ(detail.sec, 0);
+
+    r = conn->Query("select time_bucket('15 minutes', '2024-01-01 10:07:33', '2024-01-01 00:05:00')");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    date = r->Row(0).Field(0).GetCastAs<timestamp_stor_t>();
+    date.ts += TIMEZONE_GET_MICROSECOND(cm_get_db_timezone());
+    date.ts += CM_UNIX_EPOCH;
+    cm_decode_date(date.ts, &detail);
+    EXPECT_EQ(detail.hour, 10);
+    EXPECT_EQ(detail.min, 5);
+
+    // 非固定宽度的单位不支持
+    r = conn->Query("select time_bucket(interval 1 month, '2024-01-01 10:07:33'::timestamp)");
+    EXPECT_NE(r->GetRetCode(), 0);
+}
+
+TEST_F(DateFunctionTest, time_bucket_group_by) {
+    conn->Query(
+        "create table time_bucket_test(ts timestamp, v int) partition by range(ts) timescale interval '1h' "
+        "retention '30d' autopart");
+    conn->Query(
+        "insert into time_bucket_test values ('2024-01-01 10:07:00', 1), ('2024-01-01 10:37:00', 2), "
+        "('2024-01-01 11:07:00', 3), ('2024-01-01 12:59:00', 4), ('2024-01-01 11:55:00', 5), "
+        "('2024-01-01 10:59:59', 6)");
+    auto r = conn->Query(
+        "select time_bucket(interval 30 minute, ts) b, count(*), sum(v) from time_bucket_test group by b order by b");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    ASSERT_EQ(r->RowCount(), 5);
+    std::vector<int64_t> counts = {1, 2, 1, 1, 1};
+    std::vector<int64_t> sums = {1, 8, 3, 5, 4};
+    for (size_t i = 0; i < counts.size(); ++i) {
+        EXPECT_EQ(r->Row(i).Field(1).GetCastAs<int64_t>(), counts[i]);
+        EXPECT_EQ(r->Row(i).Field(2).GetCastAs<int64_t>(), sums[i]);
+    }
+
+    r = conn->Query("select time_bucket('2 hours', ts) b, count(*) from time_bucket_test group by b order by b");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    ASSERT_EQ(r->RowCount(), 2);
+    EXPECT_EQ(r->Row(0).Field(1).GetCastAs<int64_t>(), 5);
+    EXPECT_EQ(r->Row(1).Field(1).GetCastAs<int64_t>(), 1);
+}
+
+TEST_F(DateFunctionTest, time_bucket_group_by_crosspart) {
+    // a crosspart table stores a whole insert batch in the partition of its first row
+    conn->Query(
+        "create table time_bucket_cross(ts timestamp, v int) partition by range(ts) timescale interval '1h' "
+        "retention '30d' autopart crosspart");
+    auto r = conn->Query("insert into time_bucket_cross values ('2024-01-01 10:07:00', 1)");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    r = conn->Query(
+        "insert into time_bucket_cross values ('2024-01-01 12:59:00', 4), ('2024-01-01 10:37:00', 2), "
+        "('2024-01-01 11:07:00', 3)");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    r = conn->Query(
+        "select time_bucket(interval 1 hour, ts) b, count(*), sum(v) from time_bucket_cross group by b order by b");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    ASSERT_EQ(r->RowCount(), 3);
+    std::vector<int64_t> counts = {2, 1, 1};
+    std::vector<int64_t> sums = {3, 3, 4};
+    for (size_t i = 0; i < counts.size(); ++i) {
+        EXPECT_EQ(r->Row(i).Field(1).GetCastAs<int64_t>(), counts[i]);
+        EXPECT_EQ(r->Row(i).Field(2).GetCastAs<int64_t>(), sums[i]);
+    }
+}
@@ -363,6 +363,41 @@ TEST_F(IndexTest, CreateIndexOnTinyInt) {
     ASSERT_EQ(result->RowCount(), 1);
 }
 
+TEST_F(IndexTest, GroupByIndexOrderedScan) {
+    std::string tablename("index_group_by");
+    auto result = conn->Query(fmt::format("create table {} (device int, ts int, v int);", tablename).c_str());
+    EXPECT_TRUE(result->GetRetCode() == GS_SUCCESS);
+    result = conn->Query(fmt::format("create index idx_index_group_by on {}(device, ts);", tablename).c_str());
+    EXPECT_TRUE(result->GetRetCode() == GS_SUCCESS);
+    result = conn->Query(
+        fmt::format("insert into {} values(2, 1, 10),(1, 2, 20),(3, 3, 30),(2, 4, 40),(1, 5, 50),(2, 6, 60);",
+                    tablename)
+            .c_str());
+    EXPECT_TRUE(result->GetRetCode() == GS_SUCCESS);
+
+    // 索引扫描按 device 有序返回, 分组键变化即输出
+    result = conn->Query(
+        fmt::format("select device, count(*), sum(v) from {} where device >= 1 group by device;", tablename).c_str());
+    ASSERT_TRUE(result->GetRetCode() == GS_SUCCESS);
+    ASSERT_EQ(result->RowCount(), 3);
+    std::vector<int64_t> counts = {2, 3, 1};
+    std::vector<int64_t> sums = {70, 110, 30};
+    for (size_t i = 0; i < counts.size(); ++i) {
+        EXPECT_EQ(result->Row(i).Field(0).GetCastAs<int32_t>(), static_cast<int32_t>(i + 1));
+        EXPECT_EQ(result->Row(i).Field(1).GetCastAs<int64_t>(), counts[i]);
+        EXPECT_EQ(result->Row(i).Field(2).GetCastAs<int64_t>(), sums[i]);
+    }
+
+    // 子查询排序后的输入
+    result = conn->Query(
+        fmt::format("select device, count(*) from (select device from {} order by device) group by device limit 1;",
+                    tablename)
+            .c_str());
+    ASSERT_TRUE(result->GetRetCode() == GS_SUCCESS);
+    ASSERT_EQ(result->RowCount(), 1);
+    EXPECT_EQ(result->Row(0).Field(1).GetCastAs<int64_t>(), 2);
+}
+
 int main(int argc, char** argv) {
     ::testing::GTEST_FLAG(output) = "xml";
     ::testing::InitGoogleTest(&argc, argv);
@@ -25,9 +25,11 @@
 #include <ctime>
 #include <iomanip>
 #include <iostream>
+#include <thread>
 
 #include "catalog/catalog.h"
 #include "catalog/table_info.h"
+#include "common/query_metrics.h"
 #include "main/connection.h"
 #include "main/database.h"
 
@@ -362,3 +364,73 @@ TEST_F(ConnectionForPrepare , PrepareWithBinaryOp) {
     ASSERT_EQ(r->GetRetCode(), 0);
 
 }
+
+TEST_F(ConnectionForPrepare , PrepareExecuteStreaming) {
+    conn->Query("drop table if exists test_stream");
+    conn->Query("create table test_stream (id int, name varchar(20))");
+    conn->Query("insert into test_stream values (1, 'a'), (2, 'b'), (3, 'c'), (4, 'd')");
+    auto stmt = conn->Prepare("select id, name from test_stream where id > ?");
+    ASSERT_EQ(stmt->HasError(), false);
+
+    auto stream = stmt->ExecuteStreaming({ValueFactory::ValueInt(1)});
+    ASSERT_EQ(stream->GetRetCode(), 0);
+    ASSERT_EQ(stream->ColumnCount(), 2);
+    std::vector<int32_t> ids;
+    while (true) {
+        auto [record, eof] = stream->Next();
+        if (eof) {
+            break;
+        }
+        ids.push_back(record.Field(0).GetCastAs<int32_t>());
+    }
+    EXPECT_EQ(ids, std::vector<int32_t>({2, 3, 4}));
+
+    // the statement can be streamed again with new values
+    stream = stmt->ExecuteStreaming({ValueFactory::ValueInt(3)});
+    ASSERT_EQ(stream->GetRetCode(), 0);
+    auto [record, eof] = stream->Next();
+    ASSERT_FALSE(eof);
+    EXPECT_EQ(record.Field(1).GetCastAs<std::string>(), "d");
+    EXPECT_TRUE(std::get<1>(stream->Next()));
+
+    EXPECT_NE(stmt->ExecuteStreaming({})->GetRetCode(), 0);
+    auto insert = conn->Prepare("insert into test_stream values (?, ?)");
+    ASSERT_EQ(insert->HasError(), false);
+    EXPECT_NE(insert->ExecuteStreaming({ValueFactory::ValueInt(5), ValueFactory::ValueVarchar("e")})->GetRetCode(), 0);
+}
+
+TEST_F(ConnectionForPrepare, QueryMetricsCountStatements) {
+    auto at = [](const QueryMetrics::Snapshot &snapshot, StatementType type) {
+        return snapshot[static_cast<size_t>(type)];
+    };
+    conn->Query("drop table if exists test_query_metrics");
+    conn->Query("create table test_query_metrics (id int)");
+    auto before = QueryMetrics::Collect();
+
+    auto stmt = conn->Prepare("insert into test_query_metrics values (?)");
+    ASSERT_EQ(stmt->HasError(), false);
+    EXPECT_EQ(stmt->Execute({ValueFactory::ValueInt(1)})->GetRetCode(), 0);
+    EXPECT_EQ(stmt->Execute({ValueFactory::ValueInt(2)})->GetRetCode(), 0);
+    EXPECT_EQ(conn->Query("select * from test_query_metrics")->GetRetCode(), 0);
+    EXPECT_NE(conn->Query("select * from test_query_metrics where no_such_column = 1")->GetRetCode(), 0);
+    // counters recorded by another thread are summed in as well
+    std::thread([] { QueryMetrics::Record(StatementType::UPDATE_STATEMENT, 3000, false); }).join();
+
+    auto after = QueryMetrics::Collect();
+    auto inserts = at(after, StatementType::INSERT_STATEMENT).count - at(before, StatementType::INSERT_STATEMENT).count;
+    auto selects = at(after, StatementType::SELECT_STATEMENT).count - at(before, StatementType::SELECT_STATEMENT).count;
+    // a statement that fails to bind has no type yet
+    auto invalid_errors =
+        at(after, StatementType::INVALID_STATEMENT).errors - at(before, StatementType::INVALID_STATEMENT).errors;
+    auto updates = at(after, StatementType::UPDATE_STATEMENT);
+    EXPECT_EQ(inserts, 2);
+    EXPECT_EQ(selects, 1);
+    EXPECT_EQ(invalid_errors, 1);
+    EXPECT_GE(updates.count, 1);
+    EXPECT_GE(updates.buckets[5], 1);  // 3ms falls in the (2.5ms, 5ms] bucket
+    uint64_t bucket_total = 0;
+    for (auto n : updates.buckets) {
+        bucket_total += n;
+    }
+    EXPECT_EQ(bucket_total, updates.count);
+}
@@ -0,0 +1,118 @@
+/*
+* Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+*
+* openGauss embedded is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+* http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+*
+* recovery_test.cpp
+*
+* IDENTIFICATION
+* openGauss-embedded/src/compute/sql/test/recovery_test.cpp
+*
+* -------------------------------------------------------------------------
+*/
+// test for crash recovery, the redo of a killed process is replayed with the default LOG_REPLAY_PROCESSES
+#include <gtest/gtest.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include "main/connection.h"
+#include "main/database.h"
+
+const char *kRecoveryPath = "./recovery_db";
+const int kRecoveryRows = 20000;
+const int kRecoveryBatch = 500;
+
+// runs in a child process that is killed after its last commit, nothing is checkpointed or shut down
+static void WriteAndCrash() {
+    auto db_instance = std::shared_ptr<IntarkDB>(IntarkDB::GetInstance(kRecoveryPath));
+    db_instance->Init();
+    Connection conn(db_instance);
+    conn.Init();
+
+    if (conn.Query("create table rcy_table (id int primary key, val int, name varchar(50))")->GetRetCode() !=
+        GS_SUCCESS) {
+        _exit(1);
+    }
+    for (int i = 0; i < kRecoveryRows; i += kRecoveryBatch) {
+        std::vector<std::string> values;
+        for (int j = i; j < i + kRecoveryBatch; j++) {
+            values.push_back(fmt::format("({}, {}, 'name_{}')", j, j, j));
+        }
+        if (conn.Query(fmt::format("insert into rcy_table values {}", fmt::join(values, ", ")).c_str())
+                ->GetRetCode() != GS_SUCCESS) {
+            _exit(1);
+        }
+    }
+    // committed updates and deletes are replayed as well, the last transaction is lost with the process
+    if (conn.Query("update rcy_table set val = val * 2 where id % 2 = 0")->GetRetCode() != GS_SUCCESS ||
+        conn.Query("delete from rcy_table where id >= 19000")->GetRetCode() != GS_SUCCESS ||
+        conn.Query("begin")->GetRetCode() != GS_SUCCESS ||
+        conn.Query("delete from rcy_table where id < 1000")->GetRetCode() != GS_SUCCESS) {
+        _exit(1);
+    }
+    raise(SIGKILL);
+}
+
+TEST(RecoveryTest, ReplayRedoAfterCrash) {
+    system(fmt::format("rm -rf {}", kRecoveryPath).c_str());
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        WriteAndCrash();
+        _exit(1);
+    }
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFSIGNALED(status) && WTERMSIG(status) == SIGKILL) << "writer exited with " << status;
+
+    auto db_instance = std::shared_ptr<IntarkDB>(IntarkDB::GetInstance(kRecoveryPath));
+    db_instance->Init();
+    Connection conn(db_instance);
+    conn.Init();
+
+    auto result = conn.Query("select count(*), min(id), max(id), sum(val) from rcy_table");
+    ASSERT_TRUE(result->GetRetCode() == GS_SUCCESS) << result->GetRetMsg();
+    int64_t expect_sum = 0;
+    for (int i = 0; i < 19000; i++) {
+        expect_sum += i % 2 == 0 ? i * 2 : i;
+    }
+    EXPECT_EQ(result->RowRef(0).Field(0).GetCastAs<int64_t>(), 19000);
+    EXPECT_EQ(result->RowRef(0).Field(1).GetCastAs<int64_t>(), 0);
+    EXPECT_EQ(result->RowRef(0).Field(2).GetCastAs<int64_t>(), 18999);
+    EXPECT_EQ(result->RowRef(0).Field(3).GetCastAs<int64_t>(), expect_sum);
+
+    // the index was recovered together with the heap
+    result = conn.Query("select val, name from rcy_table where id = 12346");
+    ASSERT_EQ(result->RowCount(), 1);
+    EXPECT_EQ(result->RowRef(0).Field(0).GetCastAs<int64_t>(), 24692);
+    EXPECT_EQ(result->RowRef(0).Field(1).GetCastAs<std::string>(), "name_12346");
+
+    // the redo was replayed by more than one process
+    result = conn.Query("select rcy_replay_bytes, rcy_replay_processes from dv_redo_checkpoint");
+    ASSERT_TRUE(result->GetRetCode() == GS_SUCCESS) << result->GetRetMsg();
+    EXPECT_GT(result->RowRef(0).Field(0).GetCastAs<int64_t>(), 0);
+    EXPECT_GT(result->RowRef(0).Field(1).GetCastAs<int64_t>(), 1);
+
+    // the recovered database takes new writes
+    EXPECT_TRUE(conn.Query("insert into rcy_table values (19000, 1, 'again')")->GetRetCode() == GS_SUCCESS);
+}
+
+int main(int argc, char** argv) {
+    ::testing::GTEST_FLAG(output) = "xml";
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
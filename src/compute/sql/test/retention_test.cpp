@@ -0,0 +1,176 @@
+/*
+* Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+*
+* openGauss embedded is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+* http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+*
+* retention_test.cpp
+*
+* IDENTIFICATION
+* openGauss-embedded/src/compute/sql/test/retention_test.cpp
+*
+* -------------------------------------------------------------------------
+*/
+// test for the partition retention daemon
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <ctime>
+#include <fstream>
+
+#include "catalog/table_info.h"
+#include "main/connection.h"
+#include "main/database.h"
+
+// the daemon runs every PART_RETENTION_INTERVAL seconds, the test database gets its own
+// directory and config so that other tests keep the default of 60 seconds
+const char *kRetentionPath = "./retention_db";
+const int kRetentionWaitSeconds = 10;
+
+// output: like "2024-10-15 12:00:00" or "20241015" for the partition name, days_ago days before today
+std::string GetDayTime(int days_ago, bool partkey) {
+    auto time_point = std::chrono::system_clock::now() - std::chrono::hours(24 * days_ago);
+    std::time_t tt = std::chrono::system_clock::to_time_t(time_point);
+    auto time_tm = localtime(&tt);
+    char str_time[25] = {0};
+    if (partkey) {
+        sprintf(str_time, "%d%02d%02d", time_tm->tm_year + 1900, time_tm->tm_mon + 1, time_tm->tm_mday);
+    } else {
+        sprintf(str_time, "%d-%02d-%02d 12:00:00", time_tm->tm_year + 1900, time_tm->tm_mon + 1,
+                time_tm->tm_mday);
+    }
+    return std::string(str_time);
+}
+
+class RetentionTest : public ::testing::Test {
+   protected:
+    RetentionTest() {}
+    ~RetentionTest() {}
+    static void SetUpTestSuite() {
+        std::string cfg_path = std::string(kRetentionPath) + "/intarkdb/cfg";
+        system(fmt::format("rm -rf {} && mkdir -p {}", kRetentionPath, cfg_path).c_str());
+        std::ofstream ini(cfg_path + "/intarkdb.ini");
+        ini << "PART_RETENTION_INTERVAL = 1" << std::endl;
+        ini.close();
+
+        db_instance = std::shared_ptr<IntarkDB>(IntarkDB::GetInstance(kRetentionPath));
+        db_instance->Init();
+        conn = std::make_unique<Connection>(db_instance);
+        conn->Init();
+    }
+
+    static void TearDownTestSuite() {
+        conn.reset();
+    }
+
+    void SetUp() override {}
+
+    static std::shared_ptr<IntarkDB> db_instance;
+    static std::unique_ptr<Connection> conn;
+};
+
+std::shared_ptr<IntarkDB> RetentionTest::db_instance = nullptr;
+std::unique_ptr<Connection> RetentionTest::conn = nullptr;
+
+TEST_F(RetentionTest, DropExpiredPartition) {
+    std::string tablename("tbp_retention_drop");
+    auto result = conn->Query(fmt::format("CREATE TABLE {} (id int, date timestamp, value int) PARTITION BY "
+                                          "RANGE(date) timescale interval '1d' retention '2d' autopart;",
+                                          tablename)
+                                  .c_str());
+    ASSERT_TRUE(result->GetRetCode() == GS_SUCCESS);
+
+    // one partition well past the retention window and one of today
+    std::string expired_part(tablename + "_" + GetDayTime(5, true));
+    result = conn->Query(fmt::format("INSERT INTO {} VALUES (1, '{}', 1), (2, '{}', 2), (3, '{}', 3);", tablename,
+                                     GetDayTime(5, false), GetDayTime(5, false), GetDayTime(0, false))
+                             .c_str());
+    ASSERT_TRUE(result->GetRetCode() == GS_SUCCESS);
+    EXPECT_EQ(conn->GetTableInfo(tablename)->GetTableMetaInfo().part_table.desc.partcnt, 2);
+
+    uint32_t partcnt = 2;
+    for (int i = 0; i < kRetentionWaitSeconds && partcnt != 1; i++) {
+        sleep(1);
+        partcnt = conn->GetTableInfo(tablename)->GetTableMetaInfo().part_table.desc.partcnt;
+    }
+    EXPECT_EQ(partcnt, 1);
+
+    // the expired partition is gone together with its rows, the partition of today is kept
+    result = conn->Query(fmt::format("ALTER TABLE {} DROP PARTITION {};", tablename, expired_part).c_str());
+    EXPECT_TRUE(result->GetRetCode() == GS_ERROR);
+    EXPECT_STREQ(result->GetRetMsg().c_str(), fmt::format("Binder Error: part {} not exists!", expired_part).c_str());
+
+    result = conn->Query(fmt::format("SELECT id FROM {};", tablename).c_str());
+    ASSERT_TRUE(result->GetRetCode() == GS_SUCCESS);
+    ASSERT_EQ(result->RowCount(), 1);
+    EXPECT_EQ(result->RowRef(0).Field(0).GetCastAs<int32_t>(), 3);
+
+    result = conn->Query("show variables like 'retention'");
+    ASSERT_TRUE(result->GetRetCode() == GS_SUCCESS);
+    EXPECT_EQ(result->RowRef(0).Field(1).GetCastAs<std::string>(), "1");
+    EXPECT_EQ(result->RowRef(6).Field(0).GetCastAs<std::string>(), "retention_dropped_parts");
+    EXPECT_EQ(result->RowRef(6).Field(1).GetCastAs<std::string>(), "1");
+    EXPECT_EQ(result->RowRef(11).Field(0).GetCastAs<std::string>(), "retention_last_drop_part");
+    EXPECT_EQ(result->RowRef(11).Field(1).GetCastAs<std::string>(), expired_part);
+}
+
+TEST_F(RetentionTest, KeepPartitionWithinRetention) {
+    std::string tablename("tbp_retention_keep");
+    auto result = conn->Query(fmt::format("CREATE TABLE {} (id int, date timestamp, value int) PARTITION BY "
+                                          "RANGE(date) timescale interval '1d' retention '30d' autopart;",
+                                          tablename)
+                                  .c_str());
+    ASSERT_TRUE(result->GetRetCode() == GS_SUCCESS);
+    result = conn->Query(fmt::format("INSERT INTO {} VALUES (1, '{}', 1), (2, '{}', 2);", tablename,
+                                     GetDayTime(5, false), GetDayTime(0, false))
+                             .c_str());
+    ASSERT_TRUE(result->GetRetCode() == GS_SUCCESS);
+
+    // a few rounds of the daemon, nothing of this table is older than 30 days
+    sleep(3);
+    EXPECT_EQ(conn->GetTableInfo(tablename)->GetTableMetaInfo().part_table.desc.partcnt, 2);
+    result = conn->Query(fmt::format("SELECT id FROM {};", tablename).c_str());
+    ASSERT_TRUE(result->GetRetCode() == GS_SUCCESS);
+    EXPECT_EQ(result->RowCount(), 2);
+}
+
+// a round checks at most 256 tables, the next round goes on where it stopped
+TEST_F(RetentionTest, DropExpiredPartitionPastMaxTables) {
+    const int kTables = 300;
+    for (int i = 0; i < kTables; i++) {
+        auto result = conn->Query(fmt::format("CREATE TABLE tbp_retention_many_{} (id int, date timestamp) PARTITION "
+                                              "BY RANGE(date) timescale interval '1d' retention '2d' autopart;",
+                                              i)
+                                      .c_str());
+        ASSERT_TRUE(result->GetRetCode() == GS_SUCCESS);
+    }
+    std::string tablename = fmt::format("tbp_retention_many_{}", kTables - 1);
+    auto result = conn->Query(fmt::format("INSERT INTO {} VALUES (1, '{}'), (2, '{}');", tablename,
+                                          GetDayTime(5, false), GetDayTime(0, false))
+                                  .c_str());
+    ASSERT_TRUE(result->GetRetCode() == GS_SUCCESS);
+    EXPECT_EQ(conn->GetTableInfo(tablename)->GetTableMetaInfo().part_table.desc.partcnt, 2);
+
+    uint32_t partcnt = 2;
+    for (int i = 0; i < kRetentionWaitSeconds && partcnt != 1; i++) {
+        sleep(1);
+        partcnt = conn->GetTableInfo(tablename)->GetTableMetaInfo().part_table.desc.partcnt;
+    }
+    EXPECT_EQ(partcnt, 1);
+}
+
+int main(int argc, char** argv) {
+    ::testing::GTEST_FLAG(output) = "xml";
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -23,8 +23,15 @@
 // test for show table
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <unordered_set>
+#include <vector>
+
 #include "catalog/catalog.h"
 #include "catalog/table_info.h"
+#include "common/statement_stats.h"
 #include "main/connection.h"
 #include "main/database.h"
 
@@ -231,7 +238,179 @@ TEST_F(ShowTest, DescribeSpecificTableWithIndex) {
     EXPECT_EQ(r->RowRef(1).Field(0).GetCastAs<std::string>(), "v");
     EXPECT_EQ(r->RowRef(1).Field(7).GetCastAs<std::string>(), "");
     EXPECT_EQ(r->RowRef(2).Field(0).GetCastAs<std::string>(), "name"); 
-    EXPECT_EQ(r->RowRef(2).Field(7).GetCastAs<std::string>(), "MUL"); 
+    EXPECT_EQ(r->RowRef(2).Field(7).GetCastAs<std::string>(), "MUL");
+}
+
+TEST_F(ShowTest, ShowRetentionStatus) {
+    auto r = conn->Query("show variables like 'retention'");
+    EXPECT_TRUE(r->GetRetCode() == GS_SUCCESS);
+    EXPECT_EQ(r->RowCount(), 14);
+    EXPECT_EQ(r->RowRef(0).Field(0).GetCastAs<std::string>(), "retention_interval");
+    EXPECT_EQ(r->RowRef(0).Field(1).GetCastAs<std::string>(), "60");
+    EXPECT_EQ(r->RowRef(1).Field(0).GetCastAs<std::string>(), "retention_max_drops");
+    EXPECT_EQ(r->RowRef(1).Field(1).GetCastAs<std::string>(), "8");
+    EXPECT_EQ(r->RowRef(6).Field(0).GetCastAs<std::string>(), "retention_dropped_parts");
+}
+
+TEST_F(ShowTest, ShowCommitStatus) {
+    auto r = conn->Query("show variables like 'commit'");
+    EXPECT_TRUE(r->GetRetCode() == GS_SUCCESS);
+    EXPECT_EQ(r->RowCount(), 18);
+    EXPECT_EQ(r->RowRef(0).Field(0).GetCastAs<std::string>(), "commit_delay_us");
+    EXPECT_EQ(r->RowRef(0).Field(1).GetCastAs<std::string>(), "0");
+    EXPECT_EQ(r->RowRef(1).Field(0).GetCastAs<std::string>(), "commit_siblings");
+    EXPECT_EQ(r->RowRef(1).Field(1).GetCastAs<std::string>(), "5");
+    EXPECT_EQ(r->RowRef(2).Field(0).GetCastAs<std::string>(), "commit_batch_size");
+    EXPECT_EQ(r->RowRef(2).Field(1).GetCastAs<std::string>(), "64");
+    EXPECT_EQ(r->RowRef(17).Field(0).GetCastAs<std::string>(), "commit_latency_le_inf");
+}
+
+TEST_F(ShowTest, ShowKvExpireStatus) {
+    auto r = conn->Query("show variables like 'kv_expire'");
+    EXPECT_TRUE(r->GetRetCode() == GS_SUCCESS);
+    EXPECT_EQ(r->RowCount(), 13);
+    EXPECT_EQ(r->RowRef(0).Field(0).GetCastAs<std::string>(), "kv_expire_interval");
+    EXPECT_EQ(r->RowRef(0).Field(1).GetCastAs<std::string>(), "1");
+    EXPECT_EQ(r->RowRef(1).Field(0).GetCastAs<std::string>(), "kv_expire_batch");
+    EXPECT_EQ(r->RowRef(1).Field(1).GetCastAs<std::string>(), "128");
+    EXPECT_EQ(r->RowRef(6).Field(0).GetCastAs<std::string>(), "kv_expire_expired_keys");
+    EXPECT_EQ(r->RowRef(11).Field(0).GetCastAs<std::string>(), "kv_expire_ttl_tables");
+}
+
+TEST_F(ShowTest, PerfViews) {
+    for (auto view : {"dv_sessions", "dv_session_stats", "dv_sys_stats", "dv_wait_events", "dv_session_waits",
+                      "dv_buffer_pool", "dv_buffer_sets", "dv_redo_checkpoint", "dv_lock_waits", "dv_statements"}) {
+        auto r = conn->Query(fmt::format("select * from {}", view).c_str());
+        EXPECT_TRUE(r->GetRetCode() == GS_SUCCESS) << view << ": " << r->GetRetMsg();
+    }
+    EXPECT_EQ(conn->Query("select * from dv_buffer_pool")->RowCount(), 1);
+    auto sets = conn->Query("select buffer_gets, misses, hit_ratio from dv_buffer_sets where set_id = 0");
+    ASSERT_EQ(sets->RowCount(), 1);
+    EXPECT_GT(sets->RowRef(0).Field(0).GetCastAs<int64_t>(), 0);
+    EXPECT_EQ(conn->Query("select * from dv_lock_waits")->RowCount(), 0);
+
+    // the delta column counts from the previous read by this connection
+    auto commits = [](const std::unique_ptr<RecordBatch>& r) {
+        return std::make_pair(r->RowRef(0).Field(0).GetCastAs<int64_t>(), r->RowRef(0).Field(1).GetCastAs<int64_t>());
+    };
+    auto before = commits(conn->Query("select value, delta from dv_sys_stats where name = 'commits'"));
+    EXPECT_TRUE(conn->Query("create table perf_view_table(id int)")->GetRetCode() == GS_SUCCESS);
+    EXPECT_TRUE(conn->Query("insert into perf_view_table values (1)")->GetRetCode() == GS_SUCCESS);
+    auto after = commits(conn->Query("SELECT VALUE, DELTA FROM DV_SYS_STATS WHERE NAME = 'commits'"));
+    EXPECT_GT(after.first, before.first);
+    EXPECT_EQ(after.second, after.first - before.first);
+
+    // a table of the same name hides the view
+    EXPECT_TRUE(conn->Query("create table dv_sys_stats(id int)")->GetRetCode() == GS_SUCCESS);
+    EXPECT_EQ(conn->Query("select * from dv_sys_stats")->RowCount(), 0);
+    EXPECT_TRUE(conn->Query("drop table dv_sys_stats")->GetRetCode() == GS_SUCCESS);
+}
+
+TEST_F(ShowTest, StatementStats) {
+    EXPECT_TRUE(conn->Query("select dv_statements_reset()")->GetRetCode() == GS_SUCCESS);
+    EXPECT_TRUE(conn->Query("create table stmt_stats_table(id int, name varchar(20))")->GetRetCode() == GS_SUCCESS);
+    for (int i = 0; i < 10; i++) {
+        auto sql = fmt::format("INSERT  INTO stmt_stats_table VALUES ({}, 'name{}'); -- row {}", i, i, i);
+        EXPECT_TRUE(conn->Query(sql.c_str())->GetRetCode() == GS_SUCCESS);
+    }
+
+    // statements differing only in literals, spacing, case and comments share one entry
+    auto r = conn->Query(
+        "select calls, errors, rows, min_time_us, p50_time_us, p99_time_us, max_time_us from dv_statements "
+        "where query = 'insert into stmt_stats_table values (?, ?)'");
+    ASSERT_TRUE(r->GetRetCode() == GS_SUCCESS) << r->GetRetMsg();
+    ASSERT_EQ(r->RowCount(), 1);
+    EXPECT_EQ(r->RowRef(0).Field(0).GetCastAs<int64_t>(), 10);
+    EXPECT_EQ(r->RowRef(0).Field(1).GetCastAs<int64_t>(), 0);
+    EXPECT_EQ(r->RowRef(0).Field(2).GetCastAs<int64_t>(), 10);
+    auto min = r->RowRef(0).Field(3).GetCastAs<int64_t>();
+    auto max = r->RowRef(0).Field(6).GetCastAs<int64_t>();
+    EXPECT_LE(min, r->RowRef(0).Field(4).GetCastAs<int64_t>());
+    EXPECT_LE(r->RowRef(0).Field(4).GetCastAs<int64_t>(), r->RowRef(0).Field(5).GetCastAs<int64_t>());
+    EXPECT_LE(r->RowRef(0).Field(5).GetCastAs<int64_t>(), max);
+
+    EXPECT_TRUE(conn->Query("insert into stmt_stats_table values (1, 2, 3)")->GetRetCode() != GS_SUCCESS);
+    r = conn->Query("select calls, errors from dv_statements where query like 'insert into stmt_stats_table%'"
+                    " order by calls");
+    ASSERT_EQ(r->RowCount(), 2);
+    EXPECT_EQ(r->RowRef(0).Field(0).GetCastAs<int64_t>(), 1);
+    EXPECT_EQ(r->RowRef(0).Field(1).GetCastAs<int64_t>(), 1);
+
+    r = conn->Query("select dv_statements_reset()");
+    EXPECT_GE(r->RowRef(0).Field(0).GetCastAs<int64_t>(), 3);
+    EXPECT_EQ(conn->Query("select * from dv_statements where query like '%stmt_stats_table%'")->RowCount(), 0);
+}
+
+TEST_F(ShowTest, StatementStatsEvictsLeastRecent) {
+    auto &stats = StatementStats::GetInstance();
+    stats.Reset();
+    auto hot = StatementStats::Fingerprint("select * from stmt_evict_hot");
+    for (int i = 0; i < 100; i++) {
+        stats.Record(hot, 1, 1, false);
+    }
+    // twice as many new statements as there is room for, each called once
+    std::vector<StatementFingerprint> fresh;
+    for (size_t i = 0; i < StatementStats::MAX_ENTRIES * 2; i++) {
+        fresh.push_back(StatementStats::Fingerprint(fmt::format("select * from stmt_evict_{}", i)));
+        stats.Record(fresh.back(), 1, 1, false);
+    }
+
+    auto entries = stats.Snapshot();
+    std::unordered_set<uint64_t> ids;
+    for (const auto &entry : entries) {
+        ids.insert(entry.first);
+    }
+    EXPECT_LE(entries.size(), StatementStats::MAX_ENTRIES);
+    // the hot statement has not been called for a long time, the latest ones are all kept
+    EXPECT_EQ(ids.count(hot.id), 0);
+    for (size_t i = fresh.size() - 100; i < fresh.size(); i++) {
+        EXPECT_EQ(ids.count(fresh[i].id), 1) << fresh[i].text;
+    }
+    stats.Reset();
+}
+
+TEST_F(ShowTest, TraceCapture) {
+    auto trace_file = "show_test_trace.json";
+    auto trace_path = fmt::format("intarkdb/trace/{}", trace_file);
+    std::remove(trace_path.c_str());
+    auto r = conn->Query("select trace_start()");
+    ASSERT_TRUE(r->GetRetCode() == GS_SUCCESS) << r->GetRetMsg();
+    EXPECT_TRUE(r->RowRef(0).Field(0).GetCastAs<bool>());
+    EXPECT_FALSE(conn->Query("select trace_start()")->RowRef(0).Field(0).GetCastAs<bool>());
+
+    EXPECT_TRUE(conn->Query("create table trace_table(id int)")->GetRetCode() == GS_SUCCESS);
+    EXPECT_TRUE(conn->Query("insert into trace_table values (1), (2), (3)")->GetRetCode() == GS_SUCCESS);
+    EXPECT_EQ(conn->Query("select * from trace_table where id > 1")->RowCount(), 2);
+
+    // only a plain file name is taken, a refused stop keeps the capture running
+    for (auto name : {"/tmp/trace.json", "../trace.json", "sub/trace.json", "sub\\trace.json", "..", ""}) {
+        EXPECT_TRUE(conn->Query(fmt::format("select trace_stop('{}')", name).c_str())->GetRetCode() != GS_SUCCESS)
+            << name;
+    }
+
+    r = conn->Query(fmt::format("select trace_stop('{}')", trace_file).c_str());
+    ASSERT_TRUE(r->GetRetCode() == GS_SUCCESS) << r->GetRetMsg();
+    EXPECT_GT(r->RowRef(0).Field(0).GetCastAs<int64_t>(), 0);
+    std::ifstream in(trace_path);
+    std::string trace((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(trace.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0);
+    for (auto span : {"Connection::Parse", "Connection::Bind", "Planner::CreatePhysicalPlan", "SeqScanExec::Next",
+                      "InsertExec::Execute", "gstor_cursor_next", "gstor_batch_insert_row"}) {
+        EXPECT_NE(trace.find(fmt::format("\"name\":\"{}\"", span)), std::string::npos) << span;
+    }
+
+    // an existing file is not overwritten
+    EXPECT_TRUE(conn->Query(fmt::format("select trace_stop('{}')", trace_file).c_str())->GetRetCode() != GS_SUCCESS);
+    std::ifstream again(trace_path);
+    EXPECT_EQ(std::string((std::istreambuf_iterator<char>(again)), std::istreambuf_iterator<char>()), trace);
+
+    // the capture is consumed, stopping again writes an empty trace
+    auto empty_file = "show_test_trace_empty.json";
+    r = conn->Query(fmt::format("select trace_stop('{}')", empty_file).c_str());
+    ASSERT_TRUE(r->GetRetCode() == GS_SUCCESS) << r->GetRetMsg();
+    EXPECT_EQ(r->RowRef(0).Field(0).GetCastAs<int64_t>(), 0);
+    std::remove(trace_path.c_str());
+    std::remove(fmt::format("intarkdb/trace/{}", empty_file).c_str());
 }
 
 int main(int argc, char** argv) {
@@ -83,3 +83,137 @@ TEST_F(ViewTest, CreateViewWithParams) {
     result = conn->Query("create view view_with_params as select * from t1 where a = ?");
     ASSERT_NE(result->GetRetCode(), 0);  // not support params
 }
+
+TEST_F(ViewTest, ContinuousAggregate) {
+    conn->Query("drop view if exists cagg_v");
+    conn->Query("drop table if exists _cagg_cagg_v");
+    conn->Query("drop table if exists cagg_src");
+    auto r = conn->Query(
+        "create table cagg_src(ts timestamp, dev int, v int) partition by range(ts) timescale interval '1h' "
+        "retention '30d' autopart");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    r = conn->Query("insert into cagg_src values ('2026-10-19 10:05:00', 1, 10), ('2026-10-19 10:15:00', 1, 25), "
+                    "('2026-10-19 10:20:00', 2, 5)");
+    ASSERT_EQ(r->GetRetCode(), 0);
+
+    // only a group by over a timescale table
+    r = conn->Query("create view cagg_bad with (continuous) as select a, count(*) from t1 group by a");
+    ASSERT_NE(r->GetRetCode(), 0);
+    r = conn->Query("create view cagg_bad with (continuous) as select dev, v from cagg_src");
+    ASSERT_NE(r->GetRetCode(), 0);
+
+    r = conn->Query(
+        "create view cagg_v with (continuous) as "
+        "select dev, avg(v), count(*), max(v) as mx from cagg_src group by dev");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    r = conn->Query("select * from cagg_v order by dev");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    ASSERT_EQ(r->RowCount(), 2);
+    EXPECT_EQ(r->Row(0).Field(1).GetCastAs<double>(), 17.5);
+    EXPECT_EQ(r->Row(0).Field(2).GetCastAs<int64_t>(), 2);
+    EXPECT_EQ(r->Row(1).Field(3).GetCastAs<int32_t>(), 5);
+
+    // one partial state row per group and source partition
+    r = conn->Query("insert into cagg_src values ('2026-10-19 11:05:00', 2, 7)");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    r = conn->Query("select * from cagg_v order by dev");
+    ASSERT_EQ(r->RowCount(), 2);
+    EXPECT_EQ(r->Row(1).Field(1).GetCastAs<double>(), 6);
+    EXPECT_EQ(r->Row(1).Field(2).GetCastAs<int64_t>(), 2);
+    EXPECT_EQ(r->Row(1).Field(3).GetCastAs<int32_t>(), 7);
+    r = conn->Query("select * from _cagg_cagg_v");
+    EXPECT_EQ(r->RowCount(), 3);
+
+    // an aggregate over the source table matching the view is answered by the materialized table
+    r = conn->Query("select dev, sum(v), count(*) from cagg_src group by dev order by dev desc limit 1");
+    ASSERT_EQ(r->RowCount(), 1);
+    EXPECT_EQ(r->Row(0).Field(0).GetCastAs<int32_t>(), 2);
+    EXPECT_EQ(r->Row(0).Field(1).GetCastAs<int64_t>(), 12);
+
+    r = conn->Query("delete from cagg_src where dev = 1");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    r = conn->Query("select * from cagg_v");
+    ASSERT_EQ(r->RowCount(), 1);
+
+    r = conn->Query("drop view cagg_v");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    r = conn->Query("select * from _cagg_cagg_v");
+    ASSERT_NE(r->GetRetCode(), 0);
+}
+
+TEST_F(ViewTest, ContinuousAggregateQualifiedSource) {
+    conn->Query("drop view if exists cagg_q");
+    conn->Query("drop table if exists cagg_qsrc");
+    auto r = conn->Query(
+        "create table cagg_qsrc(ts timestamp, dev int, v int) partition by range(ts) timescale interval '1d' "
+        "retention '30d' autopart");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    r = conn->Query("create view cagg_q with (continuous) as select dev, sum(v), count(*) from \"SYS\".cagg_qsrc "
+                    "group by dev");
+    ASSERT_EQ(r->GetRetCode(), 0);
+
+    // inserts through a qualified or an unqualified name both invalidate the view
+    r = conn->Query("insert into \"SYS\".cagg_qsrc values ('2026-10-19 10:05:00', 1, 10)");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    r = conn->Query("select * from cagg_q");
+    ASSERT_EQ(r->RowCount(), 1);
+    EXPECT_EQ(r->Row(0).Field(1).GetCastAs<int64_t>(), 10);
+    r = conn->Query("insert into cagg_qsrc values ('2026-10-19 10:15:00', 1, 5)");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    r = conn->Query("select * from \"SYS\".cagg_q");
+    ASSERT_EQ(r->RowCount(), 1);
+    EXPECT_EQ(r->Row(0).Field(1).GetCastAs<int64_t>(), 15);
+    EXPECT_EQ(r->Row(0).Field(2).GetCastAs<int64_t>(), 2);
+
+    // a rewritten aggregate over the qualified source sees the latest insert as well
+    r = conn->Query("insert into cagg_qsrc values ('2026-10-20 10:15:00', 2, 1)");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    r = conn->Query("select dev, sum(v) from \"SYS\".cagg_qsrc group by dev order by dev");
+    ASSERT_EQ(r->RowCount(), 2);
+    EXPECT_EQ(r->Row(0).Field(1).GetCastAs<int64_t>(), 15);
+    EXPECT_EQ(r->Row(1).Field(1).GetCastAs<int64_t>(), 1);
+
+    // the source is looked up in the schema written in the statement
+    r = conn->Query("create view cagg_bad with (continuous) as select dev, count(*) from \"NOBODY\".cagg_qsrc "
+                    "group by dev");
+    ASSERT_NE(r->GetRetCode(), 0);
+
+    // dropped by its qualified name, the materialized table goes with the view
+    r = conn->Query("drop view \"SYS\".cagg_q");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    r = conn->Query("select * from _cagg_cagg_q");
+    ASSERT_NE(r->GetRetCode(), 0);
+}
+
+TEST_F(ViewTest, ContinuousAggregateUpperCaseInterval) {
+    conn->Query("drop view if exists cagg_h");
+    conn->Query("drop table if exists cagg_hsrc");
+    auto r = conn->Query(
+        "create table cagg_hsrc(ts timestamp, dev int, v int) partition by range(ts) timescale interval '1H' "
+        "retention '30d' autopart");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    r = conn->Query("insert into cagg_hsrc values ('2026-10-19 10:05:00', 1, 10), ('2026-10-19 11:05:00', 1, 20)");
+    ASSERT_EQ(r->GetRetCode(), 0);
+
+    // built by a rebuild, one partial state row per hour
+    r = conn->Query("create view cagg_h with (continuous) as select dev, sum(v), count(*) from cagg_hsrc group by dev");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    r = conn->Query("select * from cagg_h");
+    ASSERT_EQ(r->RowCount(), 1);
+    EXPECT_EQ(r->Row(0).Field(1).GetCastAs<int64_t>(), 30);
+
+    // the insert invalidates the same hourly partition the rebuild wrote, the day is not counted twice
+    r = conn->Query("insert into cagg_hsrc values ('2026-10-19 10:45:00', 1, 5)");
+    ASSERT_EQ(r->GetRetCode(), 0);
+    r = conn->Query("select * from cagg_h");
+    ASSERT_EQ(r->RowCount(), 1);
+    EXPECT_EQ(r->Row(0).Field(1).GetCastAs<int64_t>(), 35);
+    EXPECT_EQ(r->Row(0).Field(2).GetCastAs<int64_t>(), 3);
+    r = conn->Query("select _part from _cagg_cagg_h order by _part");
+    ASSERT_EQ(r->RowCount(), 2);
+    EXPECT_EQ(r->Row(0).Field(0).ToString(), "2026101910");
+    EXPECT_EQ(r->Row(1).Field(0).ToString(), "2026101911");
+
+    r = conn->Query("drop view cagg_h");
+    ASSERT_EQ(r->GetRetCode(), 0);
+}
@@ -58,6 +58,7 @@
 #define DEFAULT_OM_AGENT_PORT 3333
 #define DEFAULT_SERVER_PORT 9000
 #define DEFAULT_HOST "127.0.0.1"
+#define LOCAL_PEER_HOST "127.0.0.1"  /* peer address reported for uds and shm sessions */
 
 //rescode
 typedef enum en_res_code {
@@ -78,6 +79,8 @@ typedef enum en_res_code {
     RES_STMT_NOT_EXIST = 14,  /* statement not exist */
     RES_STMT_IDX_ERR = 15,     /* statement bind value idx error, maybe over size */
     RES_TIMEOUT = 16,         /* not connect */
+    RES_PROTO_VERSION_ERR = 17, /* no protocol version supported by both sides */
+    RES_CURSOR_NOT_EXIST = 18, /* no open cursor for the statement */
 } rescode_t;
 
 
@@ -90,6 +93,8 @@ typedef enum en_res_code {
 #define INT32_BUF_SIZE 4
 #define INT64_BUF_SIZE 8
 #define PROTO_VERSION 1
+#define PROTO_VERSION_COLUMNAR 2      /* result rows sent as typed column blocks */
+#define PROTO_VERSION_COLUMNAR_LZ4 3  /* column blocks, lz4 compressed when it pays off */
 
 // Transaction status
 typedef enum 
@@ -60,8 +60,9 @@ static const vio_t g_vio_list[] = {
     { (recv_func_t)cs_tcp_recv, (send_func_t)cs_tcp_send, (wait_func_t)cs_tcp_wait,
       (recv_timed_func_t)cs_tcp_recv_timed, (send_timed_func_t)cs_tcp_send_timed },
 
-    // IPC not implemented
-    { NULL, NULL, NULL, NULL, NULL },
+    // IPC io functions, shared memory rings signalled over a unix socket
+    { (recv_func_t)cs_shm_recv, (send_func_t)cs_shm_send, (wait_func_t)cs_shm_wait,
+      (recv_timed_func_t)cs_shm_recv_timed, (send_timed_func_t)cs_shm_send_timed },
 
     // UDS io functions
     { (recv_func_t)cs_uds_recv, (send_func_t)cs_uds_send, (wait_func_t)cs_uds_wait,
@@ -86,7 +87,7 @@ static const vio_t g_vio_list[] = {
   Macro definitions for pipe I/O operations
   @note
     Performance sensitive, the pipe->type should be guaranteed by the caller.
-      e.g. CS_TYPE_TCP, CS_TYPE_SSL, CS_TYPE_DOMAIN_SOCKET
+      e.g. CS_TYPE_TCP, CS_TYPE_SSL, CS_TYPE_DOMAIN_SOCKET, CS_TYPE_IPC
 */
 #define GET_VIO(pipe) \
     (&g_vio_list[MIN((pipe)->type, CS_TYPE_CEIL - 1)])
@@ -230,6 +231,17 @@ error:
     return GS_ERROR;
 }
 
+static status_t cs_open_shm_link(const char *server_path, cs_pipe_t *pipe, link_ready_ack_t *ack)
+{
+    // same handshake as uds, then both sides switch over to the shared memory rings
+    GS_RETURN_IFERR(cs_open_uds_link(server_path, NULL, pipe, ack));
+    if (cs_shm_attach(&pipe->link.uds, &pipe->link.shm) != GS_SUCCESS) {
+        cs_uds_socket_close(&pipe->link.uds.sock);
+        return GS_ERROR;
+    }
+    return GS_SUCCESS;
+}
+
 static status_t cs_open_rdma_link(const char *host, uint16 port, cs_pipe_t *pipe, link_ready_ack_t *ack)
 {
     rdma_link_t *link = NULL;
@@ -270,8 +282,8 @@ static status_t cs_open_rdma_link(const char *host, uint16 port, cs_pipe_t *pipe
 /* URL SAMPLE:
 TCP x.x.x.x:port, database_server1:port
 RDMA: RDMA@x.x.x.x:port
-IPC:/home/gsdb  
-UDS:/home/gsdb */
+IPC:/home/gsdb/shm.sock (unix socket of the shared memory listener)
+UDS:/home/gsdb/uds.sock */
 typedef struct st_server_info {
     cs_pipe_type_t type;
     char path[GS_FILE_NAME_BUFFER_SIZE]; /* host name(TCP) or home path(IPC) or domain socket file (uds) */
@@ -296,6 +308,7 @@ static status_t cs_parse_url(const char *url, server_info_t *server)
         }
     } else if (cm_text_equal_ins(&part1, &uds)) {
         server->type = CS_TYPE_DOMAIN_SCOKET;
+        GS_RETURN_IFERR(cm_text2str(&part2, server->path, GS_FILE_NAME_BUFFER_SIZE));
     } else {
         server->type = CS_TYPE_TCP;
         GS_RETURN_IFERR(cm_text2str(&part1, server->path, GS_FILE_NAME_BUFFER_SIZE));
@@ -332,11 +345,16 @@ status_t cs_connect(const char *url, cs_pipe_t *pipe, const char *bind_host,
     if (pipe->type == CS_TYPE_TCP) {
         GS_RETURN_IFERR(cs_open_tcp_link(server.path, server.port, pipe, &ack, bind_host));
     } else if (pipe->type == CS_TYPE_DOMAIN_SCOKET) {
+        if (CM_IS_EMPTY_STR(server_path)) {
+            server_path = server.path;
+        }
         if (CM_IS_EMPTY_STR(server_path)) {
             GS_THROW_ERROR(ERR_CLT_UDS_FILE_EMPTY);
             return GS_ERROR;
         }
         GS_RETURN_IFERR(cs_open_uds_link(server_path, client_path, pipe, &ack)); 
+    } else if (pipe->type == CS_TYPE_IPC) {
+        GS_RETURN_IFERR(cs_open_shm_link(server.path, pipe, &ack));
     } else if (pipe->type == CS_TYPE_RSOCKET) {
         GS_RETURN_IFERR(cs_open_rdma_link(server.path, server.port, pipe, &ack));
     } else {
@@ -380,6 +398,10 @@ void cs_disconnect(cs_pipe_t *pipe)
         cs_uds_disconnect(&pipe->link.uds);
     }
 
+    if (pipe->type == CS_TYPE_IPC) {
+        cs_shm_disconnect(&pipe->link.shm);
+    }
+
     if (pipe->type == CS_TYPE_RSOCKET) {
         cs_rdma_disconnect(&pipe->link.rdma);
     }
@@ -397,6 +419,9 @@ void cs_shutdown(cs_pipe_t *pipe)
         case CS_TYPE_DOMAIN_SCOKET:
             cs_shutdown_socket(pipe->link.uds.sock);
             break;
+        case CS_TYPE_IPC:
+            cs_shutdown_socket(pipe->link.shm.sock);
+            break;
         case CS_TYPE_RSOCKET:
             cs_shutdown_socket(pipe->link.rdma.sock);
             break;
@@ -535,6 +560,9 @@ status_t cs_wait(cs_pipe_t *pipe, uint32 wait_for, int32 timeout, bool32 *ready)
     if (pipe->type == CS_TYPE_DOMAIN_SCOKET) {
         return cs_uds_wait(&pipe->link.uds, wait_for, timeout, ready);
     }
+    if (pipe->type == CS_TYPE_IPC) {
+        return cs_shm_wait(&pipe->link.shm, wait_for, timeout, ready);
+    }
     if (pipe->type == CS_TYPE_RSOCKET) {
         return cs_rdma_wait(&pipe->link.rdma, wait_for, timeout, ready);
     }
@@ -543,6 +571,22 @@ status_t cs_wait(cs_pipe_t *pipe, uint32 wait_for, int32 timeout, bool32 *ready)
     return GS_ERROR;
 }
 
+bool32 cs_has_pending_input(cs_pipe_t *pipe)
+{
+    if (pipe->type == CS_TYPE_IPC) {
+        return cs_shm_has_data(&pipe->link.shm);
+    }
+    if (pipe->type != CS_TYPE_TCP && pipe->type != CS_TYPE_DOMAIN_SCOKET) {
+        return GS_FALSE;
+    }
+
+    struct pollfd fd;
+    fd.fd = cs_get_socket_fd(pipe);
+    fd.events = POLLIN;
+    fd.revents = 0;
+    return cs_tcp_poll(&fd, 1, 0) > 0;
+}
+
 status_t cs_call(cs_pipe_t *pipe, cs_packet_t *req, cs_packet_t *ack)
 {
     if (cs_write(pipe, req) != GS_SUCCESS) {
@@ -711,6 +755,10 @@ socket_t cs_get_socket_fd(cs_pipe_t* pipe)
         return pipe->link.tcp.sock;
     } else if (pipe->type == CS_TYPE_SSL) {
         return pipe->link.ssl.tcp.sock;
+    } else if (pipe->type == CS_TYPE_DOMAIN_SCOKET) {
+        return pipe->link.uds.sock;
+    } else if (pipe->type == CS_TYPE_IPC) {
+        return pipe->link.shm.sock;
     } else if (pipe->type == CS_TYPE_RSOCKET) {
         return pipe->link.rdma.sock;
     } else {
@@ -33,6 +33,7 @@
 #include "var_inc.h"
 #include "cs_ssl.h"
 #include "cs_uds.h"
+#include "cs_shm.h"
 #include "cs_rdma.h"
 
 #ifdef __cplusplus
@@ -55,6 +56,7 @@ typedef union un_cs_link {
     tcp_link_t tcp;
     ssl_link_t ssl;
     uds_link_t uds;
+    shm_link_t shm;
     rdma_link_t rdma;
     // other links can be added later
 } cs_link_t;
@@ -87,6 +89,8 @@ status_t cs_connect(const char *url, cs_pipe_t *pipe, const char *bind_host,
 void     cs_disconnect(cs_pipe_t *pipe);
 void     cs_shutdown(cs_pipe_t *pipe);
 status_t cs_wait(cs_pipe_t *pipe, uint32 wait_for, int32 timeout, bool32 *ready);
+/* checks without blocking whether the peer has already sent more bytes, e.g. a pipelined request */
+bool32   cs_has_pending_input(cs_pipe_t *pipe);
 status_t cs_read(cs_pipe_t *pipe, cs_packet_t *pack, bool32 cs_client);
 status_t cs_read_bytes(cs_pipe_t *pipe, char *buf, uint32 max_size, int32 *size);
 status_t cs_read_bytes_timeout(cs_pipe_t *pipe, char *buf, uint32 max_size, int32 *size, int timeout);
@@ -0,0 +1,528 @@
+/*
+* Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+*
+* openGauss embedded is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+* http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+*
+* cs_shm.c
+*    shared memory ring buffer transport for co-located clients
+*
+* IDENTIFICATION
+* openGauss-embedded/src/network/network/cs_shm.c
+*
+* -------------------------------------------------------------------------
+*/
+#include "cs_shm.h"
+#include "cm_memory.h"
+#include "cm_date.h"
+#include "cs_pipe.h"
+#if !defined(_WIN32) && !defined(_ANDROID)
+#include <poll.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !defined(_WIN32) && !defined(_ANDROID)
+
+#define CS_SHM_DRAIN_SIZE   64
+#define CS_SHM_FULL_WAIT    1   /* ms between checks while the peer frees ring space */
+
+static inline shm_segment_t *cs_shm_segment(const shm_link_t *link)
+{
+    return (shm_segment_t *)link->shm.addr;
+}
+
+static inline uint32 cs_shm_send_ring(const shm_link_t *link)
+{
+    return link->side == IPC_SIDE_SERVER ? CS_SHM_RING_S2C : CS_SHM_RING_C2S;
+}
+
+static inline uint32 cs_shm_recv_ring(const shm_link_t *link)
+{
+    return link->side == IPC_SIDE_SERVER ? CS_SHM_RING_C2S : CS_SHM_RING_S2C;
+}
+
+static inline uint64 cs_shm_readable(shm_ring_ctrl_t *ctrl)
+{
+    return (uint64)(cm_atomic_get(&ctrl->head) - cm_atomic_get(&ctrl->tail));
+}
+
+static inline uint64 cs_shm_writable(shm_ring_ctrl_t *ctrl)
+{
+    return CS_SHM_RING_SIZE - cs_shm_readable(ctrl);
+}
+
+static void cs_shm_close_link(shm_link_t *link)
+{
+    if (link->shm.addr != NULL) {
+        (void)shmdt(link->shm.addr);
+        link->shm.addr = NULL;
+    }
+    link->shm.id = -1;
+    if (link->sock != CS_INVALID_SOCKET) {
+        cs_close_socket(link->sock);
+        link->sock = CS_INVALID_SOCKET;
+    }
+    link->closed = GS_TRUE;
+}
+
+static status_t cs_shm_map(shm_link_t *link, int32 id)
+{
+    void *addr = shmat(id, NULL, 0);
+    if (addr == (void *)-1) {
+        GS_THROW_ERROR(ERR_CREATE_SHARED_MEMORY);
+        return GS_ERROR;
+    }
+    link->shm.id = id;
+    link->shm.addr = (char *)addr;
+    return GS_SUCCESS;
+}
+
+status_t cs_shm_accept(uds_link_t *uds, shm_link_t *link)
+{
+    socket_t sock = uds->sock;
+    char confirm = 0;
+    shm_segment_t *seg = NULL;
+    bool32 ready = GS_FALSE;
+    status_t status = GS_ERROR;
+
+    int32 id = shmget(IPC_PRIVATE, CS_SHM_SEGMENT_SIZE, IPC_CREAT | S_IRUSR | S_IWUSR);
+    if (id == -1) {
+        GS_THROW_ERROR(ERR_CREATE_SHARED_MEMORY);
+        return GS_ERROR;
+    }
+
+    link->sock = sock;
+    link->closed = GS_FALSE;
+    link->side = IPC_SIDE_SERVER;
+    link->shm.addr = NULL;
+    if (cs_shm_map(link, id) != GS_SUCCESS) {
+        (void)shmctl(id, IPC_RMID, NULL);
+        return GS_ERROR;
+    }
+
+    seg = cs_shm_segment(link);
+    MEMS_RETURN_IFERR(memset_s(seg, sizeof(shm_segment_t), 0, sizeof(shm_segment_t)));
+    seg->magic = CS_SHM_MAGIC;
+    seg->ring_size = CS_SHM_RING_SIZE;
+    CM_MFENCE;
+
+    do {
+        if (cs_uds_send_timed(uds, (char *)&id, sizeof(id), GS_NETWORK_IO_TIMEOUT) != GS_SUCCESS) {
+            break;
+        }
+        if (cs_uds_wait(uds, CS_WAIT_FOR_READ, GS_NETWORK_IO_TIMEOUT, &ready) != GS_SUCCESS) {
+            break;
+        }
+        if (!ready) {
+            GS_THROW_ERROR(ERR_TCP_TIMEOUT, "wait for shared memory attach");
+            break;
+        }
+        if (cs_uds_recv_timed(uds, &confirm, sizeof(confirm), GS_NETWORK_IO_TIMEOUT) != GS_SUCCESS) {
+            break;
+        }
+        if (confirm != CS_SHM_DOORBELL) {
+            GS_THROW_ERROR(ERR_INVALID_PROTOCOL);
+            break;
+        }
+        status = GS_SUCCESS;
+    } while (0);
+
+    // the segment lives on only while mapped, so neither side can leak it from now on
+    (void)shmctl(id, IPC_RMID, NULL);
+    if (status != GS_SUCCESS) {
+        (void)shmdt(link->shm.addr);
+        link->shm.addr = NULL;
+        link->shm.id = -1;
+    }
+    return status;
+}
+
+status_t cs_shm_attach(uds_link_t *uds, shm_link_t *link)
+{
+    socket_t sock = uds->sock;
+    int32 id = -1;
+    char confirm = CS_SHM_DOORBELL;
+    bool32 ready = GS_FALSE;
+    shm_segment_t *seg = NULL;
+
+    GS_RETURN_IFERR(cs_uds_wait(uds, CS_WAIT_FOR_READ, GS_NETWORK_IO_TIMEOUT, &ready));
+    if (!ready) {
+        GS_THROW_ERROR(ERR_TCP_TIMEOUT, "wait for shared memory id");
+        return GS_ERROR;
+    }
+    GS_RETURN_IFERR(cs_uds_recv_timed(uds, (char *)&id, sizeof(id), GS_NETWORK_IO_TIMEOUT));
+
+    link->sock = sock;
+    link->closed = GS_FALSE;
+    link->side = IPC_SIDE_CLIENT;
+    link->shm.addr = NULL;
+    GS_RETURN_IFERR(cs_shm_map(link, id));
+
+    seg = cs_shm_segment(link);
+    if (seg->magic != CS_SHM_MAGIC || seg->ring_size != CS_SHM_RING_SIZE) {
+        (void)shmdt(link->shm.addr);
+        link->shm.addr = NULL;
+        GS_THROW_ERROR(ERR_INVALID_PROTOCOL);
+        return GS_ERROR;
+    }
+
+    if (cs_uds_send_timed(uds, &confirm, sizeof(confirm), GS_NETWORK_IO_TIMEOUT) != GS_SUCCESS) {
+        (void)shmdt(link->shm.addr);
+        link->shm.addr = NULL;
+        return GS_ERROR;
+    }
+    return GS_SUCCESS;
+}
+
+void cs_shm_disconnect(shm_link_t *link)
+{
+    CM_POINTER(link);
+    // closed may already be set by a failed transfer, the mapping and socket still need releasing
+    cs_shm_close_link(link);
+}
+
+static status_t cs_shm_ring_doorbell(shm_link_t *link)
+{
+    char bell = CS_SHM_DOORBELL;
+    if (send(link->sock, &bell, sizeof(bell), MSG_DONTWAIT | MSG_NOSIGNAL) == sizeof(bell)) {
+        return GS_SUCCESS;
+    }
+    // a full socket buffer already holds plenty of unread doorbells
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+        return GS_SUCCESS;
+    }
+    link->closed = GS_TRUE;
+    GS_THROW_ERROR(ERR_PEER_CLOSED_REASON, "shm", errno);
+    return GS_ERROR;
+}
+
+/* consume pending doorbells, only called once the receive ring has been seen empty */
+static status_t cs_shm_drain_doorbells(shm_link_t *link)
+{
+    char bells[CS_SHM_DRAIN_SIZE];
+    for (;;) {
+        ssize_t size = recv(link->sock, bells, sizeof(bells), MSG_DONTWAIT);
+        if (size > 0) {
+            continue;
+        }
+        if (size == 0) {
+            link->closed = GS_TRUE;
+            GS_THROW_ERROR(ERR_PEER_CLOSED, "shm");
+            return GS_ERROR;
+        }
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            return GS_SUCCESS;
+        }
+        if (errno != EINTR) {
+            link->closed = GS_TRUE;
+            GS_THROW_ERROR(ERR_PEER_CLOSED_REASON, "shm", errno);
+            return GS_ERROR;
+        }
+    }
+}
+
+status_t cs_shm_send(shm_link_t *link, const char *buf, uint32 size, int32 *send_size)
+{
+    shm_segment_t *seg = cs_shm_segment(link);
+    uint32 ring = cs_shm_send_ring(link);
+    shm_ring_ctrl_t *ctrl = &seg->rings[ring];
+    char *data = CS_SHM_RING_DATA(seg, ring);
+
+    *send_size = 0;
+    if (link->closed) {
+        GS_THROW_ERROR(ERR_PEER_CLOSED, "shm");
+        return GS_ERROR;
+    }
+    if (size == 0) {
+        return GS_SUCCESS;
+    }
+
+    int64 head = cm_atomic_get(&ctrl->head);
+    uint64 free_size = cs_shm_writable(ctrl);
+    if (free_size == 0) {
+        return GS_SUCCESS;
+    }
+    CM_MFENCE;
+
+    uint32 len = (uint32)MIN((uint64)size, free_size);
+    uint32 pos = (uint32)((uint64)head & CS_SHM_RING_MASK);
+    uint32 first = MIN(len, CS_SHM_RING_SIZE - pos);
+    MEMS_RETURN_IFERR(memcpy_s(data + pos, CS_SHM_RING_SIZE - pos, buf, first));
+    if (first < len) {
+        MEMS_RETURN_IFERR(memcpy_s(data, CS_SHM_RING_SIZE, buf + first, len - first));
+    }
+
+    CM_MFENCE;
+    (void)cm_atomic_set(&ctrl->head, head + len);
+    // pairs with the fence in cs_shm_wait: either the reader sees the new head or we see it idle
+    CM_MFENCE;
+    if (cm_atomic_get(&ctrl->tail) == head) {
+        GS_RETURN_IFERR(cs_shm_ring_doorbell(link));
+    }
+
+    *send_size = (int32)len;
+    return GS_SUCCESS;
+}
+
+status_t cs_shm_recv(shm_link_t *link, char *buf, uint32 size, int32 *recv_size, uint32 *wait_event)
+{
+    shm_segment_t *seg = cs_shm_segment(link);
+    uint32 ring = cs_shm_recv_ring(link);
+    shm_ring_ctrl_t *ctrl = &seg->rings[ring];
+    char *data = CS_SHM_RING_DATA(seg, ring);
+    bool32 ready = GS_FALSE;
+
+    *recv_size = 0;
+    if (size == 0) {
+        return GS_SUCCESS;
+    }
+
+    while (cs_shm_readable(ctrl) == 0) {
+        GS_RETURN_IFERR(cs_shm_wait(link, CS_WAIT_FOR_READ, GS_POLL_WAIT, &ready));
+    }
+    CM_MFENCE;
+
+    int64 tail = cm_atomic_get(&ctrl->tail);
+    uint32 len = (uint32)MIN((uint64)size, cs_shm_readable(ctrl));
+    uint32 pos = (uint32)((uint64)tail & CS_SHM_RING_MASK);
+    uint32 first = MIN(len, CS_SHM_RING_SIZE - pos);
+    MEMS_RETURN_IFERR(memcpy_s(buf, size, data + pos, first));
+    if (first < len) {
+        MEMS_RETURN_IFERR(memcpy_s(buf + first, size - first, data, len - first));
+    }
+
+    CM_MFENCE;
+    (void)cm_atomic_set(&ctrl->tail, tail + len);
+    *recv_size = (int32)len;
+    return GS_SUCCESS;
+}
+
+static status_t cs_shm_poll(shm_link_t *link, int16 events, int32 timeout, bool32 *ready)
+{
+    struct pollfd fd;
+    fd.fd = link->sock;
+    fd.events = events;
+    fd.revents = 0;
+
+    *ready = GS_FALSE;
+    int32 ret = poll(&fd, 1, timeout);
+    if (ret < 0) {
+        if (errno == EINTR) {
+            return GS_SUCCESS;
+        }
+        link->closed = GS_TRUE;
+        GS_THROW_ERROR(ERR_PEER_CLOSED_REASON, "shm", errno);
+        return GS_ERROR;
+    }
+    if (ret > 0 && (fd.revents & (POLLHUP | POLLERR | POLLNVAL))) {
+        link->closed = GS_TRUE;
+        GS_THROW_ERROR(ERR_PEER_CLOSED, "shm");
+        return GS_ERROR;
+    }
+    *ready = (ret > 0);
+    return GS_SUCCESS;
+}
+
+static status_t cs_shm_wait_read(shm_link_t *link, int32 timeout, bool32 *ready)
+{
+    shm_ring_ctrl_t *ctrl = &cs_shm_segment(link)->rings[cs_shm_recv_ring(link)];
+    date_t begin = cm_monotonic_now();
+    bool32 bell = GS_FALSE;
+
+    for (;;) {
+        if (cs_shm_readable(ctrl) > 0) {
+            *ready = GS_TRUE;
+            return GS_SUCCESS;
+        }
+        GS_RETURN_IFERR(cs_shm_drain_doorbells(link));
+        CM_MFENCE;
+        if (cs_shm_readable(ctrl) > 0) {
+            *ready = GS_TRUE;
+            return GS_SUCCESS;
+        }
+
+        int32 remain = -1;  // like uds, a timeout of zero or less waits for good
+        if (timeout > 0) {
+            remain = timeout - (int32)((cm_monotonic_now() - begin) / MICROSECS_PER_MILLISEC);
+            if (remain <= 0) {
+                return GS_SUCCESS;
+            }
+        }
+        GS_RETURN_IFERR(cs_shm_poll(link, POLLIN, remain, &bell));
+        if (!bell) {
+            return GS_SUCCESS;
+        }
+    }
+}
+
+static status_t cs_shm_wait_write(shm_link_t *link, int32 timeout, bool32 *ready)
+{
+    shm_ring_ctrl_t *ctrl = &cs_shm_segment(link)->rings[cs_shm_send_ring(link)];
+    date_t begin = cm_monotonic_now();
+    bool32 hup = GS_FALSE;
+
+    for (;;) {
+        if (cs_shm_writable(ctrl) > 0) {
+            *ready = GS_TRUE;
+            return GS_SUCCESS;
+        }
+        if (timeout > 0 && (int32)((cm_monotonic_now() - begin) / MICROSECS_PER_MILLISEC) >= timeout) {
+            return GS_SUCCESS;
+        }
+        // the reader frees space without ringing back, so poll the ring and watch the socket for hangup
+        GS_RETURN_IFERR(cs_shm_poll(link, 0, CS_SHM_FULL_WAIT, &hup));
+    }
+}
+
+status_t cs_shm_wait(shm_link_t *link, uint32 wait_for, int32 timeout, bool32 *ready)
+{
+    bool32 dummy = GS_FALSE;
+    bool32 *result = (ready != NULL) ? ready : &dummy;
+
+    *result = GS_FALSE;
+    if (link->closed) {
+        GS_THROW_ERROR(ERR_PEER_CLOSED, "shm");
+        return GS_ERROR;
+    }
+
+    if (wait_for == CS_WAIT_FOR_WRITE) {
+        return cs_shm_wait_write(link, timeout, result);
+    }
+    return cs_shm_wait_read(link, timeout, result);
+}
+
+bool32 cs_shm_has_data(shm_link_t *link)
+{
+    if (link->closed) {
+        return GS_FALSE;
+    }
+    return cs_shm_readable(&cs_shm_segment(link)->rings[cs_shm_recv_ring(link)]) > 0;
+}
+
+status_t cs_shm_send_timed(shm_link_t *link, const char *buf, uint32 size, uint32 timeout)
+{
+    uint32 remain_size = size;
+    uint32 offset = 0;
+    uint32 wait_interval = 0;
+    int32 writen_size = 0;
+    bool32 ready = GS_FALSE;
+
+    while (remain_size > 0) {
+        GS_RETURN_IFERR(cs_shm_send(link, buf + offset, remain_size, &writen_size));
+        remain_size -= (uint32)writen_size;
+        offset += (uint32)writen_size;
+        if (remain_size == 0) {
+            break;
+        }
+
+        GS_RETURN_IFERR(cs_shm_wait(link, CS_WAIT_FOR_WRITE, GS_POLL_WAIT, &ready));
+        if (!ready) {
+            wait_interval += GS_POLL_WAIT;
+            if (wait_interval >= timeout) {
+                GS_THROW_ERROR(ERR_TCP_TIMEOUT, "send data");
+                return GS_ERROR;
+            }
+        }
+    }
+
+    return GS_SUCCESS;
+}
+
+status_t cs_shm_recv_timed(shm_link_t *link, char *buf, uint32 size, uint32 timeout)
+{
+    uint32 remain_size = size;
+    uint32 offset = 0;
+    uint32 wait_interval = 0;
+    int32 recv_size = 0;
+    bool32 ready = GS_FALSE;
+
+    while (remain_size > 0) {
+        GS_RETURN_IFERR(cs_shm_wait(link, CS_WAIT_FOR_READ, GS_POLL_WAIT, &ready));
+        if (!ready) {
+            wait_interval += GS_POLL_WAIT;
+            if (wait_interval >= timeout) {
+                GS_THROW_ERROR(ERR_TCP_TIMEOUT, "recv data");
+                return GS_ERROR;
+            }
+            continue;
+        }
+
+        GS_RETURN_IFERR(cs_shm_recv(link, buf + offset, remain_size, &recv_size, NULL));
+        remain_size -= (uint32)recv_size;
+        offset += (uint32)recv_size;
+    }
+
+    return GS_SUCCESS;
+}
+
+#else
+
+status_t cs_shm_accept(uds_link_t *uds, shm_link_t *link)
+{
+    GS_THROW_ERROR(ERR_PROTOCOL_NOT_SUPPORT);
+    return GS_ERROR;
+}
+
+status_t cs_shm_attach(uds_link_t *uds, shm_link_t *link)
+{
+    GS_THROW_ERROR(ERR_PROTOCOL_NOT_SUPPORT);
+    return GS_ERROR;
+}
+
+void cs_shm_disconnect(shm_link_t *link)
+{
+    link->closed = GS_TRUE;
+}
+
+status_t cs_shm_send(shm_link_t *link, const char *buf, uint32 size, int32 *send_size)
+{
+    GS_THROW_ERROR(ERR_PROTOCOL_NOT_SUPPORT);
+    return GS_ERROR;
+}
+
+status_t cs_shm_send_timed(shm_link_t *link, const char *buf, uint32 size, uint32 timeout)
+{
+    GS_THROW_ERROR(ERR_PROTOCOL_NOT_SUPPORT);
+    return GS_ERROR;
+}
+
+status_t cs_shm_recv(shm_link_t *link, char *buf, uint32 size, int32 *recv_size, uint32 *wait_event)
+{
+    GS_THROW_ERROR(ERR_PROTOCOL_NOT_SUPPORT);
+    return GS_ERROR;
+}
+
+status_t cs_shm_recv_timed(shm_link_t *link, char *buf, uint32 size, uint32 timeout)
+{
+    GS_THROW_ERROR(ERR_PROTOCOL_NOT_SUPPORT);
+    return GS_ERROR;
+}
+
+status_t cs_shm_wait(shm_link_t *link, uint32 wait_for, int32 timeout, bool32 *ready)
+{
+    GS_THROW_ERROR(ERR_PROTOCOL_NOT_SUPPORT);
+    return GS_ERROR;
+}
+
+bool32 cs_shm_has_data(shm_link_t *link)
+{
+    return GS_FALSE;
+}
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,96 @@
+/*
+* Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+*
+* openGauss embedded is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+* http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+*
+* cs_shm.h
+*    shared memory ring buffer transport for co-located clients
+*
+* IDENTIFICATION
+* openGauss-embedded/src/network/network/cs_shm.h
+*
+* -------------------------------------------------------------------------
+*/
+#ifndef __CS_SHM_H__
+#define __CS_SHM_H__
+
+#include "cm_defs.h"
+#include "cm_atomic.h"
+#include "cs_ipc.h"
+#include "cs_uds.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Each connection owns one private SysV segment holding two single-producer
+ * single-consumer byte rings: ring 0 carries client->server traffic, ring 1
+ * server->client. Payload never crosses the kernel. The unix socket the
+ * connection was accepted on stays open as the control channel: a writer drops
+ * one doorbell byte on it when the reader may be asleep, which also lets the
+ * reactor keep watching the session with epoll, and it reports peer death.
+ */
+#define CS_SHM_MAGIC        0x52534B49  /* "IKSR" */
+#define CS_SHM_RING_SIZE    SIZE_M(1)
+#define CS_SHM_RING_MASK    (CS_SHM_RING_SIZE - 1)
+#define CS_SHM_RING_C2S     0
+#define CS_SHM_RING_S2C     1
+#define CS_SHM_DOORBELL     'D'
+
+typedef struct st_shm_ring_ctrl {
+    atomic_t head;  // bytes written so far, only advanced by the producer
+    char pad1[CACHE_LINESIZE - sizeof(atomic_t)];
+    atomic_t tail;  // bytes consumed so far, only advanced by the consumer
+    char pad2[CACHE_LINESIZE - sizeof(atomic_t)];
+} shm_ring_ctrl_t;
+
+typedef struct st_shm_segment {
+    uint32 magic;
+    uint32 ring_size;
+    char pad[CACHE_LINESIZE - 2 * sizeof(uint32)];
+    shm_ring_ctrl_t rings[2];
+    // followed by the c2s and s2c data areas, CS_SHM_RING_SIZE each
+} shm_segment_t;
+
+#define CS_SHM_SEGMENT_SIZE (sizeof(shm_segment_t) + 2 * CS_SHM_RING_SIZE)
+#define CS_SHM_RING_DATA(seg, ring) ((char *)((seg) + 1) + (ring) * CS_SHM_RING_SIZE)
+
+typedef struct st_shm_link {
+    socket_t sock; // need to be first!
+    bool32 closed; // need to be second!
+    ipc_side_t side;
+    ipc_shm_t shm;
+} shm_link_t;
+
+/*
+ * Both calls run after the usual proto code / link_ready_ack exchange on the uds link and take
+ * over its socket. The server creates the segment and sends its id, the client attaches and
+ * confirms, then the server marks the segment removed so it vanishes once both sides detach.
+ */
+status_t cs_shm_accept(uds_link_t *uds, shm_link_t *link);
+status_t cs_shm_attach(uds_link_t *uds, shm_link_t *link);
+void cs_shm_disconnect(shm_link_t *link);
+status_t cs_shm_send(shm_link_t *link, const char *buf, uint32 size, int32 *send_size);
+status_t cs_shm_send_timed(shm_link_t *link, const char *buf, uint32 size, uint32 timeout);
+status_t cs_shm_recv(shm_link_t *link, char *buf, uint32 size, int32 *recv_size, uint32 *wait_event);
+status_t cs_shm_recv_timed(shm_link_t *link, char *buf, uint32 size, uint32 timeout);
+status_t cs_shm_wait(shm_link_t *link, uint32 wait_for, int32 timeout, bool32 *ready);
+/* true when the receive ring already holds bytes, whether or not a doorbell is pending for them */
+bool32 cs_shm_has_data(shm_link_t *link);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
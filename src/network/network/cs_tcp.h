@@ -99,6 +99,7 @@ status_t cs_tcp_send_timed(tcp_link_t *link, const char *buf, uint32 size, uint3
 status_t cs_tcp_recv(tcp_link_t *link, char *buf, uint32 size, int32 *recv_size, uint32 *wait_event);
 status_t cs_tcp_recv_timed(tcp_link_t *link, char *buf, uint32 size, uint32 timeout);
 status_t cs_tcp_wait(tcp_link_t *link, uint32 wait_for, int32 timeout, bool32 *ready);
+int32 cs_tcp_poll(struct pollfd *fds, uint32 nfds, int32 timeout);
 status_t cs_tcp_init();
 void cs_set_socket_timeout(socket_t sock, int32 time_out);
 void cs_reset_socket_timeout(socket_t sock);
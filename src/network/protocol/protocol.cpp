@@ -26,9 +26,21 @@
 #include <typeinfo>
 #include <sstream>
 #include <iostream>
+#include <algorithm>
+#ifdef _LZ4
+#include "lz4.h"
+#endif
 
 const static uint32_t PROTO_MAX_STR_LEN = 64 * 1024 * 1024;
 
+#ifdef _LZ4
+const static uint32_t PROTO_VERSION_MAX = PROTO_VERSION_COLUMNAR_LZ4;
+#else
+const static uint32_t PROTO_VERSION_MAX = PROTO_VERSION_COLUMNAR;
+#endif
+const static uint32_t COLUMN_BLOCK_FRAME_SIZE = 4 * sizeof(uint32_t);
+const static uint32_t COLUMN_BLOCK_COMPRESS_MIN = SIZE_K(4);
+
 
 #ifndef WIN32
 uint64_t htonll(uint64_t val) {
@@ -483,6 +495,342 @@ void ProtoFunc::WriteValueVector(const std::vector<Value> &values, std::ostrings
     }
 }
 
+uint32_t ProtoFunc::NegotiateVersion(uint32_t min_version, uint32_t max_version) {
+    // drivers older than the negotiation leave both fields zero
+    min_version = MAX(min_version, PROTO_VERSION);
+    max_version = MIN(MAX(max_version, PROTO_VERSION), PROTO_VERSION_MAX);
+    return min_version <= max_version ? max_version : 0;
+}
+
+uint32_t ProtoFunc::ColumnWidth(uint32_t type) {
+    switch (type) {
+        case GStorDataType::GS_TYPE_BOOLEAN:
+        case GStorDataType::GS_TYPE_TINYINT:
+        case GStorDataType::GS_TYPE_UTINYINT:
+            return sizeof(uint8_t);
+        case GStorDataType::GS_TYPE_SMALLINT:
+        case GStorDataType::GS_TYPE_USMALLINT:
+            return sizeof(uint16_t);
+        case GStorDataType::GS_TYPE_INTEGER:
+        case GStorDataType::GS_TYPE_UINT32:
+            return sizeof(uint32_t);
+        case GStorDataType::GS_TYPE_BIGINT:
+        case GStorDataType::GS_TYPE_UINT64:
+        case GStorDataType::GS_TYPE_REAL:
+        case GStorDataType::GS_TYPE_FLOAT:
+        case GStorDataType::GS_TYPE_DATE:
+        case GStorDataType::GS_TYPE_TIMESTAMP:
+            return sizeof(uint64_t);
+        default:
+            return 0;
+    }
+}
+
+template <typename T>
+static inline void StoreLittleEndian(char *addr, T value) {
+    memcpy(addr, &value, sizeof(T));
+    if (IS_BIG_ENDIAN) {
+        std::reverse(addr, addr + sizeof(T));
+    }
+}
+
+template <typename T>
+static inline T LoadLittleEndian(const char *addr) {
+    char tmp[sizeof(T)];
+    memcpy(tmp, addr, sizeof(T));
+    if (IS_BIG_ENDIAN) {
+        std::reverse(tmp, tmp + sizeof(T));
+    }
+    T value;
+    memcpy(&value, tmp, sizeof(T));
+    return value;
+}
+
+static void EncodeFixedValue(const Value &value, uint32_t type, char *addr) {
+    switch (type) {
+        case GStorDataType::GS_TYPE_BOOLEAN:
+            StoreLittleEndian<uint8_t>(addr, value.GetCastAs<bool>() ? 1 : 0);
+            break;
+        case GStorDataType::GS_TYPE_TINYINT:
+            StoreLittleEndian<int8_t>(addr, value.GetCastAs<int8_t>());
+            break;
+        case GStorDataType::GS_TYPE_UTINYINT:
+            StoreLittleEndian<uint8_t>(addr, value.GetCastAs<uint8_t>());
+            break;
+        case GStorDataType::GS_TYPE_SMALLINT:
+            StoreLittleEndian<int16_t>(addr, value.GetCastAs<int16_t>());
+            break;
+        case GStorDataType::GS_TYPE_USMALLINT:
+            StoreLittleEndian<uint16_t>(addr, value.GetCastAs<uint16_t>());
+            break;
+        case GStorDataType::GS_TYPE_INTEGER:
+            StoreLittleEndian<int32_t>(addr, value.GetCastAs<int32_t>());
+            break;
+        case GStorDataType::GS_TYPE_UINT32:
+            StoreLittleEndian<uint32_t>(addr, value.GetCastAs<uint32_t>());
+            break;
+        case GStorDataType::GS_TYPE_BIGINT:
+            StoreLittleEndian<int64_t>(addr, value.GetCastAs<int64_t>());
+            break;
+        case GStorDataType::GS_TYPE_UINT64:
+            StoreLittleEndian<uint64_t>(addr, value.GetCastAs<uint64_t>());
+            break;
+        case GStorDataType::GS_TYPE_REAL:
+        case GStorDataType::GS_TYPE_FLOAT:
+            StoreLittleEndian<double>(addr, value.GetCastAs<double>());
+            break;
+        default:
+            // dates and timestamps, both kept as microseconds since the unix epoch
+            StoreLittleEndian<int64_t>(addr, value.GetCastAs<timestamp_stor_t>().ts);
+            break;
+    }
+}
+
+static Value DecodeFixedValue(uint32_t type, const char *addr) {
+    switch (type) {
+        case GStorDataType::GS_TYPE_BOOLEAN:
+            return ValueFactory::ValueBool(LoadLittleEndian<uint8_t>(addr) != 0);
+        case GStorDataType::GS_TYPE_TINYINT:
+            return ValueFactory::ValueTinyInt(LoadLittleEndian<int8_t>(addr));
+        case GStorDataType::GS_TYPE_UTINYINT:
+            return ValueFactory::ValueUnsignTinyInt(LoadLittleEndian<uint8_t>(addr));
+        case GStorDataType::GS_TYPE_SMALLINT:
+            return ValueFactory::ValueSmallInt(LoadLittleEndian<int16_t>(addr));
+        case GStorDataType::GS_TYPE_USMALLINT:
+            return ValueFactory::ValueUnsignSmallInt(LoadLittleEndian<uint16_t>(addr));
+        case GStorDataType::GS_TYPE_INTEGER:
+            return ValueFactory::ValueInt(LoadLittleEndian<int32_t>(addr));
+        case GStorDataType::GS_TYPE_UINT32:
+            return ValueFactory::ValueUnsignInt(LoadLittleEndian<uint32_t>(addr));
+        case GStorDataType::GS_TYPE_BIGINT:
+            return ValueFactory::ValueBigInt(LoadLittleEndian<int64_t>(addr));
+        case GStorDataType::GS_TYPE_UINT64:
+            return ValueFactory::ValueUnsignBigInt(LoadLittleEndian<uint64_t>(addr));
+        case GStorDataType::GS_TYPE_REAL:
+        case GStorDataType::GS_TYPE_FLOAT:
+            return ValueFactory::ValueDouble(LoadLittleEndian<double>(addr));
+        case GStorDataType::GS_TYPE_DATE:
+            return ValueFactory::ValueDate(timestamp_stor_t{LoadLittleEndian<int64_t>(addr)});
+        default:
+            return ValueFactory::ValueTimeStamp(timestamp_stor_t{LoadLittleEndian<int64_t>(addr)});
+    }
+}
+
+static status_t DecodeVarValue(uint32_t type, const char *addr, uint32_t size, Value &value) {
+    switch (type) {
+        case GStorDataType::GS_TYPE_BLOB:
+        case GStorDataType::GS_TYPE_RAW:
+            value = ValueFactory::ValueBlob((const uint8_t *)addr, size);
+            return GS_SUCCESS;
+        case GStorDataType::GS_TYPE_DECIMAL:
+        case GStorDataType::GS_TYPE_NUMBER: {
+            dec4_t num;
+            if (!TryCast::Operation<std::string, dec4_t>(std::string(addr, size), num)) {
+                return GS_ERROR;
+            }
+            value = ValueFactory::ValueDecimal(num);
+            return GS_SUCCESS;
+        }
+        default:
+            value = ValueFactory::ValueVarchar(std::string(addr, size));
+            return GS_SUCCESS;
+    }
+}
+
+// append without the 4 byte alignment of cs_put_data, var column bytes are packed back to back
+static status_t PutBlockBytes(cs_packet_t *pack, const char *data, uint32_t size) {
+    CM_CHECK_SEND_PACK_FREE(pack, size);
+    if (size != 0) {
+        MEMS_RETURN_IFERR(memcpy_s(CS_WRITE_ADDR(pack), CS_REMAIN_SIZE(pack), data, size));
+    }
+    pack->head->size += size;
+    return GS_SUCCESS;
+}
+
+// zero filled space at the end of the pack, addressed through CS_RESERVE_ADDR since the pack may move
+static status_t ReserveBlockSection(cs_packet_t *pack, uint32_t size, uint32_t *offset) {
+    CM_CHECK_SEND_PACK_FREE(pack, size);
+    *offset = pack->head->size;
+    if (size != 0) {
+        MEMS_RETURN_IFERR(memset_s(CS_WRITE_ADDR(pack), CS_REMAIN_SIZE(pack), 0, size));
+    }
+    pack->head->size += size;
+    return GS_SUCCESS;
+}
+
+static status_t AlignBlockSection(cs_packet_t *pack, uint32_t payload) {
+    uint32_t used = pack->head->size - payload;
+    uint32_t offset = 0;
+    return ReserveBlockSection(pack, CM_ALIGN8(used) - used, &offset);
+}
+
+static status_t EncodeColumnBlock(cs_packet_t *pack, const ResultStruct &result, uint32_t begin, uint32_t rows) {
+    uint32_t payload = pack->head->size;
+    for (uint32_t j = 0; j < result.col_count; ++j) {
+        uint32_t type = result.col_info[j].type;
+        uint32_t width = ProtoFunc::ColumnWidth(type);
+        uint32_t nulls = 0;
+        uint32_t values = 0;
+        GS_RETURN_IFERR(ReserveBlockSection(pack, (rows + 7) / 8, &nulls));
+        GS_RETURN_IFERR(AlignBlockSection(pack, payload));
+        GS_RETURN_IFERR(ReserveBlockSection(pack, width != 0 ? rows * width : (rows + 1) * sizeof(uint32_t), &values));
+        uint32_t data = pack->head->size;
+
+        for (uint32_t i = 0; i < rows; ++i) {
+            Value value = result.batch->RowRef(begin + i).Field(j);
+            if (value.IsNull()) {
+                CS_RESERVE_ADDR(pack, nulls)[i / 8] |= (char)(1 << (i % 8));
+            } else if (width != 0) {
+                EncodeFixedValue(value, type, CS_RESERVE_ADDR(pack, values) + i * width);
+            } else if (intarkdb::IsString(value.GetType())) {
+                GS_RETURN_IFERR(PutBlockBytes(pack, value.GetRawBuff(), (uint32_t)value.Size()));
+            } else {
+                std::string text = value.ToString();
+                GS_RETURN_IFERR(PutBlockBytes(pack, text.c_str(), (uint32_t)text.size()));
+            }
+            if (width == 0) {
+                StoreLittleEndian<uint32_t>(CS_RESERVE_ADDR(pack, values) + (i + 1) * sizeof(uint32_t),
+                                            pack->head->size - data);
+            }
+        }
+        GS_RETURN_IFERR(AlignBlockSection(pack, payload));
+    }
+    return GS_SUCCESS;
+}
+
+static status_t SendColumnBlock(cs_pipe_t *pipe, cs_packet_t *pack, const ResultStruct &result, uint32_t begin,
+                                uint32_t rows, std::vector<char> &compressed) {
+    uint32_t frame = 0;
+    uint32_t flags = 0;
+    cs_init_set(pack, CS_LOCAL_VERSION);
+    GS_RETURN_IFERR(ReserveBlockSection(pack, COLUMN_BLOCK_FRAME_SIZE, &frame));
+    uint32_t payload = pack->head->size;
+    GS_RETURN_IFERR(EncodeColumnBlock(pack, result, begin, rows));
+
+    uint32_t raw_size = pack->head->size - payload;
+    uint32_t wire_size = raw_size;
+#ifdef _LZ4
+    if (result.proto_version >= PROTO_VERSION_COLUMNAR_LZ4 && raw_size >= COLUMN_BLOCK_COMPRESS_MIN) {
+        compressed.resize(LZ4_compressBound((int)raw_size));
+        int size = LZ4_compress_default(CS_RESERVE_ADDR(pack, payload), compressed.data(), (int)raw_size,
+                                        (int)compressed.size());
+        if (size > 0 && (uint32_t)size < raw_size) {
+            flags |= COLUMN_BLOCK_LZ4;
+            wire_size = (uint32_t)size;
+        }
+    }
+#endif
+    uint32_t *head = (uint32_t *)CS_RESERVE_ADDR(pack, frame);
+    head[0] = htonl(rows);
+    head[1] = htonl(flags);
+    head[2] = htonl(raw_size);
+    head[3] = htonl(wire_size);
+    if ((flags & COLUMN_BLOCK_LZ4) == 0) {
+        return cs_write_stream(pipe, CS_RESERVE_ADDR(pack, frame), COLUMN_BLOCK_FRAME_SIZE + raw_size, 0);
+    }
+    GS_RETURN_IFERR(cs_write_stream(pipe, CS_RESERVE_ADDR(pack, frame), COLUMN_BLOCK_FRAME_SIZE, 0));
+    return cs_write_stream(pipe, compressed.data(), wire_size, 0);
+}
+
+status_t ResultStruct::sendBlocks(cs_pipe_t *pipe, cs_packet_t *pack) {
+    status_t status = GS_SUCCESS;
+    uint32_t max_buf_size = pack->max_buf_size;
+    std::vector<char> compressed;
+    // a block of long strings may outgrow the agent's regular packet
+    pack->max_buf_size = GS_MAX_ALLOWED_PACKET_SIZE;
+    try {
+        for (uint64_t begin = 0; begin < row_count && status == GS_SUCCESS; begin += COLUMN_BLOCK_ROWS) {
+            uint32_t rows = (uint32_t)MIN(row_count - begin, (uint64_t)COLUMN_BLOCK_ROWS);
+            status = SendColumnBlock(pipe, pack, *this, (uint32_t)begin, rows, compressed);
+        }
+    } catch (const std::exception &ex) {
+        ERROR("[proto] encode column block err:%s", ex.what());
+        status = GS_ERROR;
+    }
+    cs_try_free_packet_buffer(pack);
+    pack->max_buf_size = max_buf_size;
+    return status;
+}
+
+static status_t DecodeColumnBlock(const char *payload, uint32_t size, uint32_t rows, ResultStruct &result) {
+    uint32_t pos = 0;
+    size_t first = result.rows.size();
+    result.rows.resize(first + rows);
+    for (uint32_t j = 0; j < result.col_count; ++j) {
+        uint32_t type = result.col_info[j].type;
+        uint32_t width = ProtoFunc::ColumnWidth(type);
+        const char *nulls = payload + pos;
+        pos = CM_ALIGN8(pos + (rows + 7) / 8);
+        uint32_t values_size = width != 0 ? rows * width : (rows + 1) * sizeof(uint32_t);
+        if (pos + values_size > size) {
+            return GS_ERROR;
+        }
+        const char *values = payload + pos;
+        pos += values_size;
+        uint32_t data_size = width != 0 ? 0 : LoadLittleEndian<uint32_t>(values + rows * sizeof(uint32_t));
+        if (pos + data_size > size) {
+            return GS_ERROR;
+        }
+        const char *data = payload + pos;
+        pos = CM_ALIGN8(pos + data_size);
+
+        for (uint32_t i = 0; i < rows; ++i) {
+            std::vector<Value> &row = result.rows[first + i].values;
+            if (nulls[i / 8] & (1 << (i % 8))) {
+                row.push_back(ValueFactory::ValueNull());
+                continue;
+            }
+            if (width != 0) {
+                row.push_back(DecodeFixedValue(type, values + i * width));
+                continue;
+            }
+            uint32_t start = LoadLittleEndian<uint32_t>(values + i * sizeof(uint32_t));
+            uint32_t end = LoadLittleEndian<uint32_t>(values + (i + 1) * sizeof(uint32_t));
+            Value value;
+            if (start > end || end > data_size || DecodeVarValue(type, data + start, end - start, value) != GS_SUCCESS) {
+                return GS_ERROR;
+            }
+            row.push_back(value);
+        }
+    }
+    return GS_SUCCESS;
+}
+
+static status_t ReadColumnBlock(cs_pipe_t *pipe, ResultStruct &result, uint32_t &rows) {
+    uint32_t flags = 0;
+    uint32_t raw_size = 0;
+    uint32_t wire_size = 0;
+    int32_t size = 0;
+    GS_RETURN_IFERR(ProtoFunc::ReadInt(pipe, rows));
+    GS_RETURN_IFERR(ProtoFunc::ReadInt(pipe, flags));
+    GS_RETURN_IFERR(ProtoFunc::ReadInt(pipe, raw_size));
+    GS_RETURN_IFERR(ProtoFunc::ReadInt(pipe, wire_size));
+    if (rows == 0 || raw_size > PROTO_MAX_STR_LEN || wire_size > PROTO_MAX_STR_LEN ||
+        (flags & ~COLUMN_BLOCK_LZ4) != 0 || ((flags & COLUMN_BLOCK_LZ4) == 0 && raw_size != wire_size)) {
+        ERROR("[proto] bad column block rows:%u flags:%u size:%u/%u", rows, flags, raw_size, wire_size);
+        return GS_ERROR;
+    }
+    std::vector<char> wire(wire_size);
+    if (cs_read_stream(pipe, wire.data(), SVR_TIME_OUT, wire_size, &size) == GS_ERROR || (uint32_t)size != wire_size) {
+        ERROR("[proto] socket read err");
+        return GS_ERROR;
+    }
+    if ((flags & COLUMN_BLOCK_LZ4) == 0) {
+        return DecodeColumnBlock(wire.data(), raw_size, rows, result);
+    }
+#ifdef _LZ4
+    std::vector<char> raw(raw_size);
+    if (LZ4_decompress_safe(wire.data(), raw.data(), (int)wire_size, (int)raw_size) != (int)raw_size) {
+        ERROR("[proto] lz4 decompress column block err");
+        return GS_ERROR;
+    }
+    return DecodeColumnBlock(raw.data(), raw_size, rows, result);
+#else
+    ERROR("[proto] lz4 compressed column block but built without lz4");
+    return GS_ERROR;
+#endif
+}
+
 PackProto::PackProto():length(0){}
 
 status_t PackProto::sendProto(cs_pipe_t *pipe) {
@@ -586,6 +934,14 @@ status_t ResultStruct::unpacket(cs_pipe_t *pipe) {
         GS_RETURN_IFERR(info.unpacket(pipe));
         col_info.push_back(info);
     }
+    if (proto_version >= PROTO_VERSION_COLUMNAR) {
+        for (uint64_t received = 0; received < row_count;) {
+            uint32_t rows = 0;
+            GS_RETURN_IFERR(ReadColumnBlock(pipe, *this, rows));
+            received += rows;
+        }
+        return GS_SUCCESS;
+    }
     for (int i = 0; i < row_count; ++i) {
         RowStruct row;
         row.setCount(col_count);
@@ -891,3 +1247,112 @@ void PrepareRes::packet(std::ostringstream &buf) {
     ProtoFunc::WriteBool(is_read_only, buf, length);
     ProtoFunc::WriteInt(param_num, buf, length);
 }
+
+status_t BatchExecuteReq::unpacket(cs_pipe_t *pipe) {
+    GS_RETURN_IFERR(ProtoFunc::ReadString(pipe, seq_id));
+    GS_RETURN_IFERR(ProtoFunc::ReadInt(pipe, stmt_id));
+    GS_RETURN_IFERR(ProtoFunc::ReadInt(pipe, parameters_size));
+    GS_RETURN_IFERR(ProtoFunc::ReadInt(pipe, row_count));
+    for (uint32_t i = 0; i < row_count; ++i) {
+        std::vector<Value> row;
+        GS_RETURN_IFERR(ProtoFunc::ReadValueVector(pipe, row, parameters_size));
+        rows.push_back(std::move(row));
+    }
+    return GS_SUCCESS;
+}
+
+void BatchExecuteReq::packet(std::ostringstream &buf) {
+    length = 0;
+    ProtoFunc::WriteInt(operation, buf, length);
+    ProtoFunc::WriteString(seq_id, buf, length);
+    ProtoFunc::WriteInt(stmt_id, buf, length);
+    ProtoFunc::WriteInt(parameters_size, buf, length);
+    ProtoFunc::WriteInt(rows.size(), buf, length);
+    for (const auto &row : rows) {
+        ProtoFunc::WriteValueVector(row, buf, length);
+    }
+}
+
+status_t BatchExecuteRes::unpacket(cs_pipe_t *pipe) {
+    uint32_t row_count = 0;
+    GS_RETURN_IFERR(ProtoFunc::ReadInt(pipe, rescode));
+    GS_RETURN_IFERR(ProtoFunc::ReadString(pipe, res_msg));
+    GS_RETURN_IFERR(ProtoFunc::ReadLong(pipe, effect_rows));
+    GS_RETURN_IFERR(ProtoFunc::ReadInt(pipe, row_count));
+    for (uint32_t i = 0; i < row_count; ++i) {
+        BatchRowStatus status;
+        GS_RETURN_IFERR(ProtoFunc::ReadInt(pipe, status.rescode));
+        GS_RETURN_IFERR(ProtoFunc::ReadLong(pipe, status.effect_rows));
+        row_status.push_back(status);
+    }
+    return GS_SUCCESS;
+}
+
+void BatchExecuteRes::packet(std::ostringstream &buf) {
+    length = 0;
+    ProtoFunc::WriteInt(rescode, buf, length);
+    ProtoFunc::WriteString(res_msg, buf, length);
+    ProtoFunc::WriteLong(effect_rows, buf, length);
+    ProtoFunc::WriteInt(row_status.size(), buf, length);
+    for (const auto &status : row_status) {
+        ProtoFunc::WriteInt(status.rescode, buf, length);
+        ProtoFunc::WriteLong(status.effect_rows, buf, length);
+    }
+}
+
+status_t CursorOpenReq::unpacket(cs_pipe_t *pipe) {
+    GS_RETURN_IFERR(ProtoFunc::ReadString(pipe, seq_id));
+    GS_RETURN_IFERR(ProtoFunc::ReadInt(pipe, stmt_id));
+    GS_RETURN_IFERR(ProtoFunc::ReadInt(pipe, fetch_rows));
+    GS_RETURN_IFERR(ProtoFunc::ReadInt(pipe, parameters_size));
+    GS_RETURN_IFERR(ProtoFunc::ReadValueVector(pipe, parameters, parameters_size));
+    return GS_SUCCESS;
+}
+
+void CursorOpenReq::packet(std::ostringstream &buf) {
+    length = 0;
+    ProtoFunc::WriteInt(operation, buf, length);
+    ProtoFunc::WriteString(seq_id, buf, length);
+    ProtoFunc::WriteInt(stmt_id, buf, length);
+    ProtoFunc::WriteInt(fetch_rows, buf, length);
+    ProtoFunc::WriteInt(parameters.size(), buf, length);
+    ProtoFunc::WriteValueVector(parameters, buf, length);
+}
+
+status_t CursorFetchReq::unpacket(cs_pipe_t *pipe) {
+    GS_RETURN_IFERR(ProtoFunc::ReadString(pipe, seq_id));
+    GS_RETURN_IFERR(ProtoFunc::ReadInt(pipe, stmt_id));
+    GS_RETURN_IFERR(ProtoFunc::ReadInt(pipe, fetch_rows));
+    return GS_SUCCESS;
+}
+
+void CursorFetchReq::packet(std::ostringstream &buf) {
+    length = 0;
+    ProtoFunc::WriteInt(operation, buf, length);
+    ProtoFunc::WriteString(seq_id, buf, length);
+    ProtoFunc::WriteInt(stmt_id, buf, length);
+    ProtoFunc::WriteInt(fetch_rows, buf, length);
+}
+
+status_t CursorFetchRes::unpacket(cs_pipe_t *pipe) {
+    GS_RETURN_IFERR(ProtoFunc::ReadInt(pipe, rescode));
+    GS_RETURN_IFERR(ProtoFunc::ReadString(pipe, res_msg));
+    GS_RETURN_IFERR(ProtoFunc::ReadBool(pipe, eof));
+    GS_RETURN_IFERR(ProtoFunc::ReadBool(pipe, has_result));
+    if (has_result) {
+        GS_RETURN_IFERR(result.unpacket(pipe));
+    }
+    return GS_SUCCESS;
+}
+
+void CursorFetchRes::packet(std::ostringstream &buf) {
+    length = 0;
+    ProtoFunc::WriteInt(rescode, buf, length);
+    ProtoFunc::WriteString(res_msg, buf, length);
+    ProtoFunc::WriteBool(eof, buf, length);
+    ProtoFunc::WriteBool(has_result, buf, length);
+    if (has_result) {
+        result.packet(buf);
+        length += result.length;
+    }
+}
@@ -30,6 +30,7 @@
 #include <vector>
 #include <sstream>
 #include  "compute/sql/include/type/value.h"
+#include  "compute/sql/include/common/record_batch.h"
 
 #ifdef CLIENT_LOG 
 #   include "logger.h"
@@ -66,7 +67,9 @@ enum PROTO_OPTION_ID {
     LOB_READ = 17,
     SESSION_PREPARE_READ_PARAMS = 18,
     GET_JDBC_META = 19,
-    COMMAND_EXECUTE = 20
+    COMMAND_EXECUTE = 20,
+    COMMAND_EXECUTE_BATCH = 21,
+    COMMAND_OPEN_CURSOR = 22
 };
 
 
@@ -143,6 +146,11 @@ public:
     static void WriteString(const std::string &value, std::ostringstream &buf, uint32_t &proto_length);
     static void WriteValueVector(const std::vector<Value> &values, std::ostringstream &buf, uint32_t &length);
     //todo writebytes
+
+    // highest version both sides support, 0 if the ranges do not overlap
+    static uint32_t NegotiateVersion(uint32_t min_version, uint32_t max_version);
+    // bytes per value of a fixed width column, 0 for offset encoded columns
+    static uint32_t ColumnWidth(uint32_t type);
 };
 
 class PackProto {
@@ -211,15 +219,36 @@ public:
     status_t unpacket(cs_pipe_t *pipe);
 };
 
+/*
+ * From PROTO_VERSION_COLUMNAR on, the result header (row_count, col_count, col_info) is followed
+ * by column blocks instead of RowStructs, until row_count rows have been sent. Each block is
+ *
+ *   uint32 rows, uint32 flags, uint32 raw_size, uint32 wire_size   (network order, like the header)
+ *   wire_size bytes of payload, lz4 compressed when flags has COLUMN_BLOCK_LZ4
+ *
+ * and the raw_size bytes of payload hold, for every column in order, a null bitmap (bit i of
+ * byte i / 8 set when row i is null) followed by either rows * ColumnWidth(type) fixed width
+ * values or rows + 1 uint32 offsets and the bytes they delimit. Payload integers are little
+ * endian so drivers can map the arrays directly, null slots are zero filled and every section
+ * starts on an 8 byte boundary of the payload. Dates and timestamps are int64 microseconds
+ * since the unix epoch, real and float are doubles, blobs go as raw bytes and the remaining
+ * types as their text form.
+ */
+#define COLUMN_BLOCK_ROWS 1024
+#define COLUMN_BLOCK_LZ4 0x1
+
 class ResultStruct: public PackProto {
 public:
     uint64_t row_count = 0;
     uint32_t col_count = 0;
     std::vector<ColInfoStruct> col_info;
     std::vector<RowStruct> rows;
+    uint32_t proto_version = PROTO_VERSION;
+    RecordBatch *batch = nullptr;  // rows of a columnar result, streamed by sendBlocks
 
     void packet(std::ostringstream &buf);
     status_t unpacket(cs_pipe_t *pipe);
+    status_t sendBlocks(cs_pipe_t *pipe, cs_packet_t *pack);
 };
 
 class ExecuteProtoReq: public PackProto { 
@@ -408,4 +437,84 @@ public:
     status_t unpacket(cs_pipe_t *pipe);
 };
 
+/*
+ * Runs one prepared statement once per parameter row in a single request. Unless the session is
+ * already inside a transaction, the rows share one transaction that is rolled back when any of
+ * them fails. Every row is attempted and reported, in request order.
+ */
+class BatchExecuteReq: public PackProto {
+public:
+    uint32_t operation = COMMAND_EXECUTE_BATCH;
+    std::string seq_id;
+    uint32_t stmt_id = 0;
+    uint32_t parameters_size = 0;  // values per row
+    uint32_t row_count = 0;
+    std::vector<std::vector<Value>> rows;
+
+    void packet(std::ostringstream &buf);
+    status_t unpacket(cs_pipe_t *pipe);
+};
+
+struct BatchRowStatus {
+    uint32_t rescode = RES_SUCCESS;
+    uint64_t effect_rows = 0;
+};
+
+class BatchExecuteRes: public PackProto {
+public:
+    uint32_t rescode = RES_SUCCESS;
+    std::string res_msg;  // message of the first failed row
+    uint64_t effect_rows = 0;  // rows changed by the batch, 0 when it was rolled back
+    std::vector<BatchRowStatus> row_status;
+
+    void packet(std::ostringstream &buf);
+    status_t unpacket(cs_pipe_t *pipe);
+};
+
+/*
+ * Server side cursors over prepared selects. COMMAND_OPEN_CURSOR executes the statement and answers
+ * with its first fetch_rows rows, RESULT_FETCH_ROWS returns the next ones and RESULT_CLOSE, with
+ * result_id set to the stmt_id, drops the cursor early. A session keeps at most one cursor per
+ * statement and holds no more than one fetch of it; the cursor is also released at eof and when
+ * the statement is executed again or closed.
+ */
+#define CURSOR_DEFAULT_FETCH_ROWS 1000
+#define CURSOR_MAX_FETCH_ROWS 100000
+
+class CursorOpenReq: public PackProto {
+public:
+    uint32_t operation = COMMAND_OPEN_CURSOR;
+    std::string seq_id;
+    uint32_t stmt_id = 0;
+    uint32_t fetch_rows = 0;  // 0 for CURSOR_DEFAULT_FETCH_ROWS
+    uint32_t parameters_size = 0;
+    std::vector<Value> parameters;
+
+    void packet(std::ostringstream &buf);
+    status_t unpacket(cs_pipe_t *pipe);
+};
+
+class CursorFetchReq: public PackProto {
+public:
+    uint32_t operation = RESULT_FETCH_ROWS;
+    std::string seq_id;
+    uint32_t stmt_id = 0;
+    uint32_t fetch_rows = 0;
+
+    void packet(std::ostringstream &buf);
+    status_t unpacket(cs_pipe_t *pipe);
+};
+
+class CursorFetchRes: public PackProto {
+public:
+    uint32_t rescode = RES_SUCCESS;
+    std::string res_msg;
+    bool eof = false;  // the cursor is exhausted and already released
+    bool has_result = false;
+    ResultStruct result;
+
+    void packet(std::ostringstream &buf);
+    status_t unpacket(cs_pipe_t *pipe);
+};
+
 #endif // __NETWORK_PROTOCOL_PROTOCOL_H__
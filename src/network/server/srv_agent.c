@@ -320,10 +320,22 @@ void srv_process_free_session(session_t *session)
 static status_t srv_process_single_session(session_t *session)
 {
     bool32 ready = GS_FALSE;
-    GS_RETURN_IFERR(cs_wait(session->pipe, CS_WAIT_FOR_READ, (int32)GS_POLL_WAIT, &ready));
+    // uds and shm links report a hung up peer here rather than on the following read
+    if (cs_wait(session->pipe, CS_WAIT_FOR_READ, (int32)GS_POLL_WAIT, &ready) != GS_SUCCESS) {
+        GS_LOG_RUN_ERR("[SESS] wait for operation error");
+        (void)srv_kill_sess(session);
+        return GS_ERROR;
+    }
     if (!ready) {
         return GS_SUCCESS;
     }
+    if (session->handshake != SESSION_HANDSHAKE_NONE) {
+        if (srv_process_handshake(session) != GS_SUCCESS) {
+            (void)srv_kill_sess(session);
+            return GS_ERROR;
+        }
+        return GS_SUCCESS;
+    }
     GS_LOG_RUN_INF("begin srv_process_command");
     return srv_process_command(session);
 }
@@ -350,13 +362,14 @@ void srv_detach_agent(session_t *session)
     session->agent = NULL;
 }
 
-static void srv_detach_agent_and_set_oneshot(session_t *session, agent_t *agent)
+static void srv_detach_agent_and_set_oneshot(session_t *session, agent_t *agent, bool32 requeue)
 {
     agent->reactor->agent_pool.shrink_hit_count = 0;
     cm_spin_lock(&session->detaching_lock, NULL);
     srv_detach_agent(session);
     CM_MFENCE;
-    if (reactor_set_oneshot(session) != GS_SUCCESS) {
+    status_t ret = requeue ? reactor_requeue_session(session) : reactor_set_oneshot(session);
+    if (ret != GS_SUCCESS) {
         GS_LOG_RUN_ERR("[agent] set oneshot flag of socket failed, session %u, reactor %lu",
             session->id, session->reactor->thread.id);
     }
@@ -367,6 +380,7 @@ static void srv_try_process_multi_sessions(agent_t *agent)
 {
     session_t *session = NULL;
     status_t ret = GS_SUCCESS;
+    uint32 pipelined = 0;
 
     for (;;) {
         // event will be set by reactor
@@ -395,8 +409,18 @@ static void srv_try_process_multi_sessions(agent_t *agent)
             return;
         } else if (reactor_in_dedicated_mode(agent->reactor)) {
             continue;
+        } else if (ret == GS_SUCCESS && cs_has_pending_input(session->pipe)) {
+            /*
+             * the client pipelined more requests behind this one, serve them without a trip through
+             * the reactor. after a run of them the session queues up again behind the other ones.
+             */
+            if (++pipelined < AGENT_MAX_PIPELINED_REQUESTS) {
+                continue;
+            }
+            srv_detach_agent_and_set_oneshot(session, agent, GS_TRUE);
+            return;
         } else {
-            srv_detach_agent_and_set_oneshot(session, agent);
+            srv_detach_agent_and_set_oneshot(session, agent, GS_FALSE);
             return;
         }
     }
@@ -38,6 +38,8 @@ extern "C" {
 
 #define AGENT_SHRINK_THRESHOLD(threshlold_secs) (1000 * (uint32)(threshlold_secs))
 #define AGENT_EXTEND_STEP 4
+// pipelined requests one agent serves back to back before the session goes back to the reactor
+#define AGENT_MAX_PIPELINED_REQUESTS 16
 
 struct st_reactor;
 typedef struct st_agent {
@@ -31,6 +31,7 @@
 #include "main/connection.h"
 #include "srv_instance.h"
 #include "srv_interface.h"
+#include <algorithm>
 #include <unordered_map>
 #include <sstream>
 #include <string>
@@ -47,6 +48,8 @@ extern "C" {
 
 struct StatementWrapper {
     std::map<uint32_t, std::unique_ptr<PreparedStatement>> statement_map;
+    // open cursors by stmt_id, declared last so they go before the statements they read from
+    std::map<uint32_t, std::unique_ptr<RecordStreaming>> cursor_map;
 };
 
 const std::unordered_map<uint32_t, std::string> m_rescode_msg = {
@@ -62,6 +65,7 @@ const std::unordered_map<uint32_t, std::string> m_rescode_msg = {
     {RES_NOT_LOGGED, "user not logged"},
     {RES_STMT_EXIST, "prepare statment is exist, please change stmt_id"},
     {RES_STMT_NOT_EXIST, "prepare statment not exist"},
+    {RES_CURSOR_NOT_EXIST, "cursor not open, it reached eof or was closed"},
 };
 
 std::string get_error_msg(uint32_t rescode) {
@@ -83,6 +87,17 @@ status_t prepare_handle(session_t *session);
 status_t prepare_update_handle(session_t *session);
 status_t prepare_query_handle(session_t *session);
 status_t execute_handle(session_t *session);
+status_t batch_execute_handle(session_t *session);
+status_t cursor_open_handle(session_t *session);
+status_t cursor_fetch_handle(session_t *session);
+
+// a cursor shares the plan of its statement, running the statement again invalidates it
+static void close_cursor(session_t *session, uint32_t stmt_id) {
+    auto wrapper = (StatementWrapper *)session->stmt;
+    if (wrapper) {
+        wrapper->cursor_map.erase(stmt_id);
+    }
+}
 
 status_t srv_process_command(session_t *session) {
     session->is_used = GS_TRUE;
@@ -123,6 +138,15 @@ status_t srv_process_command(session_t *session) {
     case COMMAND_EXECUTE:
         res = execute_handle(session);
         break;
+    case COMMAND_EXECUTE_BATCH:
+        res = batch_execute_handle(session);
+        break;
+    case COMMAND_OPEN_CURSOR:
+        res = cursor_open_handle(session);
+        break;
+    case RESULT_FETCH_ROWS:
+        res = cursor_fetch_handle(session);
+        break;
     default:
         break;
     }
@@ -150,8 +174,9 @@ status_t result_close(session_t *session) {
             res.rescode = RES_FIELD_ERR;
             break;
         }
+        GS_LOG_RUN_INF("seq_id:%s, result_id:%u", req.seq_id.c_str(), req.result_id);
+        close_cursor(session, req.result_id);
     } while (0);
-    //todo delete result
     res.sendProto(session->pipe);
     GS_LOG_RUN_INF("rescode:%u resmsg:%s", res.rescode, res.res_msg.c_str());
     return GS_SUCCESS;
@@ -168,11 +193,24 @@ status_t login_handle(session_t *session) {
         }
        
         char ipstr_remote[CM_MAX_IP_LEN];
-        std::string ip = cm_inet_ntop((struct sockaddr *)&session->pipe->link.tcp.remote.addr, ipstr_remote, CM_MAX_IP_LEN);
+        if (session->pipe->type == CS_TYPE_TCP) {
+            (void)cm_inet_ntop((struct sockaddr *)&session->pipe->link.tcp.remote.addr, ipstr_remote, CM_MAX_IP_LEN);
+        } else {
+            (void)strncpy_s(ipstr_remote, CM_MAX_IP_LEN, session->os_host, strlen(session->os_host));
+        }
+        std::string ip = ipstr_remote;
         GS_LOG_RUN_INF("session_id:%s max_version:%u max_version:%u dbname:%s user:%s user_passworld:%s ip:%s",
                        req.seq_id.c_str(), req.min_proto_version, req.max_proto_version, req.database_name.c_str(), 
                        req.user_name.c_str(), req.user_passworld.c_str(), ip.c_str());
         
+        session->proto_version = ProtoFunc::NegotiateVersion(req.min_proto_version, req.max_proto_version);
+        if (session->proto_version == 0) {
+            session->proto_version = PROTO_VERSION;
+            res.rescode = RES_PROTO_VERSION_ERR;
+            res.res_msg = "unsupported protocol version";
+            break;
+        }
+
         bool find_db = false;
         for (int i = 0; i < MAX_DB_NUM; i++) {
             if (req.database_name == srv_get_instance()->dbs[i].name) {
@@ -206,7 +244,7 @@ status_t login_handle(session_t *session) {
     if (res.rescode != RES_SUCCESS && res.res_msg.size() == 0) {
         res.res_msg = get_error_msg(res.rescode);
     }
-    res.proto_version = PROTO_VERSION;
+    res.proto_version = session->proto_version;
     res.sendProto(session->pipe);
     GS_LOG_RUN_INF("rescode:%u resmsg:%s", res.rescode, res.res_msg.c_str());
     return GS_SUCCESS;
@@ -274,7 +312,7 @@ status_t prepare_handle(session_t *session) {
     return GS_SUCCESS;
 }
 
-void write_result(const std::unique_ptr<RecordBatch> &r, ResultStruct& result) {
+void write_result(session_t *session, const std::unique_ptr<RecordBatch> &r, ResultStruct& result) {
     result.row_count = r->RowCount();
     const auto &col_header = r->GetSchema().GetColumnInfos();
     result.col_count = col_header.size();
@@ -286,19 +324,39 @@ void write_result(const std::unique_ptr<RecordBatch> &r, ResultStruct& result) {
         result.col_info.push_back(col);
     }
 
+    result.proto_version = session->proto_version;
+    if (result.proto_version >= PROTO_VERSION_COLUMNAR) {
+        // rows follow the response as column blocks, see send_result_blocks
+        result.batch = r.get();
+        return;
+    }
     for (size_t i = 0; i < r->RowCount(); i++) {
         RowStruct row;
+        const Record &record = r->RowRef(i);
         for (size_t j = 0; j < col_header.size(); ++j) {
-            const auto &v = r->Row(i).Field(j);
-            row.values.push_back(v);
+            row.values.push_back(record.Field(j));
         }
         result.rows.push_back(row);
     }
 }
 
+static status_t send_result_blocks(session_t *session, bool has_result, ResultStruct &result) {
+    if (!has_result || result.batch == nullptr) {
+        return GS_SUCCESS;
+    }
+    if (result.sendBlocks(session->pipe, session->send_pack) != GS_SUCCESS) {
+        // the client is left in the middle of a result, the stream cannot be resynchronized
+        GS_LOG_RUN_ERR("[SESS] send column blocks fail, session:%u", session->id);
+        kill_sess(session);
+        return GS_ERROR;
+    }
+    return GS_SUCCESS;
+}
+
 status_t prepare_update_handle(session_t *session) {
     PrepareUpdateReq req;
     PrepareUpdateRes res;
+    std::unique_ptr<RecordBatch> r;  // outlives the response, columnar rows are sent after it
     res.rescode = RES_SUCCESS;
     do {
         if (!session->is_logged) {
@@ -331,7 +389,8 @@ status_t prepare_update_handle(session_t *session) {
             if (req.key_mode) {
                 item->second->SetNeedResultSetEx(true);
             }
-            auto r = item->second->Execute(req.parameters);
+            close_cursor(session, req.stmt_id);
+            r = item->second->Execute(req.parameters);
             
             GS_LOG_DEBUG_INF("ret:%d StmtType:%u", r->GetRetCode(), r->GetStmtType());
             if (r->GetRetCode() != 0) {
@@ -343,7 +402,7 @@ status_t prepare_update_handle(session_t *session) {
            
             if (r->GetRecordBatchType() == RecordBatchType::Select || req.key_mode == 1) {
                 res.has_result = true;
-                write_result(r, res.result);
+                write_result(session, r, res.result);
             } else {
                 res.has_result = false;
             }
@@ -358,6 +417,7 @@ status_t prepare_update_handle(session_t *session) {
         res.res_msg = get_error_msg(res.rescode);
     }
     res.sendProto(session->pipe);
+    GS_RETURN_IFERR(send_result_blocks(session, res.has_result, res.result));
     GS_LOG_RUN_INF("rescode:%u resmsg:%s", res.rescode, res.res_msg.c_str());
     return GS_SUCCESS;
 }
@@ -365,6 +425,7 @@ status_t prepare_update_handle(session_t *session) {
 status_t prepare_query_handle(session_t *session) {
     PrepareQueryReq req;
     PrepareQueryRes res;
+    std::unique_ptr<RecordBatch> r;  // outlives the response, columnar rows are sent after it
     res.rescode = RES_SUCCESS;
     do {
         if (!session->is_logged) {
@@ -394,7 +455,8 @@ status_t prepare_query_handle(session_t *session) {
                 res.res_msg = "Don't have prepared statement";
             }
             item->second->SetLimitRowsEx(req.limit_rows);
-            auto r = item->second->Execute(req.parameters);
+            close_cursor(session, req.stmt_id);
+            r = item->second->Execute(req.parameters);
             
             GS_LOG_DEBUG_INF("ret:%d StmtType:%u", r->GetRetCode(), r->GetStmtType());
             if (r->GetRetCode() != 0) {
@@ -404,7 +466,7 @@ status_t prepare_query_handle(session_t *session) {
             }
 
             res.has_result = true;
-            write_result(r, res.result);
+            write_result(session, r, res.result);
         } catch (const std::exception& ex) {
             res.rescode = RES_SERVER_ERR;
             res.res_msg = std::string(ex.what());
@@ -415,6 +477,7 @@ status_t prepare_query_handle(session_t *session) {
         res.res_msg = get_error_msg(res.rescode);
     }
     res.sendProto(session->pipe);
+    GS_RETURN_IFERR(send_result_blocks(session, res.has_result, res.result));
     GS_LOG_RUN_INF("rescode:%u resmsg:%s", res.rescode, res.res_msg.c_str());
     return GS_SUCCESS;
 }
@@ -440,6 +503,7 @@ status_t prepare_close(session_t *session) {
             res.rescode = RES_STMT_NOT_EXIST;
             break;
         }
+        wrapper->cursor_map.erase(req.stmt_id);
         wrapper->statement_map.erase(item);
     } while (0);
 
@@ -451,6 +515,7 @@ status_t prepare_close(session_t *session) {
 status_t execute_handle(session_t *session) {
     ExecuteProtoReq req;
     ExecuteProtoRes res;
+    std::unique_ptr<RecordBatch> r;  // outlives the response, columnar rows are sent after it
     res.rescode = RES_SUCCESS;
     do {
         if (!session->is_logged) {
@@ -469,7 +534,7 @@ status_t execute_handle(session_t *session) {
                 conn->SetNeedResultSetEx(true);
             }
             conn->SetLimitRowsEx(req.limit_rows);
-            auto r = conn->Query(req.sql.c_str());
+            r = conn->Query(req.sql.c_str());
             res.is_read_only = false;
             GS_LOG_DEBUG_INF("ret:%d StmtType:%u", r->GetRetCode(), r->GetStmtType());
             if (r->GetRetCode() != 0) {
@@ -484,7 +549,7 @@ status_t execute_handle(session_t *session) {
             }
             if (r->GetRecordBatchType() == RecordBatchType::Select || req.key_mode == 1) {
                 res.has_result = true;
-                write_result(r, res.result);
+                write_result(session, r, res.result);
             } else {
                 res.has_result = false;
             }
@@ -499,10 +564,224 @@ status_t execute_handle(session_t *session) {
         res.res_msg = get_error_msg(res.rescode);
     }
     res.sendProto(session->pipe);
+    GS_RETURN_IFERR(send_result_blocks(session, res.has_result, res.result));
     GS_LOG_RUN_INF("rescode:%u resmsg:%s write_result:%d", res.rescode, res.res_msg.c_str(), res.has_result);
     return GS_SUCCESS;
 }
 
+static bool batch_end_transaction(Connection *conn, bool commit, BatchExecuteRes &res) {
+    auto r = conn->Query(commit ? "COMMIT" : "ROLLBACK");
+    if (r->GetRetCode() != 0) {
+        res.rescode = commit ? RES_COMMIT_ERR : RES_SERVER_ERR;
+        res.res_msg = r->GetRetMsg();
+        return false;
+    }
+    return true;
+}
+
+status_t batch_execute_handle(session_t *session) {
+    BatchExecuteReq req;
+    BatchExecuteRes res;
+    res.rescode = RES_SUCCESS;
+    do {
+        if (!session->is_logged) {
+            res.rescode = RES_NOT_LOGGED;
+            break;
+        }
+        if (req.unpacket(session->pipe) == GS_ERROR) {
+            res.rescode = RES_FIELD_ERR;
+            break;
+        }
+        GS_LOG_RUN_INF("seq_id:%s, stmt_id:%u, rows:%u", req.seq_id.c_str(), req.stmt_id, req.row_count);
+
+        auto wrapper = (StatementWrapper *)session->stmt;
+        if (!wrapper) {
+            res.rescode = RES_DB_ERROR;
+            res.res_msg = "Don't have prepared statement";
+            break;
+        }
+        auto item = wrapper->statement_map.find(req.stmt_id);
+        if (item == wrapper->statement_map.end()) {
+            res.rescode = RES_STMT_NOT_EXIST;
+            break;
+        }
+        if (!item->second || item->second->HasError()) {
+            res.rescode = RES_DB_ERROR;
+            res.res_msg = "Don't have prepared statement";
+            break;
+        }
+        if (item->second->IsRecordBatchSelect()) {
+            res.rescode = RES_CMD_ERR;
+            res.res_msg = "batch execute does not return rows, use a query instead";
+            break;
+        }
+
+        close_cursor(session, req.stmt_id);
+        Connection *conn = (Connection *)session->db_conn;
+        // inside a transaction of the client the rows just join it, like separate executes would
+        bool own_transaction = conn->IsAutoCommit();
+        try {
+            if (own_transaction) {
+                auto r = conn->Query("BEGIN");
+                if (r->GetRetCode() != 0) {
+                    res.rescode = RES_SERVER_ERR;
+                    res.res_msg = r->GetRetMsg();
+                    break;
+                }
+            }
+            // rows an exception keeps from running stay failed
+            res.row_status.assign(req.rows.size(), BatchRowStatus{RES_SERVER_ERR, 0});
+            for (size_t i = 0; i < req.rows.size(); ++i) {
+                auto r = item->second->Execute(req.rows[i]);
+                if (r->GetRetCode() != 0) {
+                    if (res.rescode == RES_SUCCESS) {
+                        res.rescode = RES_SERVER_ERR;
+                        res.res_msg = "row " + std::to_string(i) + ": " + r->GetRetMsg();
+                    }
+                    continue;
+                }
+                res.row_status[i].rescode = RES_SUCCESS;
+                res.row_status[i].effect_rows = r->GetEffectRow();
+                res.effect_rows += r->GetEffectRow();
+            }
+            if (own_transaction && !batch_end_transaction(conn, res.rescode == RES_SUCCESS, res)) {
+                res.effect_rows = 0;
+                break;
+            }
+            if (own_transaction && res.rescode != RES_SUCCESS) {
+                res.effect_rows = 0;
+            }
+        } catch (const std::exception& ex) {
+            if (own_transaction && !conn->IsAutoCommit()) {
+                (void)batch_end_transaction(conn, false, res);
+            }
+            res.rescode = RES_SERVER_ERR;
+            res.res_msg = std::string(ex.what());
+            res.effect_rows = 0;
+        }
+    } while (0);
+    if (res.rescode != RES_SUCCESS && res.res_msg.size() == 0) {
+        res.res_msg = get_error_msg(res.rescode);
+    }
+    res.sendProto(session->pipe);
+    GS_LOG_RUN_INF("rescode:%u resmsg:%s effect_rows:%lu", res.rescode, res.res_msg.c_str(), res.effect_rows);
+    return GS_SUCCESS;
+}
+
+// moves the next fetch_rows rows of the cursor into r, the cursor is released at eof or on error
+static void cursor_fetch(session_t *session, uint32_t stmt_id, uint32_t fetch_rows, CursorFetchRes &res,
+    std::unique_ptr<RecordBatch> &r) {
+    auto wrapper = (StatementWrapper *)session->stmt;
+    auto &cursor = wrapper->cursor_map[stmt_id];
+    uint32_t limit = fetch_rows == 0 ? CURSOR_DEFAULT_FETCH_ROWS : std::min(fetch_rows, (uint32_t)CURSOR_MAX_FETCH_ROWS);
+    try {
+        r = std::make_unique<RecordBatch>(cursor->GetSchema());
+        r->SetRecordBatchType(RecordBatchType::Select);
+        while (r->RowCount() < limit) {
+            auto [record, eof] = cursor->Next();
+            if (eof) {
+                res.eof = true;
+                break;
+            }
+            r->AddRecord(std::move(record));
+        }
+    } catch (const std::exception& ex) {
+        res.rescode = RES_SERVER_ERR;
+        res.res_msg = std::string(ex.what());
+        wrapper->cursor_map.erase(stmt_id);
+        return;
+    }
+    if (res.eof) {
+        wrapper->cursor_map.erase(stmt_id);
+    }
+    res.has_result = true;
+    write_result(session, r, res.result);
+}
+
+status_t cursor_open_handle(session_t *session) {
+    CursorOpenReq req;
+    CursorFetchRes res;
+    std::unique_ptr<RecordBatch> r;  // outlives the response, columnar rows are sent after it
+    res.rescode = RES_SUCCESS;
+    do {
+        if (!session->is_logged) {
+            res.rescode = RES_NOT_LOGGED;
+            break;
+        }
+        if (req.unpacket(session->pipe) == GS_ERROR) {
+            res.rescode = RES_FIELD_ERR;
+            break;
+        }
+        GS_LOG_RUN_INF("seq_id:%s, stmt_id:%u, fetch_rows:%u", req.seq_id.c_str(), req.stmt_id, req.fetch_rows);
+
+        auto wrapper = (StatementWrapper *)session->stmt;
+        if (!wrapper) {
+            res.rescode = RES_DB_ERROR;
+            res.res_msg = "Don't have prepared statement";
+            break;
+        }
+        auto item = wrapper->statement_map.find(req.stmt_id);
+        if (item == wrapper->statement_map.end()) {
+            res.rescode = RES_STMT_NOT_EXIST;
+            break;
+        }
+        if (!item->second || item->second->HasError()) {
+            res.rescode = RES_DB_ERROR;
+            res.res_msg = "Don't have prepared statement";
+            break;
+        }
+
+        close_cursor(session, req.stmt_id);
+        auto cursor = item->second->ExecuteStreaming(req.parameters);
+        if (cursor->GetRetCode() != 0) {
+            res.rescode = RES_SERVER_ERR;
+            res.res_msg = cursor->GetRetMsg();
+            break;
+        }
+        wrapper->cursor_map[req.stmt_id] = std::move(cursor);
+        cursor_fetch(session, req.stmt_id, req.fetch_rows, res, r);
+    } while (0);
+    if (res.rescode != RES_SUCCESS && res.res_msg.size() == 0) {
+        res.res_msg = get_error_msg(res.rescode);
+    }
+    res.sendProto(session->pipe);
+    GS_RETURN_IFERR(send_result_blocks(session, res.has_result, res.result));
+    GS_LOG_RUN_INF("rescode:%u resmsg:%s eof:%d", res.rescode, res.res_msg.c_str(), res.eof);
+    return GS_SUCCESS;
+}
+
+status_t cursor_fetch_handle(session_t *session) {
+    CursorFetchReq req;
+    CursorFetchRes res;
+    std::unique_ptr<RecordBatch> r;  // outlives the response, columnar rows are sent after it
+    res.rescode = RES_SUCCESS;
+    do {
+        if (!session->is_logged) {
+            res.rescode = RES_NOT_LOGGED;
+            break;
+        }
+        if (req.unpacket(session->pipe) == GS_ERROR) {
+            res.rescode = RES_FIELD_ERR;
+            break;
+        }
+        GS_LOG_DEBUG_INF("seq_id:%s, stmt_id:%u, fetch_rows:%u", req.seq_id.c_str(), req.stmt_id, req.fetch_rows);
+
+        auto wrapper = (StatementWrapper *)session->stmt;
+        if (!wrapper || wrapper->cursor_map.count(req.stmt_id) == 0) {
+            res.rescode = RES_CURSOR_NOT_EXIST;
+            break;
+        }
+        cursor_fetch(session, req.stmt_id, req.fetch_rows, res, r);
+    } while (0);
+    if (res.rescode != RES_SUCCESS && res.res_msg.size() == 0) {
+        res.res_msg = get_error_msg(res.rescode);
+    }
+    res.sendProto(session->pipe);
+    GS_RETURN_IFERR(send_result_blocks(session, res.has_result, res.result));
+    GS_LOG_DEBUG_INF("rescode:%u resmsg:%s eof:%d", res.rescode, res.res_msg.c_str(), res.eof);
+    return GS_SUCCESS;
+}
+
 void set_prepare_stmt(session_t *session) {
     auto wrapper = new StatementWrapper();
     session->stmt = (intarkdb_prepared_statement)wrapper;
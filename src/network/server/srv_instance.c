@@ -43,6 +43,13 @@ static status_t instance_load_params(const server_config* cfg)
 {
     memcpy(g_srv_inst->lsnr.tcp_service.host, cfg->host, sizeof(cfg->host));
     g_srv_inst->lsnr.tcp_service.port = cfg->port;
+    PRTS_RETURN_IFERR(snprintf_s(g_srv_inst->lsnr.uds_service.names[0], GS_UNIX_PATH_MAX, GS_UNIX_PATH_MAX - 1,
+        "%s", cfg->uds_path));
+    PRTS_RETURN_IFERR(snprintf_s(g_srv_inst->lsnr.shm_service.names[0], GS_UNIX_PATH_MAX, GS_UNIX_PATH_MAX - 1,
+        "%s", cfg->shm_path));
+    PRTS_RETURN_IFERR(snprintf_s(g_srv_inst->lsnr.metrics_service.host[0], CM_MAX_IP_LEN, CM_MAX_IP_LEN - 1,
+        "%s", cfg->metrics_host));
+    g_srv_inst->lsnr.metrics_service.port = cfg->metrics_port;
 
     param_value_t param_value;
 
@@ -62,9 +69,11 @@ static status_t instance_load_params(const server_config* cfg)
     GS_RETURN_IFERR(srv_get_param(DCC_PARAM_SRV_AGENT_SHRINK_THRESHOLD, &param_value));
     g_srv_inst->reactor_pool.agents_shrink_threshold = param_value.uint32_val;
 
-    GS_LOG_RUN_INF("[INST] server load params successfully, lsnr host:%s port:%u reactor_cnt:%u optimized_worker_count:%u "
-        "max_worker_count:%u max_allowed_packet:%u agent_shrink_threshold:%u",
-        g_srv_inst->lsnr.tcp_service.host[0], g_srv_inst->lsnr.tcp_service.port, reactor_pool->reactor_count,
+    GS_LOG_RUN_INF("[INST] server load params successfully, lsnr host:%s port:%u uds:%s shm:%s metrics port:%u "
+        "reactor_cnt:%u optimized_worker_count:%u max_worker_count:%u max_allowed_packet:%u agent_shrink_threshold:%u",
+        g_srv_inst->lsnr.tcp_service.host[0], g_srv_inst->lsnr.tcp_service.port,
+        g_srv_inst->lsnr.uds_service.names[0], g_srv_inst->lsnr.shm_service.names[0],
+        g_srv_inst->lsnr.metrics_service.port, reactor_pool->reactor_count,
         g_srv_inst->attr.optimized_worker_count, g_srv_inst->attr.max_worker_count,
         g_srv_inst->attr.max_allowed_packet, g_srv_inst->reactor_pool.agents_shrink_threshold);
 
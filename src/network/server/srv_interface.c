@@ -50,6 +50,10 @@ void stop_server(void) {
 void init_config(server_config *cfg) {
     strcpy(cfg->host, DEFAULT_HOST);
     cfg->port = DEFAULT_SERVER_PORT;
+    cfg->uds_path[0] = '\0';
+    cfg->shm_path[0] = '\0';
+    strcpy(cfg->metrics_host, DEFAULT_HOST);
+    cfg->metrics_port = 0;
     int db_i = 0;
     while (db_i < MAX_DB_NUM) {
         cfg->db_items[db_i].isUsed = false;
@@ -47,6 +47,10 @@ typedef struct st_server_config {
     char host[LSNR_HOST_COUNT][MAX_IP_LEN];
     unsigned short port;
     database_item db_items[MAX_DB_NUM];
+    char uds_path[GS_UNIX_PATH_MAX];  // unix domain socket listener, empty to disable
+    char shm_path[GS_UNIX_PATH_MAX];  // shared memory listener socket, empty to disable
+    char metrics_host[MAX_IP_LEN];    // address of the prometheus /metrics listener
+    unsigned short metrics_port;      // 0 to disable the metrics listener
 } server_config;
 
 EXPORT_API status_t startup_server(const server_config* cfg);
@@ -24,6 +24,7 @@
 #include "srv_lsnr.h"
 #include "srv_agent.h"
 #include "srv_instance.h"
+#include "srv_metrics.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -40,32 +41,147 @@ static status_t srv_tcp_app_connect_action(tcp_lsnr_t *lsnr, cs_pipe_t *pipe)
     return GS_SUCCESS;
 }
 
+// the handshake is left to the agent serving the session, see srv_process_handshake
+static status_t srv_uds_app_connect_action(uds_lsnr_t *lsnr, cs_pipe_t *pipe)
+{
+    if (srv_create_local_session(pipe, SESSION_HANDSHAKE_UDS) != GS_SUCCESS) {
+        cs_uds_disconnect(&pipe->link.uds);
+        GS_LOG_DEBUG_ERR("[lsnr] create uds session fail");
+        return GS_ERROR;
+    }
+
+    return GS_SUCCESS;
+}
+
+static status_t srv_shm_app_connect_action(uds_lsnr_t *lsnr, cs_pipe_t *pipe)
+{
+    if (srv_create_local_session(pipe, SESSION_HANDSHAKE_SHM) != GS_SUCCESS) {
+        cs_uds_disconnect(&pipe->link.uds);
+        GS_LOG_DEBUG_ERR("[lsnr] create shm session fail");
+        return GS_ERROR;
+    }
+
+    return GS_SUCCESS;
+}
+
+static inline bool32 srv_uds_lsnr_enabled(const uds_lsnr_t *lsnr)
+{
+    return lsnr->names[0][0] != '\0';
+}
+
+static inline bool32 srv_metrics_lsnr_enabled(const tcp_lsnr_t *lsnr)
+{
+    return lsnr->port != 0;
+}
+
+static status_t srv_start_metrics_lsnr(tcp_lsnr_t *lsnr)
+{
+    if (!srv_metrics_lsnr_enabled(lsnr)) {
+        return GS_SUCCESS;
+    }
+
+    lsnr->type = LSNR_TYPE_SERVICE;
+    if (cs_start_tcp_lsnr(lsnr, srv_metrics_connect_action, GS_FALSE) != GS_SUCCESS) {
+        GS_LOG_RUN_ERR("[lsnr] failed to start metrics lsnr on %s:%u", lsnr->host[0], lsnr->port);
+        return GS_ERROR;
+    }
+    GS_LOG_RUN_INF("[lsnr] metrics lsnr started on %s:%u", lsnr->host[0], lsnr->port);
+    return GS_SUCCESS;
+}
+
+static status_t srv_start_uds_lsnr(uds_lsnr_t *lsnr, uds_connect_action_t action, const char *desc)
+{
+    if (!srv_uds_lsnr_enabled(lsnr)) {
+        return GS_SUCCESS;
+    }
+
+    lsnr->type = LSNR_TYPE_UDS;
+    lsnr->permissions = SERVICE_FILE_PERMISSIONS;
+    if (cs_start_uds_lsnr(lsnr, action) != GS_SUCCESS) {
+        GS_LOG_RUN_ERR("[lsnr] failed to start %s lsnr on %s", desc, lsnr->names[0]);
+        return GS_ERROR;
+    }
+    GS_LOG_RUN_INF("[lsnr] %s lsnr started on %s", desc, lsnr->names[0]);
+    return GS_SUCCESS;
+}
+
 status_t srv_start_lsnr(void)
 {
     status_t status;
+    lsnr_t *lsnr = &g_srv_inst->lsnr;
 
-    g_srv_inst->lsnr.tcp_service.type = LSNR_TYPE_MES;
-    status = cs_start_tcp_lsnr(&g_srv_inst->lsnr.tcp_service, srv_tcp_app_connect_action, GS_TRUE);
+    lsnr->tcp_service.type = LSNR_TYPE_MES;
+    status = cs_start_tcp_lsnr(&lsnr->tcp_service, srv_tcp_app_connect_action, GS_TRUE);
     if (status != GS_SUCCESS) {
         GS_LOG_RUN_ERR("[lsnr] failed to start lsnr for LSNR_ADDR");
         return status;
     }
 
+    if (srv_start_uds_lsnr(&lsnr->uds_service, srv_uds_app_connect_action, "uds") != GS_SUCCESS) {
+        cs_stop_tcp_lsnr(&lsnr->tcp_service);
+        return GS_ERROR;
+    }
+
+    if (srv_start_uds_lsnr(&lsnr->shm_service, srv_shm_app_connect_action, "shm") != GS_SUCCESS) {
+        if (srv_uds_lsnr_enabled(&lsnr->uds_service)) {
+            cs_stop_uds_lsnr(&lsnr->uds_service);
+        }
+        cs_stop_tcp_lsnr(&lsnr->tcp_service);
+        return GS_ERROR;
+    }
+
+    if (srv_start_metrics_lsnr(&lsnr->metrics_service) != GS_SUCCESS) {
+        if (srv_uds_lsnr_enabled(&lsnr->shm_service)) {
+            cs_stop_uds_lsnr(&lsnr->shm_service);
+        }
+        if (srv_uds_lsnr_enabled(&lsnr->uds_service)) {
+            cs_stop_uds_lsnr(&lsnr->uds_service);
+        }
+        cs_stop_tcp_lsnr(&lsnr->tcp_service);
+        return GS_ERROR;
+    }
+
     return GS_SUCCESS;
 }
 
 void srv_pause_lsnr(lsnr_type_t type)
 {
+    lsnr_t *lsnr = &g_srv_inst->lsnr;
     if (type == LSNR_TYPE_MES || type == LSNR_TYPE_ALL) {
-        cs_pause_tcp_lsnr(&g_srv_inst->lsnr.tcp_service);
+        cs_pause_tcp_lsnr(&lsnr->tcp_service);
+    }
+    if ((type == LSNR_TYPE_SERVICE || type == LSNR_TYPE_ALL) && srv_metrics_lsnr_enabled(&lsnr->metrics_service)) {
+        cs_pause_tcp_lsnr(&lsnr->metrics_service);
+    }
+    if (type == LSNR_TYPE_UDS || type == LSNR_TYPE_ALL) {
+        if (srv_uds_lsnr_enabled(&lsnr->uds_service)) {
+            cs_pause_uds_lsnr(&lsnr->uds_service);
+        }
+        if (srv_uds_lsnr_enabled(&lsnr->shm_service)) {
+            cs_pause_uds_lsnr(&lsnr->shm_service);
+        }
     }
     return;
 }
 
 void srv_stop_lsnr(lsnr_type_t type)
 {
+    lsnr_t *lsnr = &g_srv_inst->lsnr;
     if (type == LSNR_TYPE_MES || type == LSNR_TYPE_ALL) {
-        cs_stop_tcp_lsnr(&g_srv_inst->lsnr.tcp_service);
+        cs_stop_tcp_lsnr(&lsnr->tcp_service);
+    }
+    if ((type == LSNR_TYPE_SERVICE || type == LSNR_TYPE_ALL) && srv_metrics_lsnr_enabled(&lsnr->metrics_service)) {
+        cs_stop_tcp_lsnr(&lsnr->metrics_service);
+    }
+    if (type == LSNR_TYPE_UDS || type == LSNR_TYPE_ALL) {
+        if (srv_uds_lsnr_enabled(&lsnr->uds_service)) {
+            cs_stop_uds_lsnr(&lsnr->uds_service);
+            (void)unlink(lsnr->uds_service.names[0]);
+        }
+        if (srv_uds_lsnr_enabled(&lsnr->shm_service)) {
+            cs_stop_uds_lsnr(&lsnr->shm_service);
+            (void)unlink(lsnr->shm_service.names[0]);
+        }
     }
     return;
 }
@@ -34,6 +34,9 @@ extern "C" {
 
 typedef struct st_lsnr {
     tcp_lsnr_t tcp_service;
+    uds_lsnr_t uds_service;  // plain unix domain socket, names[0] empty when disabled
+    uds_lsnr_t shm_service;  // shared memory rings, accepted on their own unix socket
+    tcp_lsnr_t metrics_service;  // http /metrics endpoint, port 0 when disabled
 } lsnr_t;
 
 status_t srv_start_lsnr(void);
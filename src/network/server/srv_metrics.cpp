@@ -0,0 +1,291 @@
+/*
+* Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+*
+* openGauss embedded is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+* http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+*
+* srv_metrics.cpp
+*
+* IDENTIFICATION
+* openGauss-embedded/src/network/server/srv_metrics.cpp
+*
+* -------------------------------------------------------------------------
+*/
+#include "srv_metrics.h"
+#include "srv_instance.h"
+#include "srv_reactor.h"
+#include "srv_agent.h"
+#include "main/connection.h"
+#include "common/query_metrics.h"
+#include "common/memory/memory_manager.h"
+#include <fmt/format.h>
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+#include <string>
+
+#define SRV_METRICS_REQUEST_SIZE 4096
+#define SRV_METRICS_IO_TIMEOUT 2000  // ms, a scraper that stalls must not hold the listener
+
+static void metrics_header(std::string &out, const char *name, const char *type, const char *help)
+{
+    fmt::format_to(std::back_inserter(out), "# HELP {} {}\n# TYPE {} {}\n", name, help, name, type);
+}
+
+template <typename T>
+static void metrics_sample(std::string &out, const std::string &name, const std::string &labels, T value)
+{
+    if (labels.empty()) {
+        fmt::format_to(std::back_inserter(out), "{} {}\n", name, value);
+    } else {
+        fmt::format_to(std::back_inserter(out), "{}{{{}}} {}\n", name, labels, value);
+    }
+}
+
+static std::string metrics_type_label(StatementType type)
+{
+    std::string name = fmt::format("{}", type);
+    std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+    return fmt::format("type=\"{}\"", name);
+}
+
+static void render_query_metrics(std::string &out)
+{
+    auto snapshot = QueryMetrics::Collect();
+
+    metrics_header(out, "intarkdb_queries_total", "counter", "Statements executed, by statement type.");
+    for (size_t t = 0; t < snapshot.size(); t++) {
+        if (snapshot[t].count > 0) {
+            metrics_sample(out, "intarkdb_queries_total", metrics_type_label((StatementType)t), snapshot[t].count);
+        }
+    }
+
+    metrics_header(out, "intarkdb_query_errors_total", "counter", "Statements that returned an error.");
+    for (size_t t = 0; t < snapshot.size(); t++) {
+        if (snapshot[t].count > 0) {
+            metrics_sample(out, "intarkdb_query_errors_total", metrics_type_label((StatementType)t),
+                           snapshot[t].errors);
+        }
+    }
+
+    metrics_header(out, "intarkdb_query_duration_seconds", "histogram", "Statement execution latency.");
+    for (size_t t = 0; t < snapshot.size(); t++) {
+        const auto &counters = snapshot[t];
+        if (counters.count == 0) {
+            continue;
+        }
+        std::string type_label = metrics_type_label((StatementType)t);
+        uint64_t cumulative = 0;
+        for (size_t b = 0; b < QueryMetrics::BUCKET_COUNT; b++) {
+            cumulative += counters.buckets[b];
+            std::string le = b < QueryMetrics::LATENCY_BUCKETS_US.size()
+                                 ? fmt::format("{}", QueryMetrics::LATENCY_BUCKETS_US[b] / 1e6)
+                                 : std::string("+Inf");
+            metrics_sample(out, "intarkdb_query_duration_seconds_bucket",
+                           fmt::format("{},le=\"{}\"", type_label, le), cumulative);
+        }
+        metrics_sample(out, "intarkdb_query_duration_seconds_sum", type_label, counters.latency_sum_us / 1e6);
+        metrics_sample(out, "intarkdb_query_duration_seconds_count", type_label, counters.count);
+    }
+}
+
+static void render_memory_metrics(std::string &out)
+{
+    auto manager = intarkdb::MemoryManager::GetInstance();
+    metrics_header(out, "intarkdb_memory_used_bytes", "gauge", "Memory reserved by running statements.");
+    metrics_sample(out, "intarkdb_memory_used_bytes", "", manager->UsedMemory());
+    metrics_header(out, "intarkdb_memory_limit_bytes", "gauge", "Memory limit of the sql engine.");
+    metrics_sample(out, "intarkdb_memory_limit_bytes", "", manager->MemoryLimit());
+}
+
+static void render_agent_metrics(std::string &out)
+{
+    reactor_pool_t *pool = &srv_get_instance()->reactor_pool;
+    uint64_t sessions = 0;
+    uint64_t agents = 0;
+    uint64_t idle = 0;
+    uint64_t max_agents = 0;
+
+    // unlocked reads, a gauge only needs to be close
+    for (uint32 i = 0; i < pool->reactor_count; i++) {
+        const reactor_t *reactor = &pool->reactors[i];
+        sessions += (uint32)reactor->session_count;
+        agents += reactor->agent_pool.curr_count;
+        idle += reactor->agent_pool.idle_count;
+        max_agents += reactor->agent_pool.max_count;
+    }
+    uint64_t busy = agents > idle ? agents - idle : 0;
+
+    metrics_header(out, "intarkdb_sessions", "gauge", "Client sessions registered with the reactors.");
+    metrics_sample(out, "intarkdb_sessions", "", sessions);
+    metrics_header(out, "intarkdb_agent_threads", "gauge", "Agent threads of the reactors, by state.");
+    metrics_sample(out, "intarkdb_agent_threads", "state=\"busy\"", busy);
+    metrics_sample(out, "intarkdb_agent_threads", "state=\"idle\"", agents - busy);
+    metrics_header(out, "intarkdb_agent_threads_max", "gauge", "Upper limit of agent threads.");
+    metrics_sample(out, "intarkdb_agent_threads_max", "", max_agents);
+    metrics_header(out, "intarkdb_agent_pool_utilization", "gauge", "Busy agent threads over the upper limit.");
+    metrics_sample(out, "intarkdb_agent_pool_utilization", "", max_agents == 0 ? 0.0 : (double)busy / max_agents);
+}
+
+// one row of a dv_* view, the kernel counters are read through the performance views
+static bool metrics_read_view(Connection *conn, const char *sql, Record &row)
+{
+    auto result = conn->Query(sql);
+    if (result->GetRetCode() != 0 || result->RowCount() == 0) {
+        GS_LOG_RUN_WAR("[metrics] %s failed: %s", sql, result->GetRetMsg().c_str());
+        return false;
+    }
+    row = result->Row(0);
+    return true;
+}
+
+typedef struct st_metrics_kernel_item {
+    const char *name;
+    const char *type;
+    const char *help;
+    double divisor;  // applied to the view column, turns microseconds into seconds
+} metrics_kernel_item_t;
+
+static const char *g_metrics_buffer_sql =
+    "SELECT buffer_gets, disk_reads, hit_ratio, dirty_pages FROM dv_buffer_pool";
+static const metrics_kernel_item_t g_metrics_buffer_items[] = {
+    {"intarkdb_buffer_gets_total", "counter", "Buffer pool page requests.", 1},
+    {"intarkdb_buffer_disk_reads_total", "counter", "Page requests that had to read the disk.", 1},
+    {"intarkdb_buffer_hit_ratio", "gauge", "Buffer pool hit ratio since startup.", 1},
+    {"intarkdb_buffer_dirty_pages", "gauge", "Dirty pages queued for checkpoint.", 1},
+};
+
+static const char *g_metrics_redo_sql =
+    "SELECT redo_flush_times, redo_flush_time_us, redo_flush_bytes, ckpt_lag_lfn, ckpt_flush_pages "
+    "FROM dv_redo_checkpoint";
+static const metrics_kernel_item_t g_metrics_redo_items[] = {
+    {"intarkdb_redo_flushes_total", "counter", "Redo log flushes.", 1},
+    {"intarkdb_redo_flush_seconds_total", "counter", "Time spent flushing redo, divide by flushes for latency.", 1e6},
+    {"intarkdb_redo_flush_bytes_total", "counter", "Redo bytes flushed.", 1},
+    {"intarkdb_checkpoint_lag_lfn", "gauge", "Redo batches written since the checkpoint truncation point.", 1},
+    {"intarkdb_checkpoint_flush_pages_total", "counter", "Pages written by checkpoints.", 1},
+};
+
+static void render_kernel_group(std::string &out, const metrics_kernel_item_t *items, uint32 count,
+    const std::vector<std::pair<std::string, Record>> &rows)
+{
+    for (uint32 i = 0; i < count; i++) {
+        metrics_header(out, items[i].name, items[i].type, items[i].help);
+        for (auto &row : rows) {
+            double value = row.second.Field(i).GetCastAs<double>() / items[i].divisor;
+            metrics_sample(out, items[i].name, row.first, value);
+        }
+    }
+}
+
+// a short lived connection per database and scrape, holding the db list lock so the database stays open
+static void render_kernel_metrics(std::string &out)
+{
+    srv_inst_t *inst = srv_get_instance();
+    std::vector<std::pair<std::string, Record>> buffer_rows;
+    std::vector<std::pair<std::string, Record>> redo_rows;
+
+    cm_spin_lock(&inst->db_list_lock, NULL);
+    for (int i = 0; i < MAX_DB_NUM; i++) {
+        if (!inst->dbs[i].isUsed) {
+            continue;
+        }
+        intarkdb_connection conn = NULL;
+        if (intarkdb_connect(inst->dbs[i].db, &conn) != SQL_SUCCESS) {
+            GS_LOG_RUN_WAR("[metrics] connect to %s failed", inst->dbs[i].name);
+            continue;
+        }
+        std::string db_label = fmt::format("db=\"{}\"", inst->dbs[i].name);
+        Record row;
+        if (metrics_read_view((Connection *)conn, g_metrics_buffer_sql, row)) {
+            buffer_rows.emplace_back(db_label, row);
+        }
+        if (metrics_read_view((Connection *)conn, g_metrics_redo_sql, row)) {
+            redo_rows.emplace_back(db_label, row);
+        }
+        intarkdb_disconnect(&conn);
+    }
+    cm_spin_unlock(&inst->db_list_lock);
+
+    render_kernel_group(out, g_metrics_buffer_items, ELEMENT_COUNT(g_metrics_buffer_items), buffer_rows);
+    render_kernel_group(out, g_metrics_redo_items, ELEMENT_COUNT(g_metrics_redo_items), redo_rows);
+}
+
+static std::string srv_render_metrics(void)
+{
+    std::string out;
+    // kernel first, the exporter's own view reads are counted as select statements
+    render_kernel_metrics(out);
+    render_query_metrics(out);
+    render_memory_metrics(out);
+    render_agent_metrics(out);
+    return out;
+}
+
+// reads up to the end of the request head, the body of a GET is ignored
+static status_t metrics_recv_request(tcp_link_t *link, char *buf, uint32 size)
+{
+    uint32 len = 0;
+    bool32 ready = GS_FALSE;
+    int32 recv_size = 0;
+    uint32 wait_event = 0;
+
+    while (len < size - 1) {
+        GS_RETURN_IFERR(cs_tcp_wait(link, CS_WAIT_FOR_READ, SRV_METRICS_IO_TIMEOUT, &ready));
+        if (!ready) {
+            GS_THROW_ERROR(ERR_TCP_TIMEOUT, "wait for metrics request");
+            return GS_ERROR;
+        }
+        GS_RETURN_IFERR(cs_tcp_recv(link, buf + len, size - 1 - len, &recv_size, &wait_event));
+        len += (uint32)recv_size;
+        buf[len] = '\0';
+        if (strstr(buf, "\r\n\r\n") != NULL || strstr(buf, "\n\n") != NULL) {
+            return GS_SUCCESS;
+        }
+    }
+    GS_THROW_ERROR(ERR_TCP_RECV, "metrics", 0);
+    return GS_ERROR;
+}
+
+static status_t metrics_send_response(tcp_link_t *link, const char *status, const std::string &body)
+{
+    std::string response = fmt::format(
+        "HTTP/1.1 {}\r\nContent-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+        "Content-Length: {}\r\nConnection: close\r\n\r\n",
+        status, body.size());
+    response += body;
+    return cs_tcp_send_timed(link, response.data(), (uint32)response.size(), SRV_METRICS_IO_TIMEOUT);
+}
+
+status_t srv_metrics_connect_action(tcp_lsnr_t *lsnr, cs_pipe_t *pipe)
+{
+    char request[SRV_METRICS_REQUEST_SIZE];
+    tcp_link_t *link = &pipe->link.tcp;
+    status_t status = metrics_recv_request(link, request, sizeof(request));
+
+    if (status == GS_SUCCESS) {
+        if (strncmp(request, "GET ", strlen("GET ")) != 0) {
+            status = metrics_send_response(link, "405 Method Not Allowed", "only GET is supported\n");
+        } else if (strncmp(request + strlen("GET "), "/metrics", strlen("/metrics")) != 0 ||
+                   strchr(" ?", request[strlen("GET /metrics")]) == NULL) {
+            status = metrics_send_response(link, "404 Not Found", "see /metrics\n");
+        } else {
+            status = metrics_send_response(link, "200 OK", srv_render_metrics());
+        }
+    }
+    if (status != GS_SUCCESS) {
+        GS_LOG_DEBUG_ERR("[metrics] scrape failed");
+        cm_reset_error();
+    }
+    cs_tcp_disconnect(link);
+    return status;
+}
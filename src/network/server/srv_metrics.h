@@ -0,0 +1,40 @@
+/*
+* Copyright (c) GBA-NCTI-ISDC. 2022-2024.
+*
+* openGauss embedded is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*
+* http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FITFOR A PARTICULAR PURPOSE.
+* See the Mulan PSL v2 for more details.
+* -------------------------------------------------------------------------
+*
+* srv_metrics.h
+*
+* IDENTIFICATION
+* openGauss-embedded/src/network/server/srv_metrics.h
+*
+* -------------------------------------------------------------------------
+*/
+
+#pragma once
+#include "cs_listener.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * plain http listener answering GET /metrics in the prometheus text format.
+ * scrapes are served one at a time on the listener thread, the counters are
+ * summed when the request arrives so the statement paths never wait for it.
+ */
+status_t srv_metrics_connect_action(tcp_lsnr_t *lsnr, cs_pipe_t *pipe);
+
+#ifdef __cplusplus
+}
+#endif
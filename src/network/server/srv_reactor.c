@@ -253,6 +253,25 @@ status_t reactor_set_oneshot(session_t *session)
     return GS_SUCCESS;
 }
 
+/*
+ * hand the session out again at once. it is armed for EPOLLOUT too, which fires on any writable
+ * socket, so input epoll cannot see, like requests left in a shm ring, is picked up as well.
+ * the next reactor_set_oneshot arms it for input only again.
+ */
+status_t reactor_requeue_session(session_t *session)
+{
+    struct epoll_event ev;
+    int fd = (int)session->pipe->link.tcp.sock;
+
+    ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLONESHOT;
+    ev.data.ptr = session;
+
+    if (epoll_ctl(session->reactor->epollfd, EPOLL_CTL_MOD, fd, &ev) != 0) {
+        return GS_ERROR;
+    }
+    return GS_SUCCESS;
+}
+
 static status_t reactor_handle_event(const reactor_t *reactor, session_t *sess)
 {
     int32 err_code;
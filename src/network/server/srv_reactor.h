@@ -77,6 +77,7 @@ typedef struct st_reactor_pool {
 struct st_session;
 
 status_t reactor_set_oneshot(session_t *session);
+status_t reactor_requeue_session(session_t *session);
 status_t reactor_register_session(session_t *session);
 void reactor_unregister_session(session_t *session);
 status_t reactor_create_pool(void);
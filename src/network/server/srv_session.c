@@ -215,6 +215,8 @@ status_t srv_alloc_session(session_t **session, const cs_pipe_t *pipe, session_t
     sess->auto_commit = true;
     sess->is_logged = false;
     sess->is_used = false;
+    sess->proto_version = PROTO_VERSION;
+    sess->handshake = SESSION_HANDSHAKE_NONE;
 
     GS_LOG_DEBUG_INF("[SESS] update sess write_key:%llx, nodeid:%u sessid:%u serial_id:%u",
         sess->write_key, node_id, sess->id, sess->serial_id);
@@ -240,11 +242,14 @@ static void srv_save_remote_host(const cs_pipe_t *pipe, session_t *session)
     if (pipe->type == CS_TYPE_TCP) {
         (void)cm_inet_ntop((struct sockaddr *)&pipe->link.tcp.remote.addr,
                            session->os_host, (int)GS_HOST_NAME_BUFFER_SIZE);
+    } else if (pipe->type == CS_TYPE_DOMAIN_SCOKET || pipe->type == CS_TYPE_IPC) {
+        // local transports have no peer address, treat them like loopback
+        (void)strncpy_s(session->os_host, GS_HOST_NAME_BUFFER_SIZE, LOCAL_PEER_HOST, strlen(LOCAL_PEER_HOST));
     }
     return;
 }
 
-status_t srv_create_session(const cs_pipe_t *pipe)
+status_t srv_create_local_session(const cs_pipe_t *pipe, session_handshake_e handshake)
 {
     session_t *session = NULL;
 
@@ -256,6 +261,7 @@ status_t srv_create_session(const cs_pipe_t *pipe)
     }
 
     srv_save_remote_host(pipe, session);
+    session->handshake = handshake;
 
     if (srv_attach_reactor(session) != GS_SUCCESS) {
         GS_LOG_RUN_WAR("[SESS] session(%u) attach reactor failed", session->id);
@@ -266,6 +272,62 @@ status_t srv_create_session(const cs_pipe_t *pipe)
     return GS_SUCCESS;
 }
 
+status_t srv_create_session(const cs_pipe_t *pipe)
+{
+    return srv_create_local_session(pipe, SESSION_HANDSHAKE_NONE);
+}
+
+/* uds clients open with the proto code and wait for link_ready_ack, see cs_open_uds_link */
+static status_t srv_uds_handshake(uds_link_t *link)
+{
+    uint32 proto_code = 0;
+    bool32 ready = GS_FALSE;
+    link_ready_ack_t ack;
+
+    GS_RETURN_IFERR(cs_uds_wait(link, CS_WAIT_FOR_READ, GS_NETWORK_IO_TIMEOUT, &ready));
+    if (!ready) {
+        GS_THROW_ERROR(ERR_TCP_TIMEOUT, "wait for client handshake");
+        return GS_ERROR;
+    }
+    GS_RETURN_IFERR(cs_uds_recv_timed(link, (char *)&proto_code, sizeof(proto_code), GS_NETWORK_IO_TIMEOUT));
+    if (proto_code != GS_PROTO_CODE) {
+        GS_THROW_ERROR(ERR_INVALID_PROTOCOL);
+        return GS_ERROR;
+    }
+
+    MEMS_RETURN_IFERR(memset_s(&ack, sizeof(ack), 0, sizeof(ack)));
+    ack.endian = (IS_BIG_ENDIAN ? (uint8)1 : (uint8)0);
+    ack.handshake_version = (uint8)CS_LOCAL_VERSION;
+    return cs_uds_send_timed(link, (char *)&ack, sizeof(ack), GS_NETWORK_IO_TIMEOUT);
+}
+
+/*
+ * the listener accepts local links without talking to the client, so a slow or silent client
+ * only holds its own agent. the reactor hands the session over once the proto code arrives.
+ */
+status_t srv_process_handshake(session_t *session)
+{
+    shm_link_t shm_link;
+
+    if (srv_uds_handshake(&session->pipe->link.uds) != GS_SUCCESS) {
+        GS_LOG_DEBUG_ERR("[SESS] uds handshake of session %u fail", session->id);
+        return GS_ERROR;
+    }
+
+    if (session->handshake == SESSION_HANDSHAKE_SHM) {
+        // the shm link takes over the socket, which keeps its place in the reactor
+        if (cs_shm_accept(&session->pipe->link.uds, &shm_link) != GS_SUCCESS) {
+            GS_LOG_DEBUG_ERR("[SESS] shm handshake of session %u fail", session->id);
+            return GS_ERROR;
+        }
+        session->pipe->link.shm = shm_link;
+        session->pipe->type = CS_TYPE_IPC;
+    }
+
+    session->handshake = SESSION_HANDSHAKE_NONE;
+    return GS_SUCCESS;
+}
+
 #if defined(__GLIBC__)
 #include <malloc.h>
 void malloc_trim_release() {
@@ -84,6 +84,8 @@ typedef struct st_sess_consense_obj {
 
 status_t srv_alloc_session(session_t **session, const cs_pipe_t *pipe, session_type_e type);
 status_t srv_create_session(const cs_pipe_t *pipe);
+status_t srv_create_local_session(const cs_pipe_t *pipe, session_handshake_e handshake);
+status_t srv_process_handshake(session_t *session);
 status_t srv_kill_sess(session_t *session);
 void srv_release_session(session_t *session);
 void srv_deinit_session(session_t *session);
@@ -40,6 +40,13 @@ typedef enum en_session_type {
     SESSION_TYPE_API,
 } session_type_e;
 
+// local links still owe the client the handshake, done by the first agent serving the session
+typedef enum en_session_handshake {
+    SESSION_HANDSHAKE_NONE = 0,
+    SESSION_HANDSHAKE_UDS,  // proto code / link_ready_ack on the uds link
+    SESSION_HANDSHAKE_SHM,  // the same, then the uds link is turned into a shm link
+} session_handshake_e;
+
 typedef struct st_sess_watch_record {
     text_t key;
     bool32 is_prefix;
@@ -54,6 +61,7 @@ typedef struct st_session {
     void *stg_handle;  // handle of storage todo delete
     session_type_e ses_type;
     uint32 proto_type;
+    uint32 proto_version;  // negotiated at login, decides the result wire format
     intarkdb_connection db_conn; //sql
     intarkdb_prepared_statement stmt; //sql prepare
     void * kv_handle;       // kv
@@ -65,6 +73,7 @@ typedef struct st_session {
     cs_pipe_t pipe_entity;  // if pipe info specified when create a session, pointer pipe will point to
     // if pipe info specified when create a session, it will point to pipe_entity, otherwise null assigned
     cs_pipe_t *pipe;
+    session_handshake_e handshake;
     char os_host[GS_HOST_NAME_BUFFER_SIZE];
     union {
         cs_packet_t *recv_pack;
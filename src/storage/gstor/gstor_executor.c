@@ -47,14 +47,17 @@ extern "C" {
 #define G_STOR_SEQUENCE_OFFSET (10)
 #define GSTOR_IDX_EXT_NAME1 ("IX_")
 #define GSTOR_IDX_EXT_NAME2 ("_001")
+#define GSTOR_IDX_EXT_NAME3 ("_002")
 #define G_STOR_TABLE_EXT_SIZE (7)
 
 
-#define G_STOR_DEFAULT_COLS (2)
+#define G_STOR_DEFAULT_COLS (3)
 #define G_STOR_DEFAULT_IDX_CNT (1)
 #define G_SOTR_DEFAULT_TBL_ID ((uint32)64)
 
 #define GSTOR_PUT_TRY_TIMES 10
+// leaf entries walked forward before a batch lookup descends the index again
+#define GSTOR_BATCH_WALK_STEPS 16
 
 static uint32 g_cur_table_id = G_SOTR_DEFAULT_TBL_ID;
 static const char *g_inst_name = "intarkdb";
@@ -67,6 +70,11 @@ static const text_t g_user_table_col2 = {
     .str = (char *)"VALUE",
     .len = 5
 };
+// unix timestamp(us) the key expires at, NULL if the key never expires
+static const text_t g_user_table_col3 = {
+    .str = (char *)"EXPIRE",
+    .len = 6
+};
 
 #define GS_MAX_KEY_LEN (uint32)4000
 
@@ -203,8 +211,10 @@ int gstor_alloc(void *cc_instance, void **handle)
         ec_handle->cursors[i] = NULL;
     }
 
+    ec_handle->scan_cursor = NULL;
     ec_handle->dc.handle = NULL;
     gstor_init_lob_buf(&ec_handle->lob_buf);
+    gstor_init_lob_buf(&ec_handle->scan_lob_buf);
     *handle = ec_handle;
     return GS_SUCCESS;
 }
@@ -214,6 +224,7 @@ static status_t gstor_create_table(void *handle, const char *table_name)
     column_def_t user_table_cols[] = {
         { g_user_table_col1, GS_TYPE_VARCHAR, GS_MAX_KEY_LEN, GS_FALSE },
         { g_user_table_col2, GS_TYPE_CLOB,    GS_MAX_KEY_LEN, GS_TRUE },
+        { g_user_table_col3, GS_TYPE_BIGINT,  sizeof(int64),  GS_TRUE },
     };
 
     uint32 table_len = (uint32)strlen(table_name);
@@ -229,6 +240,7 @@ static status_t gstor_create_table(void *handle, const char *table_name)
     PRTS_RETURN_IFERR(sprintf_s(idx_name, idx_len + 1, "%s%s%s", GSTOR_IDX_EXT_NAME1, table_name, GSTOR_IDX_EXT_NAME2));
     idx_name[idx_len] = '\0';
 
+    // the expire index is added by the first setex, see gstor_kv_enable_ttl
     index_def_t user_kv_indexes[] = {
         { {.str = idx_name, .len = idx_len}, (text_t*)&g_user_table_col1, 1, GS_TRUE}
     };
@@ -265,6 +277,7 @@ static status_t gstor_create_mem_table(void *handle, const char *table_name)
     column_def_t user_table_cols[] = {
         { g_user_table_col1, GS_TYPE_VARCHAR, GS_MAX_KEY_LEN, GS_FALSE },
         { g_user_table_col2, GS_TYPE_CLOB,    GS_MAX_KEY_LEN, GS_TRUE },
+        { g_user_table_col3, GS_TYPE_BIGINT,  sizeof(int64),  GS_TRUE },
     };
 
     uint32 table_len = (uint32)strlen(table_name);
@@ -280,6 +293,7 @@ static status_t gstor_create_mem_table(void *handle, const char *table_name)
     PRTS_RETURN_IFERR(sprintf_s(idx_name, idx_len + 1, "%s%s%s", GSTOR_IDX_EXT_NAME1, table_name, GSTOR_IDX_EXT_NAME2));
     idx_name[idx_len] = '\0';
 
+    // the expire index is added by the first setex, see gstor_kv_enable_ttl
     index_def_t user_kv_indexes[] = {
         { {.str = idx_name, .len = idx_len}, (text_t*)&g_user_table_col1, 1, GS_TRUE}
     };
@@ -998,6 +1012,8 @@ int gstor_open_table(void *handle, const char *table_name)
     knl_session_t *session = EC_SESSION(handle);
     instance_t *cc_instance = session->kernel->server;
     knl_dictionary_t *dc = EC_DC(handle);
+    // the open scan reads the table being closed
+    gstor_kv_scan_close(handle);
     knl_close_dc(dc);
     if (gstor_open_kv_table(handle, table_name, dc) != GS_SUCCESS) {
         // if (cm_get_error_code() == ERR_TABLE_OR_VIEW_NOT_EXIST) {
@@ -1023,6 +1039,8 @@ int gstor_open_table(void *handle, const char *table_name)
 int gstor_open_mem_table(void *handle, const char *table_name)
 {
     knl_dictionary_t *dc = EC_DC(handle);
+    // the open scan reads the table being closed
+    gstor_kv_scan_close(handle);
     knl_close_dc(dc);
     if (gstor_open_kv_table(handle, table_name, dc) != GS_SUCCESS) {
         if (cm_get_error_code() == ERR_TABLE_OR_VIEW_NOT_EXIST) {
@@ -1069,10 +1087,12 @@ void gstor_free(void *handle)
     knl_close_dc(EC_DC(handle));
 
     gstor_free_lob_buf(EC_LOBBUF(handle));
+    gstor_free_lob_buf(EC_SCAN_LOBBUF(handle));
 
     knl_free_session(EC_SESSION(handle));
 
     CM_FREE_PTR(EC_CURSOR(handle));
+    CM_FREE_PTR(EC_SCAN_CURSOR(handle));
 
     for(int i = 0 ; i < G_STOR_MAX_CURSOR; ++i) {
         CM_FREE_PTR(EC_CURSOR_IDX(handle,i));
@@ -1135,6 +1155,23 @@ static inline void knl_init_mtrl_vmc(knl_handle_t sess, handle_t *mtrl)
     vmc_init(&cc_instance->vmp, &ctx->vmc);
 }
 
+/* kernel workers (parallel redo replay, parallel index build) run on sessions of their own,
+ * there is no reserved session pool in the embedded instance so both kinds come from the same place */
+static status_t gstor_alloc_knl_session(instance_t *cc_instance, bool32 knl_reserved, knl_handle_t *knl_session)
+{
+    return knl_alloc_session(cc_instance, (knl_session_t **)knl_session);
+}
+
+static void gstor_release_knl_session(knl_handle_t sess)
+{
+    knl_session_t *knl_session = (knl_session_t *)sess;
+    instance_t *cc_instance = knl_session->kernel->server;
+    uint16 rmid = knl_session->rmid;
+
+    knl_free_session(knl_session);
+    knl_release_rm(cc_instance, rmid);
+}
+
 static void gstor_set_callback(void)
 {
     g_knl_callback.alloc_rm = knl_alloc_rm;
@@ -1165,6 +1202,8 @@ static void gstor_set_callback(void)
     g_knl_callback.parse_default_from_text = knl_parse_default_from_text;
     g_knl_callback.exec_default = knl_exec_default;
     g_knl_callback.keep_stack_variant = cm_keep_stack_variant;
+    g_knl_callback.alloc_knl_session = gstor_alloc_knl_session;
+    g_knl_callback.release_knl_session = gstor_release_knl_session;
 }
 
 static status_t gstor_init_db_home(instance_t *cc_instance, char *data_path)
@@ -1217,11 +1256,13 @@ static void gstor_init_default_size(knl_attr_t *attr)
     attr->temp_pool_num = DEFAULT_TEMP_POOL_NUM;
     attr->cr_pool_size = DEFAULT_CR_POOL_SIZE;
     attr->cr_pool_count = DEFAULT_CR_POOL_COUNT;
+    attr->buf_warmup_pages = DEFAULT_BUFFER_WARMUP_PAGES;
     attr->index_buf_size = DEFAULT_INDEX_BUF_SIZE;
     attr->max_rms = GS_MAX_RMS;
     attr->ckpt_interval = DEFAULT_CKPT_INTERVAL;
     attr->ckpt_io_capacity = DEFAULT_CKPT_IO_CAPACITY;
     attr->log_replay_processes = DEFAULT_LOG_REPLAY_PROCESSES;
+    attr->rcy_preload_processes = DEFAULT_RCY_PRELOAD_PROCESSES;
     attr->rcy_sleep_interval = DEFAULT_RCY_SLEEP_INTERVAL;
     attr->dbwr_processes = DEFAULT_DBWR_PROCESSES;
     attr->undo_reserve_size = DEFAULT_UNDO_RESERVER_SIZE;
@@ -1257,6 +1298,13 @@ static status_t gstor_init_default_params(knl_attr_t* attr)
     attr->enable_double_write = GS_TRUE;
     attr->rcy_check_pcn = GS_TRUE;
     attr->ashrink_wait_time = DEFAULT_ASHRINK_WAIT_TIME;
+    attr->part_retention_interval = DEFAULT_PART_RETENTION_INTERVAL;
+    attr->part_retention_max_drops = DEFAULT_PART_RETENTION_MAX_DROPS;
+    attr->kv_expire_interval = DEFAULT_KV_EXPIRE_INTERVAL;
+    attr->kv_expire_batch = DEFAULT_KV_EXPIRE_BATCH;
+    attr->commit_delay = DEFAULT_COMMIT_DELAY;
+    attr->commit_siblings = DEFAULT_COMMIT_SIBLINGS;
+    attr->commit_batch_size = DEFAULT_COMMIT_BATCH_SIZE;
     attr->db_block_checksum = (uint32)CKS_FULL;
     attr->db_isolevel = (uint8)ISOLATION_READ_COMMITTED;
     attr->ckpt_timeout = DEFAULT_CKPT_TIMEOUT;
@@ -1290,6 +1338,7 @@ static status_t gstor_init_default_params(knl_attr_t* attr)
     attr->ctrllog_backup_level = CTRLLOG_BACKUP_LEVEL_FULL;
     attr->max_sql_engine_memory = GS_SQL_ENGINE_MEMORY_SIZE;
     attr->synchronous_commit = GS_TRUE;
+    attr->enable_io_uring = GS_FALSE;
     attr->dbwr_fsync_timeout = DEFAULT_DBWR_FSYNC_TIMEOUT;
     attr->isolation_level = DEFAULT_ISOLATION_LEVEL;
     attr->timer = g_timer();
@@ -1382,6 +1431,7 @@ static status_t gstor_load_param_config(instance_t *cc_instance)
         GS_THROW_ERROR(ERR_PARAMETER_OVER_RANGE, "BUF_POOL_NUM", (int64)1, (int64)GS_MAX_BUF_POOL_NUM);
         return GS_ERROR;
     }
+    GS_RETURN_IFERR(knl_param_get_uint32(cc_instance->cc_config, "BUFFER_WARMUP_PAGES", &attr->buf_warmup_pages));
     GS_RETURN_IFERR(knl_param_get_size_uint64(cc_instance->cc_config, "LOG_BUFFER_SIZE", &attr->log_buf_size));
     if (attr->log_buf_size < GS_MIN_LOG_BUFFER_SIZE || attr->log_buf_size > GS_MAX_LOG_BUFFER_SIZE) {
         GS_THROW_ERROR(ERR_PARAMETER_OVER_RANGE, "LOG_BUFFER_SIZE", GS_MIN_LOG_BUFFER_SIZE, GS_MAX_LOG_BUFFER_SIZE);
@@ -1456,6 +1506,22 @@ static status_t gstor_load_param_config(instance_t *cc_instance)
     GS_RETURN_IFERR(knl_param_get_uint32(cc_instance->cc_config, "CKPT_INTERVAL", &attr->ckpt_interval));
     GS_RETURN_IFERR(knl_param_get_uint32(cc_instance->cc_config, "CKPT_IO_CAPACITY", &attr->ckpt_io_capacity));
     GS_RETURN_IFERR(knl_param_get_uint32(cc_instance->cc_config, "LOG_REPLAY_PROCESSES", &attr->log_replay_processes));
+    // [0,128], 0 means one replay process per cpu, 1 replays serially
+    if (attr->log_replay_processes > GS_MAX_PARAL_RCY) {
+        GS_THROW_ERROR(ERR_PARAMETER_OVER_RANGE, "LOG_REPLAY_PROCESSES", (int64)0, (int64)GS_MAX_PARAL_RCY);
+        return GS_ERROR;
+    }
+    if (attr->log_replay_processes == 0) {
+        attr->log_replay_processes =
+            MIN(MAX(attr->cpu_count, MIN_AUTO_LOG_REPLAY_PROCESSES), MAX_AUTO_LOG_REPLAY_PROCESSES);
+    }
+    GS_RETURN_IFERR(knl_param_get_uint32(cc_instance->cc_config, "RCY_PRELOAD_PROCESSES",
+        &attr->rcy_preload_processes));
+    // [0,128]
+    if (attr->rcy_preload_processes > GS_MAX_PARAL_RCY) {
+        GS_THROW_ERROR(ERR_PARAMETER_OVER_RANGE, "RCY_PRELOAD_PROCESSES", (int64)0, (int64)GS_MAX_PARAL_RCY);
+        return GS_ERROR;
+    }
     GS_RETURN_IFERR(knl_param_get_uint32(cc_instance->cc_config, "RCY_SLEEP_INTERVAL", &attr->rcy_sleep_interval));
     GS_RETURN_IFERR(knl_param_get_uint32(cc_instance->cc_config, "DBWR_PROCESSES", &attr->dbwr_processes));
     if (attr->dbwr_processes < 1 || attr->dbwr_processes > GS_MAX_DBWR_PROCESS) {
@@ -1495,6 +1561,43 @@ static status_t gstor_load_param_config(instance_t *cc_instance)
         return GS_ERROR;
     }
 
+    GS_RETURN_IFERR(knl_param_get_uint32(cc_instance->cc_config, "PART_RETENTION_INTERVAL",
+        &attr->part_retention_interval));
+    GS_RETURN_IFERR(knl_param_get_uint32(cc_instance->cc_config, "PART_RETENTION_MAX_DROPS",
+        &attr->part_retention_max_drops));
+    // [1,1024]
+    if (attr->part_retention_max_drops < 1 || attr->part_retention_max_drops > RETENTION_MAX_DROPS) {
+        GS_THROW_ERROR(ERR_PARAMETER_OVER_RANGE, "PART_RETENTION_MAX_DROPS", (int64)1, (int64)RETENTION_MAX_DROPS);
+        return GS_ERROR;
+    }
+
+    GS_RETURN_IFERR(knl_param_get_uint32(cc_instance->cc_config, "KV_EXPIRE_INTERVAL", &attr->kv_expire_interval));
+    GS_RETURN_IFERR(knl_param_get_uint32(cc_instance->cc_config, "KV_EXPIRE_BATCH", &attr->kv_expire_batch));
+    // [1,10000]
+    if (attr->kv_expire_batch < 1 || attr->kv_expire_batch > KV_EXPIRE_MAX_BATCH) {
+        GS_THROW_ERROR(ERR_PARAMETER_OVER_RANGE, "KV_EXPIRE_BATCH", (int64)1, (int64)KV_EXPIRE_MAX_BATCH);
+        return GS_ERROR;
+    }
+
+    GS_RETURN_IFERR(knl_param_get_uint32(cc_instance->cc_config, "COMMIT_DELAY_US", &attr->commit_delay));
+    // [0,100000]
+    if (attr->commit_delay > LOG_COMMIT_MAX_DELAY) {
+        GS_THROW_ERROR(ERR_PARAMETER_OVER_RANGE, "COMMIT_DELAY_US", (int64)0, (int64)LOG_COMMIT_MAX_DELAY);
+        return GS_ERROR;
+    }
+    GS_RETURN_IFERR(knl_param_get_uint32(cc_instance->cc_config, "COMMIT_SIBLINGS", &attr->commit_siblings));
+    // [1,1000]
+    if (attr->commit_siblings < 1 || attr->commit_siblings > LOG_COMMIT_MAX_SIBLINGS) {
+        GS_THROW_ERROR(ERR_PARAMETER_OVER_RANGE, "COMMIT_SIBLINGS", (int64)1, (int64)LOG_COMMIT_MAX_SIBLINGS);
+        return GS_ERROR;
+    }
+    GS_RETURN_IFERR(knl_param_get_uint32(cc_instance->cc_config, "COMMIT_BATCH_SIZE", &attr->commit_batch_size));
+    // [1,GS_MAX_SESSIONS]
+    if (attr->commit_batch_size < 1 || attr->commit_batch_size > GS_MAX_SESSIONS) {
+        GS_THROW_ERROR(ERR_PARAMETER_OVER_RANGE, "COMMIT_BATCH_SIZE", (int64)1, (int64)GS_MAX_SESSIONS);
+        return GS_ERROR;
+    }
+
     // 20241210吴锦锋：增加
     if (load_bool32_param("ENFORCED_IGNORE_ALL_REDO_LOGS", cc_instance, &attr->enforced_ignore_all_redo_logs) != GS_SUCCESS) {
         return GS_ERROR;
@@ -1532,6 +1635,17 @@ static status_t gstor_load_param_config(instance_t *cc_instance)
         return GS_ERROR;
     }
 
+    // io_engine, falls back to sync io at startup if the kernel refuses io_uring
+    char *io_engine = cm_get_config_value(cc_instance->cc_config, "IO_ENGINE");
+    if (io_engine == NULL || cm_str_equal_ins(io_engine, "SYNC")) {
+        attr->enable_io_uring = GS_FALSE;
+    } else if (cm_str_equal_ins(io_engine, "IO_URING")) {
+        attr->enable_io_uring = GS_TRUE;
+    } else {
+        GS_THROW_ERROR(ERR_INVALID_PARAMETER, "IO_ENGINE");
+        return GS_ERROR;
+    }
+
     // isolation_level
     GS_RETURN_IFERR(knl_param_get_uint32(cc_instance->cc_config, "ISOLATION_LEVEL", &attr->isolation_level));
     if (attr->isolation_level != ISOLATION_READ_COMMITTED && attr->isolation_level != ISOLATION_CURR_COMMITTED) {
@@ -1787,8 +1901,120 @@ static inline status_t gstor_set_value(knl_session_t *session, knl_cursor_t *cur
     return knl_row_put_lob(session, cursor, column, (void *)val, ra);
 }
 
+// kv tables created before the EXPIRE column was added do not support ttl
+static inline bool32 gstor_kv_has_expire(knl_dictionary_t *dc)
+{
+    return knl_get_column_count(dc->handle) > SYS_KV_EXPIRE_COL_ID;
+}
+
+/*
+ * a ddl through another handle, like the expire index added by the first setex,
+ * invalidates the dc of this one. writes through an invalid dc fail, reopen it first.
+ */
+static status_t gstor_kv_refresh_dc(void *handle)
+{
+    knl_dictionary_t *dc = EC_DC(handle);
+    char table_name[GS_NAME_BUFFER_SIZE];
+
+    if (dc->handle == NULL || DC_ENTITY(dc)->valid) {
+        return GS_SUCCESS;
+    }
+
+    MEMS_RETURN_IFERR(strcpy_s(table_name, GS_NAME_BUFFER_SIZE, DC_ENTITY(dc)->table.desc.name));
+    gstor_kv_scan_close(handle);
+    knl_close_dc(dc);
+    return gstor_open_kv_table(handle, table_name, dc);
+}
+
+static inline bool32 gstor_kv_has_expire_index(knl_dictionary_t *dc)
+{
+    for (uint32 i = 0; i < knl_get_index_count(dc->handle); i++) {
+        knl_index_desc_t *index = knl_get_index(dc->handle, i);
+        if (index->column_count == 1 && index->columns[0] == SYS_KV_EXPIRE_COL_ID) {
+            return GS_TRUE;
+        }
+    }
+    return GS_FALSE;
+}
+
+/*
+ * only tables using ttl pay for the expire index, the first setex of a table creates it and
+ * hands the table to the kv expire daemon. the ddl commits, so it is refused in a transaction.
+ */
+static status_t gstor_kv_enable_ttl(void *handle)
+{
+    knl_session_t *session = EC_SESSION(handle);
+    knl_dictionary_t *dc = EC_DC(handle);
+    knl_index_def_t def;
+    knl_index_col_def_t *column = NULL;
+    char table_name[GS_NAME_BUFFER_SIZE];
+    char idx_name[GS_NAME_BUFFER_SIZE + G_STOR_TABLE_EXT_SIZE];
+
+    if (gstor_kv_has_expire_index(dc)) {
+        return GS_SUCCESS;
+    }
+
+    if (session->rm->txn != NULL) {
+        GS_THROW_ERROR(ERR_TXN_IN_PROGRESS, "the first setex of a table must be outside a transaction");
+        return GS_ERROR;
+    }
+
+    MEMS_RETURN_IFERR(strcpy_s(table_name, GS_NAME_BUFFER_SIZE, DC_ENTITY(dc)->table.desc.name));
+    PRTS_RETURN_IFERR(sprintf_s(idx_name, sizeof(idx_name), "%s%s%s", GSTOR_IDX_EXT_NAME1, table_name,
+        GSTOR_IDX_EXT_NAME3));
+    MEMS_RETURN_IFERR(memset_s(&def, sizeof(knl_index_def_t), 0, sizeof(knl_index_def_t)));
+    def.user.str = (char *)"SYS";
+    def.user.len = 3;
+    def.table.str = table_name;
+    def.table.len = (uint32)strlen(table_name);
+    def.name.str = idx_name;
+    def.name.len = (uint32)strlen(idx_name);
+    def.cr_mode = CR_PAGE;
+
+    CM_SAVE_STACK(session->stack);
+    cm_galist_init(&def.columns, session->stack, cm_stack_alloc);
+    if (cm_galist_new(&def.columns, sizeof(knl_index_col_def_t), (void **)&column) != GS_SUCCESS) {
+        CM_RESTORE_STACK(session->stack);
+        return GS_ERROR;
+    }
+    MEMS_RETURN_IFERR(memset_s(column, sizeof(knl_index_col_def_t), 0, sizeof(knl_index_col_def_t)));
+    column->name = g_user_table_col3;
+    column->mode = SORT_MODE_ASC;
+
+    status_t status = knl_create_index(session, &def);
+    CM_RESTORE_STACK(session->stack);
+    // another handle of the table may have created it first
+    if (status != GS_SUCCESS && cm_get_error_code() != ERR_OBJECT_EXISTS &&
+        cm_get_error_code() != ERR_COLUMN_ALREADY_INDEXED) {
+        return GS_ERROR;
+    }
+    cm_reset_error();
+
+    GS_RETURN_IFERR(gstor_kv_refresh_dc(handle));
+    kv_expire_register(session, dc->uid, dc->oid);
+    return GS_SUCCESS;
+}
+
+static inline bool32 gstor_kv_expired(knl_cursor_t *cursor, knl_dictionary_t *dc, int64 now)
+{
+    if (!gstor_kv_has_expire(dc) || CURSOR_COLUMN_SIZE(cursor, SYS_KV_EXPIRE_COL_ID) == GS_NULL_VALUE_LEN) {
+        return GS_FALSE;
+    }
+    return *(int64 *)CURSOR_COLUMN_DATA(cursor, SYS_KV_EXPIRE_COL_ID) <= now;
+}
+
+static inline int64 gstor_kv_now(void)
+{
+    return (int64)(cm_utc_now() - CM_UNIX_EPOCH);
+}
+
+static inline status_t gstor_set_expire(int64 expire, row_assist_t *ra)
+{
+    return expire == 0 ? row_put_null(ra) : row_put_int64(ra, expire);
+}
+
 static inline status_t gstor_insert(knl_session_t *session, knl_cursor_t *cursor, knl_dictionary_t *dc, char *key,
-    uint32 key_len, char *val, uint32 val_len)
+    uint32 key_len, char *val, uint32 val_len, int64 expire)
 {
     GS_RETURN_IFERR(gstor_open_cursor_internal(session, cursor, dc, CURSOR_ACTION_INSERT, GS_INVALID_ID32));
 
@@ -1806,17 +2032,27 @@ static inline status_t gstor_insert(knl_session_t *session, knl_cursor_t *cursor
     };
     GS_RETURN_IFERR(gstor_set_value(session, cursor, dc, &setval, &ra));
 
+    if (gstor_kv_has_expire(dc)) {
+        GS_RETURN_IFERR(gstor_set_expire(expire, &ra));
+    }
+
     return knl_internal_insert(session, cursor);
 }
 
 static inline status_t gstor_update_core(knl_session_t *session, knl_cursor_t *cursor, knl_dictionary_t *dc, char *val,
-    uint32 val_len)
+    uint32 val_len, int64 expire)
 {
     row_assist_t ra;
     knl_update_info_t *ui = &cursor->update_info;
 
     ui->count = 1;
     ui->columns[0] = SYS_KV_VALUE_COL_ID;
+    // a plain set clears the ttl, the expire index is left alone if the key had none
+    bool32 set_expire = gstor_kv_has_expire(dc) &&
+        (expire != 0 || CURSOR_COLUMN_SIZE(cursor, SYS_KV_EXPIRE_COL_ID) != GS_NULL_VALUE_LEN);
+    if (set_expire) {
+        ui->columns[ui->count++] = SYS_KV_EXPIRE_COL_ID;
+    }
     row_init(&ra, ui->data, session->kernel->attr.max_row_size, ui->count);
 
     text_t setval = {
@@ -1824,13 +2060,16 @@ static inline status_t gstor_update_core(knl_session_t *session, knl_cursor_t *c
         .len = val_len
     };
     GS_RETURN_IFERR(gstor_set_value(session, cursor, dc, &setval, &ra));
+    if (set_expire) {
+        GS_RETURN_IFERR(gstor_set_expire(expire, &ra));
+    }
 
     cm_decode_row(ui->data, ui->offsets, ui->lens, NULL);
     return knl_internal_update(session, cursor);
 }
 
 static inline status_t gstor_update(knl_session_t *session, knl_cursor_t *cursor, knl_dictionary_t *dc, char *key,
-    uint32 key_len, char *val, uint32 val_len, bool32 *updated)
+    uint32 key_len, char *val, uint32 val_len, int64 expire, bool32 *updated)
 {
     GS_RETURN_IFERR(gstor_open_cursor_internal(session, cursor, dc, CURSOR_ACTION_UPDATE, IX_SYS_KV_01_ID));
 
@@ -1842,7 +2081,7 @@ static inline status_t gstor_update(knl_session_t *session, knl_cursor_t *cursor
         return GS_SUCCESS;
     }
     *updated = GS_TRUE;
-    return gstor_update_core(session, cursor, dc, val, val_len);
+    return gstor_update_core(session, cursor, dc, val, val_len, expire);
 }
 
 status_t row_put_default_value(knl_session_t *session, knl_cursor_t *cursor, knl_dictionary_t *dc, row_assist_t *ra, knl_column_t *column) {
@@ -2539,9 +2778,10 @@ static status_t gstor_make_scan_key(knl_session_t *session, knl_cursor_t *cursor
         GS_LOG_DEBUG_ERR("make scan key alloc mem failed");
         return GS_ERROR;
     }
-    int32 ret = strncpy_s(r_key, GS_MAX_KEY_LEN, key, len);
+    // keys are binary, they may contain '\0'
+    int32 ret = (len == 0) ? EOK : memcpy_s(r_key, GS_MAX_KEY_LEN, key, len);
     if (ret != EOK) {
-        GS_LOG_DEBUG_ERR("make scan key system call failed for strncpy %d", ret);
+        GS_LOG_DEBUG_ERR("make scan key system call failed for memcpy %d", ret);
         CM_RESTORE_STACK(session->stack);
         return GS_ERROR;
     }
@@ -2565,10 +2805,9 @@ static status_t gstor_make_scan_key(knl_session_t *session, knl_cursor_t *cursor
     return GS_SUCCESS;
 }
 
-static status_t gstor_get_table_row_kv(void *handle, char **key, unsigned int *key_len, char **val,
-    unsigned int *val_len)
+static status_t gstor_get_table_row_kv(void *handle, knl_cursor_t *cursor, lob_buf_t *lob_buf, char **key,
+    unsigned int *key_len, char **val, unsigned int *val_len)
 {
-    knl_cursor_t *cursor = EC_CURSOR(handle);
     knl_session_t *session = EC_SESSION(handle);
     instance_t *cc_instance = session->kernel->server;
 
@@ -2599,28 +2838,46 @@ static status_t gstor_get_table_row_kv(void *handle, char **key, unsigned int *k
     }
 
     // outline
-    if (*val_len > EC_LOBBUF(handle)->size) {
-        GS_RETURN_IFERR(gstor_realloc_log_buf(cc_instance, EC_LOBBUF(handle), (*val_len)));
+    if (*val_len > lob_buf->size) {
+        GS_RETURN_IFERR(gstor_realloc_log_buf(cc_instance, lob_buf, (*val_len)));
     }
 
-    *val = EC_LOBBUF(handle)->buf;
+    *val = lob_buf->buf;
     GS_RETURN_IFERR(knl_read_lob(session, locator, 0, (void *)(*val), (*val_len), NULL));
     return GS_SUCCESS;
 }
 
-int gstor_put(void *handle, char *key, unsigned int key_len, char *val, unsigned int val_len)
+/*
+ * overwrite first upsert: the key is looked up and locked by the update cursor in one index descent,
+ * only a missing key is inserted. an overwrite never goes through the duplicate key error.
+ */
+static status_t gstor_upsert_core(void *handle, char *key, unsigned int key_len, char *val, unsigned int val_len,
+    int64 expire, unsigned int *inserted)
 {
     knl_cursor_t *cursor = EC_CURSOR(handle);
     knl_session_t *session = EC_SESSION(handle);
     knl_dictionary_t *dc = EC_DC(handle);
 
+    GS_RETURN_IFERR(gstor_kv_refresh_dc(handle));
     gstor_prepare(session, cursor, EC_LOBBUF(handle));
 
     uint32 try_times = 0;
     for (;;) {
+        bool32 updated = GS_FALSE;
+        GS_RETURN_IFERR(gstor_update(session, cursor, dc, key, key_len, val, val_len, expire, &updated));
+        if (updated) {
+            if (inserted != NULL) {
+                *inserted = GS_FALSE;
+            }
+            return GS_SUCCESS;
+        }
+
         cm_set_ignore_log(GS_TRUE);
-        if (gstor_insert(session, cursor, dc, key, key_len, val, val_len) == GS_SUCCESS) {
+        if (gstor_insert(session, cursor, dc, key, key_len, val, val_len, expire) == GS_SUCCESS) {
             cm_set_ignore_log(GS_FALSE);
+            if (inserted != NULL) {
+                *inserted = GS_TRUE;
+            }
             return GS_SUCCESS;
         }
         cm_set_ignore_log(GS_FALSE);
@@ -2628,24 +2885,50 @@ int gstor_put(void *handle, char *key, unsigned int key_len, char *val, unsigned
             return GS_ERROR;
         }
 
+        // This situation must be a primary key conflict in different session (different threads)
+        // Because of read committed is not visible in different session, it needs to add session scn
+        try_times++;
+        if (try_times > GSTOR_PUT_TRY_TIMES) {
+            return GS_ERROR;
+        }
         cm_reset_error();
-        bool32 updated = GS_FALSE;
+        db_next_scn(session);
+        knl_set_session_scn(session, DB_CURR_SCN(session));
+    }
+}
 
-        GS_RETURN_IFERR(gstor_update(session, cursor, dc, key, key_len, val, val_len, &updated));
-        if (updated) {
-            return GS_SUCCESS;
-        } else {
-            // This situation must be a primary key conflict in different session (different threads)
-            // Because of read committed is not visible in different session, it needs to add session scn
-            try_times++;
-            if (try_times <= GSTOR_PUT_TRY_TIMES) {
-                db_next_scn(session);
-                knl_set_session_scn(session, DB_CURR_SCN(session));
-            } else {
-                return GS_ERROR;
-            }
-        }
+int gstor_upsert(void *handle, char *key, unsigned int key_len, char *val, unsigned int val_len,
+    unsigned int *inserted)
+{
+    return gstor_upsert_core(handle, key, key_len, val, val_len, 0, inserted);
+}
+
+int gstor_put(void *handle, char *key, unsigned int key_len, char *val, unsigned int val_len)
+{
+    return gstor_upsert_core(handle, key, key_len, val, val_len, 0, NULL);
+}
+
+/*
+ * put with ttl, the key is treated as missing once expired and deleted later by the kv expire daemon
+ */
+int gstor_setex(void *handle, char *key, unsigned int key_len, char *val, unsigned int val_len,
+    unsigned long long ttl_ms)
+{
+    GS_RETURN_IFERR(gstor_kv_refresh_dc(handle));
+    if (!gstor_kv_has_expire(EC_DC(handle))) {
+        GS_THROW_ERROR(ERR_CAPABILITY_NOT_SUPPORT, "ttl on kv table created without EXPIRE column");
+        return GS_ERROR;
     }
+    /* the expire time is the unix time(us), ttl_ms must keep it within int64 */
+    int64 now = gstor_kv_now();
+    int64 max_ttl_ms = (GS_MAX_INT64 - now) / MICROSECS_PER_MILLISEC;
+    if (ttl_ms == 0 || ttl_ms > (unsigned long long)max_ttl_ms) {
+        GS_THROW_ERROR(ERR_PARAMETER_OVER_RANGE, "ttl_ms", (int64)1, max_ttl_ms);
+        return GS_ERROR;
+    }
+    GS_RETURN_IFERR(gstor_kv_enable_ttl(handle));
+    int64 expire = now + (int64)ttl_ms * MICROSECS_PER_MILLISEC;
+    return gstor_upsert_core(handle, key, key_len, val, val_len, expire, NULL);
 }
 
 int gstor_del(void *handle, char *key, unsigned int key_len, unsigned int prefix, unsigned int *count)
@@ -2654,6 +2937,7 @@ int gstor_del(void *handle, char *key, unsigned int key_len, unsigned int prefix
     knl_session_t *session = EC_SESSION(handle);
     knl_dictionary_t *dc = EC_DC(handle);
 
+    GS_RETURN_IFERR(gstor_kv_refresh_dc(handle));
     gstor_prepare(session, cursor, EC_LOBBUF(handle));
 
     GS_RETURN_IFERR(gstor_open_cursor_internal(session, cursor, dc, CURSOR_ACTION_DELETE, IX_SYS_KV_01_ID));
@@ -2684,11 +2968,215 @@ int gstor_get(void *handle, char *key, unsigned int key_len, char **val, unsigne
     GS_RETURN_IFERR(gstor_make_scan_key(session, cursor, key, key_len, G_STOR_DEFAULT_FLAG));
 
     GS_RETURN_IFERR(knl_fetch(session, cursor));
+    *eof = cursor->eof || gstor_kv_expired(cursor, dc, gstor_kv_now());
+    if (*eof) {
+        return GS_SUCCESS;
+    }
+    return gstor_get_table_row_kv(handle, cursor, EC_LOBBUF(handle), NULL, NULL, val, val_len);
+}
+
+/*
+ * position the batch cursor on key. keys of a batch come in ascending order, so the cursor
+ * walks forward leaf to leaf while the key is close to the current entry, and only descends
+ * the index again on the first key, after GSTOR_BATCH_WALK_STEPS entries or when reopen is set.
+ */
+static status_t gstor_batch_locate(knl_session_t *session, knl_cursor_t *cursor, knl_dictionary_t *dc,
+    text_t *key, bool32 reopen, bool32 *found)
+{
+    text_t curr;
+    *found = GS_FALSE;
+
+    if (!reopen) {
+        for (uint32 steps = 0; !cursor->eof; steps++) {
+            curr.str = CURSOR_COLUMN_DATA(cursor, SYS_KV_KEY_COL_ID);
+            curr.len = CURSOR_COLUMN_SIZE(cursor, SYS_KV_KEY_COL_ID);
+            int32 cmp = cm_compare_text(&curr, key);
+            if (cmp >= 0) {
+                *found = (cmp == 0);
+                return GS_SUCCESS;
+            }
+            if (steps >= GSTOR_BATCH_WALK_STEPS) {
+                break;
+            }
+            GS_RETURN_IFERR(knl_fetch(session, cursor));
+        }
+        // no entry after the previous key
+        if (cursor->eof) {
+            return GS_SUCCESS;
+        }
+    }
+
+    GS_RETURN_IFERR(knl_reopen_cursor(session, cursor, dc));
+    knl_init_index_scan(cursor, GS_FALSE);
+    knl_set_scan_key(INDEX_DESC(cursor->index), &cursor->scan_range.l_key, GS_TYPE_STRING, key->str,
+        (uint16)key->len, SYS_KV_KEY_COL_ID);
+    knl_set_key_flag(&cursor->scan_range.r_key, SCAN_KEY_RIGHT_INFINITE, SYS_KV_KEY_COL_ID);
+    GS_RETURN_IFERR(knl_fetch(session, cursor));
+    if (cursor->eof) {
+        return GS_SUCCESS;
+    }
+    curr.str = CURSOR_COLUMN_DATA(cursor, SYS_KV_KEY_COL_ID);
+    curr.len = CURSOR_COLUMN_SIZE(cursor, SYS_KV_KEY_COL_ID);
+    *found = (cm_compare_text(&curr, key) == 0);
+    return GS_SUCCESS;
+}
+
+static inline bool32 gstor_batch_need_reopen(char **keys, unsigned int *key_lens, unsigned int i)
+{
+    if (i == 0) {
+        return GS_TRUE;
+    }
+    text_t prev = { .str = keys[i - 1], .len = key_lens[i - 1] };
+    text_t curr = { .str = keys[i], .len = key_lens[i] };
+    return cm_compare_text(&curr, &prev) <= 0;
+}
+
+int gstor_mget(void *handle, unsigned int count, char **keys, unsigned int *key_lens, gstor_kv_visit_t visit,
+    void *arg)
+{
+    knl_cursor_t *cursor = EC_CURSOR(handle);
+    knl_session_t *session = EC_SESSION(handle);
+    knl_dictionary_t *dc = EC_DC(handle);
+
+    gstor_prepare(session, cursor, EC_LOBBUF(handle));
+
+    GS_RETURN_IFERR(gstor_open_cursor_internal(session, cursor, dc, CURSOR_ACTION_SELECT, IX_SYS_KV_01_ID));
+
+    int64 now = gstor_kv_now();
+    for (unsigned int i = 0; i < count; i++) {
+        text_t key = { .str = keys[i], .len = key_lens[i] };
+        bool32 found = GS_FALSE;
+        GS_RETURN_IFERR(gstor_batch_locate(session, cursor, dc, &key, gstor_batch_need_reopen(keys, key_lens, i),
+            &found));
+        if (!found || gstor_kv_expired(cursor, dc, now)) {
+            continue;
+        }
+
+        char *val = NULL;
+        unsigned int val_len = 0;
+        GS_RETURN_IFERR(gstor_get_table_row_kv(handle, cursor, EC_LOBBUF(handle), NULL, NULL, &val, &val_len));
+        GS_RETURN_IFERR(visit(arg, i, val, val_len));
+    }
+    return GS_SUCCESS;
+}
+
+// delete one key found by the walk of gstor_mdel, the delete cursor only fetches (and locks) that row
+static status_t gstor_mdel_key(knl_session_t *session, knl_cursor_t *cursor, knl_dictionary_t *dc, text_t *key,
+    unsigned int *deleted)
+{
+    GS_RETURN_IFERR(knl_reopen_cursor(session, cursor, dc));
+    GS_RETURN_IFERR(gstor_make_scan_key(session, cursor, key->str, key->len, G_STOR_DEFAULT_FLAG));
+    GS_RETURN_IFERR(knl_fetch(session, cursor));
+    if (cursor->eof) {
+        return GS_SUCCESS;
+    }
+    GS_RETURN_IFERR(knl_internal_delete(session, cursor));
+    (*deleted)++;
+    return GS_SUCCESS;
+}
+
+/*
+ * the keys are located by a select cursor, the rows walked over between two keys are not locked.
+ * only the rows that match are fetched again by the delete cursor.
+ */
+int gstor_mdel(void *handle, unsigned int count, char **keys, unsigned int *key_lens, unsigned int *deleted)
+{
+    knl_cursor_t *cursor = EC_CURSOR(handle);
+    knl_session_t *session = EC_SESSION(handle);
+    knl_dictionary_t *dc = EC_DC(handle);
+    status_t ret;
+
+    GS_RETURN_IFERR(gstor_kv_refresh_dc(handle));
+    gstor_prepare(session, cursor, EC_LOBBUF(handle));
+
+    CM_SAVE_STACK(session->stack);
+    knl_cursor_t *walk = knl_push_cursor(session);
+    ret = gstor_open_cursor_internal(session, walk, dc, CURSOR_ACTION_SELECT, IX_SYS_KV_01_ID);
+    if (ret == GS_SUCCESS) {
+        ret = gstor_open_cursor_internal(session, cursor, dc, CURSOR_ACTION_DELETE, IX_SYS_KV_01_ID);
+    }
+
+    *deleted = 0;
+    for (unsigned int i = 0; ret == GS_SUCCESS && i < count; i++) {
+        text_t key = { .str = keys[i], .len = key_lens[i] };
+        bool32 found = GS_FALSE;
+        ret = gstor_batch_locate(session, walk, dc, &key, gstor_batch_need_reopen(keys, key_lens, i), &found);
+        if (ret == GS_SUCCESS && found) {
+            ret = gstor_mdel_key(session, cursor, dc, &key, deleted);
+        }
+    }
+    knl_close_cursor(session, walk);
+    CM_RESTORE_STACK(session->stack);
+    return ret;
+}
+
+int gstor_kv_scan_open(void *handle, char *start, unsigned int start_len, char *end, unsigned int end_len,
+    unsigned int prefix, unsigned int reverse)
+{
+    knl_session_t *session = EC_SESSION(handle);
+    knl_dictionary_t *dc = EC_DC(handle);
+
+    if (EC_SCAN_CURSOR(handle) == NULL) {
+        GS_RETURN_IFERR(knl_alloc_cursor(session->kernel->server, &EC_SCAN_CURSOR(handle)));
+    }
+    knl_cursor_t *cursor = EC_SCAN_CURSOR(handle);
+
+    gstor_prepare(session, cursor, EC_SCAN_LOBBUF(handle));
+
+    GS_RETURN_IFERR(gstor_open_cursor_internal(session, cursor, dc, CURSOR_ACTION_SELECT, IX_SYS_KV_01_ID));
+    cursor->index_dsc = reverse ? GS_TRUE : GS_FALSE;
+
+    if (prefix) {
+        return gstor_make_scan_key(session, cursor, start, start_len, G_STOR_PREFIX_FLAG);
+    }
+
+    knl_init_index_scan(cursor, GS_FALSE);
+    if (start != NULL) {
+        knl_set_scan_key(INDEX_DESC(cursor->index), &cursor->scan_range.l_key, GS_TYPE_STRING, start,
+            (uint16)start_len, SYS_KV_KEY_COL_ID);
+    } else {
+        knl_set_key_flag(&cursor->scan_range.l_key, SCAN_KEY_LEFT_INFINITE, SYS_KV_KEY_COL_ID);
+    }
+    if (end != NULL) {
+        knl_set_scan_key(INDEX_DESC(cursor->index), &cursor->scan_range.r_key, GS_TYPE_STRING, end,
+            (uint16)end_len, SYS_KV_KEY_COL_ID);
+    } else {
+        knl_set_key_flag(&cursor->scan_range.r_key, SCAN_KEY_RIGHT_INFINITE, SYS_KV_KEY_COL_ID);
+    }
+    return GS_SUCCESS;
+}
+
+int gstor_kv_scan_next(void *handle, char **key, unsigned int *key_len, char **val, unsigned int *val_len,
+    unsigned int *eof)
+{
+    knl_cursor_t *cursor = EC_SCAN_CURSOR(handle);
+    knl_session_t *session = EC_SESSION(handle);
+
+    if (cursor == NULL || !cursor->is_valid) {
+        *eof = GS_TRUE;
+        return GS_SUCCESS;
+    }
+
+    int64 now = gstor_kv_now();
+    do {
+        GS_RETURN_IFERR(knl_fetch(session, cursor));
+    } while (!cursor->eof && gstor_kv_expired(cursor, EC_DC(handle), now));
     *eof = cursor->eof;
     if (*eof) {
         return GS_SUCCESS;
     }
-    return gstor_get_table_row_kv(handle, NULL, NULL, val, val_len);
+    return gstor_get_table_row_kv(handle, cursor, EC_SCAN_LOBBUF(handle), key, key_len, val, val_len);
+}
+
+void gstor_kv_scan_close(void *handle)
+{
+    knl_cursor_t *cursor = EC_SCAN_CURSOR(handle);
+    if (cursor == NULL) {
+        return;
+    }
+    gstor_free_lob_buf(EC_SCAN_LOBBUF(handle));
+    knl_close_cursor(EC_SESSION(handle), cursor);
+    cursor->is_valid = GS_FALSE;
 }
 
 int rust_gstor_get(void *handle, char *key)
@@ -54,6 +54,8 @@ typedef struct st_ec_handle {
     struct st_knl_session *session;
     knl_dictionary_t dc;
     knl_cursor_t* cursors[G_STOR_MAX_CURSOR];
+    knl_cursor_t *scan_cursor;  // kv range scan, kept open across other kv operations
+    lob_buf_t scan_lob_buf;
 } ec_handle_t;
 
 #define EC_LOBBUF(handle) (&((ec_handle_t *)(handle))->lob_buf)
@@ -61,6 +63,8 @@ typedef struct st_ec_handle {
 #define EC_CURSOR_IDX(handle,idx) ((ec_handle_t*)(handle))->cursors[idx]
 #define EC_SESSION(handle) ((ec_handle_t *)(handle))->session
 #define EC_DC(handle) (&(((ec_handle_t *)(handle))->dc))
+#define EC_SCAN_CURSOR(handle) ((ec_handle_t *)(handle))->scan_cursor
+#define EC_SCAN_LOBBUF(handle) (&((ec_handle_t *)(handle))->scan_lob_buf)
 
 struct st_instance;
 
@@ -448,11 +452,46 @@ EXPORT_API void gstor_clean(void *handle);
 
 EXPORT_API int gstor_put(void *handle, char *key, unsigned int key_len, char *val, unsigned int val_len);
 
+// same as gstor_put, inserted tells whether the key was new or overwritten
+EXPORT_API int gstor_upsert(void *handle, char *key, unsigned int key_len, char *val, unsigned int val_len,
+    unsigned int *inserted);
+
+// same as gstor_put, the key expires ttl_ms milliseconds later. ttl_ms of 0, or one that puts the
+// expire time past int64 microseconds, is refused
+EXPORT_API int gstor_setex(void *handle, char *key, unsigned int key_len, char *val, unsigned int val_len,
+    unsigned long long ttl_ms);
+
 EXPORT_API int gstor_del(void *handle, char *key, unsigned int key_len, unsigned int prefix, unsigned int *count);
 
 EXPORT_API int gstor_get(void *handle, char *key, unsigned int key_len, char **val, unsigned int *val_len,
     unsigned int *eof);
 
+// called by gstor_mget for every key found, val is only valid during the call
+typedef int (*gstor_kv_visit_t)(void *arg, unsigned int idx, char *val, unsigned int val_len);
+
+/*
+ * batched kv operations over one open cursor, keys should be sorted ascending and unique.
+ * adjacent keys are reached by walking the index leaves instead of a new descent.
+ */
+EXPORT_API int gstor_mget(void *handle, unsigned int count, char **keys, unsigned int *key_lens,
+    gstor_kv_visit_t visit, void *arg);
+
+EXPORT_API int gstor_mdel(void *handle, unsigned int count, char **keys, unsigned int *key_lens,
+    unsigned int *deleted);
+
+/*
+ * streaming scan of the kv table in key order, one scan per handle. the range is [start, end],
+ * a NULL border is unbounded. with prefix set, the keys starting with start are scanned.
+ */
+EXPORT_API int gstor_kv_scan_open(void *handle, char *start, unsigned int start_len, char *end, unsigned int end_len,
+    unsigned int prefix, unsigned int reverse);
+
+// key and val are valid until the next call
+EXPORT_API int gstor_kv_scan_next(void *handle, char **key, unsigned int *key_len, char **val, unsigned int *val_len,
+    unsigned int *eof);
+
+EXPORT_API void gstor_kv_scan_close(void *handle);
+
 EXPORT_API int rust_gstor_get(void *handle, char *key);
 
 EXPORT_API status_t gstor_executor_insert_row(void *handle, const char *table_name, int column_count,
@@ -81,15 +81,32 @@ void knl_cleanup_session(knl_session_t *knl_session)
 #endif /* DB_DEBUG_VERSION */
 }
 
+static void knl_fold_session_stat(knl_stat_t *total, const knl_stat_t *stat)
+{
+    // knl_stat_t only holds uint64 counters
+    uint64 *dst = (uint64 *)total;
+    const uint64 *src = (const uint64 *)stat;
+    for (uint32 i = 0; i < sizeof(knl_stat_t) / sizeof(uint64); i++) {
+        dst[i] += src[i];
+    }
+}
+
 void knl_free_session(knl_session_t *knl_session)
 {
     instance_t *cc_instance = knl_session->kernel->server;
 
     uint32 id = knl_session->id;
     knl_destroy_session(&cc_instance->kernel, id);
+
+    // the performance views walk the sessions under the instance lock, unpublish before freeing
+    // and keep the counters of the closed session in the instance totals
+    cm_spin_lock(&cc_instance->lock, NULL);
+    knl_fold_session_stat(&cc_instance->kernel.stat, &knl_session->stat);
+    cc_instance->kernel.sessions[id] = NULL;
+    cm_spin_unlock(&cc_instance->lock);
+
     CM_FREE_PTR(knl_session->stack);
     CM_FREE_PTR(knl_session);
-    cc_instance->kernel.sessions[id] = NULL;
 }
 
 void knl_free_sys_sessions(instance_t *cc_instance)
@@ -258,7 +275,7 @@ status_t knl_alloc_sys_sessions(instance_t *cc_instance)
         GS_RETURN_IFERR(knl_alloc_session(cc_instance, &knl_session));
     }
 #ifdef _LIBAIO
-    // SESSION_ID_AIO = 11
+    // SESSION_ID_AIO = 13
     GS_RETURN_IFERR(knl_alloc_session(cc_instance, &knl_session));
 #endif
     return GS_SUCCESS;
@@ -81,6 +81,7 @@ config_item_t g_parameters[] = {
     {"CR_POOL_SIZE",            GS_TRUE, ATTR_NONE, "64M",      "64M",      NULL, "-", "-", "GS_TYPE_INTEGER",  GS_FALSE },
 #endif          
     {"BUF_POOL_NUM",            GS_TRUE, ATTR_NONE, "1",        "1",        NULL, "-", "-", "GS_TYPE_INTEGER",  GS_FALSE },
+    {"BUFFER_WARMUP_PAGES",     GS_TRUE, ATTR_NONE, "8192",     "8192",     NULL, "-", "-", "GS_TYPE_INTEGER",  GS_FALSE },
     {"PAGE_SIZE",               GS_TRUE, ATTR_NONE, "8K",       "8K",       NULL, "-", "-", "GS_TYPE_INTEGER",  GS_FALSE },
     {"SPACE_SIZE",              GS_TRUE, ATTR_NONE, "16M",     "16M",       NULL, "-", "-", "GS_TYPE_INTEGER",  GS_FALSE },
     {"UNDO_TABLESPACE",         GS_TRUE, ATTR_NONE, "UNDO",     "UNDO",     NULL, "-", "-", "GS_TYPE_INTEGER",  GS_FALSE },
@@ -114,7 +115,8 @@ config_item_t g_parameters[] = {
     {"CR_POOL_COUNT",           GS_TRUE, ATTR_NONE, "1",        "1",        NULL, "-", "-", "GS_TYPE_INTEGER",  GS_FALSE },
     {"CKPT_INTERVAL",           GS_TRUE, ATTR_NONE, "300",      "300",      NULL, "-", "-", "GS_TYPE_INTEGER",  GS_FALSE },
     {"CKPT_IO_CAPACITY",        GS_TRUE, ATTR_NONE, "4096",     "4096",     NULL, "-", "-", "GS_TYPE_INTEGER",  GS_FALSE },
-    {"LOG_REPLAY_PROCESSES",    GS_TRUE, ATTR_NONE, "1",        "1",        NULL, "-", "-", "GS_TYPE_INTEGER",  GS_FALSE },
+    {"LOG_REPLAY_PROCESSES",    GS_TRUE, ATTR_NONE, "0",        "0",        NULL, "-", "-", "GS_TYPE_INTEGER",  GS_FALSE },
+    {"RCY_PRELOAD_PROCESSES",   GS_TRUE, ATTR_NONE, "2",        "2",        NULL, "-", "-", "GS_TYPE_INTEGER",  GS_FALSE },
     {"RCY_SLEEP_INTERVAL",      GS_TRUE, ATTR_NONE, "32",       "32",       NULL, "-", "-", "GS_TYPE_INTEGER",  GS_FALSE },
     {"DBWR_PROCESSES",          GS_TRUE, ATTR_NONE, "4",        "1",        NULL, "-", "-", "GS_TYPE_INTEGER",  GS_TRUE  },
     {"UNDO_RETENTION_TIME",     GS_TRUE, ATTR_NONE, "20",       "20",       NULL, "-", "-", "GS_TYPE_INTEGER",  GS_TRUE  },
@@ -144,6 +146,22 @@ config_item_t g_parameters[] = {
         "GS_TYPE_INTEGER",  GS_TRUE, "## ISOLATION_LEVEL(1:Read Committed, 2:Repeatable Read)"  },
     {"TS_UPDATE_SUPPORT",       GS_TRUE, ATTR_NONE, "FALSE",    "FALSE",    NULL, "-", "-",
         "GS_TYPE_INTEGER",  GS_TRUE, "## if support update or not for timeseries table"  },
+    {"PART_RETENTION_INTERVAL", GS_TRUE, ATTR_NONE, "60",       "60",       NULL, "-", "-",
+        "GS_TYPE_INTEGER",  GS_TRUE, "## Seconds between two rounds of dropping expired timeseries partitions(0:disabled)" },
+    {"PART_RETENTION_MAX_DROPS", GS_TRUE, ATTR_NONE, "8",       "8",        NULL, "-", "-",
+        "GS_TYPE_INTEGER",  GS_TRUE, "## The maximum number of expired partitions dropped in one round(1~1024)" },
+    {"KV_EXPIRE_INTERVAL",      GS_TRUE, ATTR_NONE, "1",        "1",        NULL, "-", "-",
+        "GS_TYPE_INTEGER",  GS_TRUE, "## Seconds between two rounds of deleting expired kv keys(0:disabled)" },
+    {"KV_EXPIRE_BATCH",         GS_TRUE, ATTR_NONE, "128",      "128",      NULL, "-", "-",
+        "GS_TYPE_INTEGER",  GS_TRUE, "## The maximum number of expired kv keys deleted in one transaction(1~10000)" },
+    {"COMMIT_DELAY_US",         GS_TRUE, ATTR_NONE, "0",        "0",        NULL, "-", "-",
+        "GS_TYPE_INTEGER",  GS_TRUE, "## Microseconds a commit waits for more committers to share one redo flush(0~100000, 0:disabled)" },
+    {"COMMIT_SIBLINGS",         GS_TRUE, ATTR_NONE, "5",        "5",        NULL, "-", "-",
+        "GS_TYPE_INTEGER",  GS_TRUE, "## The minimum number of other active transactions to delay a commit(1~1000)" },
+    {"COMMIT_BATCH_SIZE",       GS_TRUE, ATTR_NONE, "64",       "64",       NULL, "-", "-",
+        "GS_TYPE_INTEGER",  GS_TRUE, "## Stop delaying a commit once so many sessions are waiting for the redo flush" },
+    {"IO_ENGINE",               GS_TRUE, ATTR_NONE, "SYNC",     "SYNC",     NULL, "-", "-",
+        "GS_TYPE_VARCHAR",  GS_TRUE, "## Engine of datafile reads, dbwr flushes and redo writes(SYNC, IO_URING)" },
 };
 
 // copy from g_parameters
@@ -53,9 +53,13 @@
 #define DEFAULT_SQL_POOL_FACTOR (0.5)
 #define DEFAULT_TEMP_POOL_NUM (uint32)1
 #define DEFAULT_CR_POOL_COUNT (uint32)1
+#define DEFAULT_BUFFER_WARMUP_PAGES (uint32)8192 // at most half of the data buffer is used
 #define DEFAULT_CKPT_INTERVAL (uint32)300
 #define DEFAULT_CKPT_IO_CAPACITY (uint32)4096
-#define DEFAULT_LOG_REPLAY_PROCESSES (uint32)1
+#define DEFAULT_LOG_REPLAY_PROCESSES (uint32)0 // 0: one per cpu, within [MIN, MAX]_AUTO_LOG_REPLAY_PROCESSES
+#define MIN_AUTO_LOG_REPLAY_PROCESSES (uint32)2
+#define MAX_AUTO_LOG_REPLAY_PROCESSES (uint32)8
+#define DEFAULT_RCY_PRELOAD_PROCESSES (uint32)2
 #define DEFAULT_RCY_SLEEP_INTERVAL (uint32)32
 #define DEFAULT_DBWR_PROCESSES (uint32)4
 #define DEFAULT_UNDO_RETENTION_TIME (uint32)20
@@ -90,6 +94,13 @@
 #define DEFAULT_MAX_CONN_NUM (uint32)100
 #define DEFAULT_DBWR_FSYNC_TIMEOUT (uint32)100
 #define DEFAULT_ISOLATION_LEVEL (uint32)1       // 1:Read Committed, 2:Repeatable Read
+#define DEFAULT_PART_RETENTION_INTERVAL (uint32)60 // second
+#define DEFAULT_PART_RETENTION_MAX_DROPS (uint32)8
+#define DEFAULT_KV_EXPIRE_INTERVAL (uint32)1 // second
+#define DEFAULT_KV_EXPIRE_BATCH (uint32)128
+#define DEFAULT_COMMIT_DELAY (uint32)0        // microsecond
+#define DEFAULT_COMMIT_SIBLINGS (uint32)5
+#define DEFAULT_COMMIT_BATCH_SIZE (uint32)64
 #define FIX_NUM_DAYS_YEAR (uint32)365
 
 int knl_param_get_config_info(config_item_t **params, uint32 *count);
@@ -1338,14 +1338,20 @@ static index_def_t g_sys_log_user_indexes[] = {
 column_def_t g_sys_kv_cols[] = {
     { {.str = (char*)"KEY",  .len = 3  }, GS_TYPE_VARCHAR,    4000,      GS_FALSE },
     { {.str = (char*)"VALUE",  .len = 5  }, GS_TYPE_CLOB,    4000,      GS_TRUE },
+    { {.str = (char*)"EXPIRE",  .len = 6  }, GS_TYPE_BIGINT,  8,         GS_TRUE },
 };
 
 text_t g_sys_kv_idx01_cols[] = {
     {.str = (char*)"KEY", .len = 3  },
 };
 
+text_t g_sys_kv_idx02_cols[] = {
+    {.str = (char*)"EXPIRE", .len = 6  },
+};
+
 static index_def_t g_sys_kv_indexes[] = {
-        {{.str = (char*)"IX_SYS_KV_001", .len = 3}, (text_t*)&g_sys_kv_idx01_cols, 1, GS_TRUE}
+        {{.str = (char*)"IX_SYS_KV_001", .len = 3}, (text_t*)&g_sys_kv_idx01_cols, 1, GS_TRUE},
+        {{.str = (char*)"IX_SYS_KV_002", .len = 13}, (text_t*)&g_sys_kv_idx02_cols, 1, GS_FALSE}
     };
 
 // SYS_LOBPART
@@ -2027,7 +2033,7 @@ static table_def_t g_sys_tables[] = {
         SYS_COL_COUNT(g_sys_kv_cols),
         (text_t *)&g_system,
         SYS_KV_ID,
-        1,
+        2,
         g_sys_kv_indexes,
         TABLE_TYPE_HEAP},
     {{.str = (char *)"SYS_LOBPART", .len = 11},
@@ -68,8 +68,10 @@ typedef struct st_table_def {
 }table_def_t;
 
 #define IX_SYS_KV_01_ID         0
+#define IX_SYS_KV_02_ID         1
 #define SYS_KV_KEY_COL_ID       0
 #define SYS_KV_VALUE_COL_ID     1
+#define SYS_KV_EXPIRE_COL_ID    2
 
 status_t knl_open_sys_database(knl_session_t *session);
 status_t knl_create_sys_database(knl_session_t *knl_session, char *home);
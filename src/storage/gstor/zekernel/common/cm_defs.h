@@ -401,7 +401,7 @@ typedef struct internal_default_value {
 #define GS_MALICIOUS_LOGIN_COUNT (uint32)9
 #define GS_MALICIOUS_LOGIN_ALARM (uint32)15
 #define GS_MAX_MALICIOUS_IP_COUNT (uint32)64000
-#define GS_SYS_SESSIONS (uint32)11
+#define GS_SYS_SESSIONS (uint32)13
 #define GS_MAX_AUTON_SESSIONS (uint32)256
 #define GS_MAX_UNDO_SEGMENTS (uint32)1024
 #if defined(INTARK_LITE)
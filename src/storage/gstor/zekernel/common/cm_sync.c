@@ -129,6 +129,36 @@ int32 cm_event_timedwait(cm_event_t *evnt, uint32 timeout /* milliseconds */)
 #endif
 }
 
+int32 cm_event_timedwait_us(cm_event_t *evnt, uint32 timeout /* microseconds */)
+{
+#ifdef _WIN32
+    return cm_event_timedwait(evnt, (timeout + 999) / 1000);
+#else
+    struct timespec tv;
+    struct timespec tim;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &tv);
+    tim.tv_sec = tv.tv_sec + timeout / 1000000;
+    tim.tv_nsec = tv.tv_nsec + ((long)timeout % 1000000) * 1000;
+    if (tim.tv_nsec >= 1000000000) {
+        tim.tv_sec++;
+        tim.tv_nsec -= 1000000000;
+    }
+
+    (void)pthread_mutex_lock(&evnt->lock);
+    if (!evnt->status) {
+        (void)pthread_cond_timedwait(&evnt->cond, &evnt->lock, &tim);
+    }
+    if (evnt->status) {
+        evnt->status = GS_FALSE;
+        (void)pthread_mutex_unlock(&evnt->lock);
+        return GS_SUCCESS;
+    }
+    (void)pthread_mutex_unlock(&evnt->lock);
+    return GS_TIMEDOUT;
+#endif
+}
+
 void cm_event_wait(cm_event_t *evnt)
 {
     (void)cm_event_timedwait(evnt, 50); // 50ms
@@ -47,6 +47,7 @@ int32 cm_event_init(cm_event_t *event);
 void cm_event_destory(cm_event_t *event);
 void cm_event_notify(cm_event_t *event);
 int32 cm_event_timedwait(cm_event_t *event, uint32 timeout /* milliseconds */);
+int32 cm_event_timedwait_us(cm_event_t *event, uint32 timeout /* microseconds */);
 void cm_event_wait(cm_event_t *event);
 
 #ifndef WIN32
@@ -0,0 +1,533 @@
+/*
+ * Copyright (c) 2022 Huawei Technologies Co.,Ltd.
+ *
+ * openGauss is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ * http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ *
+ * cm_uring.c
+ * io_uring submission and completion rings driven by raw system calls
+ *
+ * IDENTIFICATION
+ * src/storage/gstor/zekernel/common/cm_uring.c
+ *
+ * -------------------------------------------------------------------------
+ */
+#include "cm_uring.h"
+#include "cm_file.h"
+#include "cm_error.h"
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define CM_HAS_IO_URING
+#endif
+#endif
+
+#ifdef CM_HAS_IO_URING
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+#ifndef __NR_io_uring_register
+#define __NR_io_uring_register 427
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CM_HAS_IO_URING
+
+/* the kernel refuses fixed buffers larger than 1G, larger regions are registered in pieces */
+#define URING_FIXED_BUF_MAX_SIZE SIZE_G(1)
+#define URING_MAX_FIXED_BUFS     1024
+
+typedef enum en_uring_op_type {
+    URING_OP_READ = 0,
+    URING_OP_WRITE = 1,
+    URING_OP_FDATASYNC = 2,
+} uring_op_type_t;
+
+typedef struct st_uring_op {
+    int32 fd;
+    uint32 type;
+    char *buf;
+    uint32 size;
+    uint32 reserved;
+    int64 offset;
+} uring_op_t;
+
+struct st_cm_uring {
+    int32 fd;
+    uint32 entries;
+    uint32 queued; // sqes filled since the last wait
+    bool32 broken; // entering the ring failed, every later call fails
+
+    uint32 *sq_head;
+    uint32 *sq_tail;
+    uint32 *sq_array;
+    uint32 sq_mask;
+    struct io_uring_sqe *sqes;
+
+    uint32 *cq_head;
+    uint32 *cq_tail;
+    uint32 cq_mask;
+    struct io_uring_cqe *cqes;
+
+    void *sq_ring;
+    size_t sq_ring_size;
+    void *cq_ring; // NULL if the kernel maps both rings at once
+    size_t cq_ring_size;
+    size_t sqes_size;
+
+    uint32 fixed_count;
+    struct iovec fixed[URING_MAX_FIXED_BUFS];
+
+    uring_op_t *ops; // indexed by the user_data of the sqe
+};
+
+static inline int32 uring_setup(uint32 entries, struct io_uring_params *params)
+{
+    return (int32)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static inline int32 uring_enter(int32 fd, uint32 to_submit, uint32 min_complete, uint32 flags)
+{
+    return (int32)syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, NULL, 0);
+}
+
+static inline int32 uring_register(int32 fd, uint32 opcode, const void *arg, uint32 nr_args)
+{
+    return (int32)syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+bool32 cm_uring_supported(void)
+{
+    struct io_uring_params params;
+    (void)memset_s(&params, sizeof(params), 0, sizeof(params));
+
+    int32 fd = uring_setup(1, &params);
+    if (fd < 0) {
+        return GS_FALSE;
+    }
+    (void)close(fd);
+    return GS_TRUE;
+}
+
+static void uring_unmap(cm_uring_t *ring)
+{
+    if (ring->sqes != NULL && ring->sqes != MAP_FAILED) {
+        (void)munmap(ring->sqes, ring->sqes_size);
+    }
+    if (ring->cq_ring != NULL && ring->cq_ring != MAP_FAILED) {
+        (void)munmap(ring->cq_ring, ring->cq_ring_size);
+    }
+    if (ring->sq_ring != NULL && ring->sq_ring != MAP_FAILED) {
+        (void)munmap(ring->sq_ring, ring->sq_ring_size);
+    }
+}
+
+static status_t uring_map(cm_uring_t *ring, const struct io_uring_params *params)
+{
+    ring->sq_ring_size = params->sq_off.array + params->sq_entries * sizeof(uint32);
+    ring->cq_ring_size = params->cq_off.cqes + params->cq_entries * sizeof(struct io_uring_cqe);
+    bool32 single_mmap = (params->features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+        ring->sq_ring_size = MAX(ring->sq_ring_size, ring->cq_ring_size);
+    }
+
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+        IORING_OFF_SQ_RING);
+    if (ring->sq_ring == MAP_FAILED) {
+        GS_THROW_ERROR_EX(ERR_GENERIC_INTERNAL_ERROR, "failed to map io_uring submission ring, errno %d", errno);
+        return GS_ERROR;
+    }
+
+    char *cq_base = (char *)ring->sq_ring;
+    if (!single_mmap) {
+        ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd,
+            IORING_OFF_CQ_RING);
+        if (ring->cq_ring == MAP_FAILED) {
+            GS_THROW_ERROR_EX(ERR_GENERIC_INTERNAL_ERROR, "failed to map io_uring completion ring, errno %d", errno);
+            return GS_ERROR;
+        }
+        cq_base = (char *)ring->cq_ring;
+    }
+
+    ring->sqes_size = params->sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = (struct io_uring_sqe *)mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        GS_THROW_ERROR_EX(ERR_GENERIC_INTERNAL_ERROR, "failed to map io_uring submission entries, errno %d", errno);
+        return GS_ERROR;
+    }
+
+    char *sq_base = (char *)ring->sq_ring;
+    ring->sq_head = (uint32 *)(sq_base + params->sq_off.head);
+    ring->sq_tail = (uint32 *)(sq_base + params->sq_off.tail);
+    ring->sq_array = (uint32 *)(sq_base + params->sq_off.array);
+    ring->sq_mask = *(uint32 *)(sq_base + params->sq_off.ring_mask);
+    ring->cq_head = (uint32 *)(cq_base + params->cq_off.head);
+    ring->cq_tail = (uint32 *)(cq_base + params->cq_off.tail);
+    ring->cq_mask = *(uint32 *)(cq_base + params->cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)(cq_base + params->cq_off.cqes);
+    return GS_SUCCESS;
+}
+
+status_t cm_uring_create(uint32 entries, cm_uring_t **ring)
+{
+    struct io_uring_params params;
+    (void)memset_s(&params, sizeof(params), 0, sizeof(params));
+
+    cm_uring_t *new_ring = (cm_uring_t *)malloc(sizeof(cm_uring_t));
+    if (new_ring == NULL) {
+        GS_THROW_ERROR(ERR_ALLOC_MEMORY, (uint64)sizeof(cm_uring_t), "io_uring");
+        return GS_ERROR;
+    }
+    (void)memset_s(new_ring, sizeof(cm_uring_t), 0, sizeof(cm_uring_t));
+
+    new_ring->fd = uring_setup(MIN(MAX(entries, 2), CM_URING_MAX_ENTRIES), &params);
+    if (new_ring->fd < 0) {
+        GS_THROW_ERROR_EX(ERR_GENERIC_INTERNAL_ERROR, "failed to set up io_uring, errno %d", errno);
+        CM_FREE_PTR(new_ring);
+        return GS_ERROR;
+    }
+
+    new_ring->entries = params.sq_entries;
+    new_ring->ops = (uring_op_t *)malloc(sizeof(uring_op_t) * new_ring->entries);
+    if (new_ring->ops == NULL) {
+        GS_THROW_ERROR(ERR_ALLOC_MEMORY, (uint64)sizeof(uring_op_t) * new_ring->entries, "io_uring");
+        cm_uring_destroy(&new_ring);
+        return GS_ERROR;
+    }
+
+    if (uring_map(new_ring, &params) != GS_SUCCESS) {
+        cm_uring_destroy(&new_ring);
+        return GS_ERROR;
+    }
+
+    *ring = new_ring;
+    return GS_SUCCESS;
+}
+
+void cm_uring_destroy(cm_uring_t **ring)
+{
+    cm_uring_t *old_ring = *ring;
+    if (old_ring == NULL) {
+        return;
+    }
+
+    uring_unmap(old_ring);
+    if (old_ring->fd >= 0) {
+        (void)close(old_ring->fd);
+    }
+    CM_FREE_PTR(old_ring->ops);
+    CM_FREE_PTR(old_ring);
+    *ring = NULL;
+}
+
+status_t cm_uring_register_buffers(cm_uring_t *ring, char **addrs, const uint64 *sizes, uint32 count)
+{
+    if (ring->fixed_count > 0) {
+        (void)uring_register(ring->fd, IORING_UNREGISTER_BUFFERS, NULL, 0);
+        ring->fixed_count = 0;
+    }
+
+    uint32 fixed_count = 0;
+    for (uint32 i = 0; i < count; i++) {
+        for (uint64 offset = 0; offset < sizes[i]; offset += URING_FIXED_BUF_MAX_SIZE) {
+            if (fixed_count == URING_MAX_FIXED_BUFS) {
+                GS_THROW_ERROR_EX(ERR_GENERIC_INTERNAL_ERROR, "too many io_uring fixed buffers");
+                return GS_ERROR;
+            }
+            ring->fixed[fixed_count].iov_base = addrs[i] + offset;
+            ring->fixed[fixed_count].iov_len = (size_t)MIN(sizes[i] - offset, URING_FIXED_BUF_MAX_SIZE);
+            fixed_count++;
+        }
+    }
+
+    if (uring_register(ring->fd, IORING_REGISTER_BUFFERS, ring->fixed, fixed_count) < 0) {
+        GS_THROW_ERROR_EX(ERR_GENERIC_INTERNAL_ERROR, "failed to register io_uring buffers, errno %d", errno);
+        return GS_ERROR;
+    }
+    ring->fixed_count = fixed_count;
+    return GS_SUCCESS;
+}
+
+static int32 uring_fixed_index(cm_uring_t *ring, const char *buf, uint32 size)
+{
+    for (uint32 i = 0; i < ring->fixed_count; i++) {
+        const char *base = (const char *)ring->fixed[i].iov_base;
+        if (buf >= base && buf + size <= base + ring->fixed[i].iov_len) {
+            return (int32)i;
+        }
+    }
+    return -1;
+}
+
+bool32 cm_uring_is_broken(cm_uring_t *ring)
+{
+    return ring->broken;
+}
+
+static status_t uring_reserve(cm_uring_t *ring, uint32 count)
+{
+    if (ring->broken) {
+        GS_THROW_ERROR_EX(ERR_GENERIC_INTERNAL_ERROR, "io_uring is out of service");
+        return GS_ERROR;
+    }
+    if (ring->queued + count > ring->entries) {
+        return cm_uring_wait(ring);
+    }
+    return GS_SUCCESS;
+}
+
+static void uring_queue(cm_uring_t *ring, const uring_op_t *op, uint8 flags)
+{
+    uint32 index = (*ring->sq_tail + ring->queued) & ring->sq_mask;
+    struct io_uring_sqe *sqe = &ring->sqes[index];
+    int32 fixed = -1;
+
+    (void)memset_s(sqe, sizeof(struct io_uring_sqe), 0, sizeof(struct io_uring_sqe));
+    switch (op->type) {
+        case URING_OP_READ:
+        case URING_OP_WRITE:
+            fixed = uring_fixed_index(ring, op->buf, op->size);
+            if (op->type == URING_OP_READ) {
+                sqe->opcode = (fixed >= 0) ? IORING_OP_READ_FIXED : IORING_OP_READ;
+            } else {
+                sqe->opcode = (fixed >= 0) ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+            }
+            sqe->addr = (uint64)(uintptr_t)op->buf;
+            sqe->len = op->size;
+            sqe->off = (uint64)op->offset;
+            sqe->buf_index = (uint16)((fixed >= 0) ? fixed : 0);
+            break;
+        default:
+            sqe->opcode = IORING_OP_FSYNC;
+            sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+            break;
+    }
+    sqe->fd = op->fd;
+    sqe->flags = flags;
+    sqe->user_data = ring->queued;
+
+    ring->ops[ring->queued] = *op;
+    ring->sq_array[index] = index;
+    ring->queued++;
+}
+
+status_t cm_uring_prep_read(cm_uring_t *ring, int32 fd, void *buf, uint32 size, int64 offset)
+{
+    uring_op_t op = { fd, URING_OP_READ, (char *)buf, size, 0, offset };
+
+    if (uring_reserve(ring, 1) != GS_SUCCESS) {
+        return GS_ERROR;
+    }
+    uring_queue(ring, &op, 0);
+    return GS_SUCCESS;
+}
+
+status_t cm_uring_prep_write(cm_uring_t *ring, int32 fd, const void *buf, uint32 size, int64 offset, bool32 sync)
+{
+    uring_op_t op = { fd, URING_OP_WRITE, (char *)buf, size, 0, offset };
+    uring_op_t sync_op = { fd, URING_OP_FDATASYNC, NULL, 0, 0, 0 };
+
+    if (uring_reserve(ring, sync ? 2 : 1) != GS_SUCCESS) {
+        return GS_ERROR;
+    }
+    uring_queue(ring, &op, sync ? IOSQE_IO_LINK : 0);
+    if (sync) {
+        /* a failed write cancels the linked fdatasync, both complete with an error */
+        uring_queue(ring, &sync_op, 0);
+    }
+    return GS_SUCCESS;
+}
+
+/* records the first failure of the batch, later completions are still reaped */
+static status_t uring_check_result(const uring_op_t *op, int32 res)
+{
+    if (res < 0) {
+        if (op->type == URING_OP_READ) {
+            GS_THROW_ERROR(ERR_READ_FILE, -res);
+        } else if (op->type == URING_OP_WRITE) {
+            GS_THROW_ERROR(ERR_WRITE_FILE, -res);
+        } else {
+            GS_THROW_ERROR(ERR_DATAFILE_FDATASYNC, -res);
+        }
+        return GS_ERROR;
+    }
+
+    if (op->type == URING_OP_READ && (uint32)res < op->size) {
+        /* a short read is finished like cm_read_device would, it only fails at the end of the file */
+        int32 read_size = 0;
+        if (cm_pread_file(op->fd, op->buf + res, (int32)op->size - res, op->offset + res, &read_size) != GS_SUCCESS) {
+            return GS_ERROR;
+        }
+        if (res + read_size != (int32)op->size) {
+            GS_THROW_ERROR(ERR_READ_DEVICE_INCOMPLETE, res + read_size, op->size);
+            return GS_ERROR;
+        }
+    } else if (op->type == URING_OP_WRITE && (uint32)res != op->size) {
+        GS_THROW_ERROR(ERR_WRITE_FILE_PART_FINISH, res, op->size);
+        return GS_ERROR;
+    }
+    return GS_SUCCESS;
+}
+
+/*
+ * io_uring_enter failed for good, yet the kernel may have taken some of the requests of the batch before. Their
+ * buffers stay in use until they complete, so their completions are awaited before the ring is given up, the
+ * requests the kernel never took are dropped. A completion may need the task to pass through the kernel, which
+ * the sleep does.
+ */
+static void uring_drain(cm_uring_t *ring, uint32 sq_start, uint32 count, uint32 to_reap)
+{
+    uint32 taken = __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE) - sq_start;
+    uint32 in_flight = taken - (count - to_reap);
+
+    while (in_flight > 0) {
+        uint32 head = *ring->cq_head;
+        uint32 tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+        if (head == tail) {
+            cm_sleep(1);
+            continue;
+        }
+        for (; head != tail && in_flight > 0; head++) {
+            in_flight--;
+        }
+        __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+    }
+    ring->broken = GS_TRUE;
+}
+
+status_t cm_uring_wait(cm_uring_t *ring)
+{
+    uint32 count = ring->queued;
+    uint32 to_submit = count;
+    uint32 to_reap = count;
+    uint32 sq_start = *ring->sq_tail;
+    status_t status = GS_SUCCESS;
+
+    if (ring->broken) {
+        GS_THROW_ERROR_EX(ERR_GENERIC_INTERNAL_ERROR, "io_uring is out of service");
+        return GS_ERROR;
+    }
+    if (count == 0) {
+        return GS_SUCCESS;
+    }
+    __atomic_store_n(ring->sq_tail, sq_start + count, __ATOMIC_RELEASE);
+    ring->queued = 0;
+
+    while (to_reap > 0) {
+        uint32 head = *ring->cq_head;
+        uint32 tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+        if (to_submit > 0 || head == tail) {
+            int32 ret = uring_enter(ring->fd, to_submit, (head == tail) ? 1 : 0, IORING_ENTER_GETEVENTS);
+            if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                GS_THROW_ERROR_EX(ERR_GENERIC_INTERNAL_ERROR, "failed to enter io_uring, errno %d", errno);
+                uring_drain(ring, sq_start, count, to_reap);
+                return GS_ERROR;
+            }
+            to_submit -= (ret > 0) ? MIN((uint32)ret, to_submit) : 0;
+            tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+        }
+
+        for (; head != tail && to_reap > 0; head++, to_reap--) {
+            struct io_uring_cqe *cqe = &ring->cqes[head & ring->cq_mask];
+            if (uring_check_result(&ring->ops[cqe->user_data], cqe->res) != GS_SUCCESS) {
+                status = GS_ERROR;
+            }
+        }
+        __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+    }
+    return status;
+}
+
+#else
+
+bool32 cm_uring_supported(void)
+{
+    return GS_FALSE;
+}
+
+status_t cm_uring_create(uint32 entries, cm_uring_t **ring)
+{
+    GS_THROW_ERROR(ERR_CAPABILITY_NOT_SUPPORT, "io_uring");
+    return GS_ERROR;
+}
+
+void cm_uring_destroy(cm_uring_t **ring)
+{
+    *ring = NULL;
+}
+
+status_t cm_uring_register_buffers(cm_uring_t *ring, char **addrs, const uint64 *sizes, uint32 count)
+{
+    GS_THROW_ERROR(ERR_CAPABILITY_NOT_SUPPORT, "io_uring");
+    return GS_ERROR;
+}
+
+status_t cm_uring_prep_read(cm_uring_t *ring, int32 fd, void *buf, uint32 size, int64 offset)
+{
+    GS_THROW_ERROR(ERR_CAPABILITY_NOT_SUPPORT, "io_uring");
+    return GS_ERROR;
+}
+
+status_t cm_uring_prep_write(cm_uring_t *ring, int32 fd, const void *buf, uint32 size, int64 offset, bool32 sync)
+{
+    GS_THROW_ERROR(ERR_CAPABILITY_NOT_SUPPORT, "io_uring");
+    return GS_ERROR;
+}
+
+status_t cm_uring_wait(cm_uring_t *ring)
+{
+    GS_THROW_ERROR(ERR_CAPABILITY_NOT_SUPPORT, "io_uring");
+    return GS_ERROR;
+}
+
+bool32 cm_uring_is_broken(cm_uring_t *ring)
+{
+    return GS_TRUE;
+}
+
+#endif
+
+status_t cm_uring_read(cm_uring_t *ring, int32 fd, void *buf, uint32 size, int64 offset)
+{
+    if (cm_uring_prep_read(ring, fd, buf, size, offset) != GS_SUCCESS) {
+        return GS_ERROR;
+    }
+    return cm_uring_wait(ring);
+}
+
+status_t cm_uring_write(cm_uring_t *ring, int32 fd, const void *buf, uint32 size, int64 offset, bool32 sync)
+{
+    if (cm_uring_prep_write(ring, fd, buf, size, offset, sync) != GS_SUCCESS) {
+        return GS_ERROR;
+    }
+    return cm_uring_wait(ring);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2022 Huawei Technologies Co.,Ltd.
+ *
+ * openGauss is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ * http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ *
+ * cm_uring.h
+ * io_uring submission and completion rings driven by raw system calls
+ *
+ * IDENTIFICATION
+ * src/storage/gstor/zekernel/common/cm_uring.h
+ *
+ * -------------------------------------------------------------------------
+ */
+#ifndef __CM_URING_H__
+#define __CM_URING_H__
+
+#include "cm_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * A ring is owned by one thread at a time. Reads and writes are queued with the prep functions and
+ * run by cm_uring_wait, which submits everything queued and returns once all of it completed. A prep
+ * function that finds the ring full runs cm_uring_wait itself, so a batch may be larger than the ring.
+ * Buffers inside a region given to cm_uring_register_buffers are transferred with the fixed opcodes,
+ * which saves the kernel from pinning the pages on every request.
+ * If entering the ring fails, cm_uring_wait waits for the requests the kernel already took and marks the
+ * ring broken. A broken ring fails every later call and is to be destroyed, its owner goes on with
+ * synchronous io.
+ */
+typedef struct st_cm_uring cm_uring_t;
+
+#define CM_URING_MAX_ENTRIES 4096
+
+/* GS_TRUE if the running kernel lets this process set up a ring */
+bool32 cm_uring_supported(void);
+
+status_t cm_uring_create(uint32 entries, cm_uring_t **ring);
+void cm_uring_destroy(cm_uring_t **ring);
+
+/* registers count regions as fixed buffers, replacing earlier ones */
+status_t cm_uring_register_buffers(cm_uring_t *ring, char **addrs, const uint64 *sizes, uint32 count);
+
+status_t cm_uring_prep_read(cm_uring_t *ring, int32 fd, void *buf, uint32 size, int64 offset);
+/* with sync, an fdatasync linked to the write makes it durable before the batch completes */
+status_t cm_uring_prep_write(cm_uring_t *ring, int32 fd, const void *buf, uint32 size, int64 offset, bool32 sync);
+status_t cm_uring_wait(cm_uring_t *ring);
+bool32 cm_uring_is_broken(cm_uring_t *ring);
+
+status_t cm_uring_read(cm_uring_t *ring, int32 fd, void *buf, uint32 size, int64 offset);
+status_t cm_uring_write(cm_uring_t *ring, int32 fd, const void *buf, uint32 size, int64 offset, bool32 sync);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -27,7 +27,7 @@
 #ifdef _REPLICATION
 #include "knl_gbp.h"
 #endif
-#define BUF_PAGE_COST (DEFAULT_PAGE_SIZE + BUCKET_TIMES * sizeof(buf_bucket_t) + sizeof(buf_ctrl_t))
+#define BUF_PAGE_COST (DEFAULT_PAGE_SIZE + BUCKET_TIMES * sizeof(buf_bucket_t) + sizeof(buf_ctrl_t) + sizeof(uint64))
 #define BUF_PAGE_COST_WITH_GBP (BUF_PAGE_COST + sizeof(buf_gbp_ctrl_t))
 
 static buf_ctrl_t g_init_buf_ctrl = {
@@ -57,7 +57,7 @@ status_t buf_init(knl_session_t *session)
         set->size = kernel->attr.data_buf_part_size;
         set->addr = kernel->attr.data_buf + i * kernel->attr.data_buf_part_align_size;
         cm_init_cond(&set->set_cond);
-        /* set->size <= 32T, BUF_PAGE_COST >= 8360, set->capacity cannot overflow */
+        /* set->size <= 32T, BUF_PAGE_COST >= 8528 with 8K pages, set->capacity cannot overflow */
 #ifdef _REPLICATION
         set->capacity = (uint32)(set->size / (KNL_GBP_ENABLE(kernel) ? BUF_PAGE_COST_WITH_GBP : BUF_PAGE_COST));
 #else
@@ -82,6 +82,13 @@ status_t buf_init(knl_session_t *session)
         set->bucket_num = BUCKET_TIMES * set->capacity;
 
         knl_reset_large_memory((char *)set->buckets, (uint64)sizeof(buf_bucket_t) * set->bucket_num);
+        offset += (uint64)sizeof(buf_bucket_t) * set->bucket_num;
+        set->ghosts = (volatile uint64 *)(set->addr + offset);
+        set->ghost_num = set->capacity;
+        for (uint32 j = 0; j < set->ghost_num; j++) {
+            set->ghosts[j] = BUF_GHOST_EMPTY;
+        }
+        set->stat = (buf_set_stat_t){ 0 };
         buf_init_list(set);
     }
 
@@ -401,6 +408,7 @@ static void buf_check_gbp_queue_gap(knl_session_t *session, buf_ctrl_t *item)
 static void buf_init_ctrl(knl_session_t *session, buf_set_t *set, buf_ctrl_t *item, bool32 from_hwm, uint32 options)
 {
     page_head_t *page = item->page;
+    uint16 pin_gen = buf_next_pin_gen(item);
 #ifdef _REPLICATION
     if (SECUREC_UNLIKELY(KNL_GBP_ENABLE(session->kernel))) {
         buf_ctrl_t init_ctrl_with_gbp = g_init_buf_ctrl;
@@ -412,6 +420,7 @@ static void buf_init_ctrl(knl_session_t *session, buf_set_t *set, buf_ctrl_t *it
         cm_spin_lock(&item->gbp_ctrl->init_lock, NULL);
         *item = init_ctrl_with_gbp;
         item->page = page;
+        item->pin_gen = pin_gen;
         /* do not memset is_gbpdirty, gbp_next and gbp_trunc_point */
         item->gbp_ctrl->is_from_gbp = GS_FALSE;
         item->gbp_ctrl->gbp_read_version = 0;
@@ -420,32 +429,23 @@ static void buf_init_ctrl(knl_session_t *session, buf_set_t *set, buf_ctrl_t *it
     } else {
         *item = g_init_buf_ctrl;
         item->page = page;
+        item->pin_gen = pin_gen;
     }
 #else
     *item = g_init_buf_ctrl;
     item->page = page;
+    item->pin_gen = pin_gen;
 #endif
     /*
-     * strategy to add page to different list with different options:
-     * 1. use scan list only if  buffer size is little.
-     * 2. otherwise, add page to main list if resident.
-     * 3. otherwise, add page to scan list if allocate from hwm or enter page with SEQUENTIAL.
-     * 4. otherwise, add page to main list.
+     * the scan list is the probation queue and the main list the protected one:
+     * 1. add page to main list if resident, or known to be hot (buffer warm-up).
+     * 2. otherwise, add page to scan list, it moves to the main list when it is touched again (see buf_recycle),
+     *    or directly when it is read again soon after it was evicted (see buf_alloc_ctrl).
      */
-    if (set->capacity < BUF_OPTIMIZE_MIN_PAGES) {
-        item->list_id = LRU_LIST_SCAN;
-        return;
-    }
-
-    if (options & ENTER_PAGE_RESIDENT) {
+    if (options & (ENTER_PAGE_RESIDENT | ENTER_PAGE_PROTECTED)) {
         item->list_id = LRU_LIST_MAIN;
-        return;
-    }
-
-    if (from_hwm || (options & ENTER_PAGE_SEQUENTIAL)) {
-        item->list_id = LRU_LIST_SCAN;
     } else {
-        item->list_id = LRU_LIST_MAIN;
+        item->list_id = LRU_LIST_SCAN;
     }
 }
 
@@ -455,6 +455,28 @@ static inline uint32 buf_bucket_hash(page_id_t page_id, uint32 range)
     return (HASH_SEED * page_id.page + page_id.file) * HASH_SEED % range;
 }
 
+static inline uint64 buf_ghost_value(page_id_t page_id)
+{
+    return ((uint64)page_id.file << 32) | page_id.page;
+}
+
+/* remember a page evicted from the scan list, a slot is simply overwritten by the next page mapped to it */
+static inline void buf_ghost_add(buf_set_t *set, page_id_t page_id)
+{
+    set->ghosts[buf_bucket_hash(page_id, set->ghost_num)] = buf_ghost_value(page_id);
+}
+
+static inline bool32 buf_ghost_hit(buf_set_t *set, page_id_t page_id)
+{
+    uint32 slot = buf_bucket_hash(page_id, set->ghost_num);
+
+    if (set->ghosts[slot] != buf_ghost_value(page_id)) {
+        return GS_FALSE;
+    }
+    set->ghosts[slot] = BUF_GHOST_EMPTY;
+    return GS_TRUE;
+}
+
 static inline int32 buf_find_visited(buf_bucket_t **bucket_visited, uint32 bucket_visisted_num,
     buf_bucket_t *cur_bucket)
 {
@@ -564,12 +586,12 @@ static uint32 buf_expire_compress(knl_session_t *session, buf_set_t *set, buf_lr
 
         int visited_id = buf_find_visited(bucket_visited, bucket_visisted_num, cur_bucket);
         if (visited_id != -1) {
-            if (buf_can_expire(cur_ctrl, expire_type)) {
+            if (buf_can_expire(cur_ctrl, expire_type) && buf_retire_ctrl(cur_ctrl)) {
                 map_ctrl_to_bucket[i] = visited_id;
                 continue;
             }
         } else if (cm_spin_timed_lock(&cur_bucket->lock, 100)) {
-            if (buf_can_expire(cur_ctrl, expire_type)) {
+            if (buf_can_expire(cur_ctrl, expire_type) && buf_retire_ctrl(cur_ctrl)) {
                 map_ctrl_to_bucket[i] = bucket_visisted_num;
                 bucket_visited[bucket_visisted_num++] = cur_bucket;
                 continue;
@@ -582,6 +604,9 @@ static uint32 buf_expire_compress(knl_session_t *session, buf_set_t *set, buf_lr
 
     /* cancel the bucket locks if not all ctrls are reached */
     if (i < PAGE_GROUP_COUNT) {
+        for (uint32 j = 0; j < i; j++) {
+            buf_unretire_ctrl(head->compress_group[j]);
+        }
         for (i = 0; i < bucket_visisted_num; i++) {
             cm_spin_unlock(&bucket_visited[i]->lock);
         }
@@ -609,7 +634,8 @@ static uint32 buf_expire_normal(knl_session_t *session, buf_set_t *set, buf_ctrl
     buf_bucket_t *bucket = BUF_GET_BUCKET(set, ctrl->bucket_id);
 
     cm_spin_lock(&bucket->lock, &session->stat_bucket);
-    if (!buf_can_expire(ctrl, expire_type)) {
+    /* pinning without bucket lock fails once the ctrl is retired */
+    if (!buf_can_expire(ctrl, expire_type) || !buf_retire_ctrl(ctrl)) {
         cm_spin_unlock(&bucket->lock);
         return 0; // fail
     }
@@ -777,12 +803,33 @@ static bool32 buf_can_evict_general(knl_session_t *session, buf_ctrl_t *head)
     return GS_TRUE;
 }
 
+/* add the pages promoted from the scan list to the hot point of the main list */
+static void buf_promote_list(buf_set_t *set, buf_lru_list_t *promote_list)
+{
+    buf_ctrl_t *item = promote_list->lru_first;
+    buf_ctrl_t *next = NULL;
+
+    if (item == NULL) {
+        return;
+    }
+
+    cm_spin_lock(&set->main_list.lock, NULL);
+    while (item != NULL) {
+        next = item->next;
+        buf_lru_add_ctrl(&set->main_list, item, BUF_ADD_HOT);
+        item = next;
+    }
+    cm_spin_unlock(&set->main_list.lock);
+    (void)cm_atomic_add(&set->stat.promotions, (int64)promote_list->count);
+}
+
 /*
  * search a single LRU to reclaim a ctrl for use. strategy:
  * 1.if exceed searching threshold, waiting for cleaning up dirty page.
- * 2.move cold dirty page to write list.
- * 3.move hot page to the main list.
+ * 2.move page of scan list touched again to the main list.
+ * 3.move cold dirty page to write list.
  * 4.move page unreclaimable to hot point of current list.
+ * a page evicted from the scan list is remembered in the ghosts of the set.
  */
 static buf_ctrl_t *buf_recycle(knl_session_t *session, buf_set_t *set, buf_lru_list_t *list)
 {
@@ -790,6 +837,7 @@ static buf_ctrl_t *buf_recycle(knl_session_t *session, buf_set_t *set, buf_lru_l
     uint32 threshold = BUF_LRU_SEARCH_THRESHOLD(set);
     uint32 step = 0;
     buf_lru_list_t dirty_list = g_init_list_t;
+    buf_lru_list_t promote_list = g_init_list_t;
     uint32 expired_num;
 
     cm_spin_lock(&list->lock, &session->stat_buffer);
@@ -809,12 +857,26 @@ static buf_ctrl_t *buf_recycle(knl_session_t *session, buf_set_t *set, buf_lru_l
             break;
         }
 
+        /* the main list is locked after the scan list is released, see buf_promote_list */
+        if (list->type == LRU_LIST_SCAN && item->touch_number >= BUF_PROMOTE_TOUCH && !BUF_IS_COMPRESS(item)) {
+            shift = item;
+            item = item->prev;
+            buf_lru_remove_ctrl(list, shift);
+            shift->list_id = LRU_LIST_MAIN;
+            buf_lru_add_tail(&promote_list, shift);
+            continue;
+        }
+
         if (BUF_IS_COMPRESS(item)) {
             expired_num = buf_expire_compress(session, set, list, item, BUF_EVICT);
         } else {
             expired_num = buf_expire_normal(session, set, item, BUF_EVICT);
         }
         if (expired_num != 0) {
+            (void)cm_atomic_inc(&set->stat.evictions);
+            if (list->type == LRU_LIST_SCAN && !BUF_IS_COMPRESS(item)) {
+                buf_ghost_add(set, item->page_id);
+            }
             break; // We evict a page to reuse.
         }
 
@@ -846,6 +908,7 @@ static buf_ctrl_t *buf_recycle(knl_session_t *session, buf_set_t *set, buf_lru_l
     buf_lru_adjust_old_len(list);
     cm_spin_unlock(&list->lock);
     buf_lru_append_list(&set->write_list, &dirty_list);
+    buf_promote_list(set, &promote_list);
 
     return item;
 }
@@ -887,7 +950,7 @@ static buf_ctrl_t *buf_alloc_hwm(knl_session_t *session, buf_set_t *set)
 /*
  * method to alloc ctrl:
  * 1.allocate ctrl from hwm first
- * 2.recycle ctrl from AUX list,if access by sequatial,jump to 4.
+ * 2.recycle ctrl from AUX list,if access by sequatial,jump to 4 unless MAIN list exceeds its share.
  * 3.recycle ctrl from MAIN list.
  * 4.trigger page clean to release dirty page.
  */
@@ -905,7 +968,7 @@ static void buf_get_ctrl(knl_session_t *session, buf_set_t *set, uint32 options,
 
     for (;;) {
         item = buf_recycle(session, set, &set->scan_list);
-        if (item == NULL && !(options & ENTER_PAGE_SEQUENTIAL)) {
+        if (item == NULL && (!(options & ENTER_PAGE_SEQUENTIAL) || BUF_NEED_BALANCE(set))) {
             item = buf_recycle(session, set, &set->main_list);
         }
         if (item != NULL) {
@@ -1035,9 +1098,13 @@ static void buf_set_ctrl_options(knl_session_t *session, buf_set_t *set, buf_ctr
     }
 }
 
-/* update ctrl touch number when access is outside time window */
+/* update ctrl touch number when access is outside time window, scans do not make a page hotter */
 static inline void buf_update_ctrl_touch_nr(knl_session_t *session, buf_ctrl_t *item, uint32 options)
 {
+    if (options & ENTER_PAGE_SEQUENTIAL) {
+        return;
+    }
+
     date_t systime = KNL_NOW(session);
     if (systime > item->access_time + BUF_ACCESS_WINDOW) {
         item->touch_number++;
@@ -1048,6 +1115,75 @@ static inline void buf_update_ctrl_touch_nr(knl_session_t *session, buf_ctrl_t *
     }
 }
 
+/*
+ * pin a ctrl found without bucket lock. the pin word is read before the bucket version is checked again, so the
+ * ctrl was still in the bucket then, and the compare-and-swap fails if it has been retired or reused since.
+ */
+static bool32 buf_pin_ctrl_optimistic(buf_bucket_t *bucket, int32 version, buf_ctrl_t *ctrl, uint32 hash_id,
+    page_id_t page_id)
+{
+    int32 pin = __atomic_load_n(&ctrl->pin_word, __ATOMIC_ACQUIRE);
+
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&bucket->version, __ATOMIC_RELAXED) != version) {
+        return GS_FALSE;
+    }
+    if (ctrl->bucket_id != hash_id || !IS_SAME_PAGID(ctrl->page_id, page_id)) {
+        return GS_FALSE;
+    }
+
+    for (;;) {
+        if (((uint32)pin & BUF_PIN_RETIRED) || ((uint32)pin & BUF_PIN_REF_MASK) == BUF_PIN_REF_MASK) {
+            return GS_FALSE;
+        }
+        if (cm_atomic32_cas(&ctrl->pin_word, pin, pin + 1)) {
+            return GS_TRUE;
+        }
+
+        int32 curr = ctrl->pin_word;
+        if (((uint32)curr ^ (uint32)pin) & ~BUF_PIN_REF_MASK) {
+            return GS_FALSE; // retired or reused
+        }
+        pin = curr;
+    }
+}
+
+/*
+ * shared latch on a loaded page without bucket lock, the common case of reading hot pages concurrently.
+ * return NULL if the page is not found this way, the caller goes on with the locked path then.
+ */
+static buf_ctrl_t *buf_latch_optimistic(knl_session_t *session, buf_bucket_t *bucket, uint32 hash_id,
+    page_id_t page_id, uint32 options)
+{
+    buf_ctrl_t *item = NULL;
+    int32 version;
+
+    if (!buf_find_from_bucket_optimistic(bucket, page_id, &item, &version) || item == NULL) {
+        return NULL;
+    }
+    if (item->load_status != (uint8)BUF_IS_LOADED) {
+        return NULL;
+    }
+    if (!buf_pin_ctrl_optimistic(bucket, version, item, hash_id, page_id)) {
+        return NULL;
+    }
+
+    if (!buf_latch_try_s(&item->latch, (uint16)session->id, GS_FALSE)) {
+        buf_unpin_ctrl(item);
+        return NULL;
+    }
+
+    /* the page may be reloading by an exclusive holder before we latched */
+    if (item->load_status != (uint8)BUF_IS_LOADED) {
+        buf_unlatch(session, item, GS_TRUE);
+        return NULL;
+    }
+
+    buf_stat_page_inc(session, 0);
+    buf_update_ctrl_touch_nr(session, item, options);
+    return item;
+}
+
 buf_ctrl_t *buf_alloc_ctrl(knl_session_t *session, page_id_t page_id, latch_mode_t mode, uint32 options)
 {
     uint32 buf_pool_id = buf_get_pool_id(page_id, session->kernel->buf_ctx.buf_set_count);
@@ -1070,6 +1206,13 @@ buf_ctrl_t *buf_alloc_ctrl(knl_session_t *session, page_id_t page_id, latch_mode
     uint32 hash_id = buf_bucket_hash(page_id, set->bucket_num);
     buf_bucket_t *bucket = BUF_GET_BUCKET(set, hash_id);
 
+    if (mode == LATCH_MODE_S && !(options & (ENTER_PAGE_RESIDENT | ENTER_PAGE_PINNED))) {
+        item = buf_latch_optimistic(session, bucket, hash_id, page_id, options);
+        if (item != NULL) {
+            return item;
+        }
+    }
+
     /* lock bucket to find page ctrl and release lock after latching */
     cm_spin_lock(&bucket->lock, &session->stat_bucket);
     item = buf_find_from_bucket(bucket, page_id);
@@ -1080,7 +1223,7 @@ buf_ctrl_t *buf_alloc_ctrl(knl_session_t *session, page_id_t page_id, latch_mode
     }
 
     if (item != NULL) {
-        item->ref_num++;
+        buf_pin_ctrl(item);
         buf_latch_ctrl(session, bucket, item, mode);
         buf_set_ctrl_options(session, set, item, options);
         buf_update_ctrl_touch_nr(session, item, options);
@@ -1111,7 +1254,7 @@ buf_ctrl_t *buf_alloc_ctrl(knl_session_t *session, page_id_t page_id, latch_mode
     cm_spin_lock(&bucket->lock, &session->stat_bucket);
     buf_ctrl_t *temp = buf_find_from_bucket(bucket, page_id);
     if (SECUREC_UNLIKELY(temp != NULL)) {
-        temp->ref_num++;
+        buf_pin_ctrl(temp);
         buf_latch_ctrl(session, bucket, temp, mode);
         buf_set_ctrl_options(session, set, temp, options);
         knl_panic_log(IS_SAME_PAGID(page_id, temp->page_id),
@@ -1144,10 +1287,20 @@ buf_ctrl_t *buf_alloc_ctrl(knl_session_t *session, page_id_t page_id, latch_mode
         item->latch.xsid = session->id;
     }
 
-    /* add resident page to hot point of main list exclude situatuion with little buffer size */
+    /* a page read again soon after it was evicted from the scan list skips the probation */
+    if (item->list_id == LRU_LIST_SCAN && !(options & ENTER_PAGE_SEQUENTIAL) && buf_ghost_hit(set, page_id)) {
+        item->list_id = LRU_LIST_MAIN;
+        (void)cm_atomic_inc(&set->stat.ghost_hits);
+    }
+    session->stat.buf_set_misses[buf_pool_id]++;
+
+    /* add scan page to old point of scan list, other pages to hot point of their list */
     if (!page_compress(session, item->page_id)) {
         // compress page is not added here
-        buf_add_pos_t add_pos = (options & ENTER_PAGE_RESIDENT) ? BUF_ADD_HOT : BUF_ADD_OLD;
+        buf_add_pos_t add_pos = BUF_ADD_HOT;
+        if ((options & ENTER_PAGE_SEQUENTIAL) && item->list_id == LRU_LIST_SCAN) {
+            add_pos = BUF_ADD_OLD;
+        }
         cm_spin_lock(&set->list[item->list_id].lock, &session->stat_buffer);
         buf_lru_add_ctrl(&set->list[item->list_id], item, add_pos);
         cm_spin_unlock(&set->list[item->list_id].lock);
@@ -1192,7 +1345,7 @@ buf_ctrl_t *buf_try_alloc_ctrl(knl_session_t *session, page_id_t page_id, latch_
     item = buf_find_from_bucket(bucket, page_id);
     if (item != NULL) {
         if (item->load_status == (uint8)BUF_LOAD_FAILED) {
-            item->ref_num++;
+            buf_pin_ctrl(item);
             buf_latch_ctrl(session, bucket, item, mode);
             /* page maybe has been loaded by others after latching */
             if (item->load_status == (uint8)BUF_NEED_LOAD) {
@@ -1236,7 +1389,7 @@ buf_ctrl_t *buf_try_alloc_ctrl(knl_session_t *session, page_id_t page_id, latch_
     buf_ctrl_t *temp = buf_find_from_bucket(bucket, page_id);
     if (SECUREC_UNLIKELY(temp != NULL)) {
         if (temp->load_status == (uint8)BUF_LOAD_FAILED) {
-            temp->ref_num++;
+            buf_pin_ctrl(temp);
             buf_latch_ctrl(session, bucket, temp, mode);
 
             cm_spin_lock(&set->scan_list.lock, &session->stat_buffer);
@@ -1463,6 +1616,11 @@ buf_ctrl_t *buf_find_by_pageid(knl_session_t *session, page_id_t page_id)
     hash_id = buf_bucket_hash(page_id, set->bucket_num);
     bucket = BUF_GET_BUCKET(set, hash_id);
 
+    int32 version;
+    if (buf_find_from_bucket_optimistic(bucket, page_id, &ctrl, &version)) {
+        return ctrl;
+    }
+
     cm_spin_lock(&bucket->lock, &session->stat_bucket);
     ctrl = buf_find_from_bucket(bucket, page_id);
     cm_spin_unlock(&bucket->lock);
@@ -1501,7 +1659,10 @@ void buf_reset_cleaned_pages(buf_set_t *set, buf_lru_list_t *list)
     cm_release_cond(&set->set_cond);
 }
 
-/* move ctrls in old list of main list to old point of aux list */
+/*
+ * move ctrls in old list of main list to old point of aux list until the main list is back to its share,
+ * they have to be touched again to return to the main list.
+ */
 void buf_balance_set_list(buf_set_t *set)
 {
     buf_ctrl_t *shift = NULL;
@@ -1510,7 +1671,7 @@ void buf_balance_set_list(buf_set_t *set)
     buf_ctrl_t *item = list->lru_last;
 
     for (;;) {
-        if (item == NULL || item == list->lru_old) {
+        if (item == NULL || item == list->lru_old || !BUF_NEED_BALANCE(set)) {
             break;
         }
 
@@ -1522,9 +1683,11 @@ void buf_balance_set_list(buf_set_t *set)
         shift = item;
         item = item->prev;
         buf_lru_remove_ctrl(list, shift);
+        shift->touch_number /= BUF_AGE_DECREASE_FACTOR;
         cm_spin_lock(&set->scan_list.lock, NULL);
         buf_lru_add_ctrl(&set->scan_list, shift, BUF_ADD_OLD);
         cm_spin_unlock(&set->scan_list.lock);
+        (void)cm_atomic_inc(&set->stat.demotions);
     }
     cm_spin_unlock(&list->lock);
 }
@@ -1652,6 +1815,7 @@ void buf_expire_datafile_pages(knl_session_t *session, uint32 file_id)
 
             buf_bucket_t *bucket = BUF_GET_BUCKET(set, ctrl->bucket_id);
             cm_spin_lock(&bucket->lock, &session->stat_bucket);
+            buf_force_retire_ctrl(ctrl);
             ctrl->bucket_id = GS_INVALID_ID32;
             ctrl->is_resident = 0;
             buf_remove_from_bucket(bucket, ctrl);
@@ -43,6 +43,7 @@ extern "C" {
 #define ENTER_PAGE_TRY (uint8)0x08        // try to read from buffer, don't read from disk
 #define ENTER_PAGE_SEQUENTIAL (uint8)0x10 // for situation like table full scan to descrease impact on buffer
 #define ENTER_PAGE_HIGH_AGE (uint8)0x20   // decrease possibility to be recycled of page
+#define ENTER_PAGE_PROTECTED (uint8)0x40  // known hot page, added to main list without probation of scan list
 #define RD_ENTER_PAGE_MASK (~(ENTER_PAGE_PINNED | ENTER_PAGE_NO_READ | ENTER_PAGE_TRY | ENTER_PAGE_RESIDENT))
 
 #define BUF_IS_RESIDENT(ctrl) ((ctrl)->is_resident)
@@ -68,6 +69,7 @@ extern "C" {
 #define BUF_LRU_OLD_RATIO 0.6            // the position of LRU old list pointer in the LRU list
 #define BUF_MAX_PREFETCH_NUM (uint32)128 // prefetch at most BUF_MAX_PREFETCH_NUM pages
 #define BUF_PREFETCH_UNIT 8
+#define BUF_READ_AHEAD_TRIGGER 4 // pages a scan enters in a row before it is read ahead
 #define UNDO_PREFETCH_NUM 64
 
 #define BUF_LRU_OLD_TOLERANCE 256 // adjust LRU old list pointer if the distance from OLD RATION > BUF_LRU_OLD_TOLERANCE
@@ -82,7 +84,12 @@ extern "C" {
 #define BUF_AGE_DECREASE_FACTOR 2
 #define BUF_BALANCE_RATIO 0.5
 #define BUF_NEED_BALANCE(set) ((set)->scan_list.count < (uint32)((set)->main_list.count * BUF_BALANCE_RATIO))
-#define BUF_OPTIMIZE_MIN_PAGES 131072 // use scan list only when buffer set size less than 1G
+#define BUF_PROMOTE_TOUCH 1 // a scan list page touched again outside the access window moves to the main list
+#define BUF_GHOST_EMPTY GS_INVALID_ID64
+#define BUF_PIN_REF_MASK (uint32)0x0000FFFF
+#define BUF_PIN_RETIRED (uint32)0x80000000
+#define BUF_PIN_GEN_MASK (uint16)0x7FFF
+#define BUF_OPTIMISTIC_MAX_STEPS 16 // longer chains are walked under bucket lock
 
 #define PAGE_GROUP_COUNT 8
 #define MAX_PCB_VM_COUNT 8192 // GS_MAX_TAB_COMPRESS_BUF_SIZE(1G)  / 128k (vm page size)
@@ -108,11 +115,15 @@ typedef enum en_buf_load_status {
     BUF_LOAD_FAILED = 2,
 } buf_load_status_t;
 
-typedef struct st_buf_latch {
-    volatile uint16 shared_count;
-    volatile uint16 stat;
-    volatile uint16 sid;  // the first session latched buffer, less than GS_MAX_SESSIONS(8192)
-    volatile uint16 xsid; // the last session exclusively latched buffer, less than GS_MAX_SESSIONS(8192)
+/* the latch is changed as a whole with compare-and-swap, so that shared latches can be taken without bucket lock */
+typedef union un_buf_latch {
+    struct {
+        volatile uint16 shared_count;
+        volatile uint16 stat;
+        volatile uint16 sid;  // the first session latched buffer, less than GS_MAX_SESSIONS(8192)
+        volatile uint16 xsid; // the last session exclusively latched buffer, less than GS_MAX_SESSIONS(8192)
+    };
+    atomic_t value;
 } buf_latch_t;
 
 typedef enum en_buf_expire_type {
@@ -144,8 +155,14 @@ typedef struct __attribute__((aligned(128))) st_buf_ctrl
     volatile uint8 buf_pool_id;
     volatile uint8 in_ckpt;
     volatile uint8 aligned;
-    volatile uint16 ref_num;
     volatile uint16 touch_number; // touch number for LRU
+    union {
+        struct {
+            volatile uint16 ref_num;
+            volatile uint16 pin_gen; // bumped when the ctrl is reused, the top bit is set once it is being expired
+        };
+        atomic32_t pin_word; // pinned without bucket lock by compare-and-swap, see buf_retire_ctrl
+    };
 
     page_id_t page_id;
     date_t access_time; // last access time
@@ -178,6 +195,8 @@ typedef struct st_buf_bucket {
     spinlock_t lock;
     uint32 count;
     buf_ctrl_t *first;
+    atomic32_t version; // odd while the chain is being changed, lets readers walk the chain without lock
+    uint32 padding;
 } buf_bucket_t;
 
 typedef struct st_buf_lru_list {
@@ -190,6 +209,14 @@ typedef struct st_buf_lru_list {
     uint8 type;       // lru list type
 } buf_lru_list_t;
 
+/* replacement counters of a buffer set, gets and misses are counted per session in knl_stat_t */
+typedef struct st_buf_set_stat {
+    atomic_t ghost_hits; // pages read again soon after leaving the scan list, admitted to the main list
+    atomic_t promotions; // scan list pages moved to the main list
+    atomic_t demotions;  // main list pages moved back to the scan list by rebalancing
+    atomic_t evictions;
+} buf_set_stat_t;
+
 typedef struct st_buf_set {
     spinlock_t lock;
     char *addr;
@@ -199,12 +226,14 @@ typedef struct st_buf_set {
     uint32 capacity;   // total page count
     uint32 hwm;        // high water mark
     uint32 bucket_num; // total bucket count
-    uint32 padding;
+    uint32 ghost_num;  // total ghost count
 
     buf_bucket_t *buckets;     // bucket pool
     buf_ctrl_t *ctrls;         // page control pool
     buf_gbp_ctrl_t *gbp_ctrls; // page gbp control pool
     char *page_buf;            // page buffer
+    volatile uint64 *ghosts;   // ids of pages recently evicted from the scan list, direct mapped
+    buf_set_stat_t stat;
     union {
         buf_lru_list_t list[LRU_LIST_TYPE_COUNT];
         struct {
@@ -215,10 +244,20 @@ typedef struct st_buf_set {
     };
 } buf_set_t;
 
+typedef struct st_buf_warmup_ctx {
+    spinlock_t lock;          // serializes saving the hot page list
+    thread_t thread;          // loads the pages saved by the last run after database open
+    volatile bool32 enabled;  // database opened, the hot page list is saved from now on
+    volatile bool32 finished; // loading is over, a list saved before would miss the pages not yet loaded
+    date_t save_time;         // last time the hot page list was saved
+    uint32 loaded_pages;
+} buf_warmup_ctx_t;
+
 typedef struct st_buf_context {
     buf_set_t buf_set[GS_MAX_BUF_POOL_NUM];
     uint32 buf_set_count;
     thread_lock_t buf_mutex;
+    buf_warmup_ctx_t warmup;
 } buf_context_t;
 
 typedef struct st_buf_iocb {
@@ -313,17 +352,57 @@ static inline buf_ctrl_t *buf_find_from_bucket(buf_bucket_t *bucket, page_id_t p
     return NULL;
 }
 
+/*
+ * find page in bucket without bucket lock, the chain is valid if the version of bucket does not change meanwhile.
+ * ctrls are never freed, so a chain changed concurrently is still safe to walk. return GS_FALSE if the walk
+ * is not reliable and the caller should lock the bucket.
+ */
+static inline bool32 buf_find_from_bucket_optimistic(buf_bucket_t *bucket, page_id_t page_id, buf_ctrl_t **ctrl,
+    int32 *version)
+{
+    int32 begin = __atomic_load_n(&bucket->version, __ATOMIC_ACQUIRE);
+    buf_ctrl_t *item = NULL;
+    uint32 steps = 0;
+
+    if (begin & 1) {
+        return GS_FALSE;
+    }
+
+    item = bucket->first;
+    while (item != NULL) {
+        if (IS_SAME_PAGID(item->page_id, page_id)) {
+            break;
+        }
+        if (++steps > BUF_OPTIMISTIC_MAX_STEPS) {
+            return GS_FALSE;
+        }
+        item = item->hash_next;
+    }
+
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&bucket->version, __ATOMIC_RELAXED) != begin) {
+        return GS_FALSE;
+    }
+    *ctrl = item;
+    *version = begin;
+    return GS_TRUE;
+}
+
 static inline void buf_add_to_bucket(buf_bucket_t *bucket, buf_ctrl_t *ctrl)
 {
+    (void)cm_atomic32_inc(&bucket->version);
     ctrl->hash_next = bucket->first;
     bucket->first = ctrl;
     bucket->count++;
+    (void)cm_atomic32_inc(&bucket->version);
 }
 
 static inline void buf_remove_from_bucket(buf_bucket_t *bucket, buf_ctrl_t *ctrl)
 {
     buf_ctrl_t *item = bucket->first;
 
+    (void)cm_atomic32_inc(&bucket->version);
+
     if (item == ctrl) {
         bucket->first = ctrl->hash_next;
     } else {
@@ -336,6 +415,50 @@ static inline void buf_remove_from_bucket(buf_bucket_t *bucket, buf_ctrl_t *ctrl
 
     /* if the count of bucket is zero, the function will not be called */
     bucket->count--;
+    (void)cm_atomic32_inc(&bucket->version);
+}
+
+/* pin a ctrl found in bucket, the caller holds the bucket lock so that the ctrl can not be expired */
+static inline void buf_pin_ctrl(buf_ctrl_t *ctrl)
+{
+    (void)cm_atomic32_inc(&ctrl->pin_word);
+}
+
+static inline void buf_unpin_ctrl(buf_ctrl_t *ctrl)
+{
+    (void)cm_atomic32_dec(&ctrl->pin_word);
+}
+
+/*
+ * mark an unpinned ctrl before it is removed from its bucket with bucket lock held. once marked, pinning it without
+ * bucket lock fails until the ctrl is reused with a new generation. return GS_FALSE if the ctrl is pinned.
+ */
+static inline bool32 buf_retire_ctrl(buf_ctrl_t *ctrl)
+{
+    int32 pin = ctrl->pin_word;
+
+    if (((uint32)pin & BUF_PIN_REF_MASK) != 0) {
+        return GS_FALSE;
+    }
+    return cm_atomic32_cas(&ctrl->pin_word, pin, (int32)((uint32)pin | BUF_PIN_RETIRED));
+}
+
+/* the ctrl is removed from its bucket even if it is pinned, e.g. its datafile is dropped */
+static inline void buf_force_retire_ctrl(buf_ctrl_t *ctrl)
+{
+    (void)__atomic_fetch_or(&ctrl->pin_word, (int32)BUF_PIN_RETIRED, __ATOMIC_SEQ_CST);
+}
+
+/* a reused ctrl gets a new generation, which is never 0 so a ctrl being reset can not be pinned by a stale reader */
+static inline uint16 buf_next_pin_gen(const buf_ctrl_t *ctrl)
+{
+    return (uint16)((ctrl->pin_gen & BUF_PIN_GEN_MASK) % BUF_PIN_GEN_MASK + 1);
+}
+
+/* the ctrl stays in its bucket after all, nobody else can change an unpinned ctrl while the bucket is locked */
+static inline void buf_unretire_ctrl(buf_ctrl_t *ctrl)
+{
+    ctrl->pin_gen &= BUF_PIN_GEN_MASK;
 }
 
 status_t buf_init(knl_session_t *session);
@@ -24,6 +24,8 @@
 #include "knl_buffer_access.h"
 #include "knl_buflatch.h"
 
+#define BUF_URING_ENTRIES 4
+
 static inline void buf_free_iocb(knl_aio_iocbs_t *iocbs, buf_iocb_t *iocb);
 
 /*
@@ -211,6 +213,38 @@ bool32 buf_check_load_page(knl_session_t *session, page_head_t *page, page_id_t
     return GS_TRUE;
 }
 
+/*
+ * the session's ring is set up on its first buffer miss. it reads into unregistered buffers: registering
+ * the pool would pin all of it once per session, while a miss reads a single page
+ */
+static cm_uring_t *buf_get_session_uring(knl_session_t *session)
+{
+    if (session->uring != NULL || session->uring_failed || !session->kernel->attr.enable_io_uring) {
+        return session->uring;
+    }
+
+    session->uring = knl_create_uring("session", BUF_URING_ENTRIES, NULL, NULL, 0);
+    session->uring_failed = (session->uring == NULL);
+    return session->uring;
+}
+
+static inline status_t buf_read_datafile(knl_session_t *session, datafile_t *df, int32 *handle, int64 offset,
+                                         void *buf, uint32 size)
+{
+    cm_uring_t *uring = buf_get_session_uring(session);
+
+    if (uring != NULL) {
+        if (spc_read_datafile_uring(session, uring, df, handle, offset, buf, size) == GS_SUCCESS) {
+            return GS_SUCCESS;
+        }
+        if (!knl_drop_broken_uring("session", &session->uring, &session->uring_failed)) {
+            return GS_ERROR;
+        }
+        cm_reset_error();
+    }
+    return spc_read_datafile(session, df, handle, offset, buf, size);
+}
+
 status_t buf_load_page_from_disk(knl_session_t *session, buf_ctrl_t *ctrl, page_id_t page_id)
 {
     datafile_t *df = DATAFILE_GET(page_id.file);
@@ -230,7 +264,7 @@ status_t buf_load_page_from_disk(knl_session_t *session, buf_ctrl_t *ctrl, page_
     offset = (int64)page_id.page * DEFAULT_PAGE_SIZE;
     knl_begin_session_wait(session, DB_FILE_SEQUENTIAL_READ, GS_TRUE);
 
-    if (spc_read_datafile(session, df, handle, offset, ctrl->page, DEFAULT_PAGE_SIZE) != GS_SUCCESS) {
+    if (buf_read_datafile(session, df, handle, offset, ctrl->page, DEFAULT_PAGE_SIZE) != GS_SUCCESS) {
         GS_LOG_RUN_ERR("[BUFFER] failed to read datafile %s, offset %lld, size %u, error code %d", df->ctrl->name,
             offset, DEFAULT_PAGE_SIZE, errno);
         spc_close_datafile(df, handle);
@@ -1015,7 +1049,7 @@ status_t buf_load_page(knl_session_t *session, buf_ctrl_t *ctrl, page_id_t page_
 }
 
 static status_t buf_batch_load_pages(knl_session_t *session, char *read_buf, buf_ctrl_t *ctrl, page_id_t begin,
-    uint32 count)
+    uint32 count, uint32 options)
 {
     datafile_t *df = DATAFILE_GET(begin.file);
     int32 *handle = DATAFILE_FD(begin.file);
@@ -1024,6 +1058,8 @@ static status_t buf_batch_load_pages(knl_session_t *session, char *read_buf, buf
     buf_ctrl_t **ctrl_array = NULL;
     status_t status = GS_SUCCESS;
     int64 offset;
+    uint32 first = count;
+    uint32 last = 0;
     uint32 i;
     errno_t ret;
 
@@ -1031,21 +1067,31 @@ static status_t buf_batch_load_pages(knl_session_t *session, char *read_buf, buf
 
     for (i = 0; i < count; i++) {
         page_id.page = begin.page + i;
-        if (page_id.page == ctrl->page_id.page) {
+        if (ctrl != NULL && page_id.page == ctrl->page_id.page) {
             ctrl_array[i] = ctrl;
+            first = MIN(first, i);
+            last = i;
             continue;
         }
 
-        ctrl_array[i] = buf_try_alloc_ctrl(session, page_id, LATCH_MODE_S, ENTER_PAGE_SEQUENTIAL, BUF_ADD_OLD);
+        ctrl_array[i] = buf_try_alloc_ctrl(session, page_id, LATCH_MODE_S, options, BUF_ADD_OLD);
         if (ctrl_array[i] != NULL) {
             knl_panic_log(IS_SAME_PAGID(page_id, ctrl_array[i]->page_id),
                 "the page_id and current ctrl page are not "
                 "same, panic info: ctrl_page %u-%u type %u, page %u-%u",
                 ctrl_array[i]->page_id.file, ctrl_array[i]->page_id.page, ctrl_array[i]->page->type, page_id.file,
                 page_id.page);
+            first = MIN(first, i);
+            last = i;
         }
     }
 
+    /* only the span from the first to the last page not in the buffer is read */
+    if (first == count) {
+        cm_pop(session->stack);
+        return GS_SUCCESS;
+    }
+
     do {
         if (!SPACE_IS_ONLINE(space) || !DATAFILE_IS_ONLINE(df)) {
             GS_LOG_RUN_ERR("[BUFFER] offlined tablespace or datafile of page_id %u-%u", (uint32)begin.file,
@@ -1055,12 +1101,13 @@ static status_t buf_batch_load_pages(knl_session_t *session, char *read_buf, buf
             break;
         }
 
-        offset = (int64)begin.page * DEFAULT_PAGE_SIZE;
+        offset = (int64)(begin.page + first) * DEFAULT_PAGE_SIZE;
         knl_begin_session_wait(session, DB_FILE_SCATTERED_READ, GS_TRUE);
 
-        if (spc_read_datafile(session, df, handle, offset, read_buf, DEFAULT_PAGE_SIZE * count) != GS_SUCCESS) {
+        if (buf_read_datafile(session, df, handle, offset, read_buf, DEFAULT_PAGE_SIZE * (last - first + 1)) !=
+            GS_SUCCESS) {
             GS_LOG_RUN_ERR("[BUFFER] failed to read datafile %s, offset %lld, size %u, error code %d", df->ctrl->name,
-                offset, DEFAULT_PAGE_SIZE * count, errno);
+                offset, DEFAULT_PAGE_SIZE * (last - first + 1), errno);
             spc_close_datafile(df, handle);
             knl_end_session_wait(session);
             status = GS_ERROR;
@@ -1080,13 +1127,13 @@ static status_t buf_batch_load_pages(knl_session_t *session, char *read_buf, buf
                 continue;
             }
             BUF_UNPROTECT_PAGE(ctrl_array[i]->page);
-            ret =
-                memcpy_sp(ctrl_array[i]->page, DEFAULT_PAGE_SIZE, read_buf + i * DEFAULT_PAGE_SIZE, DEFAULT_PAGE_SIZE);
+            ret = memcpy_sp(ctrl_array[i]->page, DEFAULT_PAGE_SIZE, read_buf + (i - first) * DEFAULT_PAGE_SIZE,
+                DEFAULT_PAGE_SIZE);
             knl_securec_check(ret);
 
             if (!buf_check_load_page(session, ctrl_array[i]->page, ctrl_array[i]->page_id, GS_FALSE)) {
                 if (!abr_repair_page_from_standy(session, ctrl_array[i])) {
-                    if (ctrl_array[i]->page_id.page == ctrl->page_id.page) {
+                    if (ctrl_array[i] == ctrl) {
                         /* record alarm log if repair failed */
                         GS_LOG_ALARM(WARN_PAGECORRUPTED, "{'page-type':'%s','space-name':'%s','file-name':'%s'}",
                             page_type(ctrl->page->type), space->ctrl->name, df->ctrl->name);
@@ -1117,7 +1164,7 @@ static status_t buf_batch_load_pages(knl_session_t *session, char *read_buf, buf
         }
 
         /* For the incoming ctrl we do not un_latch it, since the caller wil handl the latch */
-        if (ctrl_array[i]->page_id.page != ctrl->page_id.page) {
+        if (ctrl_array[i] != ctrl) {
             buf_unlatch(session, ctrl_array[i], GS_TRUE);
         }
     }
@@ -1148,7 +1195,7 @@ static status_t buf_load_pages(knl_session_t *session, buf_ctrl_t *ctrl, page_id
     while (total_count > 0) {
         count = total_count < max_count ? total_count : max_count;
 
-        if (buf_batch_load_pages(session, read_buf, ctrl, page_id, count) != GS_SUCCESS) {
+        if (buf_batch_load_pages(session, read_buf, ctrl, page_id, count, ENTER_PAGE_SEQUENTIAL) != GS_SUCCESS) {
             mpool_free_page(session->kernel->attr.large_pool, mpool_page_id);
             return GS_ERROR;
         }
@@ -1161,6 +1208,110 @@ static status_t buf_load_pages(knl_session_t *session, buf_ctrl_t *ctrl, page_id
     return GS_SUCCESS;
 }
 
+/* the read-ahead window of a session is never larger than its buffer */
+static char *buf_get_read_ahead_buf(knl_session_t *session)
+{
+    if (session->read_ahead_buf == NULL) {
+        session->read_ahead_buf = (char *)malloc(BUF_MAX_PREFETCH_NUM * DEFAULT_PAGE_SIZE + GS_MAX_ALIGN_SIZE_4K);
+        if (session->read_ahead_buf == NULL) {
+            return NULL;
+        }
+    }
+    return (char *)cm_aligned_buf(session->read_ahead_buf);
+}
+
+/* load the pages of a read-ahead window not yet in the buffer, failures are left to the later reads */
+static void buf_read_ahead_pages(knl_session_t *session, page_id_t begin, uint32 count, uint32 options)
+{
+    uint32 mpool_page_id = GS_INVALID_ID32;
+    char *read_buf = NULL;
+
+    /* the large pool is shared by all sessions and often used up, each session has its own buffer to fall back on */
+    if (count <= GS_LARGE_PAGE_SIZE / DEFAULT_PAGE_SIZE &&
+        mpool_try_alloc_page(session->kernel->attr.large_pool, &mpool_page_id)) {
+        read_buf = mpool_page_addr(session->kernel->attr.large_pool, mpool_page_id);
+    } else {
+        read_buf = buf_get_read_ahead_buf(session);
+        if (read_buf == NULL) {
+            return;
+        }
+    }
+
+    if (buf_batch_load_pages(session, read_buf, NULL, begin, count, options) != GS_SUCCESS) {
+        GS_LOG_DEBUG_WAR("[BUFFER] failed to read ahead page %u-%u, count %u", (uint32)begin.file,
+            (uint32)begin.page, count);
+        cm_reset_error();
+    }
+
+    if (mpool_page_id != GS_INVALID_ID32) {
+        mpool_free_page(session->kernel->attr.large_pool, mpool_page_id);
+    }
+}
+
+/*
+ * sequential scan read-ahead, called before the scan enters page_id.
+ * after BUF_READ_AHEAD_TRIGGER pages in a row the scan is sequential: the pages from the end of the last
+ * window on are loaded once the scan is half way through it, so it keeps finding them in the buffer.
+ * the window doubles while its pages are still there when the scan gets to them, and halves once they
+ * were evicted first. the scan pages then go to the scan list, not to the main list of the working set.
+ * @return options for entering page_id
+ */
+uint8 buf_read_ahead(knl_session_t *session, knl_read_ahead_t *ra, page_id_t page_id)
+{
+    if (IS_SAME_PAGID(page_id, ra->last)) {
+        return ra->seq_count >= BUF_READ_AHEAD_TRIGGER ? ENTER_PAGE_SEQUENTIAL : ENTER_PAGE_NORMAL;
+    }
+
+    if (page_id.file == ra->last.file && page_id.page == ra->last.page + 1) {
+        ra->seq_count++;
+    } else {
+        ra->seq_count = 0;
+        ra->window = BUF_PREFETCH_UNIT;
+        ra->end = 0;
+    }
+    ra->last = page_id;
+
+    if (ra->seq_count < BUF_READ_AHEAD_TRIGGER) {
+        return ENTER_PAGE_NORMAL;
+    }
+
+    /* async io prefetches the next extent by itself, compressed pages are read in groups */
+    if (session->kernel->attr.enable_asynch || page_compress(session, page_id) ||
+        page_id.page + ra->window / 2 < ra->end) {
+        return ENTER_PAGE_SEQUENTIAL;
+    }
+
+    if (page_id.page < ra->end) {
+        if (buf_find_by_pageid(session, page_id) == NULL) {
+            ra->window = MAX(ra->window / 2, BUF_PREFETCH_UNIT);
+        } else {
+            ra->window = MIN(ra->window * 2, BUF_MAX_PREFETCH_NUM);
+        }
+    }
+
+    datafile_t *df = DATAFILE_GET(page_id.file);
+    space_t *space = SPACE_GET(df->space_id);
+    uint32 hwm = space->head->hwms[df->file_no]; // do not need SPACE_HEAD_RESIDENT
+    page_id_t begin = page_id;
+
+    begin.page = MAX(ra->end, page_id.page + 1);
+    if (begin.page >= hwm) {
+        return ENTER_PAGE_SEQUENTIAL;
+    }
+
+    uint32 count = MIN(ra->window, hwm - begin.page);
+    buf_read_ahead_pages(session, begin, count, ENTER_PAGE_SEQUENTIAL);
+    ra->end = begin.page + count;
+    session->stat.read_ahead_pages += count;
+    return ENTER_PAGE_SEQUENTIAL;
+}
+
+/* load a run of the hot pages saved by the last run to the main list, see buf_warmup_proc */
+void buf_warm_pages(knl_session_t *session, page_id_t begin, uint32 count)
+{
+    buf_read_ahead_pages(session, begin, count, ENTER_PAGE_PROTECTED);
+}
+
 static inline uint32 buf_log_entry_length(knl_session_t *session)
 {
     uint32 size = session->page_stack.log_begin[session->page_stack.depth - 1];
@@ -1532,6 +1683,7 @@ status_t buf_read_page(knl_session_t *session, page_id_t page_id, latch_mode_t m
     session->curr_page = (char *)ctrl->page;
     session->curr_page_ctrl = ctrl;
     session->stat.buffer_gets++;
+    session->stat.buf_set_gets[ctrl->buf_pool_id]++;
 
 #ifdef __PROTECT_BUF__
     if (mode != LATCH_MODE_X && !ctrl->is_readonly) {
@@ -1629,6 +1781,7 @@ status_t buf_read_prefetch_page(knl_session_t *session, page_id_t page_id, latch
     session->curr_page = (char *)ctrl->page;
     session->curr_page_ctrl = ctrl;
     session->stat.buffer_gets++;
+    session->stat.buf_set_gets[ctrl->buf_pool_id]++;
 
 #ifdef _STATISTICS
     stats_buf_record(session, &temp_stat, ctrl);
@@ -1705,6 +1858,7 @@ status_t buf_read_prefetch_page_num(knl_session_t *session, page_id_t page_id, u
     session->curr_page = (char *)ctrl->page;
     session->curr_page_ctrl = ctrl;
     session->stat.buffer_gets++;
+    session->stat.buf_set_gets[ctrl->buf_pool_id]++;
 
 #ifdef _STATISTICS
     stats_buf_record(session, &temp_stat, ctrl);
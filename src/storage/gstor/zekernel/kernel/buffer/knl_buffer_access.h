@@ -70,6 +70,8 @@ status_t buf_read_prefetch_page_num(knl_session_t *session, page_id_t page_id, u
     uint8 options);
 status_t buf_validate_corrupted_page(knl_session_t *session, knl_validate_t *param);
 status_t buf_read_page_asynch(knl_session_t *session, page_id_t page_id);
+uint8 buf_read_ahead(knl_session_t *session, knl_read_ahead_t *ra, page_id_t page_id);
+void buf_warm_pages(knl_session_t *session, page_id_t begin, uint32 count);
 
 void buf_leave_page(knl_session_t *session, bool32 changed);
 void buf_unreside_page(knl_session_t *session, page_id_t page_id);
@@ -0,0 +1,387 @@
+/*
+ * Copyright (c) 2022 Huawei Technologies Co.,Ltd.
+ *
+ * openGauss is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ *          http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ *
+ * knl_buffer_warmup.c
+ *    kernel buffer warm-up, the hot pages of the last run are loaded again after restart
+ *
+ * IDENTIFICATION
+ *    src/storage/gstor/zekernel/kernel/buffer/knl_buffer_warmup.c
+ *
+ * -------------------------------------------------------------------------
+ */
+#include "knl_buffer_warmup.h"
+#include "cm_file.h"
+#include "cm_checksum.h"
+#include "knl_buffer_access.h"
+#include "knl_context.h"
+
+/* at most half of the buffer is warmed up, the other half is left to the workload */
+static uint32 buf_warmup_budget(knl_instance_t *kernel)
+{
+    buf_context_t *ctx = &kernel->buf_ctx;
+    uint64 capacity = 0;
+
+    for (uint32 i = 0; i < ctx->buf_set_count; i++) {
+        capacity += ctx->buf_set[i].capacity;
+    }
+    return (uint32)MIN((uint64)kernel->attr.buf_warmup_pages, capacity / 2);
+}
+
+static void buf_warmup_file_name(knl_instance_t *kernel, char *name, uint32 name_size, const char *suffix)
+{
+    errno_t err = snprintf_s(name, name_size, name_size - 1, "%s/data/%s%s", kernel->home, BUF_WARMUP_FILE_NAME,
+        suffix);
+    knl_securec_check_ss(err);
+}
+
+/*
+ * the hot end of the main list, then the scan list pages touched again, they move to the main list
+ * as soon as recycling passes them (see buf_recycle). the walk is bounded, the list stays locked meanwhile.
+ */
+static uint32 buf_warmup_collect(knl_session_t *session, buf_lru_list_t *list, page_id_t *pages, uint32 max_count)
+{
+    uint32 steps = BUF_WARMUP_WALK_FACTOR * max_count;
+    uint32 count = 0;
+
+    cm_spin_lock(&list->lock, &session->stat_buffer);
+    for (buf_ctrl_t *ctrl = list->lru_first; ctrl != NULL && count < max_count && steps > 0; ctrl = ctrl->next) {
+        steps--;
+        if (IS_INVALID_PAGID(ctrl->page_id) ||
+            (list->type == LRU_LIST_SCAN && ctrl->touch_number < BUF_PROMOTE_TOUCH)) {
+            continue;
+        }
+        pages[count].page = ctrl->page_id.page;
+        pages[count].file = ctrl->page_id.file;
+        pages[count].aligned = 0;
+        count++;
+    }
+    cm_spin_unlock(&list->lock);
+    return count;
+}
+
+static status_t buf_warmup_write(knl_instance_t *kernel, const page_id_t *pages, uint32 count)
+{
+    char file_name[GS_FILE_NAME_BUFFER_SIZE];
+    char tmp_name[GS_FILE_NAME_BUFFER_SIZE];
+    buf_warmup_head_t head;
+    int32 handle = GS_INVALID_HANDLE;
+
+    buf_warmup_file_name(kernel, file_name, GS_FILE_NAME_BUFFER_SIZE, "");
+    buf_warmup_file_name(kernel, tmp_name, GS_FILE_NAME_BUFFER_SIZE, ".tmp");
+
+    head.magic = BUF_WARMUP_MAGIC;
+    head.count = count;
+    head.checksum = cm_get_checksum(pages, count * (uint32)sizeof(page_id_t));
+    head.reserved = 0;
+
+    if (cm_create_file(tmp_name, O_BINARY | O_RDWR | O_TRUNC, &handle) != GS_SUCCESS) {
+        return GS_ERROR;
+    }
+    if (cm_write_file(handle, &head, sizeof(buf_warmup_head_t)) != GS_SUCCESS ||
+        cm_write_file(handle, pages, (int32)(count * sizeof(page_id_t))) != GS_SUCCESS) {
+        cm_close_file(handle);
+        return GS_ERROR;
+    }
+    cm_close_file(handle);
+
+    /* replaced as a whole, a crash while saving leaves the list saved before */
+    return cm_rename_file_durably(tmp_name, file_name);
+}
+
+status_t buf_warmup_save(knl_session_t *session)
+{
+    knl_instance_t *kernel = session->kernel;
+    buf_context_t *ctx = &kernel->buf_ctx;
+    uint32 budget = buf_warmup_budget(kernel);
+    uint32 count = 0;
+
+    if (budget == 0) {
+        return GS_SUCCESS;
+    }
+
+    uint64 size = (uint64)budget * sizeof(page_id_t);
+    page_id_t *pages = (page_id_t *)malloc(size);
+    if (pages == NULL) {
+        GS_THROW_ERROR(ERR_ALLOC_MEMORY, size, "buffer warm-up list");
+        return GS_ERROR;
+    }
+
+    /* pages are spread over the sets by hash, each set keeps its share of the budget */
+    uint32 set_budget = MAX(budget / ctx->buf_set_count, 1);
+    for (uint32 i = 0; i < ctx->buf_set_count && count < budget; i++) {
+        buf_set_t *set = &ctx->buf_set[i];
+        uint32 set_count = buf_warmup_collect(session, &set->main_list, pages + count,
+            MIN(set_budget, budget - count));
+        set_count += buf_warmup_collect(session, &set->scan_list, pages + count + set_count,
+            MIN(set_budget, budget - count) - set_count);
+        count += set_count;
+    }
+
+    status_t status = buf_warmup_write(kernel, pages, count);
+    free(pages);
+    if (status == GS_SUCCESS) {
+        GS_LOG_DEBUG_INF("[BUFFER] saved %u hot pages for warm-up", count);
+    }
+    return status;
+}
+
+/* called by checkpoint thread, the list is kept fresh for a restart after a crash */
+void buf_warmup_try_save(knl_session_t *session)
+{
+    buf_warmup_ctx_t *ctx = &session->kernel->buf_ctx.warmup;
+
+    if (!ctx->enabled || !ctx->finished ||
+        KNL_NOW(session) - ctx->save_time < (date_t)BUF_WARMUP_SAVE_INTERVAL * MICROSECS_PER_SECOND) {
+        return;
+    }
+
+    if (!cm_spin_try_lock(&ctx->lock)) {
+        return;
+    }
+    /* closed meanwhile, the list has been saved at shutdown */
+    if (!ctx->enabled) {
+        cm_spin_unlock(&ctx->lock);
+        return;
+    }
+    ctx->save_time = KNL_NOW(session);
+    if (buf_warmup_save(session) != GS_SUCCESS) {
+        GS_LOG_RUN_WAR("[BUFFER] failed to save hot pages for warm-up");
+        cm_reset_error();
+    }
+    cm_spin_unlock(&ctx->lock);
+}
+
+static status_t buf_warmup_read(knl_session_t *session, page_id_t **pages, uint32 *count)
+{
+    char file_name[GS_FILE_NAME_BUFFER_SIZE];
+    buf_warmup_head_t head;
+    int32 handle = GS_INVALID_HANDLE;
+    int32 read_size = 0;
+
+    buf_warmup_file_name(session->kernel, file_name, GS_FILE_NAME_BUFFER_SIZE, "");
+    if (cm_open_file(file_name, O_BINARY | O_RDONLY, &handle) != GS_SUCCESS) {
+        return GS_ERROR;
+    }
+
+    if (cm_read_file(handle, &head, sizeof(buf_warmup_head_t), &read_size) != GS_SUCCESS ||
+        read_size != (int32)sizeof(buf_warmup_head_t) || head.magic != BUF_WARMUP_MAGIC ||
+        head.count > GS_MAX_INT32 / sizeof(page_id_t)) {
+        GS_LOG_RUN_WAR("[BUFFER] invalid warm-up file %s", file_name);
+        cm_close_file(handle);
+        return GS_ERROR;
+    }
+
+    int32 size = (int32)(head.count * sizeof(page_id_t));
+    *pages = (page_id_t *)malloc(MAX(size, 1));
+    if (*pages == NULL) {
+        GS_THROW_ERROR(ERR_ALLOC_MEMORY, (uint64)size, "buffer warm-up list");
+        cm_close_file(handle);
+        return GS_ERROR;
+    }
+
+    if (cm_read_file(handle, *pages, size, &read_size) != GS_SUCCESS || read_size != size ||
+        cm_get_checksum(*pages, (uint32)size) != head.checksum) {
+        GS_LOG_RUN_WAR("[BUFFER] invalid warm-up file %s", file_name);
+        CM_FREE_PTR(*pages);
+        cm_close_file(handle);
+        return GS_ERROR;
+    }
+    cm_close_file(handle);
+    *count = head.count;
+    return GS_SUCCESS;
+}
+
+static int32 buf_warmup_comparator(const void *pa, const void *pb)
+{
+    const page_id_t *a = (const page_id_t *)pa;
+    const page_id_t *b = (const page_id_t *)pb;
+
+    if (a->file != b->file) {
+        return a->file < b->file ? -1 : 1;
+    }
+    if (a->page != b->page) {
+        return a->page < b->page ? -1 : 1;
+    }
+    return 0;
+}
+
+/* the pages of a run that can still be loaded, the list may be older than a drop or shrink of its files */
+static uint32 buf_warmup_run_pages(knl_session_t *session, page_id_t begin, uint32 count)
+{
+    if (begin.file >= GS_MAX_DATA_FILES) {
+        return 0;
+    }
+
+    datafile_t *df = DATAFILE_GET(begin.file);
+    if (!df->ctrl->used || !DATAFILE_IS_ONLINE(df) || df->in_memory) {
+        return 0;
+    }
+
+    space_t *space = SPACE_GET(df->space_id);
+    if (!SPACE_IS_ONLINE(space) || SPACE_IS_NOLOGGING(space) || IS_SWAP_SPACE(space) || space->head == NULL ||
+        page_compress(session, begin)) {
+        return 0;
+    }
+
+    uint32 hwm = space->head->hwms[df->file_no]; // do not need SPACE_HEAD_RESIDENT
+    if (begin.page >= hwm) {
+        return 0;
+    }
+    return MIN(count, hwm - begin.page);
+}
+
+/* once every buffer ctrl is used, loading more pages would only evict the pages of the workload */
+static bool32 buf_warmup_has_free(knl_instance_t *kernel)
+{
+    buf_context_t *ctx = &kernel->buf_ctx;
+
+    for (uint32 i = 0; i < ctx->buf_set_count; i++) {
+        if (ctx->buf_set[i].hwm < ctx->buf_set[i].capacity) {
+            return GS_TRUE;
+        }
+    }
+    return GS_FALSE;
+}
+
+/*
+ * load the pages in file order, runs of adjacent pages are read in one batch.
+ * @return GS_TRUE if the whole list was loaded
+ */
+static bool32 buf_warmup_load(thread_t *thread, knl_session_t *session, page_id_t *pages, uint32 count)
+{
+    buf_warmup_ctx_t *ctx = &session->kernel->buf_ctx.warmup;
+    uint32 i = 0;
+
+    qsort(pages, count, sizeof(page_id_t), buf_warmup_comparator);
+
+    while (i < count) {
+        if (thread->closed) {
+            return GS_FALSE;
+        }
+        if (!buf_warmup_has_free(session->kernel)) {
+            break;
+        }
+
+        uint32 run = 1;
+        while (i + run < count && run < BUF_MAX_PREFETCH_NUM && pages[i + run].file == pages[i].file &&
+            pages[i + run].page == pages[i].page + run) {
+            run++;
+        }
+
+        uint32 valid = buf_warmup_run_pages(session, pages[i], run);
+        if (valid > 0) {
+            buf_warm_pages(session, pages[i], valid);
+            ctx->loaded_pages += valid;
+        }
+
+        /* duplicated ids are skipped with their run */
+        i += run;
+        while (i < count && IS_SAME_PAGID(pages[i], pages[i - 1])) {
+            i++;
+        }
+    }
+    return GS_TRUE;
+}
+
+static void buf_warmup_proc(thread_t *thread)
+{
+    knl_session_t *session = (knl_session_t *)thread->argument;
+    buf_warmup_ctx_t *ctx = &session->kernel->buf_ctx.warmup;
+    uint32 budget = buf_warmup_budget(session->kernel);
+    page_id_t *pages = NULL;
+    uint32 count = 0;
+
+    cm_set_thread_name("buf_warmup");
+    KNL_SESSION_SET_CURR_THREADID(session, cm_get_current_thread_id());
+
+    date_t begin = KNL_NOW(session);
+    if (buf_warmup_read(session, &pages, &count) != GS_SUCCESS) {
+        cm_reset_error();
+        ctx->finished = GS_TRUE;
+    } else {
+        /* the hottest pages of each set come first, a smaller budget keeps them */
+        count = MIN(count, budget);
+        if (buf_warmup_load(thread, session, pages, count)) {
+            ctx->finished = GS_TRUE;
+        }
+        GS_LOG_RUN_INF("[BUFFER] warm-up loaded %u of %u saved pages in %lld ms", ctx->loaded_pages, count,
+            (int64)(KNL_NOW(session) - begin) / MICROSECS_PER_MILLISEC);
+        CM_FREE_PTR(pages);
+    }
+
+    for (uint32 i = 0; i < GS_MAX_DATA_FILES; i++) {
+        if (session->datafiles[i] != GS_INVALID_HANDLE) {
+            spc_close_datafile(DATAFILE_GET(i), &session->datafiles[i]);
+        }
+    }
+    KNL_SESSION_CLEAR_THREADID(session);
+    g_knl_callback.release_knl_session(session);
+}
+
+/*
+ * called once the database is open, the saved pages are loaded in background while sessions
+ * are already served, a page wanted by a session before is simply found in the buffer later
+ */
+void buf_warmup_start(knl_session_t *session)
+{
+    knl_instance_t *kernel = session->kernel;
+    buf_warmup_ctx_t *ctx = &kernel->buf_ctx.warmup;
+    knl_session_t *warmup_session = NULL;
+    char file_name[GS_FILE_NAME_BUFFER_SIZE];
+
+    ctx->lock = 0;
+    ctx->loaded_pages = 0;
+    ctx->save_time = KNL_NOW(session);
+    ctx->finished = GS_TRUE;
+    ctx->enabled = (buf_warmup_budget(kernel) > 0);
+
+    buf_warmup_file_name(kernel, file_name, GS_FILE_NAME_BUFFER_SIZE, "");
+    if (!ctx->enabled || !cm_file_exist(file_name)) {
+        return;
+    }
+
+    if (g_knl_callback.alloc_knl_session(kernel->server, GS_TRUE, (knl_handle_t *)&warmup_session) != GS_SUCCESS) {
+        GS_LOG_RUN_WAR("[BUFFER] failed to alloc session for buffer warm-up");
+        cm_reset_error();
+        return;
+    }
+
+    ctx->finished = GS_FALSE;
+    if (cm_create_thread(buf_warmup_proc, 0, warmup_session, &ctx->thread) != GS_SUCCESS) {
+        GS_LOG_RUN_WAR("[BUFFER] failed to start buffer warm-up");
+        cm_reset_error();
+        g_knl_callback.release_knl_session(warmup_session);
+        ctx->finished = GS_TRUE;
+    }
+}
+
+/* stop loading and save the list for the next start, unless loading was cut short by the shutdown */
+void buf_warmup_close(knl_session_t *session)
+{
+    buf_warmup_ctx_t *ctx = &session->kernel->buf_ctx.warmup;
+
+    cm_close_thread(&ctx->thread);
+    if (!ctx->enabled) {
+        return;
+    }
+
+    cm_spin_lock(&ctx->lock, NULL);
+    ctx->enabled = GS_FALSE;
+    if (ctx->finished && buf_warmup_save(session) != GS_SUCCESS) {
+        GS_LOG_RUN_WAR("[BUFFER] failed to save hot pages for warm-up");
+        cm_reset_error();
+    }
+    cm_spin_unlock(&ctx->lock);
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2022 Huawei Technologies Co.,Ltd.
+ *
+ * openGauss is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ * http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ *
+ * knl_buffer_warmup.h
+ * kernel buffer warm-up definitions
+ *
+ * IDENTIFICATION
+ * src/storage/gstor/zekernel/kernel/buffer/knl_buffer_warmup.h
+ *
+ * -------------------------------------------------------------------------
+ */
+#ifndef __KNL_BUFFER_WARMUP_H__
+#define __KNL_BUFFER_WARMUP_H__
+
+#include "knl_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BUF_WARMUP_FILE_NAME "buf_warmup"
+#define BUF_WARMUP_MAGIC (uint32)0x42574D55
+#define BUF_WARMUP_SAVE_INTERVAL 300 // seconds, the hot page list is saved by checkpoint at most this often
+#define BUF_WARMUP_WALK_FACTOR 4     // ctrls walked in a LRU list for each page id saved at most
+
+typedef struct st_buf_warmup_head {
+    uint32 magic;
+    uint32 count;    // page ids following the head, the hottest of each buffer set first
+    uint32 checksum; // of the page ids
+    uint32 reserved;
+} buf_warmup_head_t;
+
+void buf_warmup_start(knl_session_t *session);
+void buf_warmup_close(knl_session_t *session);
+void buf_warmup_try_save(knl_session_t *session);
+status_t buf_warmup_save(knl_session_t *session);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
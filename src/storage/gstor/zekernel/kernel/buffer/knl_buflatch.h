@@ -45,6 +45,43 @@ static inline void buf_stat_page_inc(knl_session_t *session, uint32 count)
     }
 }
 
+/*
+ * buffer latch is changed by compare-and-swap on the whole latch word. exclusive latch is still taken with bucket
+ * lock held, while shared latch can be taken without it (see buf_alloc_ctrl) and unlatch never needs it.
+ */
+static inline bool32 buf_latch_try_s(buf_latch_t *latch, uint16 sid, bool32 is_force)
+{
+    buf_latch_t old_latch, new_latch;
+
+    for (;;) {
+        old_latch.value = cm_atomic_get(&latch->value);
+        new_latch.value = old_latch.value;
+        if (old_latch.stat == LATCH_STATUS_IDLE) {
+            new_latch.stat = LATCH_STATUS_S;
+            new_latch.shared_count = 1;
+            new_latch.sid = sid;
+        } else if ((old_latch.stat == LATCH_STATUS_S) || (old_latch.stat == LATCH_STATUS_IX && is_force)) {
+            new_latch.shared_count++;
+        } else {
+            return GS_FALSE;
+        }
+
+        if (cm_atomic_cas(&latch->value, old_latch.value, new_latch.value)) {
+            return GS_TRUE;
+        }
+    }
+}
+
+static inline bool32 buf_latch_change_stat(buf_latch_t *latch, buf_latch_t old_latch, uint16 stat, uint16 sid)
+{
+    buf_latch_t new_latch;
+
+    new_latch.value = old_latch.value;
+    new_latch.stat = stat;
+    new_latch.sid = sid;
+    return cm_atomic_cas(&latch->value, old_latch.value, new_latch.value);
+}
+
 /* buffer latch interface */
 static inline void buf_latch_ix2x(knl_session_t *session, buf_latch_t *latch, spinlock_t *lock)
 {
@@ -63,9 +100,10 @@ static inline void buf_latch_ix2x(knl_session_t *session, buf_latch_t *latch, sp
         }
 
         cm_spin_lock(lock, &session->stat_bucket);
-        if (latch->shared_count == 0) {
-            latch->sid = session->id;
-            latch->stat = LATCH_STATUS_X;
+        buf_latch_t old_latch;
+        old_latch.value = cm_atomic_get(&latch->value);
+        if (old_latch.shared_count == 0 &&
+            buf_latch_change_stat(latch, old_latch, LATCH_STATUS_X, (uint16)session->id)) {
             cm_spin_unlock(lock);
             buf_stat_page_inc(session, count);
             knl_try_end_session_wait(session, BUFFER_BUSY_WAIT);
@@ -87,15 +125,21 @@ static inline void buf_latch_x(knl_session_t *session, buf_ctrl_t *ctrl, bool32
     }
 
     do {
-        if (latch->stat == LATCH_STATUS_IDLE) {
-            latch->sid = session->id;
-            latch->stat = LATCH_STATUS_X;
+        buf_latch_t old_latch;
+        old_latch.value = cm_atomic_get(&latch->value);
+        if (old_latch.stat == LATCH_STATUS_IDLE) {
+            /* shared latch may be taken without bucket lock meanwhile, retry then */
+            if (!buf_latch_change_stat(latch, old_latch, LATCH_STATUS_X, (uint16)session->id)) {
+                continue;
+            }
             cm_spin_unlock(&bucket->lock);
             buf_stat_page_inc(session, count);
             knl_try_end_session_wait(session, BUFFER_BUSY_WAIT);
             return;
-        } else if (latch->stat == LATCH_STATUS_S) {
-            latch->stat = LATCH_STATUS_IX;
+        } else if (old_latch.stat == LATCH_STATUS_S) {
+            if (!buf_latch_change_stat(latch, old_latch, LATCH_STATUS_IX, old_latch.sid)) {
+                continue;
+            }
             cm_spin_unlock(&bucket->lock);
             buf_latch_ix2x(session, latch, &bucket->lock);
             return;
@@ -128,16 +172,7 @@ static inline void buf_latch_s(knl_session_t *session, buf_ctrl_t *ctrl, bool32
     }
 
     do {
-        if (latch->stat == LATCH_STATUS_IDLE) {
-            latch->stat = LATCH_STATUS_S;
-            latch->shared_count = 1;
-            latch->sid = session->id;
-            cm_spin_unlock(&bucket->lock);
-            buf_stat_page_inc(session, count);
-            knl_try_end_session_wait(session, BUFFER_BUSY_WAIT);
-            return;
-        } else if ((latch->stat == LATCH_STATUS_S) || (latch->stat == LATCH_STATUS_IX && is_force)) {
-            latch->shared_count++;
+        if (buf_latch_try_s(latch, (uint16)session->id, is_force)) {
             cm_spin_unlock(&bucket->lock);
             buf_stat_page_inc(session, count);
             knl_try_end_session_wait(session, BUFFER_BUSY_WAIT);
@@ -178,14 +213,7 @@ static inline bool32 buf_latch_timed_s(knl_session_t *session, buf_ctrl_t *ctrl,
     }
 
     do {
-        if (latch->stat == LATCH_STATUS_IDLE) {
-            latch->stat = LATCH_STATUS_S;
-            latch->shared_count = 1;
-            latch->sid = session->id;
-            cm_spin_unlock(&bucket->lock);
-            return GS_TRUE;
-        } else if ((latch->stat == LATCH_STATUS_S) || (latch->stat == LATCH_STATUS_IX && is_force)) {
-            latch->shared_count++;
+        if (buf_latch_try_s(latch, (uint16)session->id, is_force)) {
             cm_spin_unlock(&bucket->lock);
             return GS_TRUE;
         } else {
@@ -208,33 +236,29 @@ static inline bool32 buf_latch_timed_s(knl_session_t *session, buf_ctrl_t *ctrl,
     } while (1);
 }
 
+/* the latch is released before the pin, a pinned ctrl can not be expired whatever its latch is */
 static inline void buf_unlatch(knl_session_t *session, buf_ctrl_t *ctrl, bool32 release)
 {
-    buf_set_t *set;
-    buf_bucket_t *bucket;
-    buf_latch_t *latch;
-
-    set = &session->kernel->buf_ctx.buf_set[ctrl->buf_pool_id];
-    bucket = BUF_GET_BUCKET(set, ctrl->bucket_id);
-    latch = &ctrl->latch;
+    buf_latch_t *latch = &ctrl->latch;
+    buf_latch_t old_latch, new_latch;
 
-    cm_spin_lock(&bucket->lock, &session->stat_bucket);
+    do {
+        old_latch.value = cm_atomic_get(&latch->value);
+        new_latch.value = old_latch.value;
+        if (new_latch.shared_count > 0) {
+            new_latch.shared_count--;
+        }
 
-    if (latch->shared_count > 0) {
-        latch->shared_count--;
-    }
+        if ((new_latch.stat == LATCH_STATUS_S || new_latch.stat == LATCH_STATUS_X) && (new_latch.shared_count == 0)) {
+            new_latch.stat = LATCH_STATUS_IDLE;
+        }
+    } while (!cm_atomic_cas(&latch->value, old_latch.value, new_latch.value));
 
     if (release) {
         knl_panic_log(ctrl->ref_num > 0, "ctrl's ref_num is invalid, panic info: page %u-%u type %u ref_num %u",
             ctrl->page_id.file, ctrl->page_id.page, ctrl->page->type, ctrl->ref_num);
-        ctrl->ref_num--;
-    }
-
-    if ((latch->stat == LATCH_STATUS_S || latch->stat == LATCH_STATUS_X) && (latch->shared_count == 0)) {
-        latch->stat = LATCH_STATUS_IDLE;
+        buf_unpin_ctrl(ctrl);
     }
-
-    cm_spin_unlock(&bucket->lock);
 }
 
 #ifdef __cplusplus
@@ -23,6 +23,7 @@
  */
 #include "knl_context.h"
 #include "cm_file.h"
+#include "cm_uring.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -163,6 +164,11 @@ status_t db_load_lib(knl_session_t *session)
         GS_LOG_RUN_ERR("[DB] It is not support async io");
         return GS_ERROR;
     }
+
+    if (session->kernel->attr.enable_io_uring && !cm_uring_supported()) {
+        GS_LOG_RUN_WAR("[DB] io_uring is not available, IO_ENGINE falls back to SYNC");
+        session->kernel->attr.enable_io_uring = GS_FALSE;
+    }
 #ifdef _REPLICATION
     session->kernel->gbp_aly_ctx.sid = GS_INVALID_ID32;
 
@@ -176,6 +182,45 @@ status_t db_load_lib(knl_session_t *session)
     return GS_SUCCESS;
 }
 
+static void knl_log_uring_error(const char *owner, const char *action)
+{
+    int32 code = 0;
+    const char *message = NULL;
+
+    cm_get_error(&code, &message, NULL);
+    GS_LOG_RUN_WAR("[DB] %s failed to %s io_uring, code %d, %s", owner, action, code,
+        message == NULL ? "" : message);
+    cm_reset_error();
+}
+
+cm_uring_t *knl_create_uring(const char *owner, uint32 entries, char **addrs, const uint64 *sizes, uint32 count)
+{
+    cm_uring_t *ring = NULL;
+
+    if (cm_uring_create(entries, &ring) != GS_SUCCESS) {
+        knl_log_uring_error(owner, "set up");
+        return NULL;
+    }
+
+    /* without fixed buffers the pages are pinned per request, slower but still correct */
+    if (count > 0 && cm_uring_register_buffers(ring, addrs, sizes, count) != GS_SUCCESS) {
+        knl_log_uring_error(owner, "register buffers with");
+    }
+    return ring;
+}
+
+bool32 knl_drop_broken_uring(const char *owner, cm_uring_t **ring, bool32 *failed)
+{
+    if (*ring == NULL || !cm_uring_is_broken(*ring)) {
+        return GS_FALSE;
+    }
+
+    GS_LOG_RUN_WAR("[DB] %s gives up io_uring and goes on with synchronous io", owner);
+    cm_uring_destroy(ring);
+    *failed = GS_TRUE;
+    return GS_TRUE;
+}
+
 uint32 knl_io_flag(knl_session_t *session)
 {
     if (session->kernel->attr.enable_asynch) {
@@ -219,6 +264,18 @@ uint32 knl_redo_io_flag(knl_session_t *session)
     return flag;
 }
 
+/* the online log handles are shared with the log writer. with io_uring it makes its writes durable with an
+ * fdatasync linked to them, so the handles skip O_SYNC and every write through them uses log_write_device */
+uint32 knl_online_redo_io_flag(knl_session_t *session)
+{
+    uint32 flag = knl_redo_io_flag(session);
+
+    if (session->kernel->attr.enable_io_uring) {
+        flag &= ~(uint32)(O_SYNC | O_DSYNC);
+    }
+    return flag;
+}
+
 #ifdef __cplusplus
 }
 #endif
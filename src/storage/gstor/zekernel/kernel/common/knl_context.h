@@ -39,6 +39,8 @@
 #endif
 #include "knl_smon.h"
 #include "knl_rmon.h"
+#include "knl_retention.h"
+#include "knl_kv_expire.h"
 #include "knl_ashrink.h"
 #ifdef _REPLICATION
 #include "repl_log_recv.h"
@@ -82,6 +84,7 @@ typedef struct st_knl_attr {
 
     uint32 default_extents;
     uint32 buf_pool_num;
+    uint32 buf_warmup_pages; // hot pages saved for and loaded after restart, 0 disables buffer warm-up
     uint64 data_buf_size;
     uint64 data_buf_part_size;
     uint64 data_buf_part_align_size;
@@ -140,6 +143,7 @@ typedef struct st_knl_attr {
     bool32 enable_directIO;
     bool32 enable_logdirectIO;
     bool32 enable_asynch;
+    bool32 enable_io_uring; // page reads on buffer miss, dbwr flushes and redo writes go through io_uring
     bool32 enable_dsync;
     bool32 enable_fdatasync;
     bool32 enable_OSYNC;
@@ -298,6 +302,13 @@ typedef struct st_knl_attr {
     uint32 dbwr_fsync_timeout;
     uint32 isolation_level;
     bool32 enable_ts_update; // 时序表支持update操作开关
+    uint32 part_retention_interval;  // seconds between two retention rounds, 0 means disabled
+    uint32 part_retention_max_drops; // max expired partitions dropped in one retention round
+    uint32 kv_expire_interval;       // seconds between two kv expire rounds, 0 means disabled
+    uint32 kv_expire_batch;          // max expired kv keys deleted in one transaction
+    uint32 commit_delay;      // us the commit leader waits for more committers before flushing, 0 means disabled
+    uint32 commit_siblings;   // min other active transactions to delay the flush
+    uint32 commit_batch_size; // stop delaying once so many sessions are queued
 } knl_attr_t;
 
 typedef struct st_sys_name_context {  // for system name
@@ -347,6 +358,8 @@ typedef struct st_knl_instance {
     lob_area_t lob_ctx;
     smon_t smon_ctx;    // system monitor
     rmon_t rmon_ctx;    // resource monitor 
+    retention_t retention_ctx;    // partition retention
+    kv_expire_t kv_expire_ctx;    // kv key expiration
 #ifdef _STATISTICS
     stats_t stats_ctx;
 #endif
@@ -457,6 +470,11 @@ static inline bool32 page_compress(knl_session_t *session, page_id_t page_id)
 
 uint32 knl_io_flag(knl_session_t *session);
 uint32 knl_redo_io_flag(knl_session_t *session);
+uint32 knl_online_redo_io_flag(knl_session_t *session);
+/* NULL if the ring can not be set up, the failure is logged and the caller keeps to synchronous io */
+cm_uring_t *knl_create_uring(const char *owner, uint32 entries, char **addrs, const uint64 *sizes, uint32 count);
+/* destroys a ring that could not be entered any more and sets failed, GS_TRUE if it did */
+bool32 knl_drop_broken_uring(const char *owner, cm_uring_t **ring, bool32 *failed);
 
 status_t db_fdatasync_file(knl_session_t *session, int32 file);
 status_t db_fsync_file(knl_session_t *session, int32 file);
@@ -29,6 +29,7 @@
 #include "cm_charset.h"
 #include "cm_atomic.h"
 #include "cm_thread.h"
+#include "cm_uring.h"
 #include "knl_interface.h"
 #include "mtrl_defs.h"
 #ifdef DB_DEBUG_VERSION
@@ -106,7 +107,10 @@ typedef struct st_knl_stat {
     uint64 disk_write_time;
     uint64 temp_allocs;
     uint64 aio_reads;
+    uint64 read_ahead_pages;
     uint64 buffer_gets;
+    uint64 buf_set_gets[GS_MAX_BUF_POOL_NUM];
+    uint64 buf_set_misses[GS_MAX_BUF_POOL_NUM]; // pages entered but not found in the buffer set
     uint64 buffer_recycle_cnt;
     uint64 buffer_recycle_wait;
     uint64 buffer_recycle_step;
@@ -317,6 +321,9 @@ typedef struct st_knl_session {
     cm_stack_t *stack;
     knl_match_cond_t match_cond;
     int32 datafiles[GS_MAX_DATA_FILES];  // data file handles
+    cm_uring_t *uring;                   // reads pages on buffer miss with IO_ENGINE io_uring, set up on first use
+    bool32 uring_failed;                 // the ring could not be set up, reads stay synchronous
+    char *read_ahead_buf;                // read-ahead window buffer when the large pool has no page left
     knl_stat_t stat;
     knl_session_wait_t wait;
     knl_buf_wait_t buf_wait[WAITSTAT_COUNT];
@@ -0,0 +1,421 @@
+/*
+ * Copyright (c) 2022 Huawei Technologies Co.,Ltd.
+ *
+ * openGauss is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ * http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ *
+ * knl_kv_expire.c
+ * kernel kv key expiration daemon
+ *
+ * IDENTIFICATION
+ * src/storage/gstor/zekernel/kernel/daemon/knl_kv_expire.c
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "knl_kv_expire.h"
+#include "knl_context.h"
+#include "knl_table.h"
+
+#define KV_EXPIRE_SLEEP_TIME 200  // ms
+
+#define KV_EXPIRE_COL_NAME   "EXPIRE"
+#define KV_EXPIRE_MIN_INDEXES 2    // the key index and the expire index
+
+typedef struct st_kv_expire_layout {
+    uint32 col_id;       // EXPIRE column, unix time(us) the key expires at
+    uint32 index_slot;   // index on the EXPIRE column alone
+} kv_expire_layout_t;
+
+static inline int64 kv_expire_unix_now(void)
+{
+    struct timeval tv;
+
+    (void)cm_gettimeofday(&tv);
+    return (int64)tv.tv_sec * MICROSECS_PER_SECOND_LL + (int64)tv.tv_usec;
+}
+
+/*
+ * a table takes part in expiration when it has a bigint EXPIRE column and an index on that
+ * column alone, which keeps the keys in expiration order. gstor creates the index on the
+ * first setex of a table, tables never using ttl have none.
+ */
+static bool32 kv_expire_get_layout(knl_dictionary_t *dc, kv_expire_layout_t *layout)
+{
+    knl_column_t *column = NULL;
+    knl_index_desc_t *index = NULL;
+
+    if (dc->type != DICT_TYPE_TABLE && dc->type != DICT_TYPE_TABLE_NOLOGGING) {
+        return GS_FALSE;
+    }
+
+    layout->col_id = GS_INVALID_ID32;
+    for (uint32 i = 0; i < knl_get_column_count(dc->handle); i++) {
+        column = knl_get_column(dc->handle, i);
+        if (cm_str_equal(column->name, KV_EXPIRE_COL_NAME) && column->datatype == GS_TYPE_BIGINT) {
+            layout->col_id = i;
+            break;
+        }
+    }
+
+    if (layout->col_id == GS_INVALID_ID32) {
+        return GS_FALSE;
+    }
+
+    for (uint32 i = 0; i < knl_get_index_count(dc->handle); i++) {
+        index = knl_get_index(dc->handle, i);
+        if (index->column_count == 1 && index->columns[0] == layout->col_id) {
+            layout->index_slot = i;
+            return GS_TRUE;
+        }
+    }
+    return GS_FALSE;
+}
+
+static bool32 kv_expire_find_table(kv_expire_t *ctx, uint32 uid, uint32 oid, uint32 *pos)
+{
+    for (uint32 i = 0; i < ctx->table_count; i++) {
+        if (ctx->tables[i].uid == uid && ctx->tables[i].oid == oid) {
+            *pos = i;
+            return GS_TRUE;
+        }
+    }
+    return GS_FALSE;
+}
+
+/*
+ * hand a table with an expire index to the daemon, called by gstor once the index is created
+ */
+void kv_expire_register(knl_session_t *session, uint32 uid, uint32 oid)
+{
+    kv_expire_t *ctx = &session->kernel->kv_expire_ctx;
+    uint32 pos;
+
+    cm_spin_lock(&ctx->lock, NULL);
+    if (kv_expire_find_table(ctx, uid, oid, &pos)) {
+        cm_spin_unlock(&ctx->lock);
+        return;
+    }
+
+    if (ctx->table_count >= KV_EXPIRE_MAX_TABLES) {
+        cm_spin_unlock(&ctx->lock);
+        GS_LOG_RUN_WAR("[KV EXPIRE] too many ttl tables, expired keys of table %u.%u are not deleted", uid, oid);
+        return;
+    }
+
+    ctx->tables[ctx->table_count].uid = uid;
+    ctx->tables[ctx->table_count].oid = oid;
+    ctx->table_count++;
+    ctx->idle_rounds = 0;
+    cm_spin_unlock(&ctx->lock);
+}
+
+static void kv_expire_unregister(kv_expire_t *ctx, uint32 uid, uint32 oid)
+{
+    uint32 pos;
+
+    cm_spin_lock(&ctx->lock, NULL);
+    if (kv_expire_find_table(ctx, uid, oid, &pos)) {
+        ctx->table_count--;
+        ctx->tables[pos] = ctx->tables[ctx->table_count];
+    }
+    cm_spin_unlock(&ctx->lock);
+}
+
+static void kv_expire_record_error(kv_expire_t *ctx, uint32 uid, uint32 oid)
+{
+    int32 code = 0;
+    const char *message = NULL;
+
+    cm_get_error(&code, &message, NULL);
+    GS_LOG_RUN_WAR("[KV EXPIRE] failed to delete expired keys of table %u.%u, code %d, %s",
+        uid, oid, code, message == NULL ? "" : message);
+
+    cm_spin_lock(&ctx->lock, NULL);
+    ctx->failed_batches++;
+    ctx->last_errcode = code;
+    if (message != NULL) {
+        (void)strncpy_s(ctx->last_errmsg, GS_MESSAGE_BUFFER_SIZE, message,
+            MIN(strlen(message), GS_MESSAGE_BUFFER_SIZE - 1));
+    }
+    cm_spin_unlock(&ctx->lock);
+    cm_reset_error();
+}
+
+/*
+ * the ttl tables of the last run and SYS_KV, which has its expire index from bootstrap, are found
+ * once after startup from SYS_TABLES. later ones are registered by gstor on their first setex.
+ */
+static status_t kv_expire_load_tables(knl_session_t *session)
+{
+    knl_cursor_t *cursor = NULL;
+    knl_dictionary_t dc;
+    kv_expire_layout_t layout;
+    uint32 oid;
+
+    CM_SAVE_STACK(session->stack);
+
+    knl_set_session_scn(session, GS_INVALID_ID64);
+    cursor = knl_push_cursor(session);
+    knl_open_sys_cursor(session, cursor, CURSOR_ACTION_SELECT, SYS_TABLE_ID, GS_INVALID_ID32);
+
+    if (knl_fetch(session, cursor) != GS_SUCCESS) {
+        CM_RESTORE_STACK(session->stack);
+        return GS_ERROR;
+    }
+
+    while (!cursor->eof) {
+        oid = *(uint32 *)CURSOR_COLUMN_DATA(cursor, SYS_TABLE_COL_ID);
+        if (*(uint32 *)CURSOR_COLUMN_DATA(cursor, SYS_TABLE_COL_USER_ID) == DB_SYS_USER_ID &&
+            *(uint32 *)CURSOR_COLUMN_DATA(cursor, SYS_TABLE_COL_INDEXES) >= KV_EXPIRE_MIN_INDEXES) {
+            if (knl_open_dc_by_id(session, DB_SYS_USER_ID, oid, &dc, GS_TRUE) == GS_SUCCESS) {
+                if (kv_expire_get_layout(&dc, &layout)) {
+                    kv_expire_register(session, DB_SYS_USER_ID, oid);
+                }
+                dc_close(&dc);
+            } else {
+                cm_reset_error();
+            }
+        }
+
+        if (knl_fetch(session, cursor) != GS_SUCCESS) {
+            CM_RESTORE_STACK(session->stack);
+            return GS_ERROR;
+        }
+    }
+
+    CM_RESTORE_STACK(session->stack);
+    return GS_SUCCESS;
+}
+
+/*
+ * delete at most batch keys expired before now in one transaction. the scan walks the
+ * expire index from the oldest expiration, keys without ttl (NULL) sort last and are never reached.
+ */
+static status_t kv_expire_delete_batch(knl_session_t *session, knl_dictionary_t *dc, kv_expire_layout_t *layout,
+    int64 now, uint32 batch, uint32 *deleted)
+{
+    knl_cursor_t *cursor = NULL;
+    uint32 size;
+
+    *deleted = 0;
+    CM_SAVE_STACK(session->stack);
+
+    knl_set_session_scn(session, GS_INVALID_ID64);
+    cursor = knl_push_cursor(session);
+    cursor->action = CURSOR_ACTION_DELETE;
+    cursor->scan_mode = SCAN_MODE_INDEX;
+    cursor->index_slot = layout->index_slot;
+    if (knl_open_cursor(session, cursor, dc) != GS_SUCCESS) {
+        CM_RESTORE_STACK(session->stack);
+        return GS_ERROR;
+    }
+
+    knl_init_index_scan(cursor, GS_FALSE);
+    knl_set_key_flag(&cursor->scan_range.l_key, SCAN_KEY_LEFT_INFINITE, 0);
+    knl_set_scan_key(INDEX_DESC(cursor->index), &cursor->scan_range.r_key, GS_TYPE_BIGINT, &now, sizeof(int64), 0);
+
+    while (*deleted < batch) {
+        if (knl_fetch(session, cursor) != GS_SUCCESS) {
+            knl_close_cursor(session, cursor);
+            CM_RESTORE_STACK(session->stack);
+            return GS_ERROR;
+        }
+        if (cursor->eof) {
+            break;
+        }
+
+        // the key may be set again without ttl after the index entry was read
+        size = CURSOR_COLUMN_SIZE(cursor, layout->col_id);
+        if (size == GS_NULL_VALUE_LEN || *(int64 *)CURSOR_COLUMN_DATA(cursor, layout->col_id) > now) {
+            continue;
+        }
+
+        if (knl_internal_delete(session, cursor) != GS_SUCCESS) {
+            knl_close_cursor(session, cursor);
+            CM_RESTORE_STACK(session->stack);
+            return GS_ERROR;
+        }
+        (*deleted)++;
+    }
+
+    knl_close_cursor(session, cursor);
+    CM_RESTORE_STACK(session->stack);
+    return GS_SUCCESS;
+}
+
+/*
+ * expire the keys of one table batch by batch, every batch commits on its own
+ * so the row locks are held shortly and the redo of one batch stays small.
+ */
+static status_t kv_expire_table(knl_session_t *session, thread_t *thread, kv_expire_table_t *item, int64 now,
+    uint32 *expired, bool32 *is_ttl)
+{
+    kv_expire_t *ctx = &session->kernel->kv_expire_ctx;
+    uint32 batch = session->kernel->attr.kv_expire_batch;
+    knl_dictionary_t dc;
+    kv_expire_layout_t layout;
+    uint32 deleted = batch;
+    int32 code;
+
+    *is_ttl = GS_FALSE;
+    if (knl_open_dc_by_id(session, item->uid, item->oid, &dc, GS_TRUE) != GS_SUCCESS) {
+        code = cm_get_error_code();
+        if (code == ERR_TABLE_ID_NOT_EXIST || code == ERR_TABLE_OR_VIEW_NOT_EXIST || code == ERR_OBJECT_ID_NOT_EXIST) {
+            // dropped, nothing left to expire
+            cm_reset_error();
+            return GS_SUCCESS;
+        }
+        *is_ttl = GS_TRUE;
+        return GS_ERROR;
+    }
+
+    if (!kv_expire_get_layout(&dc, &layout)) {
+        dc_close(&dc);
+        return GS_SUCCESS;
+    }
+    *is_ttl = GS_TRUE;
+
+    while (deleted == batch && !thread->closed) {
+        if (kv_expire_delete_batch(session, &dc, &layout, now, batch, &deleted) != GS_SUCCESS) {
+            knl_rollback(session, NULL);
+            dc_close(&dc);
+            return GS_ERROR;
+        }
+        knl_commit(session);
+        *expired += deleted;
+
+        cm_spin_lock(&ctx->lock, NULL);
+        ctx->expired_keys += deleted;
+        cm_spin_unlock(&ctx->lock);
+
+        if (deleted == batch) {
+            // leave room for the foreground sessions writing the same table
+            cm_sleep(KV_EXPIRE_BATCH_PAUSE);
+        }
+    }
+
+    dc_close(&dc);
+    return GS_SUCCESS;
+}
+
+static void kv_expire_check_tables(knl_session_t *session, thread_t *thread)
+{
+    kv_expire_t *ctx = &session->kernel->kv_expire_ctx;
+    kv_expire_table_t tables[KV_EXPIRE_MAX_TABLES];
+    uint32 table_count;
+    uint32 ttl_tables = 0;
+    uint32 expired = 0;
+    bool32 is_ttl = GS_FALSE;
+    int64 now = kv_expire_unix_now();
+
+    cm_spin_lock(&ctx->lock, NULL);
+    table_count = ctx->table_count;
+    for (uint32 i = 0; i < table_count; i++) {
+        tables[i] = ctx->tables[i];
+    }
+    cm_spin_unlock(&ctx->lock);
+
+    for (uint32 i = 0; i < table_count && !thread->closed; i++) {
+        if (kv_expire_table(session, thread, &tables[i], now, &expired, &is_ttl) != GS_SUCCESS) {
+            kv_expire_record_error(ctx, tables[i].uid, tables[i].oid);
+        }
+
+        if (is_ttl) {
+            ttl_tables++;
+        } else {
+            // dropped or lost its expire index
+            kv_expire_unregister(ctx, tables[i].uid, tables[i].oid);
+        }
+    }
+
+    cm_spin_lock(&ctx->lock, NULL);
+    ctx->rounds++;
+    ctx->checked_tables = ttl_tables;
+    ctx->last_round_keys = expired;
+    if (expired > 0) {
+        ctx->idle_rounds = 0;
+    } else if (ctx->idle_rounds < KV_EXPIRE_MAX_BACKOFF) {
+        ctx->idle_rounds++;
+    }
+    ctx->last_round_time = cm_now();
+    cm_spin_unlock(&ctx->lock);
+}
+
+/*
+ * kv expire thread, every KV_EXPIRE_INTERVAL seconds it deletes the kv keys whose ttl
+ * has passed, KV_EXPIRE_BATCH keys per transaction. Readers already skip expired keys,
+ * the daemon only gives the space back. It stays idle while no table uses ttl and waits
+ * longer after every round which found nothing to expire.
+ */
+void kv_expire_proc(thread_t *thread)
+{
+    knl_session_t *session = (knl_session_t *)thread->argument;
+    knl_instance_t *kernel = session->kernel;
+    kv_expire_t *ctx = &kernel->kv_expire_ctx;
+    switch_ctrl_t *ctrl = &kernel->switch_ctrl;
+    uint64 elapsed = 0;
+
+    cm_set_thread_name("kv_expire");
+    GS_LOG_RUN_INF("kv expire thread started");
+    KNL_SESSION_SET_CURR_THREADID(session, cm_get_current_thread_id());
+
+    while (!thread->closed) {
+        cm_sleep(KV_EXPIRE_SLEEP_TIME);
+        elapsed += KV_EXPIRE_SLEEP_TIME;
+
+        if (kernel->db.status != DB_STATUS_OPEN || DB_IS_MAINTENANCE(session) || DB_IS_READONLY(session) ||
+            ctrl->request != SWITCH_REQ_NONE) {
+            session->status = SESSION_INACTIVE;
+            continue;
+        }
+
+        // rounds finding nothing to expire back off, a new ttl table resets the interval
+        if (kernel->attr.kv_expire_interval == 0 ||
+            elapsed < ((uint64)kernel->attr.kv_expire_interval * MILLISECS_PER_SECOND << ctx->idle_rounds)) {
+            continue;
+        }
+
+        if (!ctx->loaded) {
+            if (kv_expire_load_tables(session) != GS_SUCCESS) {
+                kv_expire_record_error(ctx, DB_SYS_USER_ID, SYS_TABLE_ID);
+                elapsed = 0;
+                continue;
+            }
+            ctx->loaded = GS_TRUE;
+        }
+
+        // the first table registered is checked at the next wakeup
+        if (ctx->table_count == 0) {
+            continue;
+        }
+
+        if (session->status == SESSION_INACTIVE) {
+            session->status = SESSION_ACTIVE;
+        }
+
+        ctx->working = GS_TRUE;
+        kv_expire_check_tables(session, thread);
+        ctx->working = GS_FALSE;
+        elapsed = 0;
+    }
+
+    GS_LOG_RUN_INF("kv expire thread closed");
+    KNL_SESSION_CLEAR_THREADID(session);
+}
+
+void kv_expire_close(knl_session_t *session)
+{
+    knl_instance_t *kernel = session->kernel;
+    kv_expire_t *ctx = &kernel->kv_expire_ctx;
+    cm_close_thread(&ctx->thread);
+}
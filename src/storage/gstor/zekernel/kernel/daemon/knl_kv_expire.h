@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2022 Huawei Technologies Co.,Ltd.
+ *
+ * openGauss is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ * http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ *
+ * knl_kv_expire.h
+ * kernel kv key expiration daemon
+ *
+ * IDENTIFICATION
+ * src/storage/gstor/zekernel/kernel/daemon/knl_kv_expire.h
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef __KNL_KV_EXPIRE_H__
+#define __KNL_KV_EXPIRE_H__
+
+#include "cm_defs.h"
+#include "cm_thread.h"
+#include "knl_session.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define KV_EXPIRE_MAX_TABLES   256    // max ttl tables checked per round
+#define KV_EXPIRE_MAX_BATCH    10000  // upper bound of KV_EXPIRE_BATCH
+#define KV_EXPIRE_BATCH_PAUSE  10     // ms, pause between two delete batches
+#define KV_EXPIRE_MAX_BACKOFF  6      // idle rounds stretch the interval up to 2^6 times
+
+typedef struct st_kv_expire_table {
+    uint32 uid;
+    uint32 oid;
+} kv_expire_table_t;
+
+typedef struct st_kv_expire {
+    thread_t thread;
+    spinlock_t lock;                 // protects the ttl tables and the status fields below
+    bool32 working;
+    bool32 loaded;                   // ttl tables of the last run are read from SYS_TABLES
+    uint32 table_count;
+    uint32 idle_rounds;              // rounds in a row without expired keys
+    kv_expire_table_t tables[KV_EXPIRE_MAX_TABLES];  // tables with an expire index, the only ones checked
+    uint64 rounds;                   // finished check rounds
+    uint64 expired_keys;             // keys deleted since startup
+    uint64 failed_batches;           // delete batches rolled back since startup
+    uint32 checked_tables;           // ttl tables checked by last round
+    uint32 last_round_keys;          // keys deleted by last round
+    date_t last_round_time;
+    int32 last_errcode;
+    char last_errmsg[GS_MESSAGE_BUFFER_SIZE];
+} kv_expire_t;
+
+void kv_expire_proc(thread_t *thread);
+void kv_expire_register(knl_session_t *session, uint32 uid, uint32 oid);
+void kv_expire_close(knl_session_t *session);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2022 Huawei Technologies Co.,Ltd.
+ *
+ * openGauss is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ * http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ *
+ * knl_retention.c
+ * kernel partition retention daemon
+ *
+ * IDENTIFICATION
+ * src/storage/gstor/zekernel/kernel/daemon/knl_retention.c
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#include "knl_retention.h"
+#include "knl_context.h"
+#include "knl_table.h"
+
+#define RETENTION_SLEEP_TIME 200  // ms
+
+typedef struct st_retention_table {
+    uint32 uid;
+    uint32 oid;
+} retention_table_t;
+
+static inline int64 retention_unix_now(void)
+{
+    struct timeval tv;
+
+    (void)cm_gettimeofday(&tv);
+    return (int64)tv.tv_sec * MICROSECS_PER_SECOND_LL + (int64)tv.tv_usec;
+}
+
+/*
+ * retention of timescale table is declared as 'Nd' or 'Nh',
+ * convert it to microseconds, 0 means nothing to do.
+ */
+static inline int64 retention_get_micros(table_t *table)
+{
+    interval_detail_t *retention = &table->desc.retention;
+
+    return ((int64)retention->day * SECONDS_PER_DAY + (int64)retention->hour * SECONDS_PER_HOUR) *
+        MICROSECS_PER_SECOND_LL;
+}
+
+/*
+ * the high bound of timescale partition is the unix timestamp(us) of the next interval,
+ * partition is expired only if all its rows are older than the cutoff time.
+ */
+static bool32 retention_part_expired(table_part_t *table_part, int64 cutoff)
+{
+    part_decode_key_t *decoder = NULL;
+
+    if (table_part->desc.groupcnt == 0 || table_part->desc.groups == NULL) {
+        return GS_FALSE;
+    }
+
+    decoder = &table_part->desc.groups[0];
+    if (decoder->count == 0 || decoder->lens[0] != PART_KEY_BITS_8_LEN) {
+        return GS_FALSE;  // MAXVALUE, DEFAULT or NULL bound never expires
+    }
+
+    return *(int64 *)(decoder->buf + decoder->offsets[0]) <= cutoff;
+}
+
+static void retention_record_error(retention_t *ctx, const char *user, const char *table, const char *part)
+{
+    int32 code = 0;
+    const char *message = NULL;
+
+    cm_get_error(&code, &message, NULL);
+    GS_LOG_RUN_WAR("[RETENTION] failed to drop partition %s of table %s.%s, code %d, %s",
+        part, user, table, code, message == NULL ? "" : message);
+
+    cm_spin_lock(&ctx->lock, NULL);
+    ctx->failed_drops++;
+    ctx->last_errcode = code;
+    if (message != NULL) {
+        (void)strncpy_s(ctx->last_errmsg, GS_MESSAGE_BUFFER_SIZE, message,
+            MIN(strlen(message), GS_MESSAGE_BUFFER_SIZE - 1));
+    }
+    cm_spin_unlock(&ctx->lock);
+    cm_reset_error();
+}
+
+static void retention_record_drop(retention_t *ctx, const char *table, const char *part)
+{
+    cm_spin_lock(&ctx->lock, NULL);
+    ctx->dropped_parts++;
+    ctx->last_drop_time = cm_now();
+    (void)strncpy_s(ctx->last_drop_table, GS_NAME_BUFFER_SIZE, table, strlen(table));
+    (void)strncpy_s(ctx->last_drop_part, GS_TS_PART_NAME_BUFFER_SIZE, part, strlen(part));
+    cm_spin_unlock(&ctx->lock);
+}
+
+/*
+ * collect timescale tables with retention from SYS_TABLES in (user#, id) order, starting at the
+ * position the previous round stopped at. is_end tells whether the scan reached the last table.
+ * the result is used after the cursor is released because dropping partition commits.
+ */
+static status_t retention_collect_tables(knl_session_t *session, retention_t *ctx, retention_table_t *tables,
+    uint32 *count, bool32 *is_end)
+{
+    knl_cursor_t *cursor = NULL;
+    uint32 size;
+
+    *count = 0;
+    CM_SAVE_STACK(session->stack);
+
+    knl_set_session_scn(session, GS_INVALID_ID64);
+    cursor = knl_push_cursor(session);
+    knl_open_sys_cursor(session, cursor, CURSOR_ACTION_SELECT, SYS_TABLE_ID, IX_SYS_TABLE_002_ID);
+    knl_init_index_scan(cursor, GS_FALSE);
+    knl_set_scan_key(INDEX_DESC(cursor->index), &cursor->scan_range.l_key, GS_TYPE_INTEGER, &ctx->next_uid,
+        sizeof(uint32), IX_COL_SYS_TABLE_002_USER_ID);
+    knl_set_scan_key(INDEX_DESC(cursor->index), &cursor->scan_range.l_key, GS_TYPE_INTEGER, &ctx->next_oid,
+        sizeof(uint32), IX_COL_SYS_TABLE_002_ID);
+    knl_set_key_flag(&cursor->scan_range.r_key, SCAN_KEY_RIGHT_INFINITE, IX_COL_SYS_TABLE_002_USER_ID);
+    knl_set_key_flag(&cursor->scan_range.r_key, SCAN_KEY_RIGHT_INFINITE, IX_COL_SYS_TABLE_002_ID);
+
+    if (knl_fetch(session, cursor) != GS_SUCCESS) {
+        CM_RESTORE_STACK(session->stack);
+        return GS_ERROR;
+    }
+
+    while (!cursor->eof && *count < RETENTION_MAX_TABLES) {
+        size = CURSOR_COLUMN_SIZE(cursor, SYS_TABLE_COL_TIMESCALE);
+        if (size != GS_NULL_VALUE_LEN && *(uint32 *)CURSOR_COLUMN_DATA(cursor, SYS_TABLE_COL_TIMESCALE)) {
+            size = CURSOR_COLUMN_SIZE(cursor, SYS_TABLE_COL_RETENTION);
+            if (size != 0 && size != GS_NULL_VALUE_LEN) {
+                tables[*count].uid = *(uint32 *)CURSOR_COLUMN_DATA(cursor, SYS_TABLE_COL_USER_ID);
+                tables[*count].oid = *(uint32 *)CURSOR_COLUMN_DATA(cursor, SYS_TABLE_COL_ID);
+                (*count)++;
+            }
+        }
+
+        if (knl_fetch(session, cursor) != GS_SUCCESS) {
+            CM_RESTORE_STACK(session->stack);
+            return GS_ERROR;
+        }
+    }
+
+    *is_end = cursor->eof;
+    CM_RESTORE_STACK(session->stack);
+    return GS_SUCCESS;
+}
+
+/*
+ * find expired partitions of one table, at most max_drops partitions are returned,
+ * names are copied out so the dc can be closed before dropping.
+ */
+static status_t retention_find_expired(knl_session_t *session, retention_table_t *item, int64 now,
+    char *user, char *name, char *parts, uint32 max_drops, uint32 *count)
+{
+    knl_dictionary_t dc;
+    dc_user_t *dc_user = NULL;
+    table_t *table = NULL;
+    table_part_t *table_part = NULL;
+    int64 retention;
+    errno_t ret;
+
+    *count = 0;
+    if (knl_open_dc_by_id(session, item->uid, item->oid, &dc, GS_TRUE) != GS_SUCCESS) {
+        return GS_ERROR;
+    }
+
+    table = DC_TABLE(&dc);
+    retention = retention_get_micros(table);
+    if (!table->desc.is_timescale || !table->desc.has_retention || !IS_PART_TABLE(table) || retention <= 0) {
+        dc_close(&dc);
+        return GS_SUCCESS;
+    }
+
+    if (dc_open_user_by_id(session, item->uid, &dc_user) != GS_SUCCESS) {
+        dc_close(&dc);
+        return GS_ERROR;
+    }
+
+    ret = strncpy_s(user, GS_NAME_BUFFER_SIZE, dc_user->desc.name, strlen(dc_user->desc.name));
+    knl_securec_check(ret);
+    ret = strncpy_s(name, GS_NAME_BUFFER_SIZE, table->desc.name, strlen(table->desc.name));
+    knl_securec_check(ret);
+
+    for (uint32 i = 0; i < table->part_table->desc.partcnt && *count < max_drops; i++) {
+        table_part = TABLE_GET_PART(table, i);
+        if (!IS_READY_PART(table_part) || !retention_part_expired(table_part, now - retention)) {
+            continue;
+        }
+
+        ret = strncpy_s(parts + (*count) * GS_TS_PART_NAME_BUFFER_SIZE, GS_TS_PART_NAME_BUFFER_SIZE,
+            table_part->desc.name, strlen(table_part->desc.name));
+        knl_securec_check(ret);
+        (*count)++;
+    }
+
+    dc_close(&dc);
+    return GS_SUCCESS;
+}
+
+/*
+ * drop partition only detaches the partition from dictionary and hands its segments
+ * to garbage segment recycling, no rows are deleted one by one.
+ */
+static status_t retention_drop_part(knl_session_t *session, char *user, char *name, char *part)
+{
+    knl_altable_def_t def;
+    errno_t ret;
+
+    ret = memset_sp(&def, sizeof(knl_altable_def_t), 0, sizeof(knl_altable_def_t));
+    knl_securec_check(ret);
+    def.action = ALTABLE_DROP_PARTITION;
+    def.options = DROP_IF_EXISTS;
+    cm_str2text(user, &def.user);
+    cm_str2text(name, &def.name);
+    cm_str2text(part, &def.part_def.name);
+
+    return knl_alter_table(session, NULL, &def);
+}
+
+static void retention_check_tables(knl_session_t *session, thread_t *thread)
+{
+    retention_t *ctx = &session->kernel->retention_ctx;
+    uint32 max_drops = session->kernel->attr.part_retention_max_drops;
+    retention_table_t tables[RETENTION_MAX_TABLES];
+    char user[GS_NAME_BUFFER_SIZE];
+    char name[GS_NAME_BUFFER_SIZE];
+    char *parts = NULL;
+    uint32 table_count = 0;
+    uint32 part_count = 0;
+    uint32 expired = 0;
+    uint32 visited = 0;
+    bool32 is_end = GS_FALSE;
+    int64 now = retention_unix_now();
+
+    if (retention_collect_tables(session, ctx, tables, &table_count, &is_end) != GS_SUCCESS) {
+        retention_record_error(ctx, "", "SYS_TABLES", "");
+        return;
+    }
+
+    CM_SAVE_STACK(session->stack);
+    parts = (char *)cm_push(session->stack, max_drops * GS_TS_PART_NAME_BUFFER_SIZE);
+    if (parts == NULL) {
+        CM_RESTORE_STACK(session->stack);
+        GS_LOG_RUN_WAR("[RETENTION] no stack memory for %u partitions", max_drops);
+        return;
+    }
+
+    for (uint32 i = 0; i < table_count && expired < max_drops && !thread->closed; i++) {
+        visited = i + 1;
+        if (retention_find_expired(session, &tables[i], now, user, name, parts, max_drops - expired,
+            &part_count) != GS_SUCCESS) {
+            cm_reset_error();
+            continue;
+        }
+
+        for (uint32 j = 0; j < part_count && !thread->closed; j++) {
+            char *part = parts + j * GS_TS_PART_NAME_BUFFER_SIZE;
+            if (retention_drop_part(session, user, name, part) != GS_SUCCESS) {
+                retention_record_error(ctx, user, name, part);
+            } else {
+                GS_LOG_RUN_INF("[RETENTION] dropped expired partition %s of table %s.%s", part, user, name);
+                retention_record_drop(ctx, name, part);
+            }
+            expired++;
+            // spread the drops out, each of them takes ddl latch and writes redo
+            cm_sleep(RETENTION_DROP_PAUSE);
+        }
+    }
+
+    CM_RESTORE_STACK(session->stack);
+
+    /*
+     * the next round goes on after the last table visited, or at it again if the drop budget ran out
+     * on it, and starts over from the first table once the scan reached the end of SYS_TABLES
+     */
+    if (visited == table_count && expired < max_drops) {
+        if (is_end) {
+            ctx->next_uid = 0;
+            ctx->next_oid = 0;
+        } else {
+            ctx->next_uid = tables[table_count - 1].uid;
+            ctx->next_oid = tables[table_count - 1].oid + 1;
+        }
+    } else if (visited > 0) {
+        ctx->next_uid = tables[visited - 1].uid;
+        ctx->next_oid = tables[visited - 1].oid;
+    }
+
+    cm_spin_lock(&ctx->lock, NULL);
+    ctx->rounds++;
+    ctx->checked_tables = table_count;
+    ctx->expired_parts = expired;
+    ctx->last_round_time = cm_now();
+    cm_spin_unlock(&ctx->lock);
+}
+
+/*
+ * partition retention thread, every PART_RETENTION_INTERVAL seconds it drops
+ * the partitions of timescale tables whose data are all beyond the table retention.
+ * At most PART_RETENTION_MAX_DROPS partitions are dropped in one round.
+ */
+void retention_proc(thread_t *thread)
+{
+    knl_session_t *session = (knl_session_t *)thread->argument;
+    knl_instance_t *kernel = session->kernel;
+    retention_t *ctx = &kernel->retention_ctx;
+    switch_ctrl_t *ctrl = &kernel->switch_ctrl;
+    uint64 elapsed = 0;
+
+    cm_set_thread_name("retention");
+    GS_LOG_RUN_INF("retention thread started");
+    KNL_SESSION_SET_CURR_THREADID(session, cm_get_current_thread_id());
+
+    while (!thread->closed) {
+        cm_sleep(RETENTION_SLEEP_TIME);
+        elapsed += RETENTION_SLEEP_TIME;
+
+        if (kernel->db.status != DB_STATUS_OPEN || DB_IS_MAINTENANCE(session) || DB_IS_READONLY(session) ||
+            ctrl->request != SWITCH_REQ_NONE) {
+            session->status = SESSION_INACTIVE;
+            continue;
+        }
+
+        if (kernel->attr.part_retention_interval == 0 ||
+            elapsed < (uint64)kernel->attr.part_retention_interval * MILLISECS_PER_SECOND) {
+            continue;
+        }
+
+        if (session->status == SESSION_INACTIVE) {
+            session->status = SESSION_ACTIVE;
+        }
+
+        ctx->working = GS_TRUE;
+        retention_check_tables(session, thread);
+        ctx->working = GS_FALSE;
+        elapsed = 0;
+    }
+
+    GS_LOG_RUN_INF("retention thread closed");
+    KNL_SESSION_CLEAR_THREADID(session);
+}
+
+void retention_close(knl_session_t *session)
+{
+    knl_instance_t *kernel = session->kernel;
+    retention_t *ctx = &kernel->retention_ctx;
+    cm_close_thread(&ctx->thread);
+}
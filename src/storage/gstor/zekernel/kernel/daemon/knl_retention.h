@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2022 Huawei Technologies Co.,Ltd.
+ *
+ * openGauss is licensed under Mulan PSL v2.
+ * You can use this software according to the terms and conditions of the Mulan PSL v2.
+ * You may obtain a copy of Mulan PSL v2 at:
+ *
+ * http://license.coscl.org.cn/MulanPSL2
+ *
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PSL v2 for more details.
+ * -------------------------------------------------------------------------
+ *
+ * knl_retention.h
+ * kernel partition retention daemon
+ *
+ * IDENTIFICATION
+ * src/storage/gstor/zekernel/kernel/daemon/knl_retention.h
+ *
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef __KNL_RETENTION_H__
+#define __KNL_RETENTION_H__
+
+#include "cm_defs.h"
+#include "cm_thread.h"
+#include "knl_session.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RETENTION_MAX_TABLES   256   // max timescale tables checked per round
+#define RETENTION_MAX_DROPS    1024  // upper bound of PART_RETENTION_MAX_DROPS
+#define RETENTION_DROP_PAUSE   100   // ms, pause between two partition drops
+
+typedef struct st_retention {
+    thread_t thread;
+    spinlock_t lock;                 // protects the status fields below
+    bool32 working;
+    uint64 rounds;                   // finished check rounds
+    uint64 dropped_parts;            // partitions dropped since startup
+    uint64 failed_drops;             // partitions failed to drop since startup
+    uint32 checked_tables;           // timescale tables checked by last round
+    uint32 expired_parts;            // expired partitions found by last round
+    date_t last_round_time;
+    date_t last_drop_time;
+    char last_drop_table[GS_NAME_BUFFER_SIZE];
+    char last_drop_part[GS_TS_PART_NAME_BUFFER_SIZE];
+    int32 last_errcode;
+    char last_errmsg[GS_MESSAGE_BUFFER_SIZE];
+    uint32 next_uid;                 // (user#, id) of SYS_TABLES the next round starts from,
+    uint32 next_oid;                 // so that tables past RETENTION_MAX_TABLES are visited as well
+} retention_t;
+
+void retention_proc(thread_t *thread);
+void retention_close(knl_session_t *session);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -243,6 +243,13 @@ typedef struct st_init_cursor {
     bool8 for_update_fetch; // for update flag
 } init_cursor_t;
 
+typedef struct st_knl_read_ahead {
+    page_id_t last;   // last page entered by the scan
+    uint32 seq_count; // pages entered in a row before last
+    uint32 window;    // pages loaded by the next read-ahead
+    uint32 end;       // first page after the loaded window, in the file of last
+} knl_read_ahead_t;
+
 typedef struct st_json_step_loc {
     uint32 pair_idx;
     uint32 pair_offset;
@@ -367,6 +374,7 @@ typedef struct st_knl_cursor {
     date_t cc_cache_time;        // the last reset scn time with current committed isolation
     uint32 tenant_id;            // record row tenant_id
     knl_cursor_operator_t fetch; // registered when open cursor
+    knl_read_ahead_t read_ahead; // sequential detection of table scan
     bool8 skip_lock;             // skip lock table when open cursor
     bool8 align[3];
     char buf[0];                 // row buffer and page buffer
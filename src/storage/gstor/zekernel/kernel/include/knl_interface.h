@@ -477,7 +477,8 @@ typedef status_t (*knl_set_vm_lob_to_knl_t)(void *stmt, knl_cursor_t *knl_cur, k
     variant_t *value, char *locator);
 
 typedef void(*knl_set_stmt_check_t)(void *stmt, knl_cursor_t *cursor, bool32 is_check);
-typedef status_t (*knl_alloc_session_t)(bool32 knl_reserved, knl_handle_t *knl_session);
+typedef status_t (*knl_alloc_session_t)(struct st_instance *cc_instance, bool32 knl_reserved,
+    knl_handle_t *knl_session);
 typedef void (*knl_release_session_t)(knl_handle_t sess);
 typedef status_t (*knl_update_depender_status_t)(knl_handle_t sess, obj_info_t *obj_addr);
 typedef void(*knl_accumate_io_t)(knl_handle_t sess, io_type_t type);
@@ -499,6 +500,7 @@ typedef void(*knl_pl_free_trig_entity_by_tab_t)(knl_handle_t knl_session, knl_di
 typedef void(*knl_pl_drop_triggers_entry_t)(knl_handle_t knl_session, knl_dictionary_t* dc);
 typedef void (*knl_mtrl_init_vmc_t)(knl_handle_t session, knl_handle_t *mtrl);
 typedef status_t(*knl_load_lnk_tab_dc_t)(knl_handle_t se, knl_lnk_dc_callback_t *callback_data);
+typedef void (*knl_trace_wait_t)(wait_event_t event, bool32 begin);
 
 typedef struct st_knl_callback {
     knl_set_vm_lob_to_knl_t set_vm_lob_to_knl;
@@ -567,6 +569,7 @@ typedef struct st_knl_callback {
     knl_pl_drop_synonym_by_user pl_drop_synonym_by_user;
     knl_mtrl_init_vmc_t init_vmc;
     knl_load_lnk_tab_dc_t load_lnk_tab_dc;
+    knl_trace_wait_t trace_wait;  // optional, told when a session wait begins and ends
 } knl_callback_t;
 
 extern knl_callback_t g_knl_callback;
@@ -44,8 +44,10 @@ typedef enum en_sys_session {
     SESSION_ID_IDX_RECYCLE = 8,
     SESSION_ID_SEG_RCYCLE = 9,
     SESSION_ID_RMON = 10,
+    SESSION_ID_RETENTION = 11,
+    SESSION_ID_KV_EXPIRE = 12,
     SESSION_ID_START = GS_SYS_SESSIONS,
-    SESSION_ID_AIO = 11,
+    SESSION_ID_AIO = 13,
 } sys_session_t;
 
 typedef enum en_wait_event {
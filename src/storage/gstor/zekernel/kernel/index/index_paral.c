@@ -161,7 +161,8 @@ status_t idxpart_alloc_resource(knl_session_t *session, uint32 paral_no, idxpart
 
     for (uint32 i = 0; i < paral_no; i++) {
         worker = &paral_ctx->workers[i];
-        if (g_knl_callback.alloc_knl_session(GS_FALSE, (knl_handle_t *)&worker->session) != GS_SUCCESS) {
+        if (g_knl_callback.alloc_knl_session(session->kernel->server, GS_FALSE,
+            (knl_handle_t *)&worker->session) != GS_SUCCESS) {
             GS_THROW_ERROR(ERR_EXCEED_SESSIONS_PER_USER, session->kernel->attr.max_sessions);
             return GS_ERROR;
         }
@@ -610,7 +611,8 @@ status_t idx_fetch_alloc_resource(knl_session_t *session, idx_paral_sort_ctx_t *
 
     for (uint32 i = 0; i < sort_ctx->paral_count; i++) {
         worker = &sort_ctx->workers[i];
-        if (g_knl_callback.alloc_knl_session(GS_FALSE, (knl_handle_t *)&worker->session) != GS_SUCCESS) {
+        if (g_knl_callback.alloc_knl_session(session->kernel->server, GS_FALSE,
+            (knl_handle_t *)&worker->session) != GS_SUCCESS) {
             GS_THROW_ERROR(ERR_EXCEED_SESSIONS_PER_USER, session->kernel->attr.max_sessions);
             return GS_ERROR;
         }
@@ -1014,7 +1016,8 @@ status_t idx_build_alloc_resource(knl_session_t *session, idx_paral_sort_ctx_t *
     for (uint32 i = 0; i < sort_ctx->build_count; i++) {
         worker = &sort_ctx->build_workers[i];
         worker->index_count = sort_ctx->index_count;
-        if (g_knl_callback.alloc_knl_session(GS_FALSE, (knl_handle_t *)&worker->session) != GS_SUCCESS) {
+        if (g_knl_callback.alloc_knl_session(session->kernel->server, GS_FALSE,
+            (knl_handle_t *)&worker->session) != GS_SUCCESS) {
             GS_THROW_ERROR(ERR_EXCEED_SESSIONS_PER_USER, session->kernel->attr.max_sessions);
             return GS_ERROR;
         }
@@ -1064,7 +1067,8 @@ status_t idx_construct_alloc_resource(knl_session_t *session, idx_paral_sort_ctx
         for (uint32 j = 0; j < sort_ctx->build_count; j++) {
             worker = &sort_ctx->workers[thread_id];
             worker->id = thread_id;
-            if (g_knl_callback.alloc_knl_session(GS_FALSE, (knl_handle_t *)&worker->session) != GS_SUCCESS) {
+            if (g_knl_callback.alloc_knl_session(session->kernel->server, GS_FALSE,
+                (knl_handle_t *)&worker->session) != GS_SUCCESS) {
                 GS_THROW_ERROR(ERR_EXCEED_SESSIONS_PER_USER, session->kernel->attr.max_sessions);
                 return GS_ERROR;
             }
@@ -1492,7 +1496,8 @@ status_t idx_init_worker_pool(knl_session_t *session, idx_paral_rebuild_ctx_t *c
 {
     for (uint32 i = 0; i < range_count; i++) {
         idx_paral_rebuild_worker_t *worker = ctx->workers + i;
-        if (g_knl_callback.alloc_knl_session(GS_FALSE, (knl_handle_t *)&worker->session) != GS_SUCCESS) {
+        if (g_knl_callback.alloc_knl_session(session->kernel->server, GS_FALSE,
+            (knl_handle_t *)&worker->session) != GS_SUCCESS) {
             GS_THROW_ERROR(ERR_EXCEED_SESSIONS_PER_USER, session->kernel->attr.max_sessions);
             return GS_ERROR;
         }
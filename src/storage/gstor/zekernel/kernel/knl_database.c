@@ -28,6 +28,7 @@
 #include "knl_db_create.h"
 #include "index_common.h"
 #include "knl_ctrl_restore.h"
+#include "knl_buffer_warmup.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -72,6 +73,8 @@ status_t db_init(knl_session_t *session)
     PRINT_SIZEOF(kernel->lob_ctx);
     PRINT_SIZEOF(kernel->smon_ctx);
     PRINT_SIZEOF(kernel->rmon_ctx);
+    PRINT_SIZEOF(kernel->retention_ctx);
+    PRINT_SIZEOF(kernel->kv_expire_ctx);
     PRINT_SIZEOF(kernel->job_ctx);
     PRINT_SIZEOF(kernel->synctimer_ctx);
     PRINT_SIZEOF(kernel->arch_ctx);
@@ -226,8 +229,8 @@ status_t db_load_logfiles(knl_session_t *session)
             return GS_ERROR;
         }
         /* logfile can be opened for a long time, closed in db_close_log_files */
-        if (cm_open_device(logfile->ctrl->name, logfile->ctrl->type, knl_redo_io_flag(session), &logfile->handle) !=
-            GS_SUCCESS) {
+        if (cm_open_device(logfile->ctrl->name, logfile->ctrl->type, knl_online_redo_io_flag(session),
+            &logfile->handle) != GS_SUCCESS) {
             GS_LOG_RUN_ERR("[DB] failed to open %s ", logfile->ctrl->name);
             return GS_ERROR;
         }
@@ -436,6 +439,7 @@ void db_close(knl_session_t *session, bool32 need_ckpt)
 #endif
     }
 
+    buf_warmup_close(session);
     rcy_close(session);
 #ifdef _REPLICATION
     gbp_agent_close(session);
@@ -448,6 +452,8 @@ void db_close(knl_session_t *session, bool32 need_ckpt)
     tx_rollback_close(session);
     smon_close(session);
     rmon_close(session);
+    retention_close(session);
+    kv_expire_close(session);
     ashrink_close(session);
 #ifdef _STATISTICS
     stats_close(session);
@@ -768,6 +774,16 @@ static status_t db_start_daemon(knl_session_t *session)
         return GS_ERROR;
     }
 
+    if (cm_create_thread(retention_proc, 0, kernel->sessions[SESSION_ID_RETENTION],
+        &kernel->retention_ctx.thread) != GS_SUCCESS) {
+        return GS_ERROR;
+    }
+
+    if (cm_create_thread(kv_expire_proc, 0, kernel->sessions[SESSION_ID_KV_EXPIRE],
+        &kernel->kv_expire_ctx.thread) != GS_SUCCESS) {
+        return GS_ERROR;
+    }
+
     if (ashrink_init(session) != GS_SUCCESS) {
         return GS_ERROR;
     }
@@ -1203,6 +1219,7 @@ status_t db_open(knl_session_t *session, db_open_opt_t *options)
 
     cm_spin_unlock(&kernel->lock);
     db->status = DB_STATUS_OPEN;
+    buf_warmup_start(session);
 
     if (DB_IS_PRIMARY(db) && db->ctrl.core.is_restored) {
         db_set_ctrl_restored(session, GS_FALSE);
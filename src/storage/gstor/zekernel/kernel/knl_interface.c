@@ -534,9 +534,18 @@ void knl_logic_log_put(knl_handle_t session, uint32 type, const void *data, uint
 
 static inline void knl_init_session_stat(knl_session_t *session)
 {
+    errno_t ret;
+
     session->stat.buffer_gets = 0;
+    ret = memset_sp(session->stat.buf_set_gets, sizeof(session->stat.buf_set_gets), 0,
+        sizeof(session->stat.buf_set_gets));
+    knl_securec_check(ret);
+    ret = memset_sp(session->stat.buf_set_misses, sizeof(session->stat.buf_set_misses), 0,
+        sizeof(session->stat.buf_set_misses));
+    knl_securec_check(ret);
     session->stat.disk_reads = 0;
     session->stat.disk_read_time = 0;
+    session->stat.read_ahead_pages = 0;
     session->stat.db_block_changes = 0;
     session->stat.con_wait_time = 0;
     session->stat.table_creates = 0;
@@ -741,6 +750,8 @@ void knl_destroy_session(knl_handle_t kernel, uint32 sid)
         return;
     }
 
+    cm_uring_destroy(&session->uring);
+    CM_FREE_PTR(session->read_ahead_buf);
 #ifdef LOG_DIAG
     for (uint32 i = 0; i < KNL_MAX_ATOMIC_PAGES; i++) {
         free(session->log_diag_page[i]);
@@ -1690,6 +1701,7 @@ status_t knl_open_cursor(knl_handle_t handle, knl_cursor_t *cursor, knl_dictiona
     cursor->cc_cache_time = KNL_NOW(session);
     cursor->eof = GS_FALSE;
     cursor->is_valid = GS_TRUE;
+    cursor->read_ahead.last = INVALID_PAGID;
     cursor->row = (row_head_t *)cursor->buf;
     cursor->chain_info = cursor->buf;
     if ( cursor->update_info.data == NULL ){
@@ -8813,6 +8825,10 @@ void knl_begin_session_wait(knl_handle_t se, wait_event_t event, bool32 immediat
     session->wait.begin_time = session->kernel->attr.timer->now;
     session->wait.immediate = immediate;
 
+    if (g_knl_callback.trace_wait != NULL) {
+        g_knl_callback.trace_wait(event, GS_TRUE);
+    }
+
     if (!immediate || !session->kernel->attr.enable_timed_stat) {
         return;
     }
@@ -8843,6 +8859,10 @@ void knl_end_session_wait(knl_handle_t se)
     session->stat.wait_count[session->wait.event]++;
 
     session->is_waiting = GS_FALSE;
+
+    if (g_knl_callback.trace_wait != NULL) {
+        g_knl_callback.trace_wait(session->wait.event, GS_FALSE);
+    }
 }
 
 status_t knl_begin_itl_waits(knl_handle_t se, uint32 *itl_waits)
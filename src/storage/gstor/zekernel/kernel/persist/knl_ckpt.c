@@ -26,6 +26,7 @@
 #include "cm_file.h"
 #include "knl_buflatch.h"
 #include "knl_ctrl_restore.h"
+#include "knl_buffer_warmup.h"
 #ifdef _ZSTD
 #include "zstd.h"
 #endif
@@ -79,6 +80,7 @@ static status_t dbwr_init(knl_session_t *session)
         dbwr->dbwr_trigger = GS_FALSE;
         dbwr->session = kernel->sessions[SESSION_ID_DBWR];
         dbwr->fsync_time = KNL_NOW(dbwr->session);
+        dbwr->uring = NULL;
         ret = memset_sp(&dbwr->datafiles, GS_MAX_DATA_FILES * sizeof(int32), 0xFF, GS_MAX_DATA_FILES * sizeof(int32));
         knl_securec_check(ret);
 #ifdef _WIN32
@@ -564,6 +566,7 @@ void ckpt_proc(thread_t *thread)
     while (!thread->closed) {
         ckpt_do_trigger_task(session, ctx, &clean_time, &ckpt_time);
         ckpt_do_timed_task(session, ctx, &clean_time, &ckpt_time);
+        buf_warmup_try_save(session);
 
         /* quickly go to the next schdule if there is trigger task */
         if (ctx->trigger_task != CKPT_MODE_IDLE) {
@@ -2027,6 +2030,119 @@ static status_t dbwr_flush_sync_io(knl_session_t *session, dbwr_context_t *dbwr)
     return dbwr_fdatasync(session, dbwr);
 }
 
+static cm_uring_t *dbwr_get_uring(knl_session_t *session, dbwr_context_t *dbwr)
+{
+    ckpt_context_t *ctx = &session->kernel->ckpt_ctx;
+    uint64 size = session->kernel->attr.dbwr_buf_size;
+
+    if (dbwr->uring == NULL && !session->uring_failed) {
+        dbwr->uring = knl_create_uring("dbwr", DBWR_URING_ENTRIES, &ctx->group.buf, &size, 1);
+        session->uring_failed = (dbwr->uring == NULL);
+    }
+    return dbwr->uring;
+}
+
+/* queues the pages of one datafile from *cursor on until the file changes or a page lies in a blocked range,
+ * the block latch is held until the whole run is on disk */
+static status_t dbwr_save_file_uring(knl_session_t *session, dbwr_context_t *dbwr, uint16 *cursor)
+{
+    ckpt_context_t *ctx = &session->kernel->ckpt_ctx;
+    uint32 buf_id = ctx->group.items[*cursor].buf_id;
+    page_head_t *page = (page_head_t *)(ctx->group.buf + ((uint64)buf_id) * DEFAULT_PAGE_SIZE);
+    uint32 file = AS_PAGID(page->id).file;
+    datafile_t *df = DATAFILE_GET(file);
+    int32 *handle = &dbwr->datafiles[file];
+    int64 offset = (int64)AS_PAGID(page->id).page * DEFAULT_PAGE_SIZE;
+    uint16 end = *cursor;
+    status_t status = GS_SUCCESS;
+
+    if (*handle == -1) {
+        if (spc_open_datafile(session, df, handle) != GS_SUCCESS) {
+            GS_LOG_RUN_ERR("[SPACE] failed to open datafile %s", df->ctrl->name);
+            return GS_ERROR;
+        }
+    }
+
+    for (;;) {
+        cm_latch_s(&df->block_latch, GS_INVALID_ID32, GS_FALSE, NULL);
+        if (!spc_datafile_is_blocked(df, (uint64)offset, (uint64)offset + DEFAULT_PAGE_SIZE)) {
+            break;
+        }
+        cm_unlatch(&df->block_latch, NULL);
+        cm_sleep(1);
+    }
+
+    for (; end <= dbwr->end; end++) {
+        buf_ctrl_t *ctrl = ctx->group.items[end].ctrl;
+        page = (page_head_t *)(ctx->group.buf + ((uint64)ctx->group.items[end].buf_id) * DEFAULT_PAGE_SIZE);
+        offset = (int64)AS_PAGID(page->id).page * DEFAULT_PAGE_SIZE;
+        if (end > *cursor && (AS_PAGID(page->id).file != file ||
+            spc_datafile_is_blocked(df, (uint64)offset, (uint64)offset + DEFAULT_PAGE_SIZE))) {
+            break;
+        }
+
+        knl_panic_log(ctrl != NULL, "ctrl is NULL, panic info: page %u-%u type %u", AS_PAGID(page->id).file,
+            AS_PAGID(page->id).page, page->type);
+        knl_panic_log(IS_SAME_PAGID(ctrl->page_id, AS_PAGID(page->id)),
+            "ctrl's page_id and page's id are not same, "
+            "panic info: ctrl_page %u-%u type %u, page %u-%u type %u",
+            ctrl->page_id.file, ctrl->page_id.page, ctrl->page->type, AS_PAGID(page->id).file, AS_PAGID(page->id).page,
+            page->type);
+        knl_panic_log(CHECK_PAGE_PCN(page), "page pcn is abnormal, panic info: page %u-%u type %u",
+            AS_PAGID(page->id).file, AS_PAGID(page->id).page, page->type);
+
+        if (page->type == PAGE_TYPE_PUNCH_PAGE) {
+            status = cm_file_punch_hole(*handle, (uint64)offset, DEFAULT_PAGE_SIZE);
+        } else {
+            status = cm_uring_prep_write(dbwr->uring, *handle, page, DEFAULT_PAGE_SIZE, offset, GS_FALSE);
+        }
+        if (status != GS_SUCCESS) {
+            break;
+        }
+    }
+
+    /*
+     * the writes already queued have to finish before the latch is released, even after a failure.
+     * a ring that broke has waited for the writes the kernel took before it failed
+     */
+    if (status == GS_SUCCESS) {
+        status = cm_uring_wait(dbwr->uring);
+    } else {
+        (void)cm_uring_wait(dbwr->uring);
+    }
+
+    if (status != GS_SUCCESS) {
+        cm_unlatch(&df->block_latch, NULL);
+        GS_LOG_RUN_ERR("[CKPT] failed to write datafile %s", df->ctrl->name);
+        spc_close_datafile(df, handle);
+        return GS_ERROR;
+    }
+    cm_unlatch(&df->block_latch, NULL);
+
+    for (uint16 i = *cursor; i < end; i++) {
+        ctx->group.items[i].ctrl->is_marked = 0;
+    }
+    dbwr->flags[file] = GS_TRUE;
+    *cursor = end;
+    return GS_SUCCESS;
+}
+
+/* the group is sorted by page id, so the pages of a datafile come in one run and go out as one batch */
+static status_t dbwr_flush_uring_io(knl_session_t *session, dbwr_context_t *dbwr)
+{
+    errno_t ret = memset_sp(dbwr->flags, sizeof(dbwr->flags), 0, sizeof(dbwr->flags));
+    knl_securec_check(ret);
+
+    uint16 cursor = dbwr->begin;
+    while (cursor <= dbwr->end) {
+        if (dbwr_save_file_uring(session, dbwr, &cursor) != GS_SUCCESS) {
+            return GS_ERROR;
+        }
+    }
+
+    return dbwr_fdatasync(session, dbwr);
+}
+
 static status_t dbwr_flush(knl_session_t *session, dbwr_context_t *dbwr)
 {
 #ifndef WIN32
@@ -2038,6 +2154,19 @@ static status_t dbwr_flush(knl_session_t *session, dbwr_context_t *dbwr)
     }
 #endif
 
+    /* compressed groups are rebuilt and punched page by page, they keep the synchronous path */
+    if (session->kernel->attr.enable_io_uring && !session->kernel->ckpt_ctx.has_compressed &&
+        dbwr_get_uring(session, dbwr) != NULL) {
+        if (dbwr_flush_uring_io(session, dbwr) == GS_SUCCESS) {
+            return GS_SUCCESS;
+        }
+        /* the pages written before the ring broke are written again below */
+        if (!knl_drop_broken_uring("dbwr", &dbwr->uring, &session->uring_failed)) {
+            return GS_ERROR;
+        }
+        cm_reset_error();
+    }
+
     if (dbwr_flush_sync_io(session, dbwr) != GS_SUCCESS) {
         return GS_ERROR;
     }
@@ -2111,6 +2240,7 @@ void dbwr_proc(thread_t *thread)
 
     dbwr_end(dbwr);
     dbwr_aio_destroy(session, dbwr);
+    cm_uring_destroy(&dbwr->uring);
     GS_LOG_RUN_INF("dbwr thread closed");
     KNL_SESSION_CLEAR_THREADID(session);
 }
@@ -48,6 +48,7 @@ extern "C" {
 #define CKPT_IS_TRIGGER(mode) \
     ((mode) == CKPT_TRIGGER_INC || (mode) == CKPT_TRIGGER_FULL || (mode) == CKPT_TRIGGER_CLEAN)
 #define CKPT_WAIT_MS 1
+#define DBWR_URING_ENTRIES 128
 
 typedef enum e_ckpt_mode {
     /* Both trigger_task and timed_task can be idle */
@@ -126,6 +127,7 @@ typedef struct st_dbwr_context {
     bool32 flags[GS_MAX_DATA_FILES];
     ckpt_asyncio_ctx_t async_ctx;
     uint32 io_cnt;
+    cm_uring_t *uring; // created on the first flush with IO_ENGINE = IO_URING
 
     // 2024-11-06
     date_t fsync_time;
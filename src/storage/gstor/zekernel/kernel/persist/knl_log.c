@@ -205,6 +205,9 @@ status_t log_init(knl_session_t *session)
 {
     errno_t ret = memset_sp(&session->kernel->redo_ctx, sizeof(log_context_t), 0, sizeof(log_context_t));
     knl_securec_check(ret);
+    if (cm_event_init(&session->kernel->redo_ctx.commit_event) != GS_SUCCESS) {
+        return GS_ERROR;
+    }
 
     log_buf_init(session);
 #ifdef _REPLICATION
@@ -226,6 +229,35 @@ status_t log_load(knl_session_t *session)
 void log_close(knl_session_t *session)
 {
     cm_close_thread(&session->kernel->redo_ctx.thread);
+    cm_uring_destroy(&session->kernel->redo_ctx.uring);
+    cm_event_destory(&session->kernel->redo_ctx.commit_event);
+}
+
+status_t log_write_device(knl_session_t *session, log_file_t *file, int64 offset, const void *buf, int32 size)
+{
+    if (cm_write_device(file->ctrl->type, file->handle, offset, buf, size) != GS_SUCCESS) {
+        return GS_ERROR;
+    }
+
+    if (LOG_WRITE_NEED_SYNC(session->kernel)) {
+        return cm_fdatasync_file(file->handle);
+    }
+    return GS_SUCCESS;
+}
+
+/* the ring is set up by the first flush, with the log write buffers registered as fixed buffers */
+static cm_uring_t *log_get_uring(knl_session_t *session, log_context_t *ctx)
+{
+    if (ctx->uring != NULL || ctx->uring_failed || !session->kernel->attr.enable_io_uring) {
+        return ctx->uring;
+    }
+
+    char *addrs[] = { ctx->logwr_buf, ctx->logwr_cipher_buf };
+    uint64 sizes[] = { ctx->logwr_buf_size, ctx->logwr_cipher_buf_size };
+    uint32 count = (ctx->logwr_cipher_buf != NULL && ctx->logwr_cipher_buf_size > 0) ? 2 : 1;
+    ctx->uring = knl_create_uring("log writer", LOG_URING_ENTRIES, addrs, sizes, count);
+    ctx->uring_failed = (ctx->uring == NULL);
+    return ctx->uring;
 }
 
 void log_flush_head(knl_session_t *session, log_file_t *file)
@@ -251,7 +283,7 @@ void log_flush_head(knl_session_t *session, log_file_t *file)
     *(log_file_head_t *)ctx->logwr_head_buf = file->head;
 
     size = CM_CALC_ALIGN(file->ctrl->block_size, sizeof(log_file_head_t));
-    if (cm_write_device(file->ctrl->type, file->handle, 0, ctx->logwr_head_buf, size) != GS_SUCCESS) {
+    if (log_write_device(session, file, 0, ctx->logwr_head_buf, size) != GS_SUCCESS) {
         GS_LOG_ALARM(WARN_FLUSHREDO, "'file-name':'%s'}", file->ctrl->name);
         CM_ABORT(0, "[LOG] ABORT INFO: flush redo file:%s, offset:%u, size:%lu failed.", file->ctrl->name, 0,
             sizeof(log_file_head_t));
@@ -343,7 +375,21 @@ status_t log_flush_to_disk(knl_session_t *session, log_context_t *ctx, log_batch
     batch->space_size = CM_CALC_ALIGN(batch->size, file->ctrl->block_size);
     log_calc_batch_checksum(session, batch);
 
-    if (cm_write_device(file->ctrl->type, file->handle, file->head.write_pos, batch, batch->space_size) != GS_SUCCESS) {
+    cm_uring_t *uring = log_get_uring(session, ctx);
+    status_t status = GS_ERROR;
+    if (uring != NULL) {
+        /* the linked fdatasync completes before the write is reported, one submission per batch */
+        status = cm_uring_write(uring, file->handle, batch, batch->space_size, (int64)file->head.write_pos,
+            LOG_WRITE_NEED_SYNC(session->kernel));
+        if (status != GS_SUCCESS && knl_drop_broken_uring("log writer", &ctx->uring, &ctx->uring_failed)) {
+            cm_reset_error();
+            uring = NULL;
+        }
+    }
+    if (uring == NULL) {
+        status = log_write_device(session, file, (int64)file->head.write_pos, batch, batch->space_size);
+    }
+    if (status != GS_SUCCESS) {
         GS_LOG_ALARM(WARN_FLUSHREDO, "'file-name':'%s'}", file->ctrl->name);
         GS_LOG_RUN_ERR("[LOG] failed to write %s", file->ctrl->name);
         cm_close_device(file->ctrl->type, &file->handle);
@@ -932,6 +978,68 @@ static inline void log_wake_up_waiter(knl_session_t *session, log_context_t *ctx
     }
 }
 
+// whether at least 'siblings' other transactions are active, they may commit soon
+static bool32 log_commit_has_siblings(knl_session_t *session, uint32 siblings)
+{
+    knl_instance_t *kernel = session->kernel;
+    uint32 count = 0;
+
+    for (uint32 i = 0; i < kernel->rm_count; i++) {
+        knl_rm_t *rm = kernel->rms[i];
+        if (rm == NULL || rm == session->rm || rm->txn == NULL) {
+            continue;
+        }
+        if (++count >= siblings) {
+            return GS_TRUE;
+        }
+    }
+    return GS_FALSE;
+}
+
+/*
+ * group commit: when followers are already queued and many transactions are active, the commit
+ * leader holds the commit lock and sleeps at most COMMIT_DELAY_US on commit_event, so that one
+ * redo flush covers all of them. the session that fills the batch to COMMIT_BATCH_SIZE wakes it.
+ */
+static void log_commit_delay(knl_session_t *session, log_context_t *ctx)
+{
+    knl_attr_t *attr = &session->kernel->attr;
+
+    // a lone committer does not pay for the scan of all rms
+    if (attr->commit_delay == 0 || ctx->tx_queue.count < 2 || ctx->tx_queue.count >= attr->commit_batch_size) {
+        return;
+    }
+
+    if (!log_commit_has_siblings(session, attr->commit_siblings)) {
+        return;
+    }
+
+    date_t begin = cm_monotonic_now();
+    date_t elapsed = 0;
+    ctx->commit_waiting = GS_TRUE;
+    CM_MFENCE;
+    while (ctx->tx_queue.count < attr->commit_batch_size && elapsed < (date_t)attr->commit_delay) {
+        (void)cm_event_timedwait_us(&ctx->commit_event, (uint32)((date_t)attr->commit_delay - elapsed));
+        elapsed = cm_monotonic_now() - begin;
+    }
+    ctx->commit_waiting = GS_FALSE;
+    ctx->stat.commit_delays++;
+    ctx->stat.commit_delay_elapsed += (uint64)elapsed;
+}
+
+static void log_stat_commit(log_context_t *ctx, uint64 usecs)
+{
+    static const uint64 bounds[LOG_COMMIT_LATENCY_BUCKETS - 1] = { 100, 500, 1000, 5000, 10000, 50000, 100000 };
+    uint32 bucket = 0;
+
+    while (bucket < LOG_COMMIT_LATENCY_BUCKETS - 1 && usecs > bounds[bucket]) {
+        bucket++;
+    }
+    (void)cm_atomic_inc((atomic_t *)&ctx->stat.commit_latency[bucket]);
+    (void)cm_atomic_inc((atomic_t *)&ctx->stat.commit_times);
+    (void)cm_atomic_add((atomic_t *)&ctx->stat.commit_elapsed, (int64)usecs);
+}
+
 static status_t log_commit_flush(knl_session_t *session)
 {
     log_context_t *ctx = &session->kernel->redo_ctx;
@@ -941,14 +1049,24 @@ static status_t log_commit_flush(knl_session_t *session)
         return GS_SUCCESS;
     }
 
+    bool32 need_flush = (!session->is_timescale || session->rm->prev != GS_INVALID_ID16);
+    if (need_flush) {
+        log_commit_delay(session, ctx);
+    }
+
     cm_spin_lock(&ctx->tx_queue.lock, &session->stat_commit_queue);
     knl_session_t *begin = ctx->tx_queue.first;
     knl_session_t *end = ctx->tx_queue.last;
+    uint32 batch_sessions = ctx->tx_queue.count;
     ctx->tx_queue.first = NULL;
+    ctx->tx_queue.count = 0;
     cm_spin_unlock(&ctx->tx_queue.lock);
 
+    ctx->stat.commit_batches++;
+    ctx->stat.commit_batch_sessions += batch_sessions;
+
     log_set_commit_progress(begin, end, LOG_WAITING);
-    if (!session->is_timescale || session->rm->prev != GS_INVALID_ID16)
+    if (need_flush)
     {
         GS_LOG_RUN_INF("session->is_timescale=%d, prev=%d,session->is_insert = %d \n",
                        session->is_timescale, session->rm->prev, session->is_insert);
@@ -994,7 +1112,17 @@ static void log_commit_enque(knl_session_t *session)
         ctx->tx_queue.last->log_next = session;
         ctx->tx_queue.last = session;
     }
+    uint32 count = ++ctx->tx_queue.count;
     cm_spin_unlock(&ctx->tx_queue.lock);
+
+    if (session->kernel->attr.commit_delay == 0) {
+        return;
+    }
+    // pairs with the fence in log_commit_delay, the leader sees the new count or gets notified
+    CM_MFENCE;
+    if (ctx->commit_waiting && count == session->kernel->attr.commit_batch_size) {
+        cm_event_notify(&ctx->commit_event);
+    }
 }
 
 void log_commit(knl_session_t *session)
@@ -1026,20 +1154,22 @@ void log_commit(knl_session_t *session)
         return;
     }
 #endif
+    date_t commit_begin = cm_monotonic_now();
     log_commit_enque(session);
     if (SECUREC_UNLIKELY(session->commit_batch)) {
         cm_sleep(GS_WAIT_FLUSH_TIME);
         if (session->log_progress == LOG_COMPLETED) {
+            log_stat_commit(&session->kernel->redo_ctx, (uint64)(cm_monotonic_now() - commit_begin));
             return;
         }
     }
 
-    
     knl_begin_session_wait(session, LOG_FILE_SYNC, GS_TRUE);
     if (log_commit_flush(session) != GS_SUCCESS) {
         CM_ABORT(0, "[LOG] ABORT INFO: commit flush redo log failed");
     }
     knl_end_session_wait(session);
+    log_stat_commit(&session->kernel->redo_ctx, (uint64)(cm_monotonic_now() - commit_begin));
 }
 
 // copy redo log from session private buffer to kernel public buffer
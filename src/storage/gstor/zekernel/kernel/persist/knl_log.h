@@ -28,7 +28,9 @@
 #include "cm_defs.h"
 #include "cm_text.h"
 #include "cm_thread.h"
+#include "cm_sync.h"
 #include "cm_device.h"
+#include "cm_uring.h"
 #include "knl_session.h"
 #include "knl_page.h"
 #include "knl_common.h"
@@ -132,6 +134,7 @@ typedef struct st_log_queue {
     spinlock_t lock;
     knl_session_t *first;
     knl_session_t *last;
+    volatile uint32 count;
 } log_queue_t;
 
 typedef struct st_log_group {
@@ -230,6 +233,14 @@ typedef struct st_log_dual_buffer {
     log_buffer_t members[GS_LOG_AREA_COUNT];
 } log_dual_buffer_t;
 
+#define LOG_COMMIT_MAX_DELAY       100000 // upper bound of COMMIT_DELAY_US
+#define LOG_COMMIT_MAX_SIBLINGS    1000   // upper bound of COMMIT_SIBLINGS
+#define LOG_COMMIT_LATENCY_BUCKETS 8      // <=100us, 500us, 1ms, 5ms, 10ms, 50ms, 100ms, inf
+#define LOG_URING_ENTRIES          8
+
+/* the online log handles skip O_SYNC with io_uring, writes through them are followed by an fdatasync */
+#define LOG_WRITE_NEED_SYNC(kernel) ((kernel)->attr.enable_io_uring && (kernel)->attr.synchronous_commit)
+
 typedef struct st_log_stat {
     struct timeval flush_begin;
     uint64 flush_times;
@@ -247,6 +258,15 @@ typedef struct st_log_stat {
     uint64 times_inf;
     uint64 space_requests;
     uint64 switch_count;
+
+    // group commit
+    uint64 commit_batches;         // redo flushes done by commit leaders
+    uint64 commit_batch_sessions;  // sessions committed by these flushes
+    uint64 commit_delays;          // flushes delayed to wait for more committers
+    uint64 commit_delay_elapsed;   // us
+    volatile uint64 commit_times;  // commits waited for redo flush
+    volatile uint64 commit_elapsed; // us
+    volatile uint64 commit_latency[LOG_COMMIT_LATENCY_BUCKETS];
 } log_stat_t;
 
 typedef struct st_replay_stat {
@@ -259,6 +279,9 @@ typedef struct st_replay_stat {
     uint64 analyze_resident_pages;
     uint64 analyze_new_pages;
     uint64 replay_elapsed; /* us */
+    uint64 replay_bytes;
+    uint32 replay_processes;
+    uint32 preload_processes;
 } replay_stat_t;
 
 /* log analyze item(page/lsn/lfn) */
@@ -303,6 +326,8 @@ typedef struct st_log_context {
     uint64 buf_lfn[GS_LOG_AREA_COUNT];
     log_dual_buffer_t bufs[GS_MAX_LOG_BUFFERS];
     log_queue_t tx_queue;
+    cm_event_t commit_event;         // wakes a delaying commit leader once the batch is full
+    volatile bool32 commit_waiting;  // a commit leader is waiting on commit_event
 
     char *logwr_head_buf;
     char *logwr_buf; // for log flush
@@ -311,6 +336,8 @@ typedef struct st_log_context {
     uint32 logwr_buf_size;
     uint32 logwr_cipher_buf_size;
     bool32 log_encrypt;
+    cm_uring_t *uring;    // writes the batches with IO_ENGINE io_uring, used under flush_lock
+    bool32 uring_failed;  // the ring could not be set up, batches are written synchronously
 
     log_point_t curr_point;
     log_point_t curr_analysis_point;
@@ -448,6 +475,7 @@ void log_add_freesize(knl_session_t *session, uint32 inx);
 void log_decrease_freesize(log_context_t *ctx, log_file_t *logfile);
 bool32 log_file_can_drop(log_context_t *ctx, uint32 file);
 void log_flush_head(knl_session_t *session, log_file_t *file);
+status_t log_write_device(knl_session_t *session, log_file_t *file, int64 offset, const void *buf, int32 size);
 uint32 log_get_id_by_asn(knl_session_t *session, uint32 rst_id, uint32 asn, bool32 *is_curr_file);
 status_t log_check_blocksize(knl_session_t *session);
 status_t log_check_minsize(knl_session_t *session);
@@ -189,7 +189,7 @@ status_t db_alter_add_logfile(knl_session_t *session, knl_alterdb_def_t *def)
         logfile->head.rst_id = 0;
         logfile->head.cmp_algorithm = COMPRESS_NONE;
 
-        if (cm_open_device(logfile->ctrl->name, logfile->ctrl->type, knl_redo_io_flag(session),
+        if (cm_open_device(logfile->ctrl->name, logfile->ctrl->type, knl_online_redo_io_flag(session),
                            &logfile->handle) != GS_SUCCESS) {
             GS_LOG_RUN_ERR("[DB] failed to open %s ", logfile->ctrl->name);
             return GS_ERROR;
@@ -377,7 +377,7 @@ void rd_alter_add_logfile(knl_session_t *session, log_entry_t *log)
     logfile->head.block_size = (int32)logfile->ctrl->block_size;
     logfile->head.rst_id = 0;
 
-    if (cm_open_device(logfile->ctrl->name, logfile->ctrl->type, knl_redo_io_flag(session),
+    if (cm_open_device(logfile->ctrl->name, logfile->ctrl->type, knl_online_redo_io_flag(session),
         &logfile->handle) != GS_SUCCESS) {
 #ifdef LOG_DIAG
         if (!session->log_diag) {
@@ -396,8 +396,7 @@ void rd_alter_add_logfile(knl_session_t *session, log_entry_t *log)
     knl_securec_check(err);
     *(log_file_head_t *)ctx->logwr_head_buf = logfile->head;
     size = CM_CALC_ALIGN(logfile->ctrl->block_size, sizeof(log_file_head_t));
-    if (cm_write_device(logfile->ctrl->type, logfile->handle, 0, ctx->logwr_head_buf,
-        size) != GS_SUCCESS) {
+    if (log_write_device(session, logfile, 0, ctx->logwr_head_buf, size) != GS_SUCCESS) {
 #ifdef LOG_DIAG
         if (!session->log_diag) {
 #else
@@ -1998,6 +1998,24 @@ bool32 db_terminate_lfn_reached(knl_session_t *session, uint64 curr_lfn)
     return ((curr_lfn == db->terminate_lfn) ? GS_TRUE : GS_FALSE);
 }
 
+static void rcy_report_replay_stat(knl_session_t *session, uint64 replay_bytes)
+{
+    rcy_context_t *rcy = &session->kernel->rcy_ctx;
+    replay_stat_t *stat = &session->kernel->redo_ctx.replay_stat;
+    uint64 elapsed = MAX(stat->replay_elapsed, 1);
+
+    stat->replay_bytes = replay_bytes;
+    stat->replay_processes = rcy->paral_rcy ? rcy->capacity : GS_DEFAULT_PARAL_RCY;
+    stat->preload_processes = rcy->paral_rcy ? rcy->preload_proc_num : 0;
+    rcy->wait_stats_view[READ_LOG_SIZE] = replay_bytes / SIZE_M(1);
+    rcy->wait_stats_view[REPALY_SPEED] = replay_bytes * MICROSECS_PER_SECOND / SIZE_M(1) / elapsed;
+
+    GS_LOG_RUN_INF("[RCY] replayed %llu bytes of redo in %llu ms, %llu KB/s, replay processes %u, "
+        "preload processes %u, preloaded pages %llu", replay_bytes, stat->replay_elapsed / MICROSECS_PER_MILLISEC,
+        replay_bytes * MICROSECS_PER_SECOND / SIZE_K(1) / elapsed, stat->replay_processes, stat->preload_processes,
+        rcy->wait_stats_view[PRELOAD_DISK_PAGES]);
+}
+
 status_t rcy_recover(knl_session_t *session)
 {
     log_point_t curr_point = session->kernel->db.ctrl.core.rcy_point;
@@ -2008,6 +2026,7 @@ status_t rcy_recover(knl_session_t *session)
     bool32 need_more_log = GS_FALSE;
     uint32 data_size = 0;
     uint32 block_size;
+    uint64 replay_bytes = 0;
 
     log_reset_point(session, &lrp_point);
     log_reset_analysis_point(session, &lrp_point);
@@ -2054,6 +2073,7 @@ status_t rcy_recover(knl_session_t *session)
         if (log_need_realloc_buf(batch, &rcy->read_buf, "rcy", GS_MAX_BATCH_SIZE)) {
             continue;
         }
+        replay_bytes += data_size;
         rcy->curr_group = rcy->group_list;
         rcy->curr_group_id = 0;
         if (rcy_replay(session, &curr_point, data_size, batch, block_size, &need_more_log, NULL, GS_FALSE) != GS_SUCCESS) {
@@ -2079,11 +2099,19 @@ status_t rcy_recover(knl_session_t *session)
     }
 
     cm_spin_unlock(&rcy->lock);
+
+    /* parallel replay is not over before the replay processes drain their buckets */
+    rcy_wait_replay_complete(session);
     (void)cm_gettimeofday(&log->replay_stat.replay_end);
     log->replay_stat.replay_elapsed = TIMEVAL_DIFF_US(&log->replay_stat.replay_begin, &log->replay_stat.replay_end);
+    rcy_report_replay_stat(session, replay_bytes);
 
-    rcy_wait_replay_complete(session);
     rcy_close_proc(session);
+    /* the parallel replay buffers take hundreds of MB, do not keep them after recovery */
+    if (rcy->paral_rcy) {
+        rcy->paral_rcy = GS_FALSE;
+        rcy_free_buffer(rcy);
+    }
     rcy->rcy_end = GS_TRUE;
     rcy_close_file(session);
 
@@ -2126,7 +2154,7 @@ status_t rcy_recover(knl_session_t *session)
 
 static status_t rcy_alloc_session(knl_instance_t *kernel, knl_session_t **session)
 {
-    if (g_knl_callback.alloc_knl_session(GS_TRUE, (knl_handle_t *)session) != GS_SUCCESS) {
+    if (g_knl_callback.alloc_knl_session(kernel->server, GS_TRUE, (knl_handle_t *)session) != GS_SUCCESS) {
         return GS_ERROR;
     }
     (*session)->curr_lsn = GS_INVALID_LSN;
@@ -2234,6 +2262,15 @@ void rcy_init_proc(knl_session_t *session)
         return;
     }
 
+    /* the buffers are released after crash recovery, the log replayer of standby needs them again */
+    if (rcy->buf == NULL && rcy_alloc_buffer(rcy) != GS_SUCCESS) {
+        GS_LOG_RUN_WAR("[RCY] failed to alloc parallel replay buffers, replay serially");
+        cm_reset_error();
+        rcy->paral_rcy = GS_FALSE;
+        rcy->preload_proc_num = 0;
+        return;
+    }
+
     rcy->replay_no_lag = GS_FALSE;
     rcy->swich_buf = GS_FALSE;
     bucket_count = GS_RCY_BUF_SIZE / sizeof(rcy_paral_group_t *);
@@ -2280,7 +2317,7 @@ void rcy_init_proc(knl_session_t *session)
 
     for (i = 0; i < rcy->preload_proc_num; i++) {
         rcy->preload_info[i].group_id = 0;
-        rcy->preload_info->curr = i;
+        rcy->preload_info[i].curr = i;
 
         if (rcy_alloc_session(kernel, &rcy->preload_info[i].session) != GS_SUCCESS) {
             GS_LOG_RUN_ERR("rcy preload proc as alloc session failed now=%u, capacity=%u", i, rcy->preload_proc_num);
@@ -751,9 +751,9 @@ static void gbp_try_pull_page_batch(knl_session_t *session, uint32 *last_result)
     *last_result = result;
 }
 
-status_t gbp_alloc_bg_session(uint8 queue_index, knl_session_t **session)
+status_t gbp_alloc_bg_session(knl_instance_t *kernel, uint8 queue_index, knl_session_t **session)
 {
-    if (g_knl_callback.alloc_knl_session(GS_TRUE, (knl_handle_t *)session) != GS_SUCCESS) {
+    if (g_knl_callback.alloc_knl_session(kernel->server, GS_TRUE, (knl_handle_t *)session) != GS_SUCCESS) {
         return GS_ERROR;
     }
     (*session)->gbp_queue_index = queue_index; // for gbp bg session, gbp_queue_index > 0
@@ -860,7 +860,7 @@ status_t gbp_agent_start_client(knl_session_t *session)
 
     /* start gbp background threads */
     for (id = 0; id < GS_GBP_SESSION_COUNT; id++) {
-        if (gbp_alloc_bg_session(id + 1, &gbp_bg_sessions[id]) != GS_SUCCESS) {
+        if (gbp_alloc_bg_session(session->kernel, id + 1, &gbp_bg_sessions[id]) != GS_SUCCESS) {
             GS_LOG_RUN_ERR("[GBP] failed to alloc gbp background session for index %u", id);
             return GS_ERROR;
         }
@@ -2163,7 +2163,7 @@ status_t gbp_aly_init(knl_session_t *session)
         aly_ctx->log_handle[i] = INVALID_FILE_HANDLE;
     }
 
-    if (gbp_alloc_bg_session(0, &aly_session) != GS_SUCCESS) {
+    if (gbp_alloc_bg_session(session->kernel, 0, &aly_session) != GS_SUCCESS) {
         return GS_ERROR;
     }
 
@@ -232,7 +232,7 @@ void gbp_knl_end_read(knl_session_t *session);
 
 void gbp_knl_check_end_point(knl_session_t *session);
 gbp_page_status_e knl_read_page_from_gbp(knl_session_t *session, buf_ctrl_t *buf_ctrl);
-status_t gbp_alloc_bg_session(uint8 queue_index, knl_session_t **session);
+status_t gbp_alloc_bg_session(knl_instance_t *kernel, uint8 queue_index, knl_session_t **session);
 void gbp_release_bg_session(knl_session_t *session);
 
 status_t gbp_aly_mem_init(knl_session_t *session);
@@ -6128,8 +6128,8 @@ static status_t heap_cache_scan_page(knl_session_t *session, knl_cursor_t *curso
             return GS_ERROR;
         }
     } else {
-        if (buf_read_prefetch_page(session, GET_ROWID_PAGE(cursor->rowid),
-            LATCH_MODE_S, ENTER_PAGE_NORMAL) != GS_SUCCESS) {
+        uint8 options = buf_read_ahead(session, &cursor->read_ahead, GET_ROWID_PAGE(cursor->rowid));
+        if (buf_read_prefetch_page(session, GET_ROWID_PAGE(cursor->rowid), LATCH_MODE_S, options) != GS_SUCCESS) {
             return GS_ERROR;
         }
     }
@@ -6203,8 +6203,8 @@ static status_t heap_fetch_by_page(knl_session_t *session, knl_cursor_t *cursor,
                 return heap_read_by_rowid(session, cursor, query_scn, cursor->isolevel, is_found);
             }
         } else {
-            if (buf_read_prefetch_page(session, GET_ROWID_PAGE(cursor->rowid),
-                                       LATCH_MODE_S, ENTER_PAGE_NORMAL) != GS_SUCCESS) {
+            uint8 options = buf_read_ahead(session, &cursor->read_ahead, GET_ROWID_PAGE(cursor->rowid));
+            if (buf_read_prefetch_page(session, GET_ROWID_PAGE(cursor->rowid), LATCH_MODE_S, options) != GS_SUCCESS) {
                 return GS_ERROR;
             }
             page = (heap_page_t *)CURR_PAGE;
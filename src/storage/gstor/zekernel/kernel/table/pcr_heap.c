@@ -967,6 +967,7 @@ status_t pcrh_prefetch_cr_page(knl_session_t *session, knl_cursor_t *cursor, knl
             pcrp_leave_page(session, GS_TRUE);
         }
 
+        (void)buf_read_ahead(session, &cursor->read_ahead, page_id);
         if (buf_read_prefetch_page(session, page_id, LATCH_MODE_S, ENTER_PAGE_SEQUENTIAL) != GS_SUCCESS) {
             return GS_ERROR;
         }
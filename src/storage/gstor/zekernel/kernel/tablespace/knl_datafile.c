@@ -51,7 +51,7 @@ void spc_close_datafile(datafile_t *df, int32 *handle)
     cm_close_device(df->ctrl->type, handle);
 }
 
-status_t spc_read_datafile(knl_session_t *session, datafile_t *df, int32 *handle, int64 offset, void *buf, uint32 size)
+static status_t spc_prepare_read_datafile(knl_session_t *session, datafile_t *df, int32 *handle)
 {
     char* suffix_name = strrchr(df->ctrl->name, '/');
     if (file_name_preproc(session, suffix_name + 1, df->ctrl->name) != GS_SUCCESS){
@@ -64,10 +64,31 @@ status_t spc_read_datafile(knl_session_t *session, datafile_t *df, int32 *handle
             return GS_ERROR;
         }
     }
+    return GS_SUCCESS;
+}
+
+status_t spc_read_datafile(knl_session_t *session, datafile_t *df, int32 *handle, int64 offset, void *buf, uint32 size)
+{
+    if (spc_prepare_read_datafile(session, df, handle) != GS_SUCCESS) {
+        return GS_ERROR;
+    }
 
     return cm_read_device(df->ctrl->type, *handle, offset, buf, size);
 }
 
+status_t spc_read_datafile_uring(knl_session_t *session, cm_uring_t *uring, datafile_t *df, int32 *handle,
+                                 int64 offset, void *buf, uint32 size)
+{
+    if (spc_prepare_read_datafile(session, df, handle) != GS_SUCCESS) {
+        return GS_ERROR;
+    }
+
+    if (df->ctrl->type != DEV_TYPE_FILE) {
+        return cm_read_device(df->ctrl->type, *handle, offset, buf, size);
+    }
+    return cm_uring_read(uring, *handle, buf, size, offset);
+}
+
 status_t spc_write_datafile(knl_session_t *session, datafile_t *df, int32 *handle, int64 offset, const void *buf,
                             int32 size)
 {
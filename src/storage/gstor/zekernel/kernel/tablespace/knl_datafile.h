@@ -234,6 +234,8 @@ status_t spc_open_datafile(knl_session_t *session, datafile_t *df, int32 *handle
 void spc_close_datafile(datafile_t *df, int32 *handle);
 void spc_invalidate_datafile(knl_session_t *session, datafile_t *df, bool32 ckpt_disable);
 status_t spc_read_datafile(knl_session_t *session, datafile_t *df, int32 *handle, int64 offset, void *buf, uint32 size);
+status_t spc_read_datafile_uring(knl_session_t *session, cm_uring_t *uring, datafile_t *df, int32 *handle,
+                                 int64 offset, void *buf, uint32 size);
 status_t spc_write_datafile(knl_session_t *session, datafile_t *df, int32 *handle, 
                             int64 offset, const void *buf, int32 size);
 status_t spc_extend_datafile(knl_session_t *session, datafile_t *df, int32 *handle, int64 size, bool32 need_redo);
@@ -99,7 +99,7 @@ ClassCmd::ClassCmd(const std::string &path, Connection *conn, KvOperator *kv_ope
     help_map.insert(std::make_pair(".index $TABLE", "Show names of indexes"));
     help_map.insert(std::make_pair(".schema $PATTERN", "Show the CREATE statements matching PATTERN"));
     help_map.insert(std::make_pair(".fullschema", "Show schema and the content of sqlite_stat tables"));
-    help_map.insert(std::make_pair(".keys", "show all keys"));
+    help_map.insert(std::make_pair(".keys", "show all keys, or the keys starting with the given prefix"));
 
     help_map.insert(std::make_pair(".mode", "Set output mode, support: " + GetModeType(",")));
     help_map.insert(std::make_pair(".explain on|off", "Turn command echo on or off"));
@@ -734,16 +734,7 @@ std::string ClassCmd::ShowIndex(const std::vector<std::string> &strList) {
 }
 
 std::string ClassCmd::SHowKeys(const std::vector<std::string> &strList) {
-    std::string result;
-    std::stringstream sql_query;
-    sql_query << "SELECT KEY FROM \"" << kv_operator->getKVTable() << "\";";
-    auto records = sql_conn->Query(sql_query.str().c_str())->GetRecords();
-    for (std::size_t i = 1; i < records.size(); i++) {
-        for (auto item : records[i]) {
-            result += item + "\n";
-        }
-    }
-    return result;
+    return kv_operator->kv_keys(strList.size() > 1 ? strList[1] : "");
 }
 
 const size_t SCHEMA_ARGS_NUM = 2;
@@ -30,9 +30,16 @@
 static std::string KV_USEAGE =
     "KV Usage: \n"
     "    set key value : set key's value \n"
+    "    setex key seconds value : set key's value, the key expires after seconds \n"
     "    get key : get key's value \n"
     "    del key : delete key \n"
-    "    kvtb tablename : change table, create if not exist \n"
+    "    mset key value [key value ...] : set several keys in one commit \n"
+    "    mget key [key ...] : get several keys' values \n"
+    "    mdel key [key ...] : delete several keys in one commit \n"
+    "    scan start|- end|- [limit] [rev] : list pairs in [start, end) in key order, - is unbounded \n"
+    "    pscan prefix [limit] [rev] : list pairs whose key starts with prefix \n"
+    "    kvtb tablename [hash|phash] : change table, create if not exist. hash is a volatile hash table, \n"
+    "        phash a hash table saved to disk when the database closes \n"
     "    multi : start a transaction \n"
     "    exec : commit current transaction \n"
     "    discard : discard current transaction \n"
@@ -42,8 +49,14 @@ static std::string KV_USEAGE =
 KvOperator::KvOperator(std::unique_ptr<KvConnection> kvconn) : kv_connection_(std::move(kvconn)), auto_commit(true)
 {
     kv_func_map.insert(std::make_pair<std::string, KvOperator::kv_func>("set", &KvOperator::kv_set));
+    kv_func_map.insert(std::make_pair<std::string, KvOperator::kv_func>("setex", &KvOperator::kv_setex));
     kv_func_map.insert(std::make_pair<std::string, KvOperator::kv_func>("get", &KvOperator::kv_get));
     kv_func_map.insert(std::make_pair<std::string, KvOperator::kv_func>("del", &KvOperator::kv_del));
+    kv_func_map.insert(std::make_pair<std::string, KvOperator::kv_func>("mset", &KvOperator::kv_mset));
+    kv_func_map.insert(std::make_pair<std::string, KvOperator::kv_func>("mget", &KvOperator::kv_mget));
+    kv_func_map.insert(std::make_pair<std::string, KvOperator::kv_func>("mdel", &KvOperator::kv_mdel));
+    kv_func_map.insert(std::make_pair<std::string, KvOperator::kv_func>("scan", &KvOperator::kv_scan));
+    kv_func_map.insert(std::make_pair<std::string, KvOperator::kv_func>("pscan", &KvOperator::kv_pscan));
     kv_func_map.insert(std::make_pair<std::string, KvOperator::kv_func>("kvtb", &KvOperator::kv_change_table));
     //事务 仿照redis命令
     kv_func_map.insert(std::make_pair<std::string, KvOperator::kv_func>("multi", &KvOperator::kv_begin));
@@ -82,6 +95,30 @@ std::string KvOperator::kv_set(const std::vector<std::string>& strList)
     return res.str();
 }
 
+std::string KvOperator::kv_setex(const std::vector<std::string>& strList)
+{
+    if (strList.size() != 4 || strList[2].empty() || strList[2].size() > 9 ||
+        strList[2].find_first_not_of("0123456789") != std::string::npos) {
+        return "cmd err usage: setex key seconds value;\n";
+    }
+
+    std::stringstream res;
+    auto reply = kv_connection_->SetEx(strList[1].c_str(), strList[1].size(), strList[3].c_str(), strList[3].size(),
+                                       (uint32_t)std::stoul(strList[2]));
+    if (reply->type == GS_SUCCESS) {
+        if (auto_commit) {
+            kv_commit({});
+            res << "Success";
+        } else {
+            res << "Success in this Transaction";
+        }
+    } else {
+        res << "kv setex failed key:" << strList[1] << " " << std::string(reply->str, reply->len);
+    }
+    res << std::endl;
+    return res.str();
+}
+
 std::string KvOperator::kv_get(const std::vector<std::string>& strList)
 {
     if(strList.size() != 2) {
@@ -125,14 +162,167 @@ std::string KvOperator::kv_del(const std::vector<std::string>& strList)
     return res.str();
 }
 
+std::string KvOperator::kv_mset(const std::vector<std::string>& strList)
+{
+    if(strList.size() < 3 || strList.size() % 2 != 1) {
+        return "cmd err usage: mset key value [key value ...];\n";
+    }
+
+    std::vector<const char*> keys, vals;
+    for (size_t i = 1; i < strList.size(); i += 2) {
+        keys.push_back(strList[i].c_str());
+        vals.push_back(strList[i + 1].c_str());
+    }
+
+    std::stringstream res;
+    auto reply = kv_connection_->MSet(keys.size(), keys.data(), vals.data());
+    if (reply->type == GS_SUCCESS) {
+        if (auto_commit) {
+            res << "Success";
+        } else {
+            res << "Success in this Transaction";
+        }
+    } else {
+        res << "kv mset failed: " << reply->str;
+    }
+    res << std::endl;
+    return res.str();
+}
+
+std::string KvOperator::kv_mget(const std::vector<std::string>& strList)
+{
+    if(strList.size() < 2) {
+        return "cmd err usage: mget key [key ...];\n";
+    }
+
+    std::vector<const char*> keys;
+    for (size_t i = 1; i < strList.size(); i++) {
+        keys.push_back(strList[i].c_str());
+    }
+
+    std::stringstream res;
+    auto reply = kv_connection_->MGet(keys.size(), keys.data());
+    if (reply->type == GS_SUCCESS) {
+        for (size_t i = 0; i < reply->elements; i++) {
+            if (reply->element[i].str != nullptr) {
+                res << reply->element[i].str;
+            } else {
+                res << "key: " << strList[i + 1] << " not exist";
+            }
+            res << std::endl;
+        }
+        return res.str();
+    }
+    res << "kv mget failed: " << reply->str << std::endl;
+    return res.str();
+}
+
+std::string KvOperator::kv_mdel(const std::vector<std::string>& strList)
+{
+    if(strList.size() < 2) {
+        return "cmd err usage: mdel key [key ...];\n";
+    }
+
+    std::vector<const char*> keys;
+    for (size_t i = 1; i < strList.size(); i++) {
+        keys.push_back(strList[i].c_str());
+    }
+
+    std::stringstream res;
+    auto reply = kv_connection_->MDel(keys.size(), keys.data());
+    if (reply->type == GS_SUCCESS) {
+        if (auto_commit) {
+            res << "Success";
+        } else {
+            res << "Success in this Transaction";
+        }
+    } else {
+        res << "kv mdel failed: " << reply->str;
+    }
+    res << std::endl;
+    return res.str();
+}
+
+std::string KvOperator::print_scan(std::unique_ptr<KvScanIterator> iter, bool with_value)
+{
+    std::stringstream res;
+    if (iter == nullptr) {
+        res << "kv scan failed: " << kv_connection_->GetRetMsg() << std::endl;
+        return res.str();
+    }
+
+    const char *key = nullptr, *val = nullptr;
+    size_t key_len = 0, val_len = 0;
+    bool eof = false;
+    while (iter->Next(&key, &key_len, &val, &val_len, &eof) == GS_SUCCESS && !eof) {
+        res << std::string(key, key_len);
+        if (with_value) {
+            res << " " << std::string(val, val_len);
+        }
+        res << std::endl;
+    }
+    if (!eof) {
+        res << "kv scan failed: " << iter->GetRetMsg() << std::endl;
+    }
+    return res.str();
+}
+
+static bool parse_scan_options(const std::vector<std::string>& strList, size_t pos, size_t& limit, bool& reverse)
+{
+    limit = 0;
+    reverse = false;
+    for (size_t i = pos; i < strList.size(); i++) {
+        if (strList[i] == "rev") {
+            reverse = true;
+        } else if (!strList[i].empty() && strList[i].find_first_not_of("0123456789") == std::string::npos) {
+            limit = std::stoull(strList[i]);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string KvOperator::kv_scan(const std::vector<std::string>& strList)
+{
+    size_t limit;
+    bool reverse;
+    if (strList.size() < 3 || strList.size() > 5 || !parse_scan_options(strList, 3, limit, reverse)) {
+        return "cmd err usage: scan start|- end|- [limit] [rev];\n";
+    }
+
+    const char *start = strList[1] == "-" ? nullptr : strList[1].c_str();
+    const char *end = strList[2] == "-" ? nullptr : strList[2].c_str();
+    return print_scan(kv_connection_->Scan(start, end, limit, reverse), true);
+}
+
+std::string KvOperator::kv_pscan(const std::vector<std::string>& strList)
+{
+    size_t limit;
+    bool reverse;
+    if (strList.size() < 2 || strList.size() > 4 || !parse_scan_options(strList, 2, limit, reverse)) {
+        return "cmd err usage: pscan prefix [limit] [rev];\n";
+    }
+
+    return print_scan(kv_connection_->ScanPrefix(strList[1].c_str(), limit, reverse), true);
+}
+
+std::string KvOperator::kv_keys(const std::string& prefix)
+{
+    return print_scan(kv_connection_->ScanPrefix(prefix.c_str(), 0, false), false);
+}
+
 std::string KvOperator::kv_change_table(const std::vector<std::string>& strList)
 {
-    if(strList.size() != 2) {
-        return "cmd err usage: kvtb tablename;\n";
+    if ((strList.size() != 2 && strList.size() != 3) ||
+        (strList.size() == 3 && strList[2] != "hash" && strList[2] != "phash")) {
+        return "cmd err usage: kvtb tablename [hash|phash];\n";
     }
-    
+
     std::stringstream res;
-    if (kv_connection_->OpenTable(strList[1].c_str()) != GS_SUCCESS) {
+    int ret = strList.size() == 2 ? kv_connection_->OpenTable(strList[1].c_str())
+                                  : kv_connection_->OpenHashTable(strList[1].c_str(), strList[2] == "phash");
+    if (ret != GS_SUCCESS) {
         res << "kv change table: "<< strList[1] << " fail";
     } else {
         res << "kv change table: "<< strList[1] << " success";
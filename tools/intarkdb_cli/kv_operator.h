@@ -38,8 +38,15 @@ public:
     typedef std::string(KvOperator::*kv_func)(const std::vector<std::string>& strList);
     //kv_func();
     std::string kv_set(const std::vector<std::string>& strList);
+    std::string kv_setex(const std::vector<std::string>& strList);
     std::string kv_get(const std::vector<std::string>& strList);
     std::string kv_del(const std::vector<std::string>& strList);
+    std::string kv_mset(const std::vector<std::string>& strList);
+    std::string kv_mget(const std::vector<std::string>& strList);
+    std::string kv_mdel(const std::vector<std::string>& strList);
+    std::string kv_scan(const std::vector<std::string>& strList);
+    std::string kv_pscan(const std::vector<std::string>& strList);
+    std::string kv_keys(const std::string& prefix);
     std::string kv_change_table(const std::vector<std::string>& strList); //change table, create if not exist
 
     std::string kv_begin(const std::vector<std::string>& strList);
@@ -54,6 +61,8 @@ public:
 
 
 private:
+    std::string print_scan(std::unique_ptr<KvScanIterator> iter, bool with_value);
+
     std::unique_ptr<KvConnection> kv_connection_;
     bool auto_commit;
     std::string kv_table{"SYS_KV"};
@@ -97,6 +97,43 @@ static int srv_find_arg(int argc, char * const argv[], const char *find_arg)
     return 0;
 }
 
+/* optional unix socket path, a missing key leaves the listener disabled */
+static bool read_local_path(const cJSON *j_config, const char *key, char *path)
+{
+    char value[CONFIG_SIZE] = {0};
+    path[0] = '\0';
+    if (json_get_string(j_config, key, value) != GS_SUCCESS) {
+        return GS_TRUE;
+    }
+    if (strlen(value) >= GS_UNIX_PATH_MAX) {
+        printf("server config %s too long \n", key);
+        return GS_FALSE;
+    }
+    strcpy(path, value);
+    return GS_TRUE;
+}
+
+/* optional prometheus endpoint, disabled unless metrics_port is set */
+static bool read_metrics_config(const cJSON *j_config, server_config* cfg)
+{
+    char host[CONFIG_SIZE] = {0};
+    double metrics_port = 0;
+    (void)json_get_number(j_config, "metrics_port", &metrics_port);
+    if (metrics_port < 0 || metrics_port > GS_MAX_UINT16) {
+        printf("server config metrics_port out of range \n");
+        return GS_FALSE;
+    }
+    cfg->metrics_port = (unsigned short)metrics_port;
+    if (json_get_string(j_config, "metrics_host", host) == GS_SUCCESS) {
+        if (strlen(host) >= MAX_IP_LEN) {
+            printf("server config metrics_host too long \n");
+            return GS_FALSE;
+        }
+        strcpy(cfg->metrics_host, host);
+    }
+    return GS_TRUE;
+}
+
 bool read_server_config(int argc, char * const argv[], server_config* cfg) {
     char config_path[GS_FILE_NAME_BUFFER_SIZE] = {0};
     int pos = srv_find_arg(argc, argv, "-C");
@@ -147,6 +184,11 @@ bool read_server_config(int argc, char * const argv[], server_config* cfg) {
         strcpy(cfg->host[host_i], cJSON_GetStringValue(cJSON_GetArrayItem(host_array, host_i)));
     }
     
+    if (!read_local_path(j_config, "uds_path", cfg->uds_path) ||
+        !read_local_path(j_config, "shm_path", cfg->shm_path) || !read_metrics_config(j_config, cfg)) {
+        return GS_FALSE;
+    }
+
     int db_i = 0;
     json_get_array(j_config, "dbs", &dbs, &size);
     if (size > MAX_DB_NUM) {
@@ -247,6 +289,10 @@ int main(int argc, char *argv[])
     for (int i = 1; i < GS_MAX_LSNR_HOST_COUNT; i++) {
         strcpy(cfg.host[i], "\0");
     }
+    cfg.uds_path[0] = '\0';
+    cfg.shm_path[0] = '\0';
+    strcpy(cfg.metrics_host, "127.0.0.1");
+    cfg.metrics_port = 0;
     
     if (read_server_config(argc, argv, &cfg) != GS_TRUE) {
         return GS_ERROR;